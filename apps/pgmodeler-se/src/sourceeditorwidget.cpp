@@ -100,7 +100,7 @@ void SourceEditorWidget::loadSyntaxConfig(const QString &filename)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
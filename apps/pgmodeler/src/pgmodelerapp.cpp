@@ -52,7 +52,7 @@ PgModelerApp::PgModelerApp(int &argc, char **argv) : Application(argc,argv)
 		{
 			Messagebox msg;
 			msg.show(Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(GlobalAttributes::getTemporaryPath()),
-												 ErrorCode::FileDirectoryNotWritten, __PRETTY_FUNCTION__,__FILE__,__LINE__));
+												 ErrorCode::FileDirectoryNotWritten, __exc_origin));
 		}
 	}
 
@@ -29,6 +29,9 @@ unsigned BaseObjectView::global_sel_order {1};
 bool BaseObjectView::use_placeholder {true};
 bool BaseObjectView::compact_view {false};
 bool BaseObjectView::hide_shadow {false};
+bool BaseObjectView::lod_enabled {true};
+double BaseObjectView::detail_thresholds[2] { 0.20, 0.40 };
+BaseObjectView::DetailLevel BaseObjectView::max_detail_level { BaseObjectView::FullDetail };
 
 std::map<QString, QTextCharFormat> BaseObjectView::font_config;
 std::map<QString, std::vector<QColor>> BaseObjectView::color_config;
@@ -349,6 +352,57 @@ bool BaseObjectView::isShadowHidden()
 	return hide_shadow;
 }
 
+void BaseObjectView::setLevelOfDetailEnabled(bool value)
+{
+	lod_enabled = value;
+}
+
+bool BaseObjectView::isLevelOfDetailEnabled()
+{
+	return lod_enabled;
+}
+
+void BaseObjectView::setDetailLevelThreshold(DetailLevel level, double scale)
+{
+	if(level == MinimumDetail || level > FullDetail)
+		return;
+
+	detail_thresholds[level - 1] = scale < 0 ? 0 : scale;
+}
+
+double BaseObjectView::getDetailLevelThreshold(DetailLevel level)
+{
+	if(level == MinimumDetail || level > FullDetail)
+		return 0;
+
+	return detail_thresholds[level - 1];
+}
+
+void BaseObjectView::setMaximumDetailLevel(DetailLevel level)
+{
+	max_detail_level = level > FullDetail ? FullDetail : level;
+}
+
+BaseObjectView::DetailLevel BaseObjectView::getMaximumDetailLevel()
+{
+	return max_detail_level;
+}
+
+BaseObjectView::DetailLevel BaseObjectView::getDetailLevel(double scale)
+{
+	DetailLevel level = MinimumDetail;
+
+	if(!lod_enabled)
+		return FullDetail;
+
+	if(scale >= detail_thresholds[FullDetail - 1])
+		level = FullDetail;
+	else if(scale >= detail_thresholds[MediumDetail - 1])
+		level = MediumDetail;
+
+	return std::min(level, max_detail_level);
+}
+
 QVariant BaseObjectView::itemChange(GraphicsItemChange change, const QVariant &value)
 {
 	if(change==ItemPositionHasChanged)
@@ -34,6 +34,17 @@
 class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 	Q_OBJECT
 
+	public:
+		/*! \brief Levels of detail used to render the objects depending on the current scale.
+		 * In MinimumDetail only the boxes of tables and the lines of relationships are drawn,
+		 * in MediumDetail the titles of tables and the relationships descriptors are drawn too and
+		 * in FullDetail all the elements of the objects are rendered */
+		enum DetailLevel: unsigned {
+			MinimumDetail,
+			MediumDetail,
+			FullDetail
+		};
+
 	protected:
 		//! \brief Fade in/out animations attributes
 		static constexpr char FinalOpacity[] = "final_opacity";
@@ -59,6 +70,16 @@ class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Indicate if the graphical element representing object's shadow must be hidden.
 		static bool hide_shadow;
 
+		//! \brief Indicates if the level of detail rendering is enabled (see getDetailLevel())
+		static bool lod_enabled;
+
+		/*! \brief Stores the minimum scale factors in which the medium and full detail
+		 * levels are used to render the objects (see DetailLevel) */
+		static double detail_thresholds[2];
+
+		//! \brief The highest detail level that getDetailLevel() can return when the level of detail is enabled
+		static DetailLevel max_detail_level;
+
 		/*! \brief Stores the selection order of the current object. This attribute is used to
 		 know when an item was selected before another in the scene because the implementation of
 		 the method QGraphicsScene :: selectedItem() the selected objects are returned without
@@ -187,6 +208,25 @@ class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 
 		static bool isShadowHidden();
 
+		static void setLevelOfDetailEnabled(bool value);
+
+		static bool isLevelOfDetailEnabled();
+
+		/*! \brief Defines the minimum scale factor in which the provided detail level is used.
+		 * The MinimumDetail level has no threshold since it's used in any scale below the MediumDetail's one */
+		static void setDetailLevelThreshold(DetailLevel level, double scale);
+
+		static double getDetailLevelThreshold(DetailLevel level);
+
+		/*! \brief Limits the detail level in which the objects are rendered no matter the scale used.
+		 * This is useful to render thumbnails/overviews of the scene in a cheaper way */
+		static void setMaximumDetailLevel(DetailLevel level);
+
+		static DetailLevel getMaximumDetailLevel();
+
+		//! \brief Returns the detail level to be used when rendering the objects in the provided scale factor
+		static DetailLevel getDetailLevel(double scale);
+
 		//! \brief Sets the  font style for the specified element id
 		static void setFontStyle(const QString &id, QTextCharFormat font_fmt);
 
@@ -19,6 +19,7 @@
 #include "basetableview.h"
 #include "schema.h"
 #include "utilsns.h"
+#include "detaileffect.h"
 
 bool BaseTableView::hide_ext_attribs {false};
 bool BaseTableView::hide_tags {false};
@@ -27,7 +28,7 @@ unsigned BaseTableView::attribs_per_page[2] { 10, 5};
 BaseTableView::BaseTableView(BaseTable *base_tab) : BaseObjectView(base_tab)
 {
 	if(!base_tab)
-		throw Exception(ErrorCode::AsgNotAllocattedObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject, __exc_origin);
 
 	pending_geom_update = false;
 	body=new RoundedRectItem;
@@ -68,6 +69,13 @@ BaseTableView::BaseTableView(BaseTable *base_tab) : BaseObjectView(base_tab)
 	this->addToGroup(ext_attribs_body);
 	this->addToGroup(attribs_toggler);
 
+	/* Columns, extended attributes, tags and the attributes toggler are only painted
+	 * in full detail level. In lower levels only the table's boxes are drawn */
+	columns->setGraphicsEffect(new DetailEffect(FullDetail));
+	ext_attribs->setGraphicsEffect(new DetailEffect(FullDetail));
+	tag_item->setGraphicsEffect(new DetailEffect(FullDetail));
+	attribs_toggler->setGraphicsEffect(new DetailEffect(FullDetail));
+
 	this->setAcceptHoverEvents(true);
 	sel_child_obj_view=nullptr;
 	configurePlaceholder();
@@ -213,7 +221,7 @@ void BaseTableView::mousePressEvent(QGraphicsSceneMouseEvent *event)
 void BaseTableView::setAttributesPerPage(BaseTable::TableSection section_id, unsigned value)
 {
 	if(section_id > BaseTable::ExtAttribsSection)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	if(value > 0)
 		attribs_per_page[section_id] = value;
@@ -222,7 +230,7 @@ void BaseTableView::setAttributesPerPage(BaseTable::TableSection section_id, uns
 unsigned BaseTableView::getAttributesPerPage(BaseTable::TableSection section_id)
 {
 	if(section_id > BaseTable::ExtAttribsSection)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	return attribs_per_page[section_id];
 }
@@ -300,7 +308,7 @@ void BaseTableView::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
 
 void BaseTableView::addConnectedRelationship(BaseRelationship *base_rel)
 {
-	BaseTable *tab = dynamic_cast<BaseTable *>(getUnderlyingObject());
+	BaseTable *tab = dynamic_cast<BaseTable *>(getUnderlyingObject()), *peer_tab = nullptr;
 
 	if(!base_rel ||
 		 (base_rel &&
@@ -308,42 +316,59 @@ void BaseTableView::addConnectedRelationship(BaseRelationship *base_rel)
 			base_rel->getTable(BaseRelationship::DstTable) != tab))
 		return;
 
+	peer_tab = base_rel->getTable(BaseRelationship::SrcTable) == tab ?
+							 base_rel->getTable(BaseRelationship::DstTable) : base_rel->getTable(BaseRelationship::SrcTable);
+
 	connected_rels.push_back(base_rel);
+	rel_peers[base_rel] = peer_tab;
+	peer_rels_count[peer_tab]++;
 }
 
 void BaseTableView::removeConnectedRelationship(BaseRelationship *base_rel)
 {
+	auto itr = rel_peers.find(base_rel);
+
 	connected_rels.erase(std::find(connected_rels.begin(), connected_rels.end(), base_rel));
+
+	if(itr != rel_peers.end())
+	{
+		if(--peer_rels_count[itr->second] == 0)
+			peer_rels_count.erase(itr->second);
+
+		rel_peers.erase(itr);
+	}
 }
 
 int BaseTableView::getConnectedRelationshipIndex(BaseRelationship *base_rel, bool only_self_rels)
 {
-	std::vector<BaseRelationship *>::iterator itr;
-	std::vector<BaseRelationship *> self_rels, *vet_rels = nullptr;
+	int idx = 0;
 
-	if(!only_self_rels)
-		vet_rels = &connected_rels;
-	else
+	for(auto &rel : connected_rels)
 	{
-		for(auto &rel : connected_rels)
-		{
-			if(rel->isSelfRelationship())
-				self_rels.push_back(rel);
-		}
+		if(only_self_rels && !rel->isSelfRelationship())
+			continue;
 
-		vet_rels = &self_rels;
-	}
+		if(rel == base_rel)
+			return idx;
 
-	itr = std::find(vet_rels->begin(), vet_rels->end(), base_rel);
-
-	if(itr != vet_rels->end())
-		return itr - vet_rels->begin();
+		idx++;
+	}
 
 	return -1;
 }
 
 unsigned BaseTableView::getConnectedRelsCount(BaseTable *src_tab, BaseTable *dst_tab)
 {
+	BaseTable *tab = dynamic_cast<BaseTable *>(getUnderlyingObject());
+
+	/* When the table is one of the ends of the relationships we just need to retrieve
+	 * the amount of relationships connected to the table at the other end */
+	if(src_tab == tab || dst_tab == tab)
+	{
+		auto itr = peer_rels_count.find(src_tab == tab ? dst_tab : src_tab);
+		return itr != peer_rels_count.end() ? itr->second : 0;
+	}
+
 	unsigned count = 0;
 
 	for(auto &rel : connected_rels)
@@ -48,6 +48,14 @@ class __libcanvas BaseTableView: public BaseObjectView {
 		/*! \brief Stores the references to the relationships connected to this table. */
 		std::vector<BaseRelationship *> connected_rels;
 
+		/*! \brief Stores the table at the other end of each connected relationship (for self relationships
+		 * it's the table itself). This is used to keep the peer_rels_count consistent on relationship removal */
+		std::map<BaseRelationship *, BaseTable *> rel_peers;
+
+		/*! \brief Stores the amount of connected relationships per table at the other end of them.
+		 * This avoids scanning all the connected relationships each time a relationship line is configured */
+		std::map<BaseTable *, unsigned> peer_rels_count;
+
 	protected:		
 		//! \brief Stores the selected child objects in order to retrieve them in ObjectScene/ModelWidget
 		QList<TableObjectView *> sel_child_objs;
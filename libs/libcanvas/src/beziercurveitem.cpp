@@ -18,6 +18,9 @@
 
 #include "beziercurveitem.h"
 #include "baserelationship.h"
+#include "baseobjectview.h"
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
 
 BezierCurveItem::BezierCurveItem(QGraphicsItem *parent) :  QGraphicsPathItem(parent)
 {
@@ -117,3 +120,16 @@ bool BezierCurveItem::collidesWithPath(const QPainterPath &path, Qt::ItemSelecti
 {
 	return stroke.intersects(path);
 }
+
+void BezierCurveItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+	if(straight_line || path().isEmpty() ||
+		 BaseObjectView::getDetailLevel(option->levelOfDetailFromTransform(painter->worldTransform())) != BaseObjectView::MinimumDetail)
+	{
+		QGraphicsPathItem::paint(painter, option, widget);
+		return;
+	}
+
+	painter->setPen(pen());
+	painter->drawLine(path().elementAt(0), path().currentPosition());
+}
@@ -70,6 +70,10 @@ class __libcanvas BezierCurveItem: public QGraphicsPathItem {
 
 		//! \brief Returns if the specified path collides with the curve (specifically, by the stroke)
 		virtual bool collidesWithPath(const QPainterPath &path, Qt::ItemSelectionMode) const;
+
+		/*! \brief Paints the curve. In minimum detail level (see BaseObjectView::getDetailLevel) the curve is
+		 * replaced by a straight line between its end points which is much cheaper to be rasterized */
+		virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget = nullptr);
 };
 
 #endif
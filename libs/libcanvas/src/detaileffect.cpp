@@ -0,0 +1,38 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "detaileffect.h"
+#include <QStyleOptionGraphicsItem>
+
+DetailEffect::DetailEffect(BaseObjectView::DetailLevel min_level, QObject *parent) : QGraphicsEffect(parent)
+{
+	this->min_level = min_level;
+}
+
+BaseObjectView::DetailLevel DetailEffect::getMinimumDetailLevel()
+{
+	return min_level;
+}
+
+void DetailEffect::draw(QPainter *painter)
+{
+	/* The item is drawn directly in the painter (no offscreen pixmap involved)
+	 * only if the current scale produces a detail level that includes it */
+	if(BaseObjectView::getDetailLevel(QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform())) >= min_level)
+		drawSource(painter);
+}
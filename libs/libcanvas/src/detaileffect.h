@@ -0,0 +1,52 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcanvas
+\class DetailEffect
+\brief Implements a graphics effect that skips the painting of the item (and its children) to which it is
+attached when the current scale of the painter is lower than the minimum detail level configured for the item.
+Since the level of detail is determined at painting time from the painter's transformation, the scene items
+don't need to be reconfigured when zooming in or out, and any rendering made in a bigger scale (printing, export, magnifier)
+gets the full detail of the objects.
+*/
+
+#ifndef DETAIL_EFFECT_H
+#define DETAIL_EFFECT_H
+
+#include "canvasglobal.h"
+#include "baseobjectview.h"
+#include <QGraphicsEffect>
+
+class __libcanvas DetailEffect: public QGraphicsEffect {
+	Q_OBJECT
+
+	private:
+		//! \brief The minimum detail level in which the item is painted
+		BaseObjectView::DetailLevel min_level;
+
+	protected:
+		void draw(QPainter *painter);
+
+	public:
+		DetailEffect(BaseObjectView::DetailLevel min_level, QObject *parent = nullptr);
+
+		BaseObjectView::DetailLevel getMinimumDetailLevel();
+};
+
+#endif
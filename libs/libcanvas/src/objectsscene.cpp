@@ -90,9 +90,13 @@ ObjectsScene::ObjectsScene()
 		object_move_timer.stop();
 	});
 
+	connect(&rels_update_timer, &QTimer::timeout, this, &ObjectsScene::updatePendingRelationships);
+
 	scene_move_timer.setInterval(SceneMoveTimeout);
 	corner_hover_timer.setInterval(SceneMoveTimeout * 10);
 	object_move_timer.setInterval(SceneMoveTimeout * 10);
+	rels_update_timer.setInterval(0);
+	rels_update_timer.setSingleShot(true);
 
 	setSceneRect(QRectF(0, 0, min_scene_width, min_scene_height));
 }
@@ -104,6 +108,9 @@ ObjectsScene::~ObjectsScene()
 	std::vector<ObjectType> obj_types={ ObjectType::Relationship, ObjectType::Textbox, ObjectType::View,
 																 ObjectType::Table, ObjectType::ForeignTable, ObjectType::Schema };
 
+	rels_update_timer.stop();
+	pending_rels.clear();
+
 	this->removeItem(selection_rect);
 	this->removeItem(rel_line);
 
@@ -1640,6 +1647,10 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 			tab_view->requestRelationshipsUpdate();
 	}
 
+	/* Reconfiguring the relationships of all moved tables right away in a single pass
+	 * since the new scene rect calculated below depends on their lines */
+	updatePendingRelationships();
+
 	//Updating schemas bounding rects after moving objects
 	for(auto &obj : schemas)
 		obj->setModified(true);
@@ -1664,8 +1675,43 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 	emit s_objectsMoved(true);
 }
 
+void ObjectsScene::scheduleRelationshipUpdate(RelationshipView *rel)
+{
+	if(!rel)
+		return;
+
+	QPointer<RelationshipView> &rel_ptr = pending_rels[rel];
+
+	/* The QPointer is (re)assigned because the relationship may have been
+	 * destroyed and another one allocated in the same address in the meantime */
+	if(rel_ptr.isNull())
+		rel_ptr = rel;
+
+	if(!rels_update_timer.isActive())
+		rels_update_timer.start();
+}
+
+void ObjectsScene::updatePendingRelationships()
+{
+	std::map<RelationshipView *, QPointer<RelationshipView>> rels;
+
+	rels_update_timer.stop();
+
+	// Swapping the pending list since reconfiguring a relationship may schedule new updates
+	rels.swap(pending_rels);
+
+	for(auto &itr : rels)
+	{
+		if(!itr.second.isNull())
+			itr.second->configureLine();
+	}
+}
+
 QRectF ObjectsScene::adjustSceneRect(bool expand_only)
 {
+	// The relationships lines must be up to date in order to calculate the correct items bounding rect
+	updatePendingRelationships();
+
 	QRectF rect = this->itemsBoundingRect(true, false, true),
 				scn_rect = sceneRect();
 
@@ -29,11 +29,14 @@
 #include <QGraphicsView>
 #include <QPrinter>
 #include <QKeyEvent>
+#include <QPointer>
 #include "layeritem.h"
 #include "baseobjectview.h"
 #include "basetableview.h"
 #include "doublenan.h"
 
+class RelationshipView;
+
 class __libcanvas ObjectsScene: public QGraphicsScene {
 	Q_OBJECT
 
@@ -78,6 +81,11 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		//! \brief Holds the tables/views which have selected children objects
 		QList<BaseTableView *> tabs_sel_children;
 
+		/*! \brief Holds the relationships which lines must be reconfigured due to the movement/resizing of the
+		 * tables they connect. Each relationship is reconfigured only once in the next batched update
+		 * no matter how many of its tables were changed (see updatePendingRelationships()) */
+		std::map<RelationshipView *, QPointer<RelationshipView>> pending_rels;
+
 		//! \brief Indicates if the scene need to be moved
 		bool move_scene,
 
@@ -101,7 +109,10 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		the timer is still running the same will be restarted, until its timeout is reached. This trick avoids 'spamming' the
 		operation list in ModelWidget creating registries only when the user starts and ends the objects movement. Intermediate
 		key presses/releases aren't not registered in the operation history */
-		object_move_timer;
+		object_move_timer,
+
+		//! \brief Timer used to run the batched update of the pending relationships in the next event loop iteration
+		rels_update_timer;
 
 		//! \brief Attributes used to control the direction of scene movement when user puts cursor at corners
 		int scene_move_dx, scene_move_dy;
@@ -381,10 +392,16 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		 * The size expanded is determined by the current page layout used by the scene. */
 		void expandSceneRect(ExpandDirection exp_dir);
 
+		//! \brief Schedules the reconfiguration of the relationship's line to the next batched update
+		void scheduleRelationshipUpdate(RelationshipView *rel);
+
 	public slots:
 		//! \brief Force the update of all layer rectangles
 		void updateLayerRects();
 
+		//! \brief Reconfigures at once the lines of all relationships scheduled via scheduleRelationshipUpdate()
+		void updatePendingRelationships();
+
 		void setLayerRectsVisible(bool value);
 		void setLayerNamesVisible(bool value);
 		void alignObjectsToGrid();
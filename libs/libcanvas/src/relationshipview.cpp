@@ -20,6 +20,8 @@
 #include "relationship.h"
 #include "tableview.h"
 #include "utilsns.h"
+#include "detaileffect.h"
+#include "objectsscene.h"
 
 bool RelationshipView::hide_name_label {false};
 bool RelationshipView::use_curved_lines {true};
@@ -30,7 +32,7 @@ RelationshipView::LineConnectionMode RelationshipView::line_conn_mode { Relation
 RelationshipView::RelationshipView(BaseRelationship *rel) : BaseObjectView(rel)
 {
 	if(!rel)
-		throw Exception(ErrorCode::AsgNotAllocattedObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject, __exc_origin);
 
 	for(unsigned i=BaseRelationship::SrcCardLabel; i <= BaseRelationship::RelNameLabel; i++)
 	{
@@ -38,6 +40,7 @@ RelationshipView::RelationshipView(BaseRelationship *rel) : BaseObjectView(rel)
 		{
 			labels[i] = new TextboxView(rel->getLabel(static_cast<BaseRelationship::LabelId>(i)), true);
 			labels[i]->setZValue(i == BaseRelationship::RelNameLabel ? 1 : 2);
+			labels[i]->setGraphicsEffect(new DetailEffect(FullDetail));
 			this->addToGroup(labels[i]);
 		}
 		else
@@ -51,6 +54,7 @@ RelationshipView::RelationshipView(BaseRelationship *rel) : BaseObjectView(rel)
 
 	descriptor=new QGraphicsPolygonItem;
 	descriptor->setZValue(0);
+	descriptor->setGraphicsEffect(new DetailEffect(MediumDetail));
 	this->addToGroup(descriptor);
 
 	obj_shadow=new QGraphicsPolygonItem;
@@ -73,6 +77,7 @@ RelationshipView::RelationshipView(BaseRelationship *rel) : BaseObjectView(rel)
 		line_circles[i]->setRect(QRectF(0,0,GraphicPointRadius,GraphicPointRadius));
 		line_circles[i]->setZValue(0);
 		line_circles[i]->setVisible(false);
+		line_circles[i]->setGraphicsEffect(new DetailEffect(MediumDetail));
 		this->addToGroup(line_circles[i]);
 	}
 
@@ -201,7 +206,7 @@ unsigned RelationshipView::getLineConnectinMode()
 QPointF RelationshipView::getConnectionPoint(BaseRelationship::TableId table_idx)
 {
 	if(table_idx > 2)
-		throw Exception(ErrorCode::RefElementInvalidIndex ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex ,__exc_origin);
 
 	return conn_points[table_idx];
 }
@@ -222,7 +227,7 @@ TextboxView *RelationshipView::getLabel(BaseRelationship::LabelId lab_idx)
 bool RelationshipView::isTableVisible(BaseRelationship::TableId table_idx)
 {
 	if(table_idx > 2)
-		throw Exception(ErrorCode::RefElementInvalidIndex ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex ,__exc_origin);
 
 	return tables[table_idx]->isVisible();
 }
@@ -554,11 +559,11 @@ void RelationshipView::connectTables()
 			tables[i]->disconnect(this);
 
 			if(BaseObjectView::isPlaceholderEnabled())
-				connect(tables[i], &BaseTableView::s_relUpdateRequest, this, &RelationshipView::configureLine);
+				connect(tables[i], &BaseTableView::s_relUpdateRequest, this, &RelationshipView::requestLineUpdate);
 			else
-				connect(tables[i], &BaseTableView::s_objectMoved, this, &RelationshipView::configureLine);
+				connect(tables[i], &BaseTableView::s_objectMoved, this, &RelationshipView::requestLineUpdate);
 
-			connect(tables[i], &BaseTableView::s_objectDimensionChanged, this, &RelationshipView::configureLine);
+			connect(tables[i], &BaseTableView::s_objectDimensionChanged, this, &RelationshipView::requestLineUpdate);
 		}
 	}
 }
@@ -586,6 +591,16 @@ void RelationshipView::configureObject()
 	connect(rel_base, &BaseRelationship::s_objectModified, this, &RelationshipView::configureLine);
 }
 
+void RelationshipView::requestLineUpdate()
+{
+	ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+
+	if(scene)
+		scene->scheduleRelationshipUpdate(this);
+	else
+		configureLine();
+}
+
 void RelationshipView::configurePositionInfo()
 {
 	if(this->isSelected())
@@ -1526,6 +1541,7 @@ void RelationshipView::configureCrowsFootDescriptors()
 			for(int idx = 0; idx < 2; idx++)
 			{
 				cf_descriptors[idx] = new QGraphicsItemGroup;
+				cf_descriptors[idx]->setGraphicsEffect(new DetailEffect(MediumDetail));
 				round_cf_descriptors[idx] = new QGraphicsEllipseItem;
 				this->addToGroup(cf_descriptors[idx]);
 			}
@@ -1762,6 +1778,7 @@ void RelationshipView::configureAttributes()
 		{
 			attrib=new QGraphicsItemGroup;
 			attrib->setZValue(-1);
+			attrib->setGraphicsEffect(new DetailEffect(FullDetail));
 
 			//Creates the line that connects the attribute to the relationship descriptor
 			lin=new QGraphicsLineItem;
@@ -2011,7 +2028,7 @@ void RelationshipView::configureLabels()
 void RelationshipView::configureLabelPosition(BaseRelationship::LabelId label_id, double x, double y)
 {
 	if(label_id > BaseRelationship::RelNameLabel)
-		throw Exception(ErrorCode::RefObjectInvalidIndex ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex ,__exc_origin);
 
 	if(labels[label_id])
 	{
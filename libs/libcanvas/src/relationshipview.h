@@ -227,6 +227,11 @@ class __libcanvas RelationshipView: public BaseObjectView {
 		//! \brief Configures the relationship line
 		void configureLine();
 
+		/*! \brief Requests the reconfiguration of the relationship line to the scene so it can be done in a batch
+		 * together with the other relationships affected by the tables changes. If the relationship
+		 * is not in a scene the line is configured immediately */
+		void requestLineUpdate();
+
 	private slots:
 		//! \brief Makes the comple relationship configuration
 		virtual void configureObject() override;
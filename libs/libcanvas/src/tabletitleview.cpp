@@ -20,6 +20,7 @@
 #include "schema.h"
 #include "tag.h"
 #include "physicaltable.h"
+#include "detaileffect.h"
 
 TableTitleView::TableTitleView() : BaseObjectView(nullptr)
 {
@@ -32,6 +33,9 @@ TableTitleView::TableTitleView() : BaseObjectView(nullptr)
 	box=new RoundedRectItem;
 	box->setRoundedCorners(RoundedRectItem::TopLeftCorner | RoundedRectItem::TopRightCorner);
 	box->setZValue(0);
+
+	schema_name->setGraphicsEffect(new DetailEffect(MediumDetail));
+	obj_name->setGraphicsEffect(new DetailEffect(MediumDetail));
 }
 
 TableTitleView::~TableTitleView()
@@ -53,10 +57,10 @@ void TableTitleView::configureObject(BaseGraphicObject *object)
 
 	//Raises an error if the object related to the title is not allocated
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject, __exc_origin);
 	//Raises an error if the object is invalid
 	else if(!BaseTable::isBaseTable(object->getObjectType()))
-		throw Exception(ErrorCode::OprObjectInvalidType, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprObjectInvalidType, __exc_origin);
 
 	schema=dynamic_cast<Schema *>(object->getSchema());
 	tag=dynamic_cast<BaseTable *>(object)->getTag();
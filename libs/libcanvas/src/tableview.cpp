@@ -281,10 +281,10 @@ void TableView::configureObject()
 QPointF TableView::getConnectionPoints(TableObject *tab_obj, ConnectionPoint conn_pnt)
 {
 	if(!tab_obj)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	if(conn_pnt > RightConnPoint)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	if(conn_points.count(tab_obj)==0)
 		//Returns the center point in case of the connection point of the table object wasn't calculated already
@@ -82,7 +82,7 @@ namespace CompatNs {
 																.arg(attribs[Attributes::Table])
 																.arg(BaseObject::getTypeName(ObjectType::Table));
 
-									throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 								}
 
 								if(!attribs[Attributes::Column].isEmpty())
@@ -102,7 +102,7 @@ namespace CompatNs {
 																				attribs[Attributes::Column])
 																	.arg(BaseObject::getTypeName(ObjectType::Column));
 
-										throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 									}
 								}
 
@@ -207,7 +207,7 @@ namespace CompatNs {
 																		 .arg(BaseObject::getTypeName(ObjectType::Table))
 																		 .arg(aux_attribs[Attributes::Table])
 																		 .arg(BaseObject::getTypeName(ObjectType::Tag))
-																 , ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+																 , ErrorCode::RefObjectInexistsModel,__exc_origin);
 							}
 
 							view->setTag(dynamic_cast<Tag *>(tag));
@@ -242,7 +242,7 @@ namespace CompatNs {
 		catch(Exception &e)
 		{
 			if(view) delete view;
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 		}
 
 		return view;
@@ -260,7 +260,7 @@ namespace CompatNs {
 		XmlParser *xmlparser = dbmodel->getXMLParser();
 
 		if(!object)
-			throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 		xmlparser->getElementAttributes(attribs);
 		obj_type_aux=object->getObjectType();
@@ -391,7 +391,7 @@ namespace CompatNs {
 													 .arg(object->getTypeName())
 													 .arg(attribs_aux[Attributes::Name])
 													 .arg(BaseObject::getTypeName(obj_type)),
-											 ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											 ErrorCode::RefObjectInexistsModel,__exc_origin);
 		}
 		//Schema on extensions are optional
 		else if(!object->getSchema() && (BaseObject::acceptsSchema(obj_type_aux) && obj_type_aux != ObjectType::Extension))
@@ -399,7 +399,7 @@ namespace CompatNs {
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvObjectAllocationNoSchema)
 													 .arg(object->getName())
 													 .arg(object->getTypeName()),
-											 ErrorCode::InvObjectAllocationNoSchema,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											 ErrorCode::InvObjectAllocationNoSchema,__exc_origin);
 		}
 	}
 
@@ -31,16 +31,16 @@ Reference::Reference(PhysicalTable *table, Column *column, const QString &tab_al
 {
 	//Raises an error if the table is not allocated
 	if(!table)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	//Raises an error if the table/column alias has an invalid name
 	else if((!tab_alias.isEmpty() && !BaseObject::isValidName(tab_alias)) ||
 					(!col_alias.isEmpty() && !BaseObject::isValidName(col_alias)))
-		throw Exception(ErrorCode::AsgInvalidNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidNameObject,__exc_origin);
 
 	//Raises an error if the column parent table differs from the passed table
 	else if(column && column->getParentTable()!=table)
-		throw Exception(ErrorCode::AsgObjectBelongsAnotherTable ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgObjectBelongsAnotherTable ,__exc_origin);
 
 	this->table=table;
 	this->column=column;
@@ -53,10 +53,10 @@ Reference::Reference(const QString &expression, const QString &expr_alias)
 {
 	//Raises an error if the user try to create an reference using an empty expression
 	if(expression.isEmpty())
-		throw Exception(ErrorCode::AsgInvalidExpressionObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidExpressionObject,__exc_origin);
 	//Raises an error if the expression alias has an invalid name
 	else if(!expr_alias.isEmpty() && !BaseObject::isValidName(expr_alias))
-		throw Exception(ErrorCode::AsgInvalidNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidNameObject,__exc_origin);
 
 	table=nullptr;
 	column=nullptr;
@@ -121,18 +121,18 @@ void Reference::addColumn(const QString &name, PgSqlType type, const QString &al
 	if(!BaseObject::isValidName(name))
 	{
 		if(aux_name.isEmpty())
-			throw Exception(ErrorCode::AsgEmptyNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgEmptyNameObject,__exc_origin);
 		else if(aux_name.size() > BaseObject::ObjectNameMaxLength)
-			throw Exception(ErrorCode::AsgLongNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgLongNameObject,__exc_origin);
 		else
-			throw Exception(ErrorCode::AsgInvalidNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgInvalidNameObject,__exc_origin);
 	}
 
 	// Checking if the column already exists
 	for(auto &col : columns)
 	{
 		if(col.getName() == name)
-			throw Exception(ErrorCode::InsDuplicatedElement,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::InsDuplicatedElement,__exc_origin);
 	}
 
 	columns.push_back(SimpleColumn(name, *type, alias));
@@ -141,7 +141,7 @@ void Reference::addColumn(const QString &name, PgSqlType type, const QString &al
 void Reference::addColumn(Column *col)
 {
 	if(!col)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	addColumn(col->getName(), col->getType(), col->getAlias());
 }
@@ -192,7 +192,7 @@ Reference::ReferType Reference::getReferenceType()
 void Reference::setReferenceAlias(const QString &alias)
 {
 	if(alias.size() > BaseObject::ObjectNameMaxLength)
-		throw Exception(ErrorCode::AsgLongNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgLongNameObject,__exc_origin);
 
 	ref_alias = alias;
 }
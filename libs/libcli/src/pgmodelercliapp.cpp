@@ -56,6 +56,7 @@ const QString PgModelerCliApp::Diff {"--diff"};
 const QString PgModelerCliApp::DropDatabase {"--drop-database"};
 const QString PgModelerCliApp::DropObjects {"--drop-objects"};
 const QString PgModelerCliApp::NonTransactional {"--non-transactional"};
+const QString PgModelerCliApp::BatchSize {"--batch-size"};
 const QString PgModelerCliApp::PgSqlVer {"--pgsql-ver"};
 const QString PgModelerCliApp::Help {"--help"};
 const QString PgModelerCliApp::ShowGrid {"--show-grid"};
@@ -71,6 +72,7 @@ const QString PgModelerCliApp::User {"--user"};
 const QString PgModelerCliApp::Passwd {"--passwd"};
 const QString PgModelerCliApp::InitialDb {"--initial-db"};
 const QString PgModelerCliApp::Silent {"--silent"};
+const QString PgModelerCliApp::Verbose {"--verbose"};
 const QString PgModelerCliApp::ListConns {"--list-conns"};
 const QString PgModelerCliApp::Simulate {"--simulate"};
 const QString PgModelerCliApp::FixModel {"--fix-model"};
@@ -108,6 +110,7 @@ const QString PgModelerCliApp::NoCascadeDrop {"--no-cascade"};
 const QString PgModelerCliApp::RecreateUnmod {"--recreate-unmod"};
 const QString PgModelerCliApp::ReplaceModified {"--replace-mod"};
 const QString PgModelerCliApp::ForceReCreateObjs { "--force-re-create" };
+const QString PgModelerCliApp::Jobs {"--jobs"};
 const QString PgModelerCliApp::CreateConfigs {"--create-configs"};
 const QString PgModelerCliApp::MissingOnly {"--missing-only"};
 const QString PgModelerCliApp::IgnoreFaultyPlugins {"--ignore-faulty"};
@@ -148,11 +151,13 @@ std::map<QString, bool> PgModelerCliApp::long_opts {
 	{ DropMissingObjs, false },	{ ForceDropColsConstrs, false },	{ RenameDb, false },
 	{ NoSequenceReuse, false },	{ NoCascadeDrop, false },
 	{ RecreateUnmod, false }, { ReplaceModified, false },	{ ForceReCreateObjs, true },
+	{ Jobs, true },
 	{ ExportToDict, false }, { NoIndex, false },	{ Split, false },	{ SystemWide, false },
 	{ CreateConfigs, false }, { Force, false }, { MissingOnly, false },
 	{ DependenciesSql, false }, { ChildrenSql, false }, { GenDropScript, false },
 	{ GroupByType, false }, { CommentsAsAliases, false }, { IgnoreFaultyPlugins, false },
-	{ ListPlugins, false }, { Markdown, false }, { NonTransactional, false }
+	{ ListPlugins, false }, { Markdown, false }, { NonTransactional, false },
+	{ BatchSize, true }, { Verbose, false }
 };
 
 attribs_map PgModelerCliApp::short_opts {
@@ -176,12 +181,12 @@ attribs_map PgModelerCliApp::short_opts {
 	{ DropClusterObjs, "-dc" },	{ RevokePermissions, "-rv" },	{ DropMissingObjs, "-dm" },
 	{ ForceDropColsConstrs, "-fd" },	{ RenameDb, "-rn" },
 	{ NoSequenceReuse, "-ns" },	{ NoCascadeDrop, "-nd" }, { RecreateUnmod, "-ru" },
-	{ ReplaceModified, "-rm" },	{ ForceReCreateObjs, "-fr" }, { NoIndex, "-ni" },	{ Split, "-sp" },
+	{ ReplaceModified, "-rm" },	{ ForceReCreateObjs, "-fr" }, { Jobs, "-j" }, { NoIndex, "-ni" },	{ Split, "-sp" },
 	{ SystemWide, "-sw" },	{ CreateConfigs, "-cc" }, { Force, "-ff" },
 	{ MissingOnly, "-mo" }, { DependenciesSql, "-ds" }, { ChildrenSql, "-cs" },
 	{ GroupByType, "-gt" },	{ GenDropScript, "-gd" }, { CommentsAsAliases, "-cl" },
 	{ IgnoreFaultyPlugins, "-ip" }, { ListPlugins, "-lp" }, { Markdown, "-md" },
-	{ NonTransactional, "-nt" }
+	{ NonTransactional, "-nt" }, { BatchSize, "-bs" }, { Verbose, "-vb" }
 };
 
 std::map<QString, QStringList> PgModelerCliApp::accepted_opts {
@@ -193,16 +198,16 @@ std::map<QString, QStringList> PgModelerCliApp::accepted_opts {
 
 	{{ ExportToDbms }, { Input, PgSqlVer, IgnoreDuplicates, IgnoreErrorCodes,
 												DropDatabase, DropObjects, Simulate, UseTmpNames, Force,
-												NonTransactional }},
+												NonTransactional, BatchSize }},
 
 	{{ ImportDb }, { InputDb, Output, IgnoreImportErrors, ImportSystemObjs, ImportExtensionObjs,
 										FilterObjects, OnlyMatching, MatchByName, ForceChildren, DebugMode, ConnAlias,
-										Host, Port, User, Passwd, InitialDb, CommentsAsAliases }},
+										Host, Port, User, Passwd, InitialDb, CommentsAsAliases, Jobs }},
 
 	{{ Diff }, { Input, PgSqlVer, IgnoreDuplicates, IgnoreErrorCodes, CompareTo, PartialDiff, Force,
 								StartDate, EndDate, SaveDiff, ApplyDiff, NoDiffPreview, DropClusterObjs, RevokePermissions,
 								DropMissingObjs, ForceDropColsConstrs, RenameDb, NoCascadeDrop,
-								NoSequenceReuse, RecreateUnmod, ReplaceModified, ForceReCreateObjs, NonTransactional }},
+								NoSequenceReuse, RecreateUnmod, ReplaceModified, ForceReCreateObjs, NonTransactional, BatchSize, Jobs }},
 
 	{{ DbmMimeType }, { SystemWide, Force }},
 	{{ FixModel },	{ Input, Output, FixTries }},
@@ -224,6 +229,7 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 		buffer_size = 0;
 		model = nullptr;
 		scene = nullptr;
+		verbose_mode = false;
 		xmlparser = nullptr;
 		zoom = 1;
 
@@ -261,14 +267,14 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 
 					//Raises an error if the option is not recognized
 					if(!isOptionRecognized(op, accepts_val))
-						throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,__exc_origin);
 
 					//Raises an error if the value is empty and the option accepts a value
 					if(accepts_val && value.isEmpty())
-						throw Exception(tr("Value not specified for option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(tr("Value not specified for option `%1'.").arg(orig_op), ErrorCode::Custom,__exc_origin);
 
 					if(!accepts_val && !value.isEmpty())
-						throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,__exc_origin);
 
 					/* If we find a filter object parameter we append its parameter index so
 					 * its value is not replaced by the next filter parameter found */
@@ -288,6 +294,7 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 			model=new DatabaseModel;
 			xmlparser=model->getXMLParser();
 			silent_mode=(parsed_opts.count(Silent));
+			verbose_mode=(parsed_opts.count(Verbose));
 
 			//If the export is to png or svg loads additional configurations
 			if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb))
@@ -398,7 +405,7 @@ QString PgModelerCliApp::getParsedOptValue(const QString &opt)
 	if(parsed_opts.count(opt) == 0)
 	{
 		throw Exception(tr("Trying to retrieve the value of unknown parsed option `%1'!").arg(opt),
-										ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::Custom,__exc_origin);
 	}
 
 	return parsed_opts[opt];
@@ -409,7 +416,7 @@ void PgModelerCliApp::setParsedOptValue(const QString &opt, const QString &value
 	if(parsed_opts.count(opt) == 0)
 	{
 		throw Exception(tr("Trying to set the value of unknown parsed option `%1'!").arg(opt),
-										 ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										 ErrorCode::Custom,__exc_origin);
 	}
 
 	parsed_opts[opt] = value;
@@ -425,7 +432,7 @@ void PgModelerCliApp::configureConnection(bool extra_conn)
 	{
 		if(!connections.count(parsed_opts[ConnAlias + chr]))
 			throw Exception(tr("Connection aliased as '%1' was not found in the configuration file.").arg(parsed_opts[ConnAlias + chr]),
-							ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::Custom,__exc_origin);
 
 		//Make a copy of the named connection
 		*conn = (*connections[parsed_opts[ConnAlias + chr]]);
@@ -517,6 +524,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr(" %1, %2 [FILE|DIRECTORY]   Output file or directory. Required for fixing models or exporting to SQL, HTML, PNG, or SVG.").arg(short_opts[Output], Output));
 	printText(tr(" %1, %2\t\t  Force the PostgreSQL syntax to the specified version when generating SQL code. The version string must be in the form [major].[minor], e.g., %3.").arg(short_opts[PgSqlVer], PgSqlVer, PgSqlVersions::DefaulVersion));
 	printText(tr(" %1, %2\t\t\t  Silent execution. Only critical messages and errors are displayed during the process.").arg(short_opts[Silent], Silent));
+	printText(tr(" %1, %2\t\t\t  Verbose execution. Prints additional details about the process, like the time spent in each model loading stage.").arg(short_opts[Verbose], Verbose));
 	printText();
 
 	printText(tr("SQL file export options: "));
@@ -550,6 +558,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr(" %1, %2\t\t  Simulates an export process by executing all steps but undoing any modifications in the end.").arg(short_opts[Simulate], Simulate));
 	printText(tr(" %1, %2\t\t  Generates temporary names for database, roles, and tablespaces when in simulation mode.").arg(short_opts[UseTmpNames], UseTmpNames));
 	printText(tr(" %1, %2\t  Run the export process in a non-transactional mode where changes are not rolled back in case of errors.").arg(short_opts[NonTransactional], NonTransactional));
+	printText(tr(" %1, %2 [NUMBER]\t  Sends the commands to the server in pipelined batches of the specified size instead of one by one.").arg(short_opts[BatchSize], BatchSize));
 	printText();
 
 	printText(tr("Connection options: "));
@@ -571,6 +580,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr(" %1, %2\t\t  Performs object matching based on their names instead of their signature ([schema].[name]).").arg(short_opts[MatchByName], MatchByName));
 	printText(tr(" %1, %2 [OBJECTS]  Forces importing children objects related to tables/views/foreign tables matched by the filter(s). Provide a comma-separated list of types.").arg(short_opts[ForceChildren], ForceChildren));
 	printText(tr(" %1, %2\t\t  Runs the import in debug mode, printing all queries executed on the server.").arg(short_opts[DebugMode], DebugMode));
+	printText(tr(" %1, %2 [NUMBER]\t  Number of connections used in parallel to retrieve the objects from the database. The objects are created in the same order regardless of the number of jobs.").arg(short_opts[Jobs], Jobs));
 	printText();
 
 	printText(tr("Diff options: "));
@@ -592,6 +602,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr(" %1, %2\t\t  Recreates unmodifiable objects (those that cannot be changed via ALTER command).").arg(short_opts[RecreateUnmod], RecreateUnmod));
 	printText(tr(" %1, %2\t\t  Replaces modifiable objects (those that support CREATE OR REPLACE command).").arg(short_opts[ReplaceModified], ReplaceModified));
 	printText(tr(" %1, %2 [OBJECTS] Uses DROP and CREATE commands to fully modify changed objects. Provide a comma-separated list of types.").arg(short_opts[ForceReCreateObjs], ForceReCreateObjs));
+	printText(tr(" %1, %2 [NUMBER]\t  Number of parallel jobs used to import the database and to compare the objects of each schema. The generated diff is the same regardless of the number of jobs.").arg(short_opts[Jobs], Jobs));
 	printText();
 
 	printText(tr("Model fix options: "));
@@ -691,7 +702,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr("     Using filtering options may import additional objects due to automatic dependency resolution."));
 	printText();
 	printText(tr("** The diff process supports all import-related options."));
-	printText(tr("   It also accepts these export operation options: `%1', `%2', and `%3'.").arg(IgnoreDuplicates, IgnoreErrorCodes, NonTransactional));
+	printText(tr("   It also accepts these export operation options: `%1', `%2', `%3', and `%4'.").arg(IgnoreDuplicates, IgnoreErrorCodes, NonTransactional, BatchSize));
 	printText();
 	printText(tr("** The partial diff operation always forces the options %1 and %2 = %3 for more reliable results.").arg(OnlyMatching, ForceChildren, AllChildren));
 	printText(tr("   * The options %1 and %2 accept ISO8601 date/time format: `yyyy-MM-dd hh:mm:ss'.").arg(StartDate, EndDate));
@@ -816,52 +827,52 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 			zoom = opts[ZoomFactor].toDouble()/static_cast<double>(100);
 
 		if(other_modes_cnt == 0 && exp_mode_cnt == 0)
-			throw Exception(tr("No operation mode was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("No operation mode was specified!"), ErrorCode::Custom,__exc_origin);
 		
 		if((exp_mode_cnt > 0 && (fix_model || upd_mime || import_db || diff || create_configs || list_conns || list_plugins)) ||
 			 (exp_mode_cnt == 0 && other_modes_cnt > 1))
-			throw Exception(tr("Multiple operation modes were specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("Multiple operation modes were specified!"), ErrorCode::Custom,__exc_origin);
 		
 		if(!fix_model && !upd_mime && !plugin_op && exp_mode_cnt > 1)
-			throw Exception(tr("Multiple export modes were specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("Multiple export modes were specified!"), ErrorCode::Custom,__exc_origin);
 		
 		if(!plugin_op && !list_conns && !list_plugins && !upd_mime && !import_db &&
 			 !diff && !create_configs && !opts.count(Input))
-			throw Exception(tr("No input file was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("No input file was specified!"), ErrorCode::Custom,__exc_origin);
 
 		if(import_db && !opts.count(InputDb))
-			throw Exception(tr("No input database was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("No input database was specified!"), ErrorCode::Custom,__exc_origin);
 
 		if(!plugin_op && !export_dbms && !upd_mime && !list_conns &&
 			 !list_plugins && !diff && !create_configs && !opts.count(Output))
-			throw Exception(tr("No output file was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("No output file was specified!"), ErrorCode::Custom,__exc_origin);
 		
 		if(!export_dbms && !upd_mime && !import_db && !list_conns && !list_plugins &&
 			 !create_configs && opts.count(Input) && opts.count(Output) &&
 			 QFileInfo(opts[Input]).absoluteFilePath() == QFileInfo(opts[Output]).absoluteFilePath())
-			throw Exception(tr("The input file must be different from the output!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("The input file must be different from the output!"), ErrorCode::Custom,__exc_origin);
 		
 		if(export_dbms && !opts.count(ConnAlias) &&
 			 (!opts.count(Host) || !opts.count(User) || !opts.count(Passwd) || !opts.count(InitialDb)) )
-			throw Exception(tr("Incomplete connection information!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("Incomplete connection information!"), ErrorCode::Custom,__exc_origin);
 		
 		if(export_dbms && opts.count(Force) && !opts.count(DropDatabase))
-			throw Exception(tr("The option `%1' must be used only with `%2' when exporting to DBMS!").arg(Force, DropDatabase), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("The option `%1' must be used only with `%2' when exporting to DBMS!").arg(Force, DropDatabase), ErrorCode::Custom,__exc_origin);
 
 		if(export_dbms && opts.count(Simulate) && opts.count(NonTransactional))
-			throw Exception(tr("The options `%1' and `%2' can't be used together when exporting to DBMS!").arg(Simulate, NonTransactional), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("The options `%1' and `%2' can't be used together when exporting to DBMS!").arg(Simulate, NonTransactional), ErrorCode::Custom,__exc_origin);
 
 		if(export_dbms && (opts.count(IgnoreErrorCodes) || opts.count(IgnoreDuplicates)) && !opts.count(NonTransactional))
-			throw Exception(tr("The options `%1' and `%2' can't be used in transactional export mode. Use `%3' to enable those options!").arg(IgnoreErrorCodes, IgnoreDuplicates, NonTransactional), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("The options `%1' and `%2' can't be used in transactional export mode. Use `%3' to enable those options!").arg(IgnoreErrorCodes, IgnoreDuplicates, NonTransactional), ErrorCode::Custom,__exc_origin);
 
 		if(opts.count(ExportToPng) && (zoom < ModelWidget::MinimumZoom || zoom > ModelWidget::MaximumZoom))
-			throw Exception(tr("Invalid zoom specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("Invalid zoom specified!"), ErrorCode::Custom,__exc_origin);
 		
 		if(upd_mime && opts[DbmMimeType] != Install && opts[DbmMimeType] != Uninstall)
-			throw Exception(tr("Invalid action specified to mime type update option!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("Invalid action specified to mime type update option!"), ErrorCode::Custom,__exc_origin);
 
 		if(create_configs && opts.count(Force) && opts.count(MissingOnly))
-			throw Exception(tr("The options `%1' and `%2' can't be used together when handling configuration files!").arg(Force, MissingOnly), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(tr("The options `%1' and `%2' can't be used together when handling configuration files!").arg(Force, MissingOnly), ErrorCode::Custom,__exc_origin);
 
 		if(opts.count(DependenciesSql) || opts.count(ChildrenSql) || opts.count(GroupByType))
 		{
@@ -870,36 +881,36 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 			num_opts += opts.count(GroupByType) ? 1 : 0;
 
 			if(!export_file || (export_file && !opts.count(Split)))
-				throw Exception(tr("The options `%1', `%2' and `%3' must be used together with the split mode option `%4'!").arg(DependenciesSql, ChildrenSql, GroupByType, Split), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("The options `%1', `%2' and `%3' must be used together with the split mode option `%4'!").arg(DependenciesSql, ChildrenSql, GroupByType, Split), ErrorCode::Custom,__exc_origin);
 			else if(num_opts > 1)
-				throw Exception(tr("The options `%1', `%2' and `%3' can't be used at the same time!").arg(DependenciesSql, ChildrenSql, GroupByType), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("The options `%1', `%2' and `%3' can't be used at the same time!").arg(DependenciesSql, ChildrenSql, GroupByType), ErrorCode::Custom,__exc_origin);
 		}
 
 		if(diff)
 		{
 			if(!opts.count(Input) && !opts.count(InputDb))
-				throw Exception(tr("No input file or database was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("No input file or database was specified!"), ErrorCode::Custom,__exc_origin);
 
 			if(opts.count(Input) && opts.count(InputDb))
-				throw Exception(tr("The input file and the input database can't be used at the same time!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("The input file and the input database can't be used at the same time!"), ErrorCode::Custom,__exc_origin);
 
 			if(!opts.count(CompareTo))
-				throw Exception(tr("No database to be compared was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("No database to be compared was specified!"), ErrorCode::Custom,__exc_origin);
 
 			if(!opts.count(SaveDiff) && !opts.count(ApplyDiff))
-				throw Exception(tr("No diff action (save or apply) was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("No diff action (save or apply) was specified!"), ErrorCode::Custom,__exc_origin);
 
 			if(opts.count(SaveDiff) && opts[Output].isEmpty())
-				throw Exception(tr("No output file for the diff code was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("No output file for the diff code was specified!"), ErrorCode::Custom,__exc_origin);
 
 			if(opts.count(PartialDiff) && opts[Input].isEmpty() && (opts.count(StartDate) || opts.count(EndDate)))
-				throw Exception(tr("The date filters are allowed only on partial diff using an input model!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("The date filters are allowed only on partial diff using an input model!"), ErrorCode::Custom,__exc_origin);
 
 			if(opts.count(PartialDiff) && opts.count(FilterObjects) && (opts.count(StartDate) || opts.count(EndDate)))
-				throw Exception(tr("The date filters and object filters can't be used together!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("The date filters and object filters can't be used together!"), ErrorCode::Custom,__exc_origin);
 
 			if(opts.count(PartialDiff) && !opts.count(FilterObjects) && !opts.count(StartDate) && !opts.count(EndDate))
-				throw Exception(tr("Partial diff enabled but no object filter was provided!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("Partial diff enabled but no object filter was provided!"), ErrorCode::Custom,__exc_origin);
 
 			// For partial diff we force the --only-matching option and --force-children = all
 			if(opts.count(PartialDiff))
@@ -919,7 +930,7 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 					*dates[idx] = QDateTime::fromString(opts[dt_params[idx]], Qt::ISODate);
 
 					if(!dates[idx]->isValid())
-						throw Exception(tr("Invalid date format `%1' in option `%2'!").arg(opts[dt_params[idx]], dt_params[idx]), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(tr("Invalid date format `%1' in option `%2'!").arg(opts[dt_params[idx]], dt_params[idx]), ErrorCode::Custom,__exc_origin);
 				}
 			}
 
@@ -974,7 +985,7 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 		{
 			long_opt = itr.first;
 
-			if(long_opt == curr_op_mode || long_opt == Silent)
+			if(long_opt == curr_op_mode || long_opt == Silent || long_opt == Verbose)
 				continue;
 
 			/* Before validate the option we need to remove any appended number to the option name
@@ -984,7 +995,7 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 			if(!acc_opts.contains(long_opt))
 			{
 				throw Exception(tr("The option `%1' is not accepted by the operation mode `%2'!").arg(long_opt, curr_op_mode),
-												ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::Custom,__exc_origin);
 			}
 		}
 
@@ -1031,7 +1042,7 @@ int PgModelerCliApp::exec()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -1158,7 +1169,7 @@ void PgModelerCliApp::extractObjectXML()
 	start = header_match.capturedStart();
 
 	if(start < 0)
-		throw Exception(tr("Invalid input file! It seems that is not a pgModeler generated model or the file is corrupted!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(tr("Invalid input file! It seems that is not a pgModeler generated model or the file is corrupted!"), ErrorCode::Custom,__exc_origin);
 
 	//Extracting layers informations from the tag <dbmodel>
 	static QRegularExpression dbm_regexp { TagExpr.arg(Attributes::DbModel) },
@@ -1498,7 +1509,7 @@ void PgModelerCliApp::recreateObjects()
 				has_fix_log = true;
 			}
 			else
-				throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 		}
 
 		if(objs_xml.isEmpty() && (!fail_objs.isEmpty() || !constr.isEmpty()))
@@ -2014,6 +2025,18 @@ void PgModelerCliApp::loadModel()
 	//Load the model file
 	model->loadModel(parsed_opts[Input]);
 
+	if(verbose_mode)
+	{
+		printMessage(tr("Model loading stages:"));
+
+		for(auto &stage : model->getLoadingStages())
+		{
+			printMessage(QString("  %1: %2 ms%3").arg(stage.name,
+																							 QString::number(stage.elapsed_ns / 1000000.0, 'f', 2),
+																							 stage.obj_count > 0 ? tr(" (%1 object(s))").arg(stage.obj_count) : ""));
+		}
+	}
+
 	/* The scene object is created only when some options are used
 	 * so we need to check it if is not null to avoid segfaults */
 	if(scene)
@@ -2100,6 +2123,9 @@ void PgModelerCliApp::exportModel()
 		if(parsed_opts.count(IgnoreErrorCodes))
 			export_hlp->setIgnoredErrors(parsed_opts[IgnoreErrorCodes].split(','));
 
+		if(parsed_opts.count(BatchSize))
+			export_hlp->setStatementsBatchSize(parsed_opts[BatchSize].toUInt());
+
 		export_hlp->exportToDBMS(model, connection, parsed_opts[PgSqlVer],
 								parsed_opts.count(IgnoreDuplicates),
 								parsed_opts.count(DropDatabase),
@@ -2183,6 +2209,9 @@ void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
 																 !parsed_opts.count(Diff),
 																 parsed_opts.count(CommentsAsAliases) > 0);
 
+		if(parsed_opts.count(Jobs))
+			import_hlp->setImportJobs(parsed_opts[Jobs].toUInt());
+
 		model->createSystemObjects(true);
 		import_hlp->setSelectedOIDs(model, obj_oids, col_oids);
 		import_hlp->importDatabase();
@@ -2190,7 +2219,7 @@ void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2276,6 +2305,9 @@ void PgModelerCliApp::diffModelDatabase()
 
 	diff_hlp->setForcedRecreateTypeNames(parsed_opts[ForceReCreateObjs].split(',', Qt::SkipEmptyParts));
 
+	if(parsed_opts.count(Jobs))
+		diff_hlp->setParallelJobs(parsed_opts[Jobs].toUInt());
+
 	if(!parsed_opts[PgSqlVer].isEmpty())
 		diff_hlp->setPgSQLVersion(parsed_opts[PgSqlVer]);
 	else
@@ -2361,6 +2393,9 @@ void PgModelerCliApp::diffModelDatabase()
 				if(parsed_opts.count(IgnoreErrorCodes))
 					export_hlp->setIgnoredErrors(parsed_opts[IgnoreErrorCodes].split(','));
 
+				if(parsed_opts.count(BatchSize))
+					export_hlp->setStatementsBatchSize(parsed_opts[BatchSize].toUInt());
+
 				export_hlp->exportToDBMS();
 			}
 		}
@@ -2382,7 +2417,7 @@ void PgModelerCliApp::updateMimeType()
 	}
 	catch (Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 #endif
 }
@@ -2497,10 +2532,10 @@ void PgModelerCliApp::handleLinuxMimeDatabase(bool uninstall, bool system_wide,
 	{
 		//When installing, check if the necessary file exists. If exists, raises an error and abort.
 		if(!uninstall && QFileInfo::exists(files[i]) && !force)
-			throw Exception(MsgFileAssociated, ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(MsgFileAssociated, ErrorCode::Custom,__exc_origin);
 
 		if(uninstall && !QFileInfo::exists(files[i]) && !force)
-			throw Exception(MsgNoFileAssociation, ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(MsgNoFileAssociation, ErrorCode::Custom,__exc_origin);
 	}
 
 	if(!uninstall && !system_wide)
@@ -2517,7 +2552,7 @@ void PgModelerCliApp::handleLinuxMimeDatabase(bool uninstall, bool system_wide,
 				if(!QFile(files[i]).remove() && !force)
 				{
 					throw Exception(tr("Can't erase the file %1! Check if the current user has permissions to delete it and if the file exists.").arg(files[i]),
-													ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+													ErrorCode::Custom,__exc_origin);
 				}
 			}
 			else
@@ -2553,7 +2588,7 @@ void PgModelerCliApp::handleLinuxMimeDatabase(bool uninstall, bool system_wide,
 
 			if(!out.isOpen())
 				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(mimeapps),
-												ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::FileDirectoryNotWritten,__exc_origin);
 
 			//Opens the mimeapps.list to add a entry linking pgModeler to .dbm files
 			buf=out.readAll();
@@ -2597,7 +2632,7 @@ void PgModelerCliApp::handleLinuxMimeDatabase(bool uninstall, bool system_wide,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2616,12 +2651,12 @@ void PgModelerCliApp::handleWindowsMimeDatabase(bool uninstall, bool system_wide
 	if(uninstall && !force &&
 		 (dbm_ext.value("Default").toString().isEmpty() ||
 			sch_ext.value("Default").toString().isEmpty()))
-		throw Exception(MsgNoFileAssociation, ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(MsgNoFileAssociation, ErrorCode::Custom,__exc_origin);
 
 	if(!uninstall && !force &&
 		 (!dbm_ext.value("Default").toString().isEmpty() ||
 			!sch_ext.value("Default").toString().isEmpty()))
-		throw Exception(MsgFileAssociated, ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(MsgFileAssociated, ErrorCode::Custom,__exc_origin);
 
 	if(!uninstall)
 	{
@@ -2682,7 +2717,7 @@ void PgModelerCliApp::createConfigurations()
 			force = parsed_opts.count(Force) > 0;
 
 	if(!missing_only && !force && QDir(GlobalAttributes::getConfigurationsPath()).exists())
-		throw Exception(tr("Configuration files already exist!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(tr("Configuration files already exist!"), ErrorCode::Custom,__exc_origin);
 
 	try
 	{
@@ -2695,7 +2730,7 @@ void PgModelerCliApp::createConfigurations()
 			printMessage(tr("Backup path: %1").arg(bkp_conf_dir));
 
 			if(!dir.rename(conf_dir, bkp_conf_dir))
-				throw Exception(tr("Failed to create the configuration files backup!").arg(bkp_conf_dir), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(tr("Failed to create the configuration files backup!").arg(bkp_conf_dir), ErrorCode::Custom,__exc_origin);
 		}
 
 		createUserConfiguration();
@@ -2703,7 +2738,7 @@ void PgModelerCliApp::createConfigurations()
 	}
 	catch (Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2769,7 +2804,7 @@ void PgModelerCliApp::loadPlugins()
 			{
 				errors.push_back(Exception(Exception::getErrorMessage(ErrorCode::PluginNotLoaded)
 																	 .arg(plugin_name, lib, tr("The plug-in contains a list of options that are either malformed or that conflict with the pgmodeler-cli default options!")),
-																	 ErrorCode::PluginNotLoaded, __PRETTY_FUNCTION__,__FILE__,__LINE__,
+																	 ErrorCode::PluginNotLoaded, __exc_origin,
 																	 nullptr, tr("Plug-in id: %1").arg(plugin_name)));
 			}
 			else if(plugin->getOperationId() != PgModelerCliPlugin::CustomCliOp &&
@@ -2777,7 +2812,7 @@ void PgModelerCliApp::loadPlugins()
 			{
 				errors.push_back(Exception(Exception::getErrorMessage(ErrorCode::PluginNotLoaded)
 																	 .arg(plugin_name, lib, tr("The plug-in doesn't implement a custom CLI operation but has a list of operation modes defined!")),
-																	 ErrorCode::PluginNotLoaded, __PRETTY_FUNCTION__,__FILE__,__LINE__,
+																	 ErrorCode::PluginNotLoaded, __exc_origin,
 																	 nullptr, tr("Plug-in id: %1").arg(plugin_name)));
 			}
 			else if(plugin->getOperationId() == PgModelerCliPlugin::CustomCliOp &&
@@ -2785,7 +2820,7 @@ void PgModelerCliApp::loadPlugins()
 			{
 				errors.push_back(Exception(Exception::getErrorMessage(ErrorCode::PluginNotLoaded)
 																	 .arg(plugin_name, lib, tr("The plug-in implements a custom CLI operation but doesn't specify a list of operation modes!")),
-																	 ErrorCode::PluginNotLoaded, __PRETTY_FUNCTION__,__FILE__,__LINE__,
+																	 ErrorCode::PluginNotLoaded, __exc_origin,
 																	 nullptr, tr("Plug-in id: %1").arg(plugin_name)));
 			}
 			else
@@ -2807,7 +2842,7 @@ void PgModelerCliApp::loadPlugins()
 		{
 			errors.push_back(Exception(Exception::getErrorMessage(ErrorCode::PluginNotLoaded)
 																 .arg(plugin_name, lib, plugin_loader.errorString()),
-																	 ErrorCode::PluginNotLoaded, __PRETTY_FUNCTION__,__FILE__,__LINE__,
+																	 ErrorCode::PluginNotLoaded, __exc_origin,
 																	 nullptr, tr("Plug-in id: %1").arg(plugin_name)));
 		}
 	}
@@ -2817,7 +2852,7 @@ void PgModelerCliApp::loadPlugins()
 		plugin_load_errors = Exception(Exception::getErrorMessage(ErrorCode::PluginsNotLoaded) + " " +
 																	 tr("HINT: you can use the option `%1' to ignore the faulty plug-in(s) errors.").arg(IgnoreFaultyPlugins),
 																	 ErrorCode::PluginsNotLoaded,
-																	 __PRETTY_FUNCTION__, __FILE__, __LINE__, errors).getExceptionsText();
+																	 __exc_origin, errors).getExceptionsText();
 	}
 }
 
@@ -2980,7 +3015,7 @@ void PgModelerCliApp::runPluginsPreOperations()
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e,
+			throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e,
 											tr("Plug-in id: %1").arg(plugin->getPluginName()));
 		}
 	}
@@ -2996,7 +3031,7 @@ void PgModelerCliApp::runPluginsOperations()
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e,
+			throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e,
 											tr("Plug-in id: %1").arg(plugin->getPluginName()));
 		}
 	}
@@ -3012,7 +3047,7 @@ void PgModelerCliApp::runPluginsPostOperations()
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e,
+			throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e,
 											tr("Plug-in id: %1").arg(plugin->getPluginName()));
 		}
 	}
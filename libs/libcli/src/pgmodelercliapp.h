@@ -104,6 +104,9 @@ class __libcli PgModelerCliApp: public Application {
 		//! \brief Indicates if the cli must run in silent mode
 		bool silent_mode;
 
+		//! \brief Indicates if the cli must print additional details about the operations (e.g. model loading stages)
+		bool verbose_mode;
+
 		//! \brief Store the error stack related to plugins loading
 		QString plugin_load_errors;
 
@@ -216,6 +219,7 @@ class __libcli PgModelerCliApp: public Application {
 		DropDatabase,
 		DropObjects,
 		NonTransactional,
+		BatchSize,
 		PgSqlVer,
 		Help,
 		ShowGrid,
@@ -231,6 +235,7 @@ class __libcli PgModelerCliApp: public Application {
 		Passwd,
 		InitialDb,
 		Silent,
+		Verbose,
 		ListConns,
 		Simulate,
 		FixModel,
@@ -268,6 +273,7 @@ class __libcli PgModelerCliApp: public Application {
 		RecreateUnmod,
 		ReplaceModified,
 		ForceReCreateObjs,
+		Jobs,
 		CreateConfigs,
 		MissingOnly,
 		IgnoreFaultyPlugins,
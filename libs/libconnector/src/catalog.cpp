@@ -101,6 +101,7 @@ const std::map<ObjectType, QString> Catalog::parent_aliases {
 };
 
 attribs_map Catalog::catalog_queries {};
+QMutex Catalog::queries_mutex;
 
 Catalog::Catalog()
 {
@@ -122,6 +123,7 @@ void Catalog::setConnection(Connection &conn)
 		QStringList obj_oids;
 
 		connection.close();
+		queued_obj_types.clear();
 		connection.setConnectionParams(conn.getConnectionParams());
 		connection.connect();
 
@@ -154,13 +156,14 @@ void Catalog::setConnection(Connection &conn)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 void Catalog::closeConnection()
 {
 	connection.close();
+	queued_obj_types.clear();
 }
 
 bool Catalog::isConnectionValid()
@@ -250,7 +253,7 @@ void Catalog::setObjectFilters(QStringList filters, bool only_matching, bool mat
 			if(!TableObject::isTableObject(BaseObject::getObjectType(type_name)))
 			{
 				throw Exception(Exception::getErrorMessage(ErrorCode::InvChildObjectTypeFilter).arg(type_name),
-												ErrorCode::InvChildObjectTypeFilter,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::InvChildObjectTypeFilter,__exc_origin);
 			}
 		}
 
@@ -280,7 +283,7 @@ void Catalog::setObjectFilters(QStringList filters, bool only_matching, bool mat
 		if(values.size() != 3)
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvalidObjectFilter).arg(filter).arg(modes.join('|')),
-											ErrorCode::InvalidObjectFilter,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::InvalidObjectFilter,__exc_origin);
 		}
 
 		obj_type = BaseObject::getObjectType(values[0]);
@@ -291,7 +294,7 @@ void Catalog::setObjectFilters(QStringList filters, bool only_matching, bool mat
 		if(obj_type == ObjectType::BaseObject || pattern.isEmpty() || !modes.contains(mode))
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvalidObjectFilter).arg(filter).arg(modes.join('|')),
-											ErrorCode::InvalidObjectFilter,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::InvalidObjectFilter,__exc_origin);
 		}
 
 		// Converting wildcard patterns into regexp syntax
@@ -412,10 +415,15 @@ bool Catalog::isExtensionObject(unsigned oid, const QString &ext_name)
 
 void Catalog::loadCatalogQuery(const QString &qry_id)
 {
+	QMutexLocker locker(&queries_mutex);
+
 	if(catalog_queries.count(qry_id)==0)
 		catalog_queries[qry_id] = UtilsNs::loadFile(GlobalAttributes::getSchemaFilePath(GlobalAttributes::CatalogSchemasDir, qry_id));
 
-	schparser.loadBuffer(catalog_queries[qry_id]);
+	QString qry_buffer = catalog_queries[qry_id];
+
+	locker.unlock();
+	schparser.loadBuffer(qry_buffer);
 }
 
 QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs)
@@ -541,7 +549,7 @@ void Catalog::executeCatalogQuery(const QString &qry_type, ObjectType obj_type,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 						QString("catalog: %1").arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -590,7 +598,7 @@ unsigned Catalog::getObjectsCount(std::vector<ObjectType> obj_types, bool incl_s
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -668,7 +676,7 @@ void Catalog::getObjectsOIDs(std::map<ObjectType, std::vector<unsigned> > &obj_o
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -696,7 +704,7 @@ attribs_map Catalog::getObjectsNames(ObjectType obj_type, const QString &sch_nam
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -769,7 +777,7 @@ std::vector<attribs_map> Catalog::getObjectsNames(std::vector<ObjectType> obj_ty
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -795,40 +803,45 @@ attribs_map Catalog::getAttributes(const QString &obj_name, ObjectType obj_type,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
-std::vector<attribs_map> Catalog::getMultipleAttributes(ObjectType obj_type, attribs_map extra_attribs)
+std::vector<attribs_map> Catalog::getResultSetAttributes(ResultSet &res, ObjectType obj_type)
 {
-	try
-	{
-		ResultSet res;
-		attribs_map tuple;
-		std::vector<attribs_map> obj_attribs;
+	attribs_map tuple;
+	std::vector<attribs_map> obj_attribs;
 
-		executeCatalogQuery(QueryAttribs, obj_type, res, false, extra_attribs);
-		if(res.accessTuple(ResultSet::FirstTuple))
+	if(res.accessTuple(ResultSet::FirstTuple))
+	{
+		do
 		{
-			do
-			{
-				tuple=changeAttributeNames(res.getTupleValues());
+			tuple=changeAttributeNames(res.getTupleValues());
 
-				/* Insert the object type as an attribute of the query result to facilitate the
-				import process on the classes that uses the Catalog */
-				tuple[Attributes::ObjectType]=QString("%1").arg(enum_t(obj_type));
+			/* Insert the object type as an attribute of the query result to facilitate the
+			import process on the classes that uses the Catalog */
+			tuple[Attributes::ObjectType]=QString("%1").arg(enum_t(obj_type));
 
-				obj_attribs.push_back(tuple);
-				tuple.clear();
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
+			obj_attribs.push_back(tuple);
+			tuple.clear();
 		}
+		while(res.accessTuple(ResultSet::NextTuple));
+	}
 
-		return obj_attribs;
+	return obj_attribs;
+}
+
+std::vector<attribs_map> Catalog::getMultipleAttributes(ObjectType obj_type, attribs_map extra_attribs)
+{
+	try
+	{
+		ResultSet res;
+		executeCatalogQuery(QueryAttribs, obj_type, res, false, extra_attribs);
+		return getResultSetAttributes(res, obj_type);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -862,7 +875,7 @@ std::vector<attribs_map> Catalog::getMultipleAttributes(const QString &catalog_s
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -881,7 +894,7 @@ QString Catalog::getCommentQuery(const QString &oid_field, ObjectType obj_type,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 						QString("catalog: %1").arg(query_id));
 	}
 }
@@ -901,7 +914,7 @@ QString Catalog::getNotExtObjectQuery(const QString &oid_field)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 						QString("catalog: %1").arg(query_id));
 	}
 }
@@ -949,25 +962,71 @@ std::vector<attribs_map> Catalog::getObjectsAttributes(ObjectType obj_type, cons
 {
 	try
 	{
-		bool is_shared_obj=(obj_type==ObjectType::Database ||	obj_type==ObjectType::Role ||
-												obj_type==ObjectType::Tablespace || obj_type==ObjectType::Language ||
-												obj_type==ObjectType::Cast);
+		return getMultipleAttributes(obj_type, getObjectsAttributesQueryAttribs(obj_type, schema, table, filter_oids, extra_attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
+						QString("catalog: %1").arg(BaseObject::getSchemaName(obj_type)));
+	}
+}
+
+attribs_map Catalog::getObjectsAttributesQueryAttribs(ObjectType obj_type, const QString &schema, const QString &table, const std::vector<unsigned> &filter_oids, attribs_map extra_attribs)
+{
+	bool is_shared_obj=(obj_type==ObjectType::Database ||	obj_type==ObjectType::Role ||
+											obj_type==ObjectType::Tablespace || obj_type==ObjectType::Language ||
+											obj_type==ObjectType::Cast);
+
+	extra_attribs[Attributes::Schema]=schema;
+	extra_attribs[Attributes::Table]=table;
+
+	if(!filter_oids.empty())
+		extra_attribs[Attributes::FilterOids]=createOidFilter(filter_oids);
+
+	//Retrieve the comment catalog query. Only columns need to retreive comments in their own catalog query file
+	if(obj_type != ObjectType::Column)
+		extra_attribs[Attributes::Comment] = getCommentQuery(oid_fields.at(obj_type), obj_type, is_shared_obj);
+
+	return extra_attribs;
+}
+
+void Catalog::enqueueObjectsAttributes(ObjectType obj_type, const QString &schema, const QString &table, const std::vector<unsigned> &filter_oids, attribs_map extra_attribs)
+{
+	try
+	{
+		extra_attribs = getObjectsAttributesQueryAttribs(obj_type, schema, table, filter_oids, extra_attribs);
+		connection.sendDMLCommand(getCatalogQuery(QueryAttribs, obj_type, false, extra_attribs));
+		queued_obj_types.push_back(obj_type);
+	}
+	catch(Exception &e)
+	{
+		queued_obj_types.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
+						QString("catalog: %1").arg(BaseObject::getSchemaName(obj_type)));
+	}
+}
 
-		extra_attribs[Attributes::Schema]=schema;
-		extra_attribs[Attributes::Table]=table;
+bool Catalog::getNextObjectsAttributes(ObjectType &obj_type, std::vector<attribs_map> &obj_attribs)
+{
+	if(queued_obj_types.empty())
+		return false;
 
-		if(!filter_oids.empty())
-			extra_attribs[Attributes::FilterOids]=createOidFilter(filter_oids);
+	obj_type = queued_obj_types.front();
+	queued_obj_types.pop_front();
 
-		//Retrieve the comment catalog query. Only columns need to retreive comments in their own catalog query file
-		if(obj_type != ObjectType::Column)
-			extra_attribs[Attributes::Comment] = getCommentQuery(oid_fields.at(obj_type), obj_type, is_shared_obj);
+	try
+	{
+		ResultSet res;
 
-		return getMultipleAttributes(obj_type, extra_attribs);
+		connection.getNextResult(res);
+		obj_attribs = getResultSetAttributes(res, obj_type);
+		return true;
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		//The connection discards all the pending results in case of errors
+		queued_obj_types.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 						QString("catalog: %1").arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -981,7 +1040,7 @@ attribs_map Catalog::getObjectAttributes(ObjectType obj_type, unsigned oid, cons
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 										qApp->translate("Catalog","Object type: %1","", -1).arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -1000,7 +1059,7 @@ QString Catalog::getObjectOID(const QString &name, ObjectType obj_type, const QS
 
 		if(res.getTupleCount() > 1)
 			throw Exception(qApp->translate("Catalog","The catalog query returned more than one OID!","", -1),
-											ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::Custom,__exc_origin);
 
 		if(res.getTupleCount() == 0)
 			return "0";
@@ -1010,7 +1069,7 @@ QString Catalog::getObjectOID(const QString &name, ObjectType obj_type, const QS
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 										qApp->translate("Catalog","Object type: %1","", -1).arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -1049,7 +1108,7 @@ attribs_map Catalog::getServerAttributes()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 										qApp->translate("Catalog","Object type: server","", -1));
 	}
 
@@ -1064,10 +1123,25 @@ bool Catalog::isServerSupported()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
+unsigned Catalog::getExecutedQueriesCount()
+{
+	return connection.getExecutedCommandsCount();
+}
+
+unsigned Catalog::getRoundTripsCount()
+{
+	return connection.getRoundTripsCount();
+}
+
+void Catalog::resetQueriesStats()
+{
+	connection.resetCommandsStats();
+}
+
 QStringList Catalog::parseArrayValues(const QString &array_val)
 {
 	QStringList list;
@@ -1317,6 +1391,6 @@ void Catalog::operator = (const Catalog &catalog)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
@@ -30,6 +30,8 @@ This class is the basis for the reverse engineering feature.
 #include "baseobject.h"
 #include <QTextStream>
 #include <QApplication>
+#include <deque>
+#include <QMutex>
 
 class __libconnector Catalog {
 	public:
@@ -126,9 +128,16 @@ class __libconnector Catalog {
 		//! \brief Store the cached catalog queries
 		static attribs_map catalog_queries;
 
+		//! \brief Serializes the loading of catalog queries since several catalogs can be used in different threads
+		static QMutex queries_mutex;
+
 		//! \brief Connection used to query the pg_catalog
 		Connection connection;
 
+		/*! \brief Stores the object types of the attributes queries enqueued via enqueueObjectsAttributes()
+		 * in the same order they were sent to the server (see getNextObjectsAttributes()) */
+		std::deque<ObjectType> queued_obj_types;
+
 		//! \brief Stores the last system object identifier. This is used to filter system objects
 		unsigned last_sys_oid;
 
@@ -257,6 +266,12 @@ class __libconnector Catalog {
 		the specified list of types.	A schema name can be specified in order to filter only objects of the specifed schema */
 		std::vector<attribs_map> getObjectsNames(std::vector<ObjectType> obj_types, const QString &sch_name="", const QString &tab_name="", attribs_map extra_attribs=attribs_map(), bool sort_results=false);
 
+		//! \brief Configures the attributes used by the catalog query that retrieves the attributes of several objects of the same type
+		attribs_map getObjectsAttributesQueryAttribs(ObjectType obj_type, const QString &schema, const QString &table, const std::vector<unsigned> &filter_oids, attribs_map extra_attribs);
+
+		//! \brief Converts all tuples of the result set to attributes maps marking each one with the specified object type
+		std::vector<attribs_map> getResultSetAttributes(ResultSet &res, ObjectType obj_type);
+
 		//! \brief Returns a set of multiple attributes (several tuples) for the specified object type
 		std::vector<attribs_map> getMultipleAttributes(ObjectType obj_type, attribs_map extra_attribs=attribs_map());
 
@@ -271,6 +286,15 @@ class __libconnector Catalog {
 		and by table name (only when retriving child objects for a specific table) */
 		std::vector<attribs_map> getObjectsAttributes(ObjectType obj_type, const QString &schema="", const QString &table="", const std::vector<unsigned> &filter_oids={}, attribs_map extra_attribs=attribs_map());
 
+		/*! \brief Enqueues the query that retrieves the attributes of objects of the specified type (see getObjectsAttributes())
+		 * without waiting for its result. Several queries can be enqueued and sent to the server at once reducing the amount
+		 * of network round trips. The results must be retrieved in the same order they were enqueued via getNextObjectsAttributes() */
+		void enqueueObjectsAttributes(ObjectType obj_type, const QString &schema="", const QString &table="", const std::vector<unsigned> &filter_oids={}, attribs_map extra_attribs=attribs_map());
+
+		/*! \brief Retrieves the attributes of the oldest query enqueued via enqueueObjectsAttributes() storing them in obj_attribs
+		 * and the related object type in obj_type. Returns false when there are no pending queries */
+		bool getNextObjectsAttributes(ObjectType &obj_type, std::vector<attribs_map> &obj_attribs);
+
 		//! \brief Returns the attributes for the object specified by its type and OID
 		attribs_map getObjectAttributes(ObjectType obj_type, unsigned oid, const QString sch_name="", const QString tab_name="", attribs_map extra_attribs=attribs_map());
 
@@ -287,6 +311,16 @@ class __libconnector Catalog {
 		 * of the currently open connection of the catalog object. */
 		bool isServerSupported();
 
+		/*! \brief Returns the amount of catalog queries executed since the connection was configured
+		 *  or the counters were reset (see resetQueriesStats()) */
+		unsigned getExecutedQueriesCount();
+
+		//! \brief Returns the amount of network round trips used to execute the catalog queries
+		unsigned getRoundTripsCount();
+
+		//! \brief Resets the executed queries and round trips counters of the catalog connection
+		void resetQueriesStats();
+
 		//! \brief Parse a PostgreSQL array value and return the elements in a string list
 		static QStringList parseArrayValues(const QString &array_val);
 
@@ -23,6 +23,7 @@
 #include "exception.h"
 
 QStringList Connection::notices;
+QMutex Connection::notices_mutex;
 
 bool Connection::notice_enabled {false};
 bool Connection::print_sql {false};
@@ -62,6 +63,9 @@ Connection::Connection()
 	connection=nullptr;
 	auto_browse_db=false;	
 	cmd_exec_timeout=0;
+	unsynced_cmds=pending_syncs=0;
+	executed_cmds=round_trips=0;
+	streaming=stream_cancelled=stream_in_block=false;
 
 	for(unsigned idx=OpValidation; idx <= OpDiff; idx++)
 		default_for_oper[idx]=false;
@@ -100,7 +104,7 @@ void Connection::setConnectionParam(const QString &param, const QString &value)
 
 	//Raise an error in case the param name is empty
 	if(param.isEmpty())
-		throw Exception(ErrorCode::AsgInvalidConnParameter, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::AsgInvalidConnParameter, __exc_origin);
 
 	/* Set the value to the specified param on the map.
 	One special case is treated here, if user use the parameter SERVER_FQDN and the value
@@ -167,9 +171,16 @@ void Connection::generateConnectionString()
 
 void Connection::noticeProcessor(void *, const char *message)
 {
+	QMutexLocker locker(&notices_mutex);
 	notices.push_back(QString(message));
 }
 
+void Connection::clearNotices()
+{
+	QMutexLocker locker(&notices_mutex);
+	notices.clear();
+}
+
 void Connection::validateConnectionStatus()
 {
 	if(cmd_exec_timeout > 0)
@@ -180,7 +191,7 @@ void Connection::validateConnectionStatus()
 		if(dt >= cmd_exec_timeout)
 		{
 			close();
-			throw Exception(ErrorCode::ConnectionTimeout, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+			throw Exception(ErrorCode::ConnectionTimeout, __exc_origin);
 		}
 	}
 
@@ -188,7 +199,7 @@ void Connection::validateConnectionStatus()
 		throw Exception(Exception::getErrorMessage(ErrorCode::ConnectionBroken)
 										.arg(connection_params[ParamServerFqdn].isEmpty() ? connection_params[ParamServerIp] : connection_params[ParamServerFqdn])
 										.arg(connection_params[ParamPort]),
-										ErrorCode::ConnectionBroken, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::ConnectionBroken, __exc_origin);
 }
 
 void Connection::setNoticeEnabled(bool value)
@@ -237,11 +248,11 @@ void Connection::connect()
 		is trying to connect without configuring connection parameters,
 		thus an error is raised */
 	if(connection_str.isEmpty())
-		throw Exception(ErrorCode::ConnectionNotConfigured, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::ConnectionNotConfigured, __exc_origin);
 	else if(connection)
 	{
 		if(!silence_conn_err)
-			throw Exception(ErrorCode::ConnectionAlreadyStablished, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+			throw Exception(ErrorCode::ConnectionAlreadyStablished, __exc_origin);
 		else
 		{
 			QTextStream err(stderr);
@@ -262,10 +273,10 @@ void Connection::connect()
 		//Raise the error generated by the DBMS
 		throw Exception(Exception::getErrorMessage(ErrorCode::ConnectionNotStablished)
 						.arg(PQerrorMessage(connection)), ErrorCode::ConnectionNotStablished,
-						__PRETTY_FUNCTION__, __FILE__, __LINE__);
+						__exc_origin);
 	}
 
-	notices.clear();
+	clearNotices();
 
 	if(!notice_enabled)
 		//Completely disable notice/warnings in the connection
@@ -282,7 +293,7 @@ void Connection::connect()
 
 		throw Exception(Exception::getErrorMessage(ErrorCode::UnsupportedPGVersion).arg(pgver),
 										ErrorCode::UnsupportedPGVersion,
-										__PRETTY_FUNCTION__, __FILE__, __LINE__);
+										__exc_origin);
 	}
 
 	// Switching to another role if the related parameter is set
@@ -301,13 +312,17 @@ void Connection::close()
 		connection=nullptr;
 		last_cmd_execution=QDateTime();
 	}
+
+	pending_cmds.clear();
+	unsynced_cmds=pending_syncs=0;
+	streaming=stream_cancelled=stream_in_block=false;
 }
 
 void Connection::reset()
 {
 	//Raise an erro in case the user try to reset a not opened connection
 	if(!connection)
-		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
 
 	//Reinicia a conexão
 	PQreset(connection);
@@ -328,7 +343,7 @@ attribs_map Connection::getServerInfo()
 	attribs_map info;
 
 	if(!connection)
-		throw Exception(ErrorCode::OprNotAllocatedConnection,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedConnection,__exc_origin);
 
 	info[ServerPid]=QString::number(PQbackendPID(connection));
 	info[ServerVersion]=getPgSQLVersion();
@@ -395,7 +410,7 @@ QString  Connection::getPgSQLVersion(bool major_only)
 	QString raw_ver, fmt_ver;
 
 	if(!connection)
-		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
 
 	raw_ver=QString("%1").arg(PQserverVersion(connection));
 
@@ -426,6 +441,7 @@ QString  Connection::getPgSQLVersion(bool major_only)
 
 QStringList Connection::getNotices()
 {
+	QMutexLocker locker(&notices_mutex);
 	return notices;
 }
 
@@ -435,13 +451,19 @@ void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 
 	//Raise an error in case the user try to close a not opened connection
 	if(!connection)
-		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
+
+	//Discarding the remaining results of a previous streamed command so the connection can be used again
+	if(streaming)
+		discardStreamedResults();
 
 	validateConnectionStatus();
-	notices.clear();
+	clearNotices();
 
 	//Alocates a new result to receive the resultset returned by the sql command
     sql_res = PQexec(connection, sql.toStdString().c_str());
+	executed_cmds++;
+	round_trips++;
 
 	//Prints the SQL to stdout when the flag is active
 	if(print_sql)
@@ -452,7 +474,7 @@ void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
 						.arg(PQerrorMessage(connection)),
-						ErrorCode::SQLCommandNotExecuted, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
+						ErrorCode::SQLCommandNotExecuted, __exc_origin, nullptr,
 						QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE)));
 	}
 
@@ -466,11 +488,17 @@ void Connection::executeDDLCommand(const QString &sql)
 
 	//Raise an error in case the user try to close a not opened connection
 	if(!connection)
-		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
+
+	//Discarding the remaining results of a previous streamed command so the connection can be used again
+	if(streaming)
+		discardStreamedResults();
 
 	validateConnectionStatus();
-	notices.clear();
+	clearNotices();
 	sql_res=PQexec(connection, sql.toStdString().c_str());
+	executed_cmds++;
+	round_trips++;
 
 	//Prints the SQL to stdout when the flag is active
 	if(print_sql)
@@ -487,16 +515,332 @@ void Connection::executeDDLCommand(const QString &sql)
 
 		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
 						.arg(PQerrorMessage(connection)),
-						ErrorCode::SQLCommandNotExecuted, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,	field);
+						ErrorCode::SQLCommandNotExecuted, __exc_origin, nullptr,	field);
 	}
 
 	PQclear(sql_res);
 }
 
+void Connection::sendDMLCommand(const QString &sql)
+{
+	//Raise an error in case the user try to send commands using a not opened connection
+	if(!connection)
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
+
+	if(streaming)
+		discardStreamedResults();
+
+	if(pending_cmds.isEmpty())
+	{
+		validateConnectionStatus();
+		clearNotices();
+	}
+
+#ifdef LIBPQ_HAS_PIPELINING
+	/* Entering pipeline mode in the first enqueued command. The connection is
+	 * put in non-blocking mode while the pipeline is active so libpq can flush the
+	 * remaining commands while reading the results, avoiding a deadlock when the
+	 * server output buffer gets full before all commands are sent */
+	if(PQpipelineStatus(connection) == PQ_PIPELINE_OFF &&
+		 (PQsetnonblocking(connection, 1) != 0 || PQenterPipelineMode(connection) != 1))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+										.arg(PQerrorMessage(connection)),
+										ErrorCode::SQLCommandNotExecuted, __exc_origin);
+	}
+
+	/* Pipeline mode only accepts commands sent through the extended query protocol,
+	 * so we use PQsendQueryParams() without parameters instead of PQsendQuery() */
+	if(PQsendQueryParams(connection, sql.toStdString().c_str(), 0,
+											 nullptr, nullptr, nullptr, nullptr, 0) != 1)
+	{
+		QString err_msg = PQerrorMessage(connection);
+
+		discardPendingResults();
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(err_msg),
+										ErrorCode::SQLCommandNotExecuted, __exc_origin);
+	}
+
+	unsynced_cmds++;
+	executed_cmds++;
+#endif
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+		qDebug().noquote() << "\n---\n" << sql;
+
+	pending_cmds.append(sql);
+}
+
+bool Connection::getNextResult(ResultSet &result)
+{
+	if(pending_cmds.isEmpty())
+		return false;
+
+	//Raise an error in case the user try to retrieve results using a not opened connection
+	if(!connection)
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
+
+#ifdef LIBPQ_HAS_PIPELINING
+	PGresult *sql_res = nullptr, *aux_res = nullptr;
+	ExecStatusType status;
+
+	/* Marking the end of the commands sent so far so the server starts
+	 * to process them and libpq flushes them to the server */
+	if(unsynced_cmds > 0)
+	{
+		if(PQpipelineSync(connection) != 1)
+		{
+			QString err_msg = PQerrorMessage(connection);
+
+			discardPendingResults();
+			throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(err_msg),
+											ErrorCode::SQLCommandNotExecuted, __exc_origin);
+		}
+
+		unsynced_cmds = 0;
+		pending_syncs++;
+		round_trips++;
+	}
+
+	pending_cmds.removeFirst();
+	sql_res = PQgetResult(connection);
+
+	//Skipping the synchronization points of previous pipelines
+	while(sql_res && PQresultStatus(sql_res) == PGRES_PIPELINE_SYNC)
+	{
+		PQclear(sql_res);
+		pending_syncs--;
+		sql_res = PQgetResult(connection);
+	}
+
+	//Consuming the extra results (if any) until the null pointer that separates the results of each command
+	while(sql_res && (aux_res = PQgetResult(connection)))
+		PQclear(aux_res);
+
+	status = PQresultStatus(sql_res);
+
+	//Raise an error in case the command sql execution is not sucessful
+	if(!sql_res || status == PGRES_FATAL_ERROR ||
+		 status == PGRES_PIPELINE_ABORTED || status == PGRES_BAD_RESPONSE)
+	{
+		QString err_msg = sql_res ? PQresultErrorMessage(sql_res) : PQerrorMessage(connection),
+				field = sql_res ? PQresultErrorField(sql_res, PG_DIAG_SQLSTATE) : "";
+
+		PQclear(sql_res);
+		discardPendingResults();
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(err_msg),
+										ErrorCode::SQLCommandNotExecuted, __exc_origin, nullptr, field);
+	}
+
+	//Leaving the pipeline mode when the last pending result is retrieved
+	if(pending_cmds.isEmpty())
+		discardPendingResults();
+
+	// Initializes the result set with the PG result instance.
+	result.initResultSet(sql_res);
+#else
+	/* When pipeline mode is not available the enqueued commands are
+	 * executed one by one as their results are requested */
+	bool print = print_sql;
+
+	try
+	{
+		QString sql = pending_cmds.takeFirst();
+
+		//Avoiding printing the command twice since it was printed when enqueued
+		print_sql = false;
+		executeDMLCommand(sql, result);
+		print_sql = print;
+	}
+	catch(Exception &e)
+	{
+		print_sql = print;
+		pending_cmds.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
+	}
+#endif
+
+	return true;
+}
+
+void Connection::discardPendingResults()
+{
+#ifdef LIBPQ_HAS_PIPELINING
+	PGresult *sql_res = nullptr;
+
+	if(connection && PQpipelineStatus(connection) != PQ_PIPELINE_OFF)
+	{
+		/* Commands sent after the last synchronization point need one more sync
+		 * otherwise the server will never send back their results */
+		if(unsynced_cmds > 0 && PQpipelineSync(connection) == 1)
+			pending_syncs++;
+
+		while(pending_syncs > 0 && PQstatus(connection) != CONNECTION_BAD)
+		{
+			sql_res = PQgetResult(connection);
+
+			if(sql_res && PQresultStatus(sql_res) == PGRES_PIPELINE_SYNC)
+				pending_syncs--;
+
+			PQclear(sql_res);
+		}
+
+		PQexitPipelineMode(connection);
+		PQsetnonblocking(connection, 0);
+	}
+#endif
+
+	pending_cmds.clear();
+	unsynced_cmds = pending_syncs = 0;
+}
+
+unsigned Connection::getPendingCommandsCount()
+{
+	return pending_cmds.size();
+}
+
+unsigned Connection::getExecutedCommandsCount()
+{
+	return executed_cmds;
+}
+
+unsigned Connection::getRoundTripsCount()
+{
+	return round_trips;
+}
+
+void Connection::resetCommandsStats()
+{
+	executed_cmds = round_trips = 0;
+}
+
+bool Connection::isPipelineSupported()
+{
+#ifdef LIBPQ_HAS_PIPELINING
+	return true;
+#else
+	return false;
+#endif
+}
+
+void Connection::sendStreamedDMLCommand(const QString &sql)
+{
+	//Raise an error in case the user try to send commands using a not opened connection
+	if(!connection)
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
+
+	if(streaming)
+		discardStreamedResults();
+
+	validateConnectionStatus();
+	clearNotices();
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+		qDebug().noquote() << "\n---\n" << sql;
+
+	/* Commands sent inside a transaction block opened by the user can't be cancelled
+	 * since that would abort the whole transaction (see cancelStreamedCommand()) */
+	stream_in_block = PQtransactionStatus(connection) != PQTRANS_IDLE;
+	stream_cancelled = false;
+
+	/* The single-row mode must be activated right after sending the command. We use the extended
+	 * query protocol (PQsendQueryParams) so commands with multiple statements, which would mix
+	 * rows of different results in the same stream, are rejected by the server */
+	if(PQsendQueryParams(connection, sql.toStdString().c_str(), 0,
+											 nullptr, nullptr, nullptr, nullptr, 0) != 1 ||
+		 PQsetSingleRowMode(connection) != 1)
+	{
+		QString err_msg = PQerrorMessage(connection);
+
+		streaming = true;
+		discardStreamedResults();
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(err_msg),
+										ErrorCode::SQLCommandNotExecuted, __exc_origin);
+	}
+
+	executed_cmds++;
+	round_trips++;
+	streaming = true;
+}
+
+bool Connection::getNextStreamedResult(ResultSet &result)
+{
+	PGresult *sql_res = nullptr;
+	ExecStatusType status;
+
+	if(!streaming || !connection)
+		return false;
+
+	sql_res = PQgetResult(connection);
+
+	//A null result indicates that all results of the command were retrieved
+	if(!sql_res)
+	{
+		streaming = false;
+		return false;
+	}
+
+	status = PQresultStatus(sql_res);
+
+	//Raise an error in case the command sql execution is not sucessful
+	if(status == PGRES_FATAL_ERROR || status == PGRES_BAD_RESPONSE)
+	{
+		QString err_msg = PQresultErrorMessage(sql_res),
+				field = PQresultErrorField(sql_res, PG_DIAG_SQLSTATE);
+
+		PQclear(sql_res);
+		discardStreamedResults();
+
+		//The error raised by the server due to cancelStreamedCommand() only signals the end of the rows
+		if(stream_cancelled && field == "57014")
+			return false;
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(err_msg),
+										ErrorCode::SQLCommandNotExecuted, __exc_origin, nullptr, field);
+	}
+
+	// Initializes the result set with the PG result instance.
+	result.initResultSet(sql_res);
+	return true;
+}
+
+void Connection::discardStreamedResults()
+{
+	PGresult *sql_res = nullptr;
+
+	while(streaming && connection && (sql_res = PQgetResult(connection)))
+		PQclear(sql_res);
+
+	streaming = false;
+}
+
+bool Connection::cancelStreamedCommand()
+{
+	if(!streaming || stream_in_block)
+		return false;
+
+	if(!stream_cancelled)
+	{
+		requestCancel();
+		stream_cancelled = true;
+	}
+
+	return true;
+}
+
+bool Connection::isStreaming()
+{
+	return streaming;
+}
+
 void Connection::setDefaultForOperation(ConnOperation op_id, bool value)
 {
 	if(op_id > OpNone)
-		throw Exception(ErrorCode::RefElementInvalidIndex,  __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,  __exc_origin);
 
 	if(op_id != OpNone)
 		default_for_oper[op_id]=value;
@@ -505,7 +849,7 @@ void Connection::setDefaultForOperation(ConnOperation op_id, bool value)
 bool Connection::isDefaultForOperation(ConnOperation op_id)
 {
 	if(op_id > OpNone)
-		throw Exception(ErrorCode::RefElementInvalidIndex,  __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,  __exc_origin);
 
 	if(op_id==OpNone)
 		return false;
@@ -535,7 +879,7 @@ void Connection::switchToDatabase(const QString &dbname)
 		connection_params[ParamDbName]=prev_dbname;
 		connect();
 
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -548,6 +892,10 @@ void Connection::operator = (const Connection &conn)
 	this->connection_params=conn.connection_params;
 	this->connection_str=conn.connection_str;
 	this->connection=nullptr;
+	this->pending_cmds.clear();
+	this->unsynced_cmds=this->pending_syncs=0;
+	this->executed_cmds=this->round_trips=0;
+	this->streaming=false;
 
 	for(unsigned idx=OpValidation; idx <= OpDiff; idx++)
 		default_for_oper[idx]=conn.default_for_oper[idx];
@@ -556,7 +904,7 @@ void Connection::operator = (const Connection &conn)
 void Connection::requestCancel()
 {
 	if(!connection)
-		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __exc_origin);
 
 	PGcancel *cancel = PQgetCancel(connection);
 
@@ -577,6 +925,6 @@ bool Connection::isServerSupported()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
@@ -30,6 +30,7 @@
 #include "attribsmap.h"
 #include <QRegularExpression>
 #include <QDateTime>
+#include <QMutex>
 
 class __libconnector Connection {
 	private:
@@ -56,6 +57,12 @@ class __libconnector Connection {
 		The list is filled only if notice_enabled is true */
 		static QStringList notices;
 
+		//! \brief Serializes the access to the notices list since connections can be used by several threads at once
+		static QMutex notices_mutex;
+
+		//! \brief Clears the list of notices in a thread-safe way
+		static void clearNotices();
+
 		//! \brief Generates the connection string based on the parameter map
 		void generateConnectionString();
 
@@ -92,6 +99,31 @@ class __libconnector Connection {
 		is used if none is explicitly specified by the user in the UI */
 		default_for_oper[4];
 
+		/*! \brief Stores the commands enqueued via sendDMLCommand() which results were not
+		 *  yet retrieved via getNextResult(). The commands are kept in the same order they were sent */
+		QStringList pending_cmds;
+
+		/*! \brief Stores the amount of commands sent to the server after the last pipeline synchronization point
+		 *  and the amount of synchronization points which results were not yet consumed (see getNextResult()) */
+		unsigned unsynced_cmds,	pending_syncs;
+
+		//! \brief Indicates that a command sent via sendStreamedDMLCommand() still has results to be retrieved
+		bool streaming;
+
+		/*! \brief Indicates that the streamed command was cancelled via cancelStreamedCommand() and
+		 *  that it was sent inside a transaction block, in which case it can't be cancelled */
+		bool stream_cancelled, stream_in_block;
+
+		/*! \brief Stores the amount of commands executed in the server and the amount of network round trips
+		 *  used to execute them since the connection was created or resetCommandsStats() was called. Commands
+		 *  sent together in a single pipeline are counted as one round trip (see sendDMLCommand()) */
+		unsigned executed_cmds, round_trips;
+
+		/*! \brief Consumes and discards all the results of the pending commands leaving pipeline mode
+		 *  so the connection can be used again to execute commands. This is called when an error
+		 *  occurs while sending commands or retrieving their results */
+		void discardPendingResults();
+
 		/*! \brief Validates the connection status (command exec. timeout and connection status) and
 		raise errors in case of exceeded timeout or bad connection. This method is called prior any
 		command execution */
@@ -256,6 +288,61 @@ class __libconnector Connection {
 		 to be an data definition one  */
 		void executeDDLCommand(const QString &sql);
 
+		/*! \brief Enqueues a DML command to be executed on the server without waiting for its result.
+		 * Several commands can be enqueued at once and their results are retrieved, in the same order
+		 * they were sent, by calling getNextResult(). When libpq supports pipeline mode (PostgreSQL 14+)
+		 * all enqueued commands are sent in a single pipeline avoiding one network round trip per command.
+		 * Each command must contain a single SQL statement. */
+		void sendDMLCommand(const QString &sql);
+
+		/*! \brief Retrieves the result of the oldest command enqueued via sendDMLCommand() storing it in
+		 * the provided result set. Returns false when there are no pending commands. In case of errors
+		 * the remaining pending commands are discarded and an exception is raised */
+		bool getNextResult(ResultSet &result);
+
+		//! \brief Returns the amount of commands enqueued via sendDMLCommand() which results were not retrieved yet
+		unsigned getPendingCommandsCount();
+
+		//! \brief Returns true when the libpq used to build the connector supports pipeline mode
+		static bool isPipelineSupported();
+
+		//! \brief Returns the amount of commands executed through the connection (see resetCommandsStats())
+		unsigned getExecutedCommandsCount();
+
+		//! \brief Returns the amount of network round trips used to execute the commands (see resetCommandsStats())
+		unsigned getRoundTripsCount();
+
+		//! \brief Resets the executed commands and round trips counters
+		void resetCommandsStats();
+
+		/*! \brief Sends a single DML command to the server in streaming (single-row) mode. Instead of materializing
+		 * the whole result in memory, the rows are retrieved one by one as getNextStreamedResult() is called,
+		 * so the caller is able to handle the first rows while the remaining ones are still being transferred.
+		 * The command is sent through the extended query protocol so it can't contain multiple statements. */
+		void sendStreamedDMLCommand(const QString &sql);
+
+		/*! \brief Retrieves the next result of the command sent via sendStreamedDMLCommand(). Each returned row is stored
+		 * in a single tuple result set (see ResultSet::isSingleTuple()) and the end of the rows is signaled by a result
+		 * with no tuples. Returns false when all the results were retrieved. In case of errors the remaining results are
+		 * discarded and an exception is raised */
+		bool getNextStreamedResult(ResultSet &result);
+
+		/*! \brief Consumes and discards all the remaining results of the command sent via sendStreamedDMLCommand().
+		 * The command is not cancelled, it runs until its end in the server, this way commands that change data
+		 * and return rows (e.g. UPDATE ... RETURNING) have the same effects they would have if all rows were read.
+		 * This method blocks until the server finishes the command, use cancelStreamedCommand() before calling it
+		 * to abort read-only commands */
+		void discardStreamedResults();
+
+		/*! \brief Requests the server to cancel the command sent via sendStreamedDMLCommand() so the remaining rows
+		 * are not transferred. The cancellation error is not raised by getNextStreamedResult(), which just signals the
+		 * end of the results. Returns false, doing nothing, when the command was sent inside a transaction block
+		 * since cancelling it would abort the whole transaction */
+		bool cancelStreamedCommand();
+
+		//! \brief Returns if there's a command sent via sendStreamedDMLCommand() which results were not completely retrieved
+		bool isStreaming();
+
 		//! \brief Toggles the default status for the connect in the specified operation (OP_??? constants).
 		void setDefaultForOperation(ConnOperation op_id, bool value);
 
@@ -40,7 +40,7 @@ ResultSet::~ResultSet()
 void ResultSet::initResultSet(PGresult *sql_res)
 {
     if(!sql_res)
-        throw Exception(ErrorCode::AsgNotAllocatedSQLResult, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+        throw Exception(ErrorCode::AsgNotAllocatedSQLResult, __exc_origin);
 
     int res_state = -1;
 
@@ -53,20 +53,20 @@ void ResultSet::initResultSet(PGresult *sql_res)
     {
         //Generating an error in case the server returns an incomprehensible response
         case PGRES_BAD_RESPONSE:
-            throw Exception(ErrorCode::IncomprehensibleDBMSResponse, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+            throw Exception(ErrorCode::IncomprehensibleDBMSResponse, __exc_origin);
 
         //Generating an error in case the server returns a fatal error
         case PGRES_FATAL_ERROR:
             throw Exception(Exception::getErrorMessage(ErrorCode::DBMSFatalError)
                                 .arg(PQresultErrorMessage(sql_res)),
-                            ErrorCode::DBMSFatalError, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+                            ErrorCode::DBMSFatalError, __exc_origin);
 
         //In case of sucess states the result will be created
         default:
-            /* For any other result set status different from PGRES_TUPLES_OK
+            /* For any other result set status different from PGRES_TUPLES_OK/PGRES_SINGLE_TUPLE
                  * we flag the result set as empty since they either return no tuples
                  * or aren't support at the moment by this class */
-            empty_result = res_state != PGRES_TUPLES_OK;
+            empty_result = res_state != PGRES_TUPLES_OK && res_state != PGRES_SINGLE_TUPLE;
             current_tuple = -1;
         break;
     }
@@ -87,7 +87,7 @@ QString ResultSet::getColumnName(int column_idx)
 {
 	//Throws an error in case the column index is invalid
 	if(column_idx < 0 || column_idx >= getColumnCount())
-		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __exc_origin);
 
 	//Returns the column name on the specified index
     //QString col_name { PQfname(sql_result, column_idx) };
@@ -113,7 +113,7 @@ unsigned ResultSet::getColumnTypeId(int column_idx)
 {
 	//Throws an error in case the column index is invalid
 	if(column_idx < 0 || column_idx >= getColumnCount())
-		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __exc_origin);
 
 	//Returns the column type id on the specified index
 	return static_cast<unsigned>(PQftype(sql_result, column_idx));
@@ -129,7 +129,7 @@ int ResultSet::getColumnIndex(const QString &column_name)
 	/* In case the index is negative indicates that the column doesn't exists in the tuple
 		thus an error will be raised */
 	if(col_idx < 0)
-		throw Exception(ErrorCode::RefTupleColumnInvalidName, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefTupleColumnInvalidName, __exc_origin);
 
 	return col_idx;
 }
@@ -142,9 +142,9 @@ int ResultSet::validateColumnName(const QString &column_name)
 		 a tuple of an empty result or generated from an INSERT, DELETE, UPDATE,
 		 that is, which command do not return lines but only do updates or removal */
 		if(getTupleCount() == 0 || empty_result)
-			throw Exception(ErrorCode::RefInvalidTuple, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+			throw Exception(ErrorCode::RefInvalidTuple, __exc_origin);
 		else if(current_tuple < 0 || current_tuple >= getTupleCount())
-			throw Exception(ErrorCode::RefInvalidTupleColumn, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+			throw Exception(ErrorCode::RefInvalidTupleColumn, __exc_origin);
 
 		//Get the column index through its name
 		return getColumnIndex(column_name);
@@ -152,7 +152,7 @@ int ResultSet::validateColumnName(const QString &column_name)
 	catch(Exception &e)
 	{
 		//Capture and redirect any generated exception
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -166,16 +166,16 @@ void ResultSet::validateColumnIndex(int column_idx)
 {
 	//Raise an error in case the column index is invalid
 	if(column_idx < 0 || column_idx >= getColumnCount())
-		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __exc_origin);
 
 	/* Raises an error if the user try to get the value of a column in
 		a tuple of an empty result or generated from an INSERT, DELETE, UPDATE,
 		that is, which command do not return lines but only do updates or removal */
 	if(getTupleCount() == 0 || empty_result)
-		throw Exception(ErrorCode::RefInvalidTuple, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefInvalidTuple, __exc_origin);
 
 	if(current_tuple < 0 || current_tuple >= getTupleCount())
-		throw Exception(ErrorCode::RefInvalidTupleColumn, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefInvalidTupleColumn, __exc_origin);
 }
 
 char *ResultSet::getColumnValue(int column_idx)
@@ -210,9 +210,9 @@ int ResultSet::getColumnSize(int column_idx)
 {
 	//Raise an error in case the column index is invalid
 	if(column_idx < 0 || column_idx >= getColumnCount())
-		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __exc_origin);
 	else if(current_tuple < 0 || current_tuple >= getTupleCount())
-		throw Exception(ErrorCode::RefInvalidTupleColumn, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefInvalidTupleColumn, __exc_origin);
 
 	//Retorns the column value length on the current tuple
 	return PQgetlength(sql_result, current_tuple, column_idx);
@@ -223,7 +223,7 @@ attribs_map ResultSet::getTupleValues()
 	attribs_map tup_vals;
 
 	if(current_tuple < 0 || current_tuple >= getTupleCount())
-		throw Exception(ErrorCode::RefInvalidTuple, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefInvalidTuple, __exc_origin);
 
 	for(int col=0; col < getColumnCount(); col++)
 		tup_vals[getColumnName(col)]=getColumnValue(col);
@@ -263,7 +263,7 @@ bool ResultSet::isColumnBinaryFormat(const QString &column_name)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 
 	/* Returns the column format in the current tuple.
@@ -276,7 +276,7 @@ bool ResultSet::isColumnBinaryFormat(int column_idx)
 {
 	//Raise an error in case the column index is invalid
 	if(column_idx < 0 || column_idx >= getColumnCount())
-		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __exc_origin);
 
 	/* Returns the column format in the current tuple.
 		According to libpq documentation, value = 0, indicates column text format,
@@ -293,7 +293,7 @@ bool ResultSet::accessTuple(TupleId tuple_id)
 	/* Raises an error if trying to access the tuple with
 	 * an invalid tuple id */
 	if(tuple_id > NextTuple)
-		throw Exception(ErrorCode::RefInvalidTuple, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefInvalidTuple, __exc_origin);
 
 	/* If we have an empty result (generated from a DDL command for example)
 	 * or we have no tuples in the result set (generated from a DML but without returned rows) */
@@ -336,3 +336,8 @@ bool ResultSet::isValid()
 	return (sql_result != nullptr);
 }
 
+bool ResultSet::isSingleTuple()
+{
+	return sql_result && PQresultStatus(sql_result) == PGRES_SINGLE_TUPLE;
+}
+
@@ -131,6 +131,10 @@ class __libconnector ResultSet {
 		//! \brief Returns if the result set is valid (created from a valid result set)
 		bool isValid();
 
+		/*! \brief Returns if the result set holds a single tuple of a command executed in streaming mode
+		 *  (see Connection::sendStreamedDMLCommand()) */
+		bool isSingleTuple();
+
         ResultSet &operator = (const PGresult *) = delete;
         ResultSet &operator = (const ResultSet &) = delete;
 
@@ -73,6 +73,9 @@ HEADERS += src/coreglobal.h \
 	   src/operatorclasselement.h \
 	   src/operatorclass.h \
 	   src/operationlist.h \
+	   src/modeljournal.h \
+	   src/objectrefset.h \
+	   src/objectsobserver.h \
 	   src/tableobject.h \
 	   src/collation.h \
 	   src/excludeelement.h \
@@ -156,6 +159,8 @@ SOURCES +=  src/textbox.cpp \
 	    src/operatorclasselement.cpp \
 	    src/operatorclass.cpp \
 	    src/operationlist.cpp \
+	    src/modeljournal.cpp \
+	    src/objectrefset.cpp \
 	    src/tableobject.cpp \
 	    src/collation.cpp \
 	    src/excludeelement.cpp \
@@ -76,7 +76,7 @@ void BaseFunction::addParameter(Parameter param)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgDuplicatedParameterFunction)
 						.arg(param.getName())
 						.arg(this->signature),
-						ErrorCode::AsgDuplicatedParameterFunction,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgDuplicatedParameterFunction,__exc_origin);
 
 	//Inserts the parameter in the function
 	parameters.push_back(param);
@@ -146,7 +146,7 @@ void BaseFunction::setBasicFunctionAttributes(SchemaParser::CodeType def_type)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -167,7 +167,7 @@ void BaseFunction::setLibrary(const QString &library)
 	if(language->getName().toLower() != DefaultLanguages::C)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgRefLibraryFuncLanguageNotC)
 						.arg(this->getSignature()),
-						ErrorCode::AsgRefLibraryFuncLanguageNotC,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgRefLibraryFuncLanguageNotC,__exc_origin);
 
 	setCodeInvalidated(this->library != library);
 	this->library=library;
@@ -178,7 +178,7 @@ void BaseFunction::setSymbol(const QString &symbol)
 	if(language->getName().toLower() != DefaultLanguages::C)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgRefLibraryFuncLanguageNotC)
 						.arg(this->getSignature()),
-						ErrorCode::AsgRefLibraryFuncLanguageNotC,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgRefLibraryFuncLanguageNotC,__exc_origin);
 
 	setCodeInvalidated(this->symbol != symbol);
 	this->symbol=symbol;
@@ -188,10 +188,10 @@ void BaseFunction::setLanguage(BaseObject *lang)
 {
 	//Raises an error if the language is not allocated
 	if(!lang)
-		throw Exception(ErrorCode::AsgNotAllocatedLanguage,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocatedLanguage,__exc_origin);
 	//Raises an error if the language object is invalid
 	else if(lang->getObjectType()!=ObjectType::Language)
-		throw Exception(ErrorCode::AsgInvalidLanguageObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidLanguageObject,__exc_origin);
 
 	setCodeInvalidated(this->language != lang);
 	this->language=lang;
@@ -223,7 +223,7 @@ void BaseFunction::addTransformTypes(const QStringList &types)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -232,13 +232,13 @@ void BaseFunction::setConfigurationParam(const QString &cfg_param, const QString
 	if(!ConfigParamPattern.match(cfg_param).hasMatch())
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvConfigParameterName).arg(cfg_param).arg(signature),
-										ErrorCode::InvConfigParameterName, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::InvConfigParameterName, __exc_origin);
 	}
 
 	if(value.isEmpty())
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::EmptyConfigParameterValue).arg(cfg_param).arg(signature),
-										ErrorCode::EmptyConfigParameterValue, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::EmptyConfigParameterValue, __exc_origin);
 	}
 
 	config_params[cfg_param] = value;
@@ -261,7 +261,7 @@ void BaseFunction::setFunctionSource(const QString &src_code)
 	if(language && language->getName().toLower() == DefaultLanguages::C)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgSourceCodeFuncCLanguage)
 						.arg(this->getSignature()),
-						ErrorCode::AsgSourceCodeFuncCLanguage,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgSourceCodeFuncCLanguage,__exc_origin);
 
 	setCodeInvalidated(this->func_source != src_code);
 	this->func_source=src_code;
@@ -296,7 +296,7 @@ Parameter BaseFunction::getParameter(unsigned param_idx)
 {
 	//Raises an error if the parameter index is out of bound
 	if(param_idx>=parameters.size())
-		throw Exception(ErrorCode::RefParameterInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefParameterInvalidIndex,__exc_origin);
 
 	return parameters[param_idx];
 }
@@ -353,7 +353,7 @@ void BaseFunction::removeParameter(unsigned param_idx)
 {
 	//Raises an error if parameter index is out of bound
 	if(param_idx>=parameters.size())
-		throw Exception(ErrorCode::RefParameterInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefParameterInvalidIndex,__exc_origin);
 
 	auto itr = parameters.begin() + param_idx;
 	parameters.erase(itr);
@@ -451,7 +451,7 @@ attribs_map BaseFunction::getAlterCodeAttributes(BaseFunction *func)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 
 	return attribs;
@@ -109,7 +109,9 @@ BaseObject::BaseObject()
 	owner=nullptr;
 	tablespace=nullptr;
 	database=nullptr;
+	observer=nullptr;
 	collation=nullptr;
+	fp_info=nullptr;
 	attributes[Attributes::Name]="";
 	attributes[Attributes::Alias]="";
 	attributes[Attributes::Comment]="";
@@ -388,6 +390,17 @@ BaseObject *BaseObject::getDatabase()
 	return this->database;
 }
 
+void BaseObject::setObserver(ObjectsObserver *observer)
+{
+	this->observer = observer;
+}
+
+void BaseObject::notifyNameChanged()
+{
+	if(observer)
+		observer->handleObjectRenamed(this);
+}
+
 void BaseObject::setProtected(bool value)
 {
 	setCodeInvalidated(this->is_protected != value);
@@ -403,23 +416,28 @@ void BaseObject::setName(const QString &name)
 	if(!isValidName(aux_name))
 	{
 		if(aux_name.isEmpty())
-			throw Exception(ErrorCode::AsgEmptyNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgEmptyNameObject,__exc_origin);
 		//If the name is quoted we add 2 bytes to the maximum in order to check if it exceeds the limit
 		else if(aux_name.size() > (ObjectNameMaxLength + (is_quoted ? 2 : 0)))
-			throw Exception(ErrorCode::AsgLongNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgLongNameObject,__exc_origin);
 		else
-			throw Exception(ErrorCode::AsgInvalidNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgInvalidNameObject,__exc_origin);
 	}
 
 	aux_name.remove('"');
 	setCodeInvalidated(this->obj_name!=aux_name);
-	this->obj_name=aux_name;
+
+	if(this->obj_name != aux_name)
+	{
+		this->obj_name=aux_name;
+		notifyNameChanged();
+	}
 }
 
 void BaseObject::setAlias(const QString &alias)
 {
 	if(alias.size() > ObjectNameMaxLength)
-		throw Exception(ErrorCode::AsgLongNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgLongNameObject,__exc_origin);
 
 	this->alias = alias;
 	setCodeInvalidated(this->alias != alias);
@@ -551,6 +569,15 @@ bool BaseObject::acceptsComment(ObjectType obj_type)
 				 obj_type!=ObjectType::Permission;
 }
 
+bool BaseObject::hasDerivedSignature(ObjectType obj_type)
+{
+	return obj_type == ObjectType::Function || obj_type == ObjectType::Procedure ||
+				 obj_type == ObjectType::Aggregate || obj_type == ObjectType::Operator ||
+				 obj_type == ObjectType::Cast || obj_type == ObjectType::OpClass ||
+				 obj_type == ObjectType::OpFamily || obj_type == ObjectType::Transform ||
+				 obj_type == ObjectType::UserMapping || obj_type == ObjectType::Permission;
+}
+
 bool BaseObject::acceptsCustomSQL()
 {
 	return BaseObject::acceptsCustomSQL(this->obj_type);
@@ -596,22 +623,27 @@ void BaseObject::setSchema(BaseObject *schema)
 	if(!schema)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedSchema)
 						.arg(this->obj_name, this->getTypeName()),
-						ErrorCode::AsgNotAllocatedSchema,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgNotAllocatedSchema,__exc_origin);
 	else if(schema && schema->getObjectType()!=ObjectType::Schema)
-		throw Exception(ErrorCode::AsgInvalidSchemaObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidSchemaObject,__exc_origin);
 	else if(!acceptsSchema())
-		throw Exception(ErrorCode::AsgInvalidSchemaObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidSchemaObject,__exc_origin);
 
 	setCodeInvalidated(this->schema != schema);
-	this->schema = schema;
+
+	if(this->schema != schema)
+	{
+		this->schema = schema;
+		notifyNameChanged();
+	}
 }
 
 void BaseObject::setOwner(BaseObject *owner)
 {
 	if(owner && owner->getObjectType()!=ObjectType::Role)
-		throw Exception(ErrorCode::AsgInvalidRoleObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidRoleObject,__exc_origin);
 	else if(!acceptsOwner())
-		throw Exception(ErrorCode::AsgRoleObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgRoleObjectInvalidType,__exc_origin);
 
 	setCodeInvalidated(this->owner != owner);
 	this->owner = owner;
@@ -620,9 +652,9 @@ void BaseObject::setOwner(BaseObject *owner)
 void BaseObject::setTablespace(BaseObject *tablespace)
 {
 	if(tablespace && tablespace->getObjectType()!=ObjectType::Tablespace)
-		throw Exception(ErrorCode::AsgInvalidTablespaceObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidTablespaceObject,__exc_origin);
 	else if(!acceptsTablespace())
-		throw Exception(ErrorCode::AsgTablespaceInvalidObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgTablespaceInvalidObject,__exc_origin);
 
 	setCodeInvalidated(this->tablespace != tablespace);
 	this->tablespace = tablespace;
@@ -631,9 +663,9 @@ void BaseObject::setTablespace(BaseObject *tablespace)
 void BaseObject::setCollation(BaseObject *collation)
 {
 	if(collation && !acceptsCollation())
-		throw Exception(ErrorCode::AsgInvalidCollationObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidCollationObject,__exc_origin);
 	if(collation && collation->getObjectType()!=ObjectType::Collation)
-		throw Exception(ErrorCode::AsgInvalidCollationObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidCollationObject,__exc_origin);
 
 	setCodeInvalidated(this->collation != collation);
 	this->collation = collation;
@@ -642,7 +674,7 @@ void BaseObject::setCollation(BaseObject *collation)
 void BaseObject::setAppendedSQL(const QString &sql)
 {
 	if(!acceptsCustomSQL())
-		throw Exception(ErrorCode::AsgCustomSQLObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgCustomSQLObjectInvalidType,__exc_origin);
 
 	setCodeInvalidated(this->appended_sql != sql);
 	this->appended_sql=sql;
@@ -651,7 +683,7 @@ void BaseObject::setAppendedSQL(const QString &sql)
 void BaseObject::setPrependedSQL(const QString &sql)
 {
 	if(!acceptsCustomSQL())
-		throw Exception(ErrorCode::AsgCustomSQLObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgCustomSQLObjectInvalidType,__exc_origin);
 
 	setCodeInvalidated(this->prepended_sql != sql);
 	this->prepended_sql=sql;
@@ -690,7 +722,10 @@ QString BaseObject::getName(bool format, bool prepend_schema)
 		}
 	}
 
-	cached_names[name_id] = obj_name;
+	//Empty names aren't cached otherwise they'd be written again in every call
+	if(!obj_name.isEmpty())
+		cached_names[name_id] = obj_name;
+
 	return obj_name;
 }
 
@@ -837,7 +872,11 @@ QString BaseObject::getSourceCode(SchemaParser::CodeType def_type, bool reduced_
 			(def_type==SchemaParser::XmlCode &&
 			 obj_type!=ObjectType::BaseObject && obj_type!=ObjectType::BaseTable))
 	{
-		bool format=false;
+		bool format=false,
+
+				/* When computing the fingerprint the comment and the custom SQL are hashed in raw
+				 * form and the object's code itself isn't generated (see getCodeFingerprint()) */
+				gen_fingerprint=(fp_info && def_type==SchemaParser::XmlCode);
 
 		schparser.setPgSQLVersion(BaseObject::pgsql_ver, ignore_db_version);
 		attributes[Attributes::SqlDisabled]=(sql_disabled ? Attributes::True : "");
@@ -909,23 +948,26 @@ QString BaseObject::getSourceCode(SchemaParser::CodeType def_type, bool reduced_
 			else
 				attributes[Attributes::Comment]=comment;
 
-			schparser.ignoreUnkownAttributes(true);
+			if(!gen_fingerprint)
+			{
+				schparser.ignoreUnkownAttributes(true);
 
-			attributes[Attributes::Comment]=
-					schparser.getSourceCode(Attributes::Comment, attributes, def_type);
+				attributes[Attributes::Comment]=
+						schparser.getSourceCode(Attributes::Comment, attributes, def_type);
+			}
 		}
 
 		if(!appended_sql.isEmpty())
 		{
 			attributes[Attributes::AppendedSql]=appended_sql;
 
-			if(def_type==SchemaParser::XmlCode)
+			if(def_type==SchemaParser::XmlCode && !gen_fingerprint)
 			{
 				schparser.ignoreUnkownAttributes(true);
 				attributes[Attributes::AppendedSql]=
 						schparser.getSourceCode(QString(Attributes::AppendedSql).remove('-'), attributes, def_type);
 			}
-			else
+			else if(def_type==SchemaParser::SqlCode)
 			{
 				attributes[Attributes::AppendedSql]="\n-- Appended SQL commands --\n" + appended_sql;
 			}
@@ -935,13 +977,13 @@ QString BaseObject::getSourceCode(SchemaParser::CodeType def_type, bool reduced_
 		{
 			attributes[Attributes::PrependedSql]=prepended_sql;
 
-			if(def_type==SchemaParser::XmlCode)
+			if(def_type==SchemaParser::XmlCode && !gen_fingerprint)
 			{
 				schparser.ignoreUnkownAttributes(true);
 				attributes[Attributes::PrependedSql]=
 						schparser.getSourceCode(QString(Attributes::PrependedSql).remove('-'), attributes, def_type);
 			}
-			else
+			else if(def_type==SchemaParser::SqlCode)
 			{
 				attributes[Attributes::PrependedSql]="\n-- Prepended SQL commands --\n" + prepended_sql;
 			}
@@ -957,6 +999,13 @@ QString BaseObject::getSourceCode(SchemaParser::CodeType def_type, bool reduced_
 
 		try
 		{
+			if(gen_fingerprint)
+			{
+				fp_info->hash = hashAttributes(*fp_info->ignored_attribs, *fp_info->ignored_tags);
+				clearAttributes();
+				return "";
+			}
+
 			code_def+=schparser.getSourceCode(objs_schemas[enum_t(obj_type)], attributes, def_type);
 
 			//Internally disabling the SQL definition
@@ -995,9 +1044,9 @@ QString BaseObject::getSourceCode(SchemaParser::CodeType def_type, bool reduced_
 				throw Exception(Exception::getErrorMessage(ErrorCode::AsgObjectInvalidDefinition)
 								.arg(this->getName(true))
 								.arg(this->getTypeName()),
-								ErrorCode::AsgObjectInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+								ErrorCode::AsgObjectInvalidDefinition,__exc_origin,&e);
 			else
-				throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+				throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 		}
 	}
 
@@ -1027,11 +1076,11 @@ void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_
 {
 	//Raises an error if some of the objects aren't allocated
 	if(!obj1 || !obj2)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	//Raises an error if the involved objects are the same
 	if(obj1==obj2)
-		throw Exception(ErrorCode::InvIdSwapSameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InvIdSwapSameObject,__exc_origin);
 
 	//Raises an error if the some of the objects are system objects
 	if(obj1->isSystemObject())
@@ -1039,7 +1088,7 @@ void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_
 		throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 						.arg(obj1->getName())
 						.arg(obj1->getTypeName()),
-						ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::OprReservedObject,__exc_origin);
 	}
 
 	if(obj2->isSystemObject())
@@ -1047,7 +1096,7 @@ void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_
 		throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 						.arg(obj2->getName())
 						.arg(obj2->getTypeName()),
-						ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::OprReservedObject,__exc_origin);
 	}
 
 	//Raises an error if the object is object is cluster level and the swap of these types isn't enabled
@@ -1058,26 +1107,34 @@ void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_
 
 		 obj1->getObjectType() != obj2->getObjectType())
 	{
-		throw Exception(ErrorCode::InvIdSwapInvalidObjectType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InvIdSwapInvalidObjectType,__exc_origin);
 	}
 
 	unsigned id_bkp=obj1->object_id;
 	obj1->object_id=obj2->object_id;
 	obj2->object_id=id_bkp;
+
+	/* The ids define the creation order of the objects so their codes are invalidated
+	 * in order to notify the observers (see ModelJournal) about the new order */
+	obj1->setCodeInvalidated(true);
+	obj2->setCodeInvalidated(true);
 }
 
 void BaseObject::updateObjectId(BaseObject *obj)
 {
 	//Raises an error if some of the objects aren't allocated
 	if(!obj)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 	else  if(obj->isSystemObject())
 		throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 						.arg(obj->getName())
 						.arg(obj->getTypeName()),
-						ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::OprReservedObject,__exc_origin);
 	else
+	{
 		obj->object_id=++global_id;
+		obj->setCodeInvalidated(true);
+	}
 }
 
 std::vector<ObjectType> BaseObject::getObjectTypes(bool inc_table_objs, std::vector<ObjectType> exclude_types)
@@ -1166,7 +1223,7 @@ void BaseObject::setPgSQLVersion(const QString &version)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -1218,10 +1275,11 @@ void BaseObject::operator = (BaseObject &obj)
 	this->sql_disabled=obj.sql_disabled;
 	this->system_obj=obj.system_obj;
 	this->setCodeInvalidated(true);
+	notifyNameChanged();
 	//updateDependencies();
 }
 
-void BaseObject::setCodeInvalidated(bool value)
+void BaseObject::setCodeInvalidated(bool value, bool notify)
 {
 	if(value != code_invalidated)
 	{
@@ -1237,9 +1295,24 @@ void BaseObject::setCodeInvalidated(bool value)
 
 	if(value)
 	{
+		/* The fingerprints are computed without generating the code (see getCodeFingerprint()),
+		 * so they are discarded even if the code is already invalidated */
+		cached_fingerprints.clear();
+
+		/* The invalidation is notified even if the code is already invalidated since the object
+		 * can be modified again before its code is regenerated */
+		if(observer && notify)
+			observer->handleObjectInvalidated(this);
+
 		cached_names[RawName].clear();
 		cached_names[FmtName].clear();
 		cached_names[Signature].clear();
+
+		/* Objects which signatures are derived from other attributes (e.g. function's parameters
+		 * or cast's data types) can have them changed without calling setName(), so any
+		 * invalidation of these objects must be notified to the database */
+		if(notify && hasDerivedSignature(obj_type))
+			notifyNameChanged();
 	}
 }
 
@@ -1260,70 +1333,171 @@ bool BaseObject::isCodeInvalidated()
 
 bool BaseObject::isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const QStringList &ignored_attribs, const QStringList &ignored_tags)
 {
-	QString xml, tag=QString("<%1").arg(this->getSchemaName()),
-			attr_regex=QString("(%1=\")"),
-			tag_regex=QString("<%1[^>]*((/>)|(>((?:(?!</%1>).)*)</%1>))");
-	QStringList xml_defs{ xml_def1, xml_def2 };
-	int start=0, end=-1, tag_end=-1;
-	QRegularExpression regexp, tag_end_regexp("(\\\\)?(>)");
-	QRegularExpressionMatch match;
+	return removeIgnoredCode(xml_def1, ignored_attribs, ignored_tags) !=
+				 removeIgnoredCode(xml_def2, ignored_attribs, ignored_tags);
+}
 
-	for(int i=0; i < 2; i++)
+QString BaseObject::removeIgnoredCode(const QString &xml_def, const QStringList &ignored_attribs, const QStringList &ignored_tags)
+{
+	QString xml = xml_def.simplified(), attr_start, open_tag, close_tag;
+	qsizetype start = -1, end = -1, tag_end = -1, pos = 0;
+
+	//Removing ignored attributes of the root element
+	for(auto &attr : ignored_attribs)
 	{
-		xml=xml_defs[i].simplified();
+		attr_start = attr + "=\"";
 
-		//Removing ignored attributes
-		for(auto &attr : ignored_attribs)
+		do
 		{
-			do
-			{
-				regexp.setPattern(attr_regex.arg(attr));
-				tag_end = xml.indexOf(tag_end_regexp);
+			tag_end = xml.indexOf('>');
+
+			if(tag_end > 0 && xml.at(tag_end - 1) == '\\')
+				tag_end--;
+
+			start = xml.indexOf(attr_start);
+			end = start >= 0 ? xml.indexOf('"', start + attr_start.size()) : -1;
+
+			if(end > tag_end)
+				end = -1;
+
+			if(start >= 0 && end >= 0)
+				xml.remove(start, (end - start) + 1);
+		}
+		while(start >= 0 && end >= 0);
+	}
+
+	/* Removing ignored tags, either in the form <tag ... /> or <tag ...> ... </tag>,
+	 * in the latter the element ends in the first closing tag found */
+	for(auto &tag : ignored_tags)
+	{
+		open_tag = "<" + tag;
+		close_tag = "</" + tag + ">";
+		pos = 0;
 
-				match = regexp.match(xml);
-				start = match.capturedStart();
-				end=xml.indexOf('"', start + match.capturedLength());
+		while((start = xml.indexOf(open_tag, pos)) >= 0)
+		{
+			tag_end = xml.indexOf('>', start + open_tag.size());
+
+			if(tag_end < 0)
+				break;
+
+			if(xml.at(tag_end - 1) == '/' && tag_end - 1 >= start + open_tag.size())
+				end = tag_end + 1;
+			else
+			{
+				end = xml.indexOf(close_tag, tag_end + 1);
 
-				if(end > tag_end)
-					end=-1;
+				if(end < 0)
+				{
+					pos = start + 1;
+					continue;
+				}
 
-				if(start >=0 && end >=0)
-					xml.remove(start, (end - start) + 1);
+				end += close_tag.size();
 			}
-			while(start >= 0 && end >= 0);
+
+			xml.remove(start, end - start);
+			pos = start;
 		}
+	}
+
+	return xml.simplified();
+}
+
+QByteArray BaseObject::hashAttributes(const QStringList &ignored_attribs, const QStringList &ignored_tags)
+{
+	QCryptographicHash hash(QCryptographicHash::Md5);
+	QString value;
+
+	auto add_data = [&hash](const QString &str) {
+		hash.addData(QByteArray::fromRawData(reinterpret_cast<const char *>(str.constData()), str.size() * sizeof(QChar)));
+		hash.addData(QByteArray(1, '\0'));
+	};
+
+	add_data(objs_schemas[enum_t(obj_type)]);
+
+	for(auto &[attr, val] : attributes)
+	{
+		/* The ref-type is configured by the objects that reference this one (e.g. aggregates and languages)
+		 * and only appears in the reduced form, so it's left out otherwise the fingerprint would depend
+		 * on which referrer had its code generated last */
+		if(val.isEmpty() || attr == Attributes::RefType ||
+			 ignored_attribs.contains(attr) || ignored_tags.contains(attr))
+			continue;
+
+		value = val.contains('<') ? removeIgnoredCode(val, {}, ignored_tags) : val.simplified();
+
+		if(value.isEmpty())
+			continue;
+
+		add_data(attr);
+		add_data(value);
+	}
+
+	return hash.result();
+}
 
-		//Removing ignored tags
-		for(auto &tag : ignored_tags)
-			xml.remove(QRegularExpression(tag_regex.arg(tag)));
+QByteArray BaseObject::getCodeFingerprint(const QStringList &ignored_attribs, const QStringList &ignored_tags)
+{
+	QString mask_id = pgsql_ver + "|" + ignored_attribs.join(',') + "|" + ignored_tags.join(','), xml;
+	FingerprintInfo fp { &ignored_attribs, &ignored_tags, {} };
+
+	if(cached_fingerprints.count(mask_id))
+		return cached_fingerprints.at(mask_id);
 
-		xml_defs[i]=xml.simplified();
+	try
+	{
+		fp_info = &fp;
+		xml = getSourceCode(SchemaParser::XmlCode);
+		fp_info = nullptr;
+	}
+	catch(Exception &e)
+	{
+		fp_info = nullptr;
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 
-	return (xml_defs[0]!=xml_defs[1]);
+	if(fp.hash.isEmpty())
+	{
+		xml = removeIgnoredCode(xml, ignored_attribs, ignored_tags);
+		fp.hash = QCryptographicHash::hash(QByteArray::fromRawData(reinterpret_cast<const char *>(xml.constData()),
+																																 xml.size() * sizeof(QChar)),
+																			 QCryptographicHash::Md5);
+	}
+
+	//Database object doesn't handles cached code.
+	if(obj_type != ObjectType::Database)
+		cached_fingerprints[mask_id] = fp.hash;
+
+	return fp.hash;
 }
 
 bool BaseObject::isCodeDiffersFrom(BaseObject *object, const QStringList &ignored_attribs, const QStringList &ignored_tags)
 {
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 	else if(object->getObjectType()!=this->getObjectType())
-		throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprObjectInvalidType,__exc_origin);
 
 	try
 	{
-		return BaseObject::isCodeDiffersFrom(this->getSourceCode(SchemaParser::XmlCode),
-											 object->getSourceCode(SchemaParser::XmlCode),
-											 ignored_attribs, ignored_tags);
+		return getCodeFingerprint(ignored_attribs, ignored_tags) !=
+					 object->getCodeFingerprint(ignored_attribs, ignored_tags);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 QString BaseObject::getCachedCode(unsigned def_type, bool reduced_form)
 {
+	/* The code must pass through getSourceCode() while the fingerprint is being computed.
+	 * The reduced form is used by the referrers of the object, so it's returned as usual
+	 * and the fingerprint being computed isn't even checked in that case */
+	if(def_type==SchemaParser::XmlCode && !reduced_form && fp_info)
+		return "";
+
 	if(def_type==SchemaParser::SqlCode && schparser.getPgSQLVersion()!=BaseObject::pgsql_ver)
 		code_invalidated=true;
 
@@ -1369,7 +1543,7 @@ QString BaseObject::getDropCode(bool cascade)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1387,7 +1561,7 @@ QString BaseObject::getAlterCode(QString sch_name, attribs_map &attribs, bool ig
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1411,12 +1585,12 @@ QString BaseObject::getAlterCode(BaseObject *object)
 QString BaseObject::getAlterCode(BaseObject *object, bool ignore_name_diff)
 {
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	QString alter;
 
 	if(object->obj_type!=this->obj_type)
-		throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprObjectInvalidType,__exc_origin);
 
 	setBasicAttributes(true);
 
@@ -1449,7 +1623,7 @@ QString BaseObject::getAlterCode(BaseObject *object, bool ignore_name_diff)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 
 	return alter;
@@ -1481,7 +1655,7 @@ QString BaseObject::getAlterCommentDefinition(BaseObject *object, attribs_map at
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1498,20 +1672,20 @@ std::vector<BaseObject*> BaseObject::getReferences(bool inc_indirect_refs, const
 std::vector<BaseObject *> BaseObject::getLinkedObjects(ObjLinkType lnk_type, bool incl_ind_links, const std::vector<ObjectType> &excl_types, bool rem_duplicates)
 {
 	std::vector<BaseObject *> linked_objs,
-			*obj_list =	(lnk_type == ObjDependencies ? &object_deps : &object_refs);
+			obj_list =	(lnk_type == ObjDependencies ? object_deps.toVector() : object_refs.toVector());
 
 	if(incl_ind_links)
 	{
-		__getLinkedObjects(lnk_type, *obj_list, linked_objs);
+		__getLinkedObjects(lnk_type, obj_list, linked_objs);
 
 		if(!excl_types.empty())
 			linked_objs = CoreUtilsNs::filterObjectsByType(linked_objs, excl_types);
 	}
 
 	if(!excl_types.empty())
-		linked_objs = CoreUtilsNs::filterObjectsByType(*obj_list, excl_types);
+		linked_objs = CoreUtilsNs::filterObjectsByType(obj_list, excl_types);
 	else
-		linked_objs = *obj_list;
+		linked_objs = std::move(obj_list);
 
 	if(rem_duplicates)
 	{
@@ -1539,7 +1713,7 @@ void BaseObject::setDependency(BaseObject* dep_obj)
 	if(!dep_obj)
 		return;
 
-	object_deps.push_back(dep_obj);
+	object_deps.insert(dep_obj);
 	dep_obj->setReference(this);
 }
 
@@ -1548,7 +1722,7 @@ void BaseObject::setReference(BaseObject *ref_obj)
 	if(!ref_obj)
 		return;
 
-	object_refs.push_back(ref_obj);
+	object_refs.insert(ref_obj);
 }
 
 void BaseObject::unsetReference(BaseObject *ref_obj)
@@ -1556,10 +1730,7 @@ void BaseObject::unsetReference(BaseObject *ref_obj)
 	if(!ref_obj)
 		return;
 
-	auto itr = std::find(object_refs.begin(), object_refs.end(), ref_obj);
-
-	if(itr != object_refs.end())
-		object_refs.erase(itr);
+	object_refs.remove(ref_obj);
 }
 
 void BaseObject::unsetDependency(BaseObject *dep_obj)
@@ -1567,13 +1738,8 @@ void BaseObject::unsetDependency(BaseObject *dep_obj)
 	if(!dep_obj)
 		return;
 
-	auto itr = std::find(object_deps.begin(), object_deps.end(), dep_obj);
-
-	if(itr != object_deps.end())
-	{
+	if(object_deps.remove(dep_obj))
 		dep_obj->unsetReference(this);
-		object_deps.erase(itr);
-	}
 }
 
 void BaseObject::setClearDepsInDtor(bool value)
@@ -1586,7 +1752,7 @@ void BaseObject::clearDependencies()
 	if(object_deps.empty() && object_refs.empty())
 		return;
 
-	for(auto &obj : object_deps)
+	for(auto *obj : object_deps)
 		obj->unsetReference(this);
 
 	object_deps.clear();
@@ -1594,10 +1760,14 @@ void BaseObject::clearDependencies()
 
 void BaseObject::clearReferences()
 {
-	for(auto &obj : object_refs)
-		obj->unsetDependency(this);
+	/* The list is cleared before unsetting the dependencies since
+	 * unsetDependency() also removes the referrer from object_refs */
+	std::vector<BaseObject *> refs = object_refs.toVector();
 
 	object_refs.clear();
+
+	for(auto &obj : refs)
+		obj->unsetDependency(this);
 }
 
 void BaseObject::clearAllDepsRefs()
@@ -1613,7 +1783,7 @@ bool BaseObject::isReferenced()
 
 bool BaseObject::isReferencedBy(BaseObject *ref_obj)
 {
-	return std::find(object_refs.begin(), object_refs.end(), ref_obj) != object_refs.end();
+	return object_refs.contains(ref_obj);
 }
 
 bool BaseObject::hasDependencies()
@@ -1623,7 +1793,7 @@ bool BaseObject::hasDependencies()
 
 bool BaseObject::isDependingOn(BaseObject *dep_obj)
 {
-	return std::find(object_deps.begin(), object_deps.end(), dep_obj) != object_deps.end();
+	return object_deps.contains(dep_obj);
 }
 
 void BaseObject::updateDependencies()
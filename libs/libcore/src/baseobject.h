@@ -35,6 +35,8 @@
 #include "enumtype.h"
 #include "exception.h"
 #include "pgsqlversions.h"
+#include "objectrefset.h"
+#include "objectsobserver.h"
 
 enum class ObjectType: unsigned {
 	Column,
@@ -102,8 +104,12 @@ class __libcore BaseObject {
 		//! \brief Stores the database wich the object belongs
 		BaseObject *database;
 
+		/*! \brief Stores the observer notified about the renaming and modifications of the object (see setObserver()).
+		 *  Copies of the object share the same observer so this one must ignore the objects it doesn't know */
+		ObjectsObserver *observer;
+
 		//! \brief Stores the objects that references the "this" object
-		std::vector<BaseObject *> object_refs,
+		ObjectRefSet object_refs,
 
 		//! \brief Stores the objects that "this" object depends on to create a valid SQL code
 		object_deps;
@@ -172,7 +178,9 @@ class __libcore BaseObject {
 		//! \brief Stores the cached xml and sql code
 		QString cached_code[2],
 
-		//! \brief Stores the xml code in reduced form
+		/*! \brief Stores the xml code in reduced form. This is the code used by the objects that reference this one,
+		 *  so once it's cached (along with the names below) generating the code of the referrers doesn't
+		 *  change this object. This allows objects to be compared by different threads (see ModelsDiffHelper) */
 		cached_reduced_code,
 
 		/*! \brief Store the cached names of the object (raw name, formated name, signature)
@@ -180,6 +188,22 @@ class __libcore BaseObject {
 		 *  need to be retrieved, improving the overall perfomance */
 		cached_names[3];
 
+		/*! \brief Stores the fingerprints computed in getCodeFingerprint(). The key is an identifier of the
+		 *  PostgreSQL version and the ignored attributes and tags used to compute each fingerprint.
+		 *  The fingerprints are discarded every time the code is invalidated (see setCodeInvalidated()) */
+		std::map<QString, QByteArray> cached_fingerprints;
+
+		//! \brief Holds the ignored attributes/tags and the resulting hash of the fingerprint being computed
+		struct FingerprintInfo {
+			const QStringList *ignored_attribs, *ignored_tags;
+			QByteArray hash;
+		};
+
+		/*! \brief References the fingerprint being computed by getCodeFingerprint(). While it's set, the cached
+		 *  xml code is ignored and getSourceCode() hashes the attributes passed to the schema parser instead of
+		 *  generating the xml code (see hashAttributes()) */
+		FingerprintInfo *fp_info;
+
 		//! \brief References the cached names entries
 		enum CachedNameId: unsigned {
 			RawName, // Original name without formatting (double-quotes)
@@ -261,6 +285,14 @@ class __libcore BaseObject {
 							 if the user calls getDatabase() in further operations may result in crash */
 		void setDatabase(BaseObject *db);
 
+		//! \brief Set the observer notified about the renaming and modifications of the object
+		void setObserver(ObjectsObserver *observer);
+
+		/*! \brief Notifies the observer of the object (see setObserver()) that the
+		 *  name, the schema or the signature of the object may have changed. This is used by
+		 *  the database model to keep its names index up to date (see DatabaseModel::getObject()) */
+		void notifyNameChanged();
+
 		/*! \brief Swap the the ids of the specified objects. The method will raise errors if the objects are the same,
 		or some of them are system object. The boolean param enables the id swap between ordinary object and
 		cluster level objects (database, tablespace and roles). */
@@ -276,6 +308,11 @@ class __libcore BaseObject {
 		 string in case of no code is cached */
 		QString getCachedCode(unsigned def_type, bool reduced_form);
 
+		/*! \brief Returns a 128-bit (MD5) hash of the non-empty attributes of the object except the ones named as the ignored
+		 *  attributes or tags. The ignored tags are also removed from the values that contain xml code (e.g. the reduced
+		 *  form of the owner or the code of the columns of a table). The values are simplified before hashing */
+		QByteArray hashAttributes(const QStringList &ignored_attribs, const QStringList &ignored_tags);
+
 		/*! \brief Configures the DIF_SQL attribute depending on the type of the object. This attribute is used to know how
 		ALTER, COMMENT and DROP commands must be generated. Refer to schema files for comments, drop and alter. */
 		void setBasicAttributes(bool format_name);
@@ -284,6 +321,10 @@ class __libcore BaseObject {
 	and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed */
 		bool isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const QStringList &ignored_attribs, const QStringList &ignored_tags);
 
+		/*! \brief Removes the ignored attributes (only in the root element) and ignored tags from the provided xml buffer
+		 *  returning the simplified resulting code. This is the code used to compare two objects (see isCodeDiffersFrom()) */
+		static QString removeIgnoredCode(const QString &xml_def, const QStringList &ignored_attribs, const QStringList &ignored_tags);
+
 		/*! \brief Copies the non-empty attributes on the map at parameter to the own object attributes map. This method is used
 		as an auxiliary when generating alter definition for some objects. When one or more attributes are copied an especial
 		attribute is inserted (HAS_CHANGES) in order to help the atler generatin process to identify which attributes are
@@ -552,6 +593,10 @@ class __libcore BaseObject {
 		//! \brief Returns if the specified type accepts comment
 		static bool acceptsComment(ObjectType obj_type);
 
+		/*! \brief Returns if the signature of the objects of the specified type is derived from attributes
+		 *  other than the name and schema (e.g. function's parameters or cast's data types) */
+		static bool hasDerivedSignature(ObjectType obj_type);
+
 		//! \brief Returns if the object accepts to have a schema assigned
 		bool acceptsSchema();
 
@@ -592,8 +637,10 @@ class __libcore BaseObject {
 				Some key attributes / setters in the base classes BaseObject, BaseTable and BaseRelationship
 				will automatically invalidate the code but for all other setters / attributes the user must call
 				this method explicitly in order to force the regeneration of the code.
-				This method has no effect when the cached code support is disables. See enableCachedCode() */
-		virtual void setCodeInvalidated(bool value);
+				This method has no effect when the cached code support is disables. See enableCachedCode().
+				The notify parameter must be false when the code is invalidated without any change in the object
+				(e.g. bulk cache resets) so the invalidation isn't reported to the observer as a modification */
+		virtual void setCodeInvalidated(bool value, bool notify = true);
 
 		virtual void configureSearchAttributes();
 
@@ -604,6 +651,12 @@ class __libcore BaseObject {
 		and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed */
 		virtual bool isCodeDiffersFrom(BaseObject *object, const QStringList &ignored_attribs={}, const QStringList &ignored_tags={});
 
+		/*! \brief Returns a fingerprint of the xml code of the object without the ignored attributes and tags. Instead of generating
+		 *  the code, the attributes that the schema parser would receive are hashed (see hashAttributes()). Objects which code isn't
+		 *  generated by BaseObject::getSourceCode() have their xml code hashed instead. The fingerprint is cached until the code
+		 *  of the object is invalidated, so unchanged objects are compared without configuring their attributes again */
+		QByteArray getCodeFingerprint(const QStringList &ignored_attribs={}, const QStringList &ignored_tags={});
+
 		/*! \brief Returns the valid object types in a vector. The types
 		ObjectType::ObjBaseObject, TYPE_ATTRIBUTE and ObjectType::ObjBaseTable aren't included in return vector.
 		By default table objects (columns, trigger, constraints, etc) are included. To
@@ -24,7 +24,7 @@
 BaseRelationship::BaseRelationship(BaseRelationship *rel)
 {
 	if(!rel)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	for(unsigned i=0; i < 3; i++)
 		lables[i]=nullptr;
@@ -72,7 +72,7 @@ BaseRelationship::BaseRelationship(RelType rel_type, BaseTable *src_tab, BaseTab
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -132,12 +132,12 @@ void BaseRelationship::configureRelationship()
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedTable)
 							.arg(this->getName())
 							.arg(BaseObject::getTypeName(ObjectType::BaseRelationship)),
-							ErrorCode::AsgNotAllocatedTable,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgNotAllocatedTable,__exc_origin);
 
 		/* Raises an error if the relationship type is generalization or dependency
 			and the source and destination table are the same. */
 		if((rel_type==RelationshipGen || rel_type==RelationshipDep || rel_type==RelationshipPart) && src_table==dst_table)
-			throw Exception(ErrorCode::InvInheritCopyPartRelationship,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::InvInheritCopyPartRelationship,__exc_origin);
 
 		//Allocates the textbox for the name label
 		lables[RelNameLabel]=new Textbox;
@@ -160,7 +160,7 @@ void BaseRelationship::configureRelationship()
 	}
 	else
 		//Raises an error if the specified relationship typ is invalid
-		throw Exception(ErrorCode::AllocationObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AllocationObjectInvalidType,__exc_origin);
 }
 
 BaseRelationship::~BaseRelationship()
@@ -189,7 +189,7 @@ void BaseRelationship::setName(const QString &name)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -205,7 +205,7 @@ void BaseRelationship::setMandatoryTable(TableId table_id, bool value)
 	if(rel_type==Relationship11 &&
 			((table_id==SrcTable && value && dst_mandatory) ||
 			 (table_id==DstTable && value && src_mandatory)))
-		throw Exception(ErrorCode::NotImplementedRelationshipType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::NotImplementedRelationshipType,__exc_origin);
 
 	//Case the source table is mandatory
 	if(table_id==SrcTable)
@@ -317,7 +317,7 @@ void BaseRelationship::connectRelationship()
 Textbox *BaseRelationship::getLabel(LabelId label_id)
 {
 	if(label_id > RelNameLabel)
-		throw Exception(ErrorCode::RefLabelInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefLabelInvalidIndex,__exc_origin);
 
 	return lables[label_id];
 }
@@ -388,6 +388,9 @@ void BaseRelationship::setRelationshipAttributes()
 
 QString BaseRelationship::getCachedCode(unsigned def_type)
 {
+	if(fp_info && def_type==SchemaParser::XmlCode)
+		return "";
+
 	if(!code_invalidated &&
 			((!cached_code[def_type].isEmpty()) ||
 			 (def_type==SchemaParser::XmlCode  && !cached_reduced_code.isEmpty())))
@@ -493,7 +496,7 @@ void BaseRelationship::setPoints(const std::vector<QPointF> &points)
 void BaseRelationship::setLabelDistance(LabelId label_id, QPointF label_dist)
 {
 	if(label_id > RelNameLabel)
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	lables_dist[label_id]=label_dist;
 	setCodeInvalidated(true);
@@ -502,7 +505,7 @@ void BaseRelationship::setLabelDistance(LabelId label_id, QPointF label_dist)
 QPointF BaseRelationship::getLabelDistance(LabelId label_id)
 {
 	if(label_id > RelNameLabel)
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	return lables_dist[label_id];
 }
@@ -608,13 +611,13 @@ void BaseRelationship::updateDependencies()
 	BaseObject::updateDependencies({ src_table, dst_table });
 }
 
-void BaseRelationship::setCodeInvalidated(bool value)
+void BaseRelationship::setCodeInvalidated(bool value, bool notify)
 {
 	if(src_table)
-		src_table->setCodeInvalidated(value);
+		src_table->setCodeInvalidated(value, notify);
 
 	if(dst_table)
-		dst_table->setCodeInvalidated(value);
+		dst_table->setCodeInvalidated(value, notify);
 
-	BaseGraphicObject::setCodeInvalidated(value);
+	BaseGraphicObject::setCodeInvalidated(value, notify);
 }
@@ -178,7 +178,7 @@ class __libcore BaseRelationship: public BaseGraphicObject  {
 
 		QString getRelTypeAttribute();
 
-		virtual void setCodeInvalidated(bool value) override;
+		virtual void setCodeInvalidated(bool value, bool notify = true) override;
 
 		virtual QString getAlterCode(BaseObject *) override { return ""; }
 
@@ -37,9 +37,9 @@ BaseTable::BaseTable()
 	resetCurrentPages();
 }
 
-void BaseTable::setCodeInvalidated(bool value)
+void BaseTable::setCodeInvalidated(bool value, bool notify)
 {
-	BaseGraphicObject::setCodeInvalidated(value);
+	BaseGraphicObject::setCodeInvalidated(value, notify);
 	resetHashCode();
 }
 
@@ -75,7 +75,7 @@ QString BaseTable::getAlterCode(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -107,7 +107,7 @@ bool BaseTable::isPaginationEnabled()
 void BaseTable::setCurrentPage(TableSection section_id, unsigned value)
 {
 	if(section_id > ExtAttribsSection)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	setCodeInvalidated(curr_page[section_id] != value);
 	curr_page[section_id] = value;
@@ -116,7 +116,7 @@ void BaseTable::setCurrentPage(TableSection section_id, unsigned value)
 unsigned BaseTable::getCurrentPage(TableSection section_id)
 {
 	if(section_id > ExtAttribsSection)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	return curr_page[section_id];
 }
@@ -145,7 +145,7 @@ class __libcore BaseTable: public BaseGraphicObject {
 		 * saved in separated files. This changes the way links are generated inside the data dictionaries */
 		virtual QString getDataDictionary(bool split, bool md_format, const attribs_map &extra_attribs = {}) = 0;
 
-		virtual void setCodeInvalidated(bool value) override;
+		virtual void setCodeInvalidated(bool value, bool notify = true) override;
 
 		virtual void setModified(bool value) override;
 
@@ -62,7 +62,7 @@ void Column::setName(const QString &name)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -70,11 +70,11 @@ void Column::setType(PgSqlType tp)
 {
 	//An error is raised if the column receive a pseudo-type as data type.
 	if(tp.isPseudoType())
-		throw Exception(ErrorCode::AsgPseudoTypeColumn,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgPseudoTypeColumn,__exc_origin);
 	else if(this->identity_type != IdentityType::Null && !tp.isIntegerType())
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvalidIdentityColumn).arg(getSignature()),
-										ErrorCode::InvalidIdentityColumn, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidIdentityColumn, __exc_origin);
 	}
 
 	setCodeInvalidated(this->type != tp);
@@ -86,7 +86,7 @@ void Column::setIdentityType(IdentityType id_type)
 	if(id_type != IdentityType::Null && !type.isIntegerType())
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvalidIdentityColumn).arg(getSignature()),
-										ErrorCode::InvalidIdentityColumn, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidIdentityColumn, __exc_origin);
 	}
 
 	setCodeInvalidated(identity_type != id_type);
@@ -177,12 +177,12 @@ void Column::setSequence(BaseObject *seq)
 							.arg(this->obj_name)
 							.arg(this->getTypeName())
 							.arg(BaseObject::getTypeName(ObjectType::Sequence)),
-							ErrorCode::AsgInvalidObjectType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgInvalidObjectType,__exc_origin);
 		else if(!type.isIntegerType() && !type.isNumericType())
 			throw Exception(Exception::getErrorMessage(ErrorCode::IncompColumnTypeForSequence)
 							.arg(seq->getName(true))
 							.arg(this->obj_name),
-							ErrorCode::IncompColumnTypeForSequence,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::IncompColumnTypeForSequence,__exc_origin);
 
 		default_value="";
 		identity_type=IdentityType::Null;
@@ -286,7 +286,7 @@ QString Column::getAlterCode(BaseObject *object)
 	Column *col=dynamic_cast<Column *>(object);
 
 	if(!col)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	try
 	{
@@ -387,7 +387,7 @@ QString Column::getAlterCode(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -448,7 +448,7 @@ QString Column::getDataDictionary(bool md_format, const attribs_map &extra_attri
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
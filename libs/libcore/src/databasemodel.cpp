@@ -20,7 +20,18 @@
 #include "coreutilsns.h"
 #include "defaultlanguages.h"
 #include <QtDebug>
+#include <QElapsedTimer>
+#include <QSaveFile>
+#include <QThreadPool>
+#include <QSemaphore>
+#include <QUuid>
+#include <QSet>
+#include <QRegularExpression>
+#include <deque>
+#include <atomic>
+#include <unordered_map>
 #include <random>
+#include <set>
 #include "utilsns.h"
 #include "doublenan.h"
 
@@ -56,6 +67,7 @@ DatabaseModel::DatabaseModel()
 	conn_limit=-1;
 	last_zoom=1;
 	loading_model=invalidated=append_at_eod=prepend_at_bod=false;
+	notify_scheduled=false;
 	attributes[Attributes::Encoding]="";
 	attributes[Attributes::TemplateDb]="";
 	attributes[Attributes::ConnLimit]="";
@@ -109,7 +121,7 @@ DatabaseModel::DatabaseModel()
 		{ ObjectType::Tablespace, std::bind(&DatabaseModel::createTablespace, this) },
 		{ ObjectType::Schema, std::bind(&DatabaseModel::createSchema, this) },
 		{ ObjectType::Language, std::bind(&DatabaseModel::createLanguage, this) },
-		{ ObjectType::Function, std::bind(&DatabaseModel::createFunction, this) },
+		{ ObjectType::Function, [this](){ return createFunction(); } },
 		{ ObjectType::Type, std::bind(&DatabaseModel::createType, this) },
 		{ ObjectType::Domain, std::bind(&DatabaseModel::createDomain, this) },
 		{ ObjectType::Cast, std::bind(&DatabaseModel::createCast, this) },
@@ -139,7 +151,7 @@ DatabaseModel::DatabaseModel()
 		{ ObjectType::UserMapping, std::bind(&DatabaseModel::createUserMapping, this) },
 		{ ObjectType::ForeignTable, std::bind(&DatabaseModel::createForeignTable, this) },
 		{ ObjectType::Transform, std::bind(&DatabaseModel::createTransform, this) },
-		{ ObjectType::Procedure, std::bind(&DatabaseModel::createProcedure, this) },
+		{ ObjectType::Procedure, [this](){ return createProcedure(); } },
 		{ ObjectType::Sequence, [this](){ return createSequence(); } },
 		{ ObjectType::Constraint, [this](){ return createConstraint(nullptr); } }
 	};
@@ -301,7 +313,7 @@ void DatabaseModel::setEncoding(EncodingType encod)
 void DatabaseModel::setLocalization(unsigned localiz_id, const QString &value)
 {
 	if(localiz_id > Collation::LcCollate)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	localizations[localiz_id]=value;
 }
@@ -315,7 +327,7 @@ void DatabaseModel::setConnectionLimit(int conn_lim)
 void DatabaseModel::setTemplateDB(const QString &temp_db)
 {
 	if(!temp_db.isEmpty() && !BaseObject::isValidName(temp_db))
-		throw Exception(ErrorCode::AsgInvalidNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidNameObject,__exc_origin);
 
 	this->template_db=temp_db;
 }
@@ -344,7 +356,7 @@ void DatabaseModel::addObject(BaseObject *object, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -359,7 +371,7 @@ void DatabaseModel::removeObject(BaseObject *object, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -371,7 +383,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	std::vector<BaseObject *>::iterator itr, itr_end;
 
 	if(!object)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	obj_type=object->getObjectType();
 
@@ -395,7 +407,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 				throw Exception(Exception::getErrorMessage(ErrorCode::AsgTablespaceDuplicatedDirectory)
 								.arg(tabspc->getName())
 								.arg(aux_tabspc->getName()),
-								ErrorCode::AsgTablespaceDuplicatedDirectory,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::AsgTablespaceDuplicatedDirectory,__exc_origin);
 			}
 
 			itr++;
@@ -430,7 +442,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 				.arg(this->getName(true))
 				.arg(this->getTypeName());
 
-		throw Exception(str_aux,ErrorCode::AsgDuplicatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(str_aux,ErrorCode::AsgDuplicatedObject,__exc_origin);
 	}
 
 	try
@@ -460,13 +472,16 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 
 	obj_list=getObjectList(object->getObjectType());
 
 	if(obj_idx < 0 || obj_idx >= static_cast<int>(obj_list->size()))
+	{
 		obj_list->push_back(object);
+		idx = obj_list->size() - 1;
+	}
 	else
 	{
 		if(obj_idx >=0 && idx < 0)
@@ -477,10 +492,15 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 		if(obj_list->size() > 0)
 			obj_list->insert((obj_list->begin() + idx), object);
 		else
+		{
 			obj_list->push_back(object);
+			idx = 0;
+		}
 	}
 
+	addToNamesIndex(object, idx);
 	object->setDatabase(this);
+	object->setObserver(this);
 	emit s_objectAdded(object);
 	this->setInvalidated(true);
 }
@@ -488,7 +508,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_refs)
 {
 	if(!object)
-		throw Exception(ErrorCode::RemNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RemNotAllocatedObject,__exc_origin);
 	else
 	{
 		std::vector<BaseObject *> *obj_list=nullptr;
@@ -498,7 +518,7 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 		obj_list=getObjectList(obj_type);
 
 		if(!obj_list)
-			throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::ObtObjectInvalidType,__exc_origin);
 		else
 		{
 			std::vector<BaseObject *> refs;
@@ -521,7 +541,7 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 									.arg(object->getTypeName())
 									.arg(refs[0]->getName(true))
 							.arg(refs[0]->getTypeName()),
-							err_code,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							err_code,__exc_origin);
 				}
 				else
 				{
@@ -535,7 +555,7 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 							.arg(refs[0]->getTypeName())
 							.arg(ref_obj_parent->getName(true))
 							.arg(ref_obj_parent->getTypeName()),
-							err_code,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							err_code,__exc_origin);
 				}
 			}
 
@@ -548,11 +568,13 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 					removePermissions(object);
 
 				obj_list->erase(obj_list->begin() + obj_idx);
+				removeFromNamesIndex(object, obj_idx);
 			}
 		}
 
 		object->clearAllDepsRefs();
 		object->setDatabase(nullptr);
+		object->setObserver(nullptr);
 		emit s_objectRemoved(object);
 	}
 }
@@ -566,7 +588,7 @@ std::vector<BaseObject *> DatabaseModel::getObjects(ObjectType obj_type, BaseObj
 	obj_list=getObjectList(obj_type);
 
 	if(!obj_list)
-		throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::ObtObjectInvalidType,__exc_origin);
 
 	itr=obj_list->begin();
 	itr_end=obj_list->end();
@@ -605,44 +627,266 @@ std::vector<BaseObject *> DatabaseModel::getObjects(BaseObject *schema)
 	return sel_list;
 }
 
+void DatabaseModel::rebuildNamesIndex(ObjectType obj_type)
+{
+	ObjectNamesIndex &names_idx = names_idxs[obj_type];
+	std::vector<BaseObject *> *obj_list = getObjectList(obj_type);
+	int pos = 0;
+
+	names_idx.objects.clear();
+	names_idx.positions.clear();
+	names_idx.keys.clear();
+
+	if(!obj_list)
+		return;
+
+	names_idx.objects.reserve(obj_list->size() * 2);
+	names_idx.positions.reserve(obj_list->size());
+	names_idx.keys.reserve(obj_list->size());
+
+	for(auto &object : *obj_list)
+	{
+		QStringList keys = getNamesIndexKeys(object);
+
+		for(auto &key : keys)
+			names_idx.objects.insert(key, object);
+
+		names_idx.keys[object] = keys;
+		names_idx.positions[object] = pos++;
+	}
+}
+
+QStringList DatabaseModel::getNamesIndexKeys(BaseObject *object)
+{
+	if(!object)
+		return {};
+
+	QStringList keys = { object->getSignature().remove('"') };
+	QString name = object->getName(false);
+
+	if(name != keys.at(0))
+		keys.append(name);
+
+	return keys;
+}
+
+void DatabaseModel::addToNamesIndex(BaseObject *object, int obj_idx)
+{
+	ObjectNamesIndex &names_idx = names_idxs[object->getObjectType()];
+	std::vector<BaseObject *> *obj_list = getObjectList(object->getObjectType());
+
+	if(!obj_list)
+		return;
+
+	QStringList keys = getNamesIndexKeys(object);
+
+	for(auto &key : keys)
+		names_idx.objects.insert(key, object);
+
+	names_idx.keys[object] = keys;
+
+	// Updating the position of the inserted object and the ones that were moved forward
+	for(int pos = obj_idx; pos < static_cast<int>(obj_list->size()); pos++)
+		names_idx.positions[obj_list->at(pos)] = pos;
+}
+
+void DatabaseModel::removeFromNamesIndex(BaseObject *object, int obj_idx)
+{
+	ObjectNamesIndex &names_idx = names_idxs[object->getObjectType()];
+	std::vector<BaseObject *> *obj_list = getObjectList(object->getObjectType());
+
+	if(!obj_list)
+		return;
+
+	for(auto &key : names_idx.keys.take(object))
+		names_idx.objects.remove(key, object);
+
+	names_idx.positions.remove(object);
+
+	modified_mutex.lock();
+	modified_objs.remove(object);
+	modified_mutex.unlock();
+
+	// Updating the position of the objects that were moved backward
+	for(int pos = obj_idx; pos < static_cast<int>(obj_list->size()); pos++)
+		names_idx.positions[obj_list->at(pos)] = pos;
+}
+
+bool DatabaseModel::isNamesIndexed(BaseObject *object) const
+{
+	if(!object)
+		return false;
+
+	auto itr = names_idxs.find(object->getObjectType());
+	return itr != names_idxs.end() && itr->second.positions.contains(object);
+}
+
+bool DatabaseModel::updateNamesIndexKeys(BaseObject *object)
+{
+	if(!isNamesIndexed(object))
+		return false;
+
+	ObjectNamesIndex &names_idx = names_idxs[object->getObjectType()];
+	QStringList keys = getNamesIndexKeys(object);
+	QStringList &curr_keys = names_idx.keys[object];
+
+	if(keys == curr_keys)
+		return false;
+
+	for(auto &key : curr_keys)
+		names_idx.objects.remove(key, object);
+
+	for(auto &key : keys)
+		names_idx.objects.insert(key, object);
+
+	curr_keys = keys;
+	return true;
+}
+
+void DatabaseModel::handleObjectRenamed(BaseObject *object)
+{
+	/* Copies of the model's objects (e.g. the ones stored in the operation list)
+	 * share the same observer but they don't have entries in the names index */
+	if(!updateNamesIndexKeys(object))
+		return;
+
+	std::vector<BaseObject *> objects = { object };
+	QSet<BaseObject *> visited = { object };
+	BaseObject *obj = nullptr;
+
+	/* A new signature/name can reflect in the signatures of the objects that reference the renamed one:
+	 * the objects in a renamed schema or the objects which signatures are derived from other objects
+	 * (e.g. the functions using a renamed type as parameter). Those ones, in their turn, can affect
+	 * other signatures (e.g. a renamed schema changes the signature of a type in it), so the references
+	 * are visited in breadth-first manner, stopping in the objects which keys remain the same */
+	for(unsigned idx = 0; idx < objects.size(); idx++)
+	{
+		obj = objects[idx];
+
+		for(auto &ref : obj->getReferences())
+		{
+			if((ref->getSchema() != obj && !BaseObject::hasDerivedSignature(ref->getObjectType())) ||
+				 visited.contains(ref))
+				continue;
+
+			visited.insert(ref);
+
+			if(updateNamesIndexKeys(ref))
+				objects.push_back(ref);
+		}
+	}
+}
+
+void DatabaseModel::handleObjectInvalidated(BaseObject *object)
+{
+	if(!isNamesIndexed(object))
+		return;
+
+	/* An object can be invalidated several times in a row (e.g. on each position change while it's
+	 * dragged in the canvas) so the listeners are notified only once in the next event loop pass */
+	QMutexLocker locker(&modified_mutex);
+
+	modified_objs.insert(object);
+
+	if(!notify_scheduled)
+	{
+		notify_scheduled = true;
+		QMetaObject::invokeMethod(this, &DatabaseModel::notifyModifiedObjects, Qt::QueuedConnection);
+	}
+}
+
+void DatabaseModel::notifyModifiedObjects()
+{
+	QSet<BaseObject *> objects;
+
+	modified_mutex.lock();
+	objects.swap(modified_objs);
+	notify_scheduled = false;
+	modified_mutex.unlock();
+
+	for(auto &object : objects)
+	{
+		if(isNamesIndexed(object))
+			emit s_objectModified(object);
+	}
+}
+
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
 {
 	BaseObject *object=nullptr;
 	std::vector<BaseObject *> *obj_list=nullptr;
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	bool found=false;
 	QString aux_name1;
+	int pos = -1;
+	bool idx_valid = true;
 
 	obj_list=getObjectList(obj_type);
 
 	if(!obj_list)
-		throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-	else
+		throw Exception(ErrorCode::ObtObjectInvalidType,__exc_origin);
+
+	aux_name1=QString(name).remove('"');
+	obj_idx = -1;
+
+	// Types that never had objects added don't have an index at all
+	auto itr = names_idxs.find(obj_type);
+
+	if(itr != names_idxs.end())
 	{
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
-		obj_idx=-1;
-		aux_name1=QString(name).remove('"');
+		const ObjectNamesIndex &names_idx = itr->second;
 
-		while(itr!=itr_end && !found)
+		/* In case of more than one object sharing the same key (e.g. tables with
+		 * the same name in different schemas) we return the one that comes first in the list */
+		for(auto &obj : names_idx.objects.values(aux_name1))
 		{
-			if((*itr)->getSignature().remove("\"") == aux_name1 ||
-				 (*itr)->getName(false) == aux_name1)
+			pos = names_idx.positions.value(obj, -1);
+
+			if(pos < 0 || pos >= static_cast<int>(obj_list->size()) ||
+				 obj_list->at(pos) != obj || !getNamesIndexKeys(obj).contains(aux_name1))
 			{
-				found = true;
+				idx_valid = false;
 				break;
 			}
 
-			itr++;
+			if(obj_idx < 0 || pos < obj_idx)
+			{
+				object = obj;
+				obj_idx = pos;
+			}
 		}
+	}
 
-		if(found)
+	/* Fallback to the linear search in the very unlikely case the index is inconsistent
+	 * (e.g. an object which name was changed without notifying the model) */
+	if(!idx_valid)
+	{
+		object = nullptr;
+		obj_idx = -1;
+
+		for(pos = 0; pos < static_cast<int>(obj_list->size()); pos++)
 		{
-			object = (*itr);
-			obj_idx = (itr - obj_list->begin());
+			if(obj_list->at(pos)->getSignature().remove('"') == aux_name1 ||
+				 obj_list->at(pos)->getName(false) == aux_name1)
+			{
+				object = obj_list->at(pos);
+				obj_idx = pos;
+				break;
+			}
 		}
 	}
 
+#ifndef QT_NO_DEBUG
+	/* In debug builds the misses are confirmed by the linear search so an object
+	 * missing in the names index (the same inconsistency above) is caught right away */
+	if(idx_valid && !object)
+	{
+		for(auto &obj : *obj_list)
+		{
+			Q_ASSERT_X(obj->getSignature().remove('"') != aux_name1 && obj->getName(false) != aux_name1,
+								 "DatabaseModel::getObject", "object missing in the names index");
+		}
+	}
+#endif
+
 	return object;
 }
 
@@ -682,9 +926,9 @@ BaseObject *DatabaseModel::getObject(unsigned obj_idx, ObjectType obj_type)
 	obj_list=getObjectList(obj_type);
 
 	if(!obj_list)
-		throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::ObtObjectInvalidType,__exc_origin);
 	else if(obj_idx >= obj_list->size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	return obj_list->at(obj_idx);
 }
@@ -696,7 +940,7 @@ unsigned DatabaseModel::getObjectCount(ObjectType obj_type)
 	obj_list = getObjectList(obj_type);
 
 	if(!obj_list)
-		throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::ObtObjectInvalidType,__exc_origin);
 
 	return obj_list->size();
 }
@@ -714,7 +958,7 @@ unsigned DatabaseModel::getObjectsCount(const std::vector<ObjectType> &obj_types
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -746,7 +990,7 @@ unsigned DatabaseModel::getObjectCount()
 QString DatabaseModel::getLocalization(unsigned localiz_id)
 {
 	if(localiz_id > Collation::LcCollate)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	return localizations[localiz_id];
 }
@@ -769,7 +1013,7 @@ EncodingType DatabaseModel::getEncoding()
 BaseObject *DatabaseModel::getDefaultObject(ObjectType obj_type)
 {
 	if(default_objs.count(obj_type)==0)
-		throw Exception(ErrorCode::RefObjectInvalidType, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidType, __exc_origin);
 
 	return default_objs[obj_type];
 }
@@ -872,6 +1116,7 @@ void DatabaseModel::destroyObjects()
 		delete perm;
 
 	permissions.clear();
+	rebuildNamesIndex(ObjectType::Permission);
 
 	for(auto &inv_obj : invalid_special_objs)
 		delete inv_obj;
@@ -886,7 +1131,10 @@ void DatabaseModel::destroyObjects()
 		rem_obj_types.erase(end, rem_obj_types.end());
 
 		for(auto type : rem_obj_types)
+		{
 			getObjectList(type)->clear();
+			rebuildNamesIndex(type);
+		}
 	}
 
 	BaseGraphicObject::setUpdatesEnabled(true);
@@ -908,7 +1156,7 @@ void DatabaseModel::addTable(Table *table, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -932,7 +1180,7 @@ void DatabaseModel::removeTable(Table *table, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -946,7 +1194,7 @@ void DatabaseModel::addSequence(Sequence *sequence, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -968,7 +1216,7 @@ void DatabaseModel::removeSequence(Sequence *sequence, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -980,7 +1228,7 @@ void DatabaseModel::addCollation(Collation *collation, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1002,7 +1250,7 @@ void DatabaseModel::removeCollation(Collation *collation, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1016,14 +1264,14 @@ void DatabaseModel::addExtension(Extension *extension, int obj_idx)
 	catch(Exception &e)
 	{
 		removeExtensionObjects(extension);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
 void DatabaseModel::removeExtensionObjects(Extension *ext)
 {
 	if(!ext)
-		throw Exception(ErrorCode::AsgNotAllocattedObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject, __exc_origin);
 
 	/* Checking if the user tries to remove an extension that
 	 * has one or more children being referenced in the model */
@@ -1042,7 +1290,7 @@ void DatabaseModel::removeExtensionObjects(Extension *ext)
 				throw Exception(Exception::getErrorMessage(ErrorCode::RemExtRefChildObject)
 												.arg(ext->getSignature(), obj->getName(), obj->getTypeName(),
 														 ref_obj->getSignature(), ref_obj->getTypeName()),
-												 ErrorCode::RemExtRefChildObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+												 ErrorCode::RemExtRefChildObject, __exc_origin);
 			}
 		}
 
@@ -1076,7 +1324,7 @@ void DatabaseModel::setRelTablesModified(BaseRelationship *rel)
 bool DatabaseModel::updateExtensionObjects(Extension *ext)
 {
 	if(!ext)
-		throw Exception(ErrorCode::AsgNotAllocattedObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject, __exc_origin);
 
 	std::vector<BaseObject *> new_objs;
 
@@ -1113,7 +1361,7 @@ bool DatabaseModel::updateExtensionObjects(Extension *ext)
 					{
 						throw Exception(Exception::getErrorMessage(ErrorCode::AddExtDupChildObject)
 														.arg(ext->getSignature(), obj->getSignature(), obj->getTypeName()),
-														ErrorCode::AddExtDupChildObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+														ErrorCode::AddExtDupChildObject,__exc_origin);
 					}
 
 					// If the retrieved type is one of the extension's child types we just skip it
@@ -1185,7 +1433,7 @@ bool DatabaseModel::updateExtensionObjects(Extension *ext)
 			delete *itr;
 		}
 
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -1207,7 +1455,7 @@ void DatabaseModel::addTag(Tag *tag, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1219,7 +1467,7 @@ void DatabaseModel::removeTag(Tag *tag, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1241,7 +1489,7 @@ void DatabaseModel::addEventTrigger(EventTrigger *evnttrig, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1253,7 +1501,7 @@ void DatabaseModel::removeEventTrigger(EventTrigger *evnttrig, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1275,7 +1523,7 @@ void DatabaseModel::addGenericSQL(GenericSQL *genericsql, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1287,7 +1535,7 @@ void DatabaseModel::removeGenericSQL(GenericSQL *genericsql, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1309,7 +1557,7 @@ void DatabaseModel::addForeignDataWrapper(ForeignDataWrapper *fdata_wrapper, int
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1321,7 +1569,7 @@ void DatabaseModel::removeForeignDataWrapper(ForeignDataWrapper *fdata_wrapper,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1343,7 +1591,7 @@ void DatabaseModel::addForeignServer(ForeignServer *server, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1355,7 +1603,7 @@ void DatabaseModel::removeForeignServer(ForeignServer *server, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1377,7 +1625,7 @@ void DatabaseModel::addUserMapping(UserMapping *usrmap, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1389,7 +1637,7 @@ void DatabaseModel::removeUserMapping(UserMapping *usrmap, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1415,7 +1663,7 @@ void DatabaseModel::addForeignTable(ForeignTable *table, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1437,7 +1685,7 @@ void DatabaseModel::addTransform(Transform *transf, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1449,7 +1697,7 @@ void DatabaseModel::removeTransform(Transform *transf, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1471,7 +1719,7 @@ void DatabaseModel::addProcedure(Procedure *proc, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1483,7 +1731,7 @@ void DatabaseModel::removeProcedure(Procedure *proc, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1506,14 +1754,14 @@ void DatabaseModel::removeForeignTable(ForeignTable *table, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 void DatabaseModel::removeExtension(Extension *extension, int obj_idx)
 {
 	if(!extension)
-		throw Exception(ErrorCode::RemNotAllocatedObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RemNotAllocatedObject, __exc_origin);
 
 	try
 	{
@@ -1522,7 +1770,7 @@ void DatabaseModel::removeExtension(Extension *extension, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1539,7 +1787,7 @@ void DatabaseModel::addView(View *view, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1565,14 +1813,14 @@ void DatabaseModel::removeView(View *view, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 void DatabaseModel::updateTableFKRelationships(Table *table)
 {
 	if(!table)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	if(table->getDatabase() != this)
 		return;
@@ -1700,7 +1948,7 @@ void DatabaseModel::updateViewRelationships(View *view, bool force_rel_removal)
 	std::vector<BaseObject *>::iterator itr, itr_end;
 
 	if(!view)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	if(getObjectIndex(view) < 0 || force_rel_removal)
 	{
@@ -1809,7 +2057,7 @@ void DatabaseModel::disconnectRelationships()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1862,17 +2110,17 @@ std::vector<Exception> DatabaseModel::createSpecialObjects()
 	return errors;
 }
 
-void DatabaseModel::updateRelsGeneratedObjects()
+void DatabaseModel::updateRelsGeneratedObjects(const std::vector<Relationship *> &rels)
 {
 	try
 	{
 		Relationship *rel = nullptr;
 		bool rels_updated = false;
-		auto itr = relationships.begin(), itr_end = relationships.end();
+		auto itr = rels.begin(), itr_end = rels.end();
 
 		while(itr != itr_end)
 		{
-			rel = dynamic_cast<Relationship *>(*itr);
+			rel = *itr;
 			itr++;
 
 			rel->blockSignals(true);
@@ -1885,25 +2133,156 @@ void DatabaseModel::updateRelsGeneratedObjects()
 			if(itr == itr_end && rels_updated)
 			{
 				rels_updated = false;
-				itr = relationships.begin();
+				itr = rels.begin();
 			}
 		}
 	}
 	catch (Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin);
 	}
 }
 
-bool DatabaseModel::validateRelationships()
+std::vector<Relationship *> DatabaseModel::getInvalidRelationshipsSubgraph()
 {
+	std::vector<Relationship *> rels, sorted_rels;
+	std::vector<bool> affected;
+	std::vector<unsigned> pending, in_degree;
+	std::vector<std::vector<unsigned>> dependents;
+	std::map<BaseTable *, std::vector<unsigned>> readers, writers;
+	std::set<unsigned> ready;
 	Relationship *rel = nullptr;
+	BaseTable *recv_tab = nullptr;
+	unsigned idx = 0;
+
+	/* Returns the tables from which the relationship copies columns. For many-to-many
+	 * relationships there's no single reference table so both tables are considered */
+	auto get_ref_tables = [](Relationship *rel) -> std::vector<BaseTable *> {
+		if(rel->getRelationshipType() == BaseRelationship::RelationshipNn)
+			return { rel->getTable(BaseRelationship::SrcTable), rel->getTable(BaseRelationship::DstTable) };
+
+		return { rel->getReferenceTable() };
+	};
+
+	for(auto &obj : relationships)
+	{
+		rel = dynamic_cast<Relationship *>(obj);
+		idx = rels.size();
+		rels.push_back(rel);
+
+		for(auto &tab : get_ref_tables(rel))
+		{
+			if(tab)
+				readers[tab].push_back(idx);
+		}
+
+		recv_tab = rel->getReceiverTable();
+
+		if(recv_tab)
+			writers[recv_tab].push_back(idx);
+
+		if(rel->isInvalidated())
+			pending.push_back(idx);
+	}
+
+	affected.resize(rels.size(), false);
+
+	for(auto &id : pending)
+		affected[id] = true;
+
+	/* Walking from the invalidated relationships to all the relationships that either
+	 * write to the same receiver table or read columns from it, since the disconnection
+	 * of the former changes the columns/constraints seen by the latter */
+	while(!pending.empty())
+	{
+		recv_tab = rels[pending.back()]->getReceiverTable();
+		pending.pop_back();
+
+		if(!recv_tab)
+			continue;
+
+		for(auto *tab_rels : { &readers[recv_tab], &writers[recv_tab] })
+		{
+			for(auto &id : *tab_rels)
+			{
+				if(affected[id])
+					continue;
+
+				affected[id] = true;
+				pending.push_back(id);
+			}
+		}
+	}
+
+	/* Sorting the affected relationships (Kahn's algorithm) so writers of a table are
+	 * connected before its readers, using the creation order to break ties */
+	in_degree.resize(rels.size(), 0);
+	dependents.resize(rels.size());
+
+	for(idx = 0; idx < rels.size(); idx++)
+	{
+		if(!affected[idx])
+			continue;
+
+		for(auto &tab : get_ref_tables(rels[idx]))
+		{
+			if(!tab || !writers.count(tab))
+				continue;
+
+			for(auto &id : writers[tab])
+			{
+				if(id == idx || !affected[id])
+					continue;
+
+				dependents[id].push_back(idx);
+				in_degree[idx]++;
+			}
+		}
+	}
+
+	for(idx = 0; idx < rels.size(); idx++)
+	{
+		if(affected[idx] && in_degree[idx] == 0)
+			ready.insert(idx);
+	}
+
+	while(!ready.empty())
+	{
+		idx = *ready.begin();
+		ready.erase(ready.begin());
+		sorted_rels.push_back(rels[idx]);
+		affected[idx] = false;
+
+		for(auto &id : dependents[idx])
+		{
+			if(--in_degree[id] == 0)
+				ready.insert(id);
+		}
+	}
+
+	/* Relationships in a dependency cycle are appended in creation order,
+	 * the connection retries in validateRelationships() will handle them */
+	for(idx = 0; idx < rels.size(); idx++)
+	{
+		if(affected[idx])
+			sorted_rels.push_back(rels[idx]);
+	}
+
+	return sorted_rels;
+}
+
+bool DatabaseModel::validateRelationships()
+{
 	BaseRelationship *base_rel = nullptr;
 	std::vector<Exception> errors;
 	std::map<Relationship *, Exception> rel_errors;
-	std::vector<Relationship *> failed_rels;
+	std::vector<Relationship *> inv_rels, failed_rels, pend_rels;
+	Textbox *label = nullptr;
+	bool has_special_objs = false, connected = false;
 
-	if(!hasInvalidRelatioships())
+	inv_rels = getInvalidRelationshipsSubgraph();
+
+	if(inv_rels.empty())
 		return false;
 
 	if(!loading_model)
@@ -1913,45 +2292,63 @@ bool DatabaseModel::validateRelationships()
 	if(!loading_model && xml_special_objs.empty())
 		storeSpecialObjectsXML();
 
-	// Disconnecting all relationships in order to force the correct propagation of columns/constraints
-	disconnectRelationships();
+	has_special_objs = !xml_special_objs.empty();
 
-	// Trying to connect all relatinships in the order they were created
-	for(auto &rl : relationships)
+	/* Disconnecting only the affected relationships (from the last to the first) in order
+	 * to force the correct propagation of columns/constraints. The relationships outside
+	 * the affected subgraph keep connected since their columns aren't changed */
+	for(auto ritr = inv_rels.rbegin(); ritr != inv_rels.rend(); ritr++)
+	{
+		(*ritr)->blockSignals(loading_model);
+		(*ritr)->disconnectRelationship();
+		(*ritr)->blockSignals(false);
+	}
+
+	// Trying to connect the affected relationships in dependency order
+	for(auto &rel : inv_rels)
 	{
 		try
 		{
-			rel = dynamic_cast<Relationship *>(rl);
 			rel->blockSignals(true);
 			rel->connectRelationship();
-			rel->blockSignals(false);
 		}
 		catch(Exception &)
 		{
 			failed_rels.push_back(rel);
 		}
+
+		rel->blockSignals(false);
 	}
 
-	// Trying to recreate relationships that failed to connect previously
-	unsigned idx = 0, max_tries = failed_rels.size();
+	/* Trying to reconnect the relationships that failed to connect previously.
+	 * New rounds are made only while at least one relationship gets connected
+	 * in the previous round, since only that can change the outcome of the others */
+	connected = true;
 
-	while(idx < max_tries)
+	while(!failed_rels.empty() && connected)
 	{
+		connected = false;
+		pend_rels.clear();
+		rel_errors.clear();
+
 		for(auto &rel : failed_rels)
 		{
 			try
 			{
 				rel->blockSignals(true);
 				rel->connectRelationship();
-				rel->blockSignals(false);
+				connected = true;
 			}
 			catch(Exception &e)
 			{
 				rel_errors[rel] = e;
+				pend_rels.push_back(rel);
 			}
+
+			rel->blockSignals(false);
 		}
 
-		idx++;
+		failed_rels.swap(pend_rels);
 	}
 
 	/* Checking if some failed relationships have generated errors in the connection retry.
@@ -1962,13 +2359,14 @@ bool DatabaseModel::validateRelationships()
 		if(!re.first->isRelationshipConnected())
 		{
 			errors.push_back(re.second);
+			inv_rels.erase(std::find(inv_rels.begin(), inv_rels.end(), re.first));
 			__removeObject(re.first, -1, false);
 		}
 	}
 
 	/* Updating the relationship generated objects.
 	 * The columns and contraints not created in first connection are properly created */
-	updateRelsGeneratedObjects();
+	updateRelsGeneratedObjects(inv_rels);
 
 	//Recreating the special objects that depends on the columns created by relationshps
 	errors = createSpecialObjects();
@@ -2003,13 +2401,37 @@ bool DatabaseModel::validateRelationships()
 
 	if(!loading_model)
 	{
-		//Set all the model objects as modified to force the redraw of the entire model
 		BaseGraphicObject::setUpdatesEnabled(true);
-		setObjectsModified();
+
+		/* When special objects were recreated they may belong to any table/view so all the
+		 * model objects are set as modified to force the redraw of the entire model.
+		 * Otherwise, only the affected relationships and their tables are redrawn */
+		if(has_special_objs || !errors.empty())
+			setObjectsModified();
+		else
+		{
+			for(auto &rel : inv_rels)
+			{
+				for(auto &tab : { rel->getTable(BaseRelationship::SrcTable), rel->getTable(BaseRelationship::DstTable) })
+				{
+					//Resetting the hash code to force the table to be redrawn
+					tab->resetHashCode();
+					tab->setModified(true);
+				}
+
+				rel->setModified(true);
+
+				for(unsigned lbl_id = BaseRelationship::SrcCardLabel; lbl_id <= BaseRelationship::RelNameLabel; lbl_id++)
+				{
+					label = rel->getLabel(static_cast<BaseRelationship::LabelId>(lbl_id));
+					if(label) label->setModified(true);
+				}
+			}
+		}
 	}
 
 	if(!errors.empty())
-		throw Exception(ErrorCode::RemInvalidatedObjects,__PRETTY_FUNCTION__,__FILE__,__LINE__, errors);
+		throw Exception(ErrorCode::RemInvalidatedObjects,__exc_origin, errors);
 
 	return true;
 }
@@ -2020,7 +2442,7 @@ void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 	{
 		//Raises an error if the user try to check the redundancy starting from a unnallocated relationship
 		if(!rel)
-			throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 		BaseRelationship::RelType rel_type = rel->getRelationshipType();
 
@@ -2099,13 +2521,13 @@ void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 				msg=Exception::getErrorMessage(ErrorCode::InsRelationshipRedundancy)
 					.arg(rel->getName())
 					.arg(str_aux);
-				throw Exception(msg,ErrorCode::InsRelationshipRedundancy,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(msg,ErrorCode::InsRelationshipRedundancy,__exc_origin);
 			}
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2329,7 +2751,7 @@ void DatabaseModel::storeSpecialObjectsXML()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2367,7 +2789,7 @@ void DatabaseModel::createSpecialObject(const QString &xml_def, unsigned obj_id)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, xml_def);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e, xml_def);
 	}
 }
 
@@ -2394,7 +2816,7 @@ void DatabaseModel::addRelationship(BaseRelationship *rel, int obj_idx)
 					.arg(tab1->getTypeName())
 					.arg(tab2->getName(true))
 					.arg(tab2->getTypeName());
-				throw Exception(msg,ErrorCode::InsDuplicatedRelationship,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(msg,ErrorCode::InsDuplicatedRelationship,__exc_origin);
 			}
 		}
 
@@ -2422,7 +2844,7 @@ void DatabaseModel::addRelationship(BaseRelationship *rel, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2467,7 +2889,7 @@ void DatabaseModel::removeRelationship(BaseRelationship *rel, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2475,7 +2897,7 @@ BaseRelationship *DatabaseModel::getRelationship(unsigned obj_idx, ObjectType re
 {
 	//Raises an error if the object type used to get a relationship is invalid
 	if(rel_type!=ObjectType::Relationship && rel_type!=ObjectType::BaseRelationship)
-		throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::ObtObjectInvalidType,__exc_origin);
 
 	return dynamic_cast<BaseRelationship *>(getObject(obj_idx, rel_type));
 }
@@ -2567,7 +2989,7 @@ void DatabaseModel::addTextbox(Textbox *txtbox, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2579,7 +3001,7 @@ void DatabaseModel::removeTextbox(Textbox *txtbox, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2604,7 +3026,7 @@ void DatabaseModel::addSchema(Schema *schema, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2626,7 +3048,7 @@ void DatabaseModel::removeSchema(Schema *schema, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2638,7 +3060,7 @@ void DatabaseModel::addRole(Role *role, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2660,7 +3082,7 @@ void DatabaseModel::removeRole(Role *role, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2672,7 +3094,7 @@ void DatabaseModel::addTablespace(Tablespace *tabspc, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2694,7 +3116,7 @@ void DatabaseModel::removeTablespace(Tablespace *tabspc, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2706,7 +3128,7 @@ void DatabaseModel::addCast(Cast *cast, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2718,7 +3140,7 @@ void DatabaseModel::removeCast(Cast *cast, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2740,7 +3162,7 @@ void DatabaseModel::addConversion(Conversion *conv, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2752,7 +3174,7 @@ void DatabaseModel::removeConversion(Conversion *conv, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2774,7 +3196,7 @@ void DatabaseModel::addLanguage(Language *lang, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2796,7 +3218,7 @@ void DatabaseModel::removeLanguage(Language *lang, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2808,7 +3230,7 @@ void DatabaseModel::addFunction(Function *func, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2830,7 +3252,7 @@ void DatabaseModel::removeFunction(Function *func, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2842,7 +3264,7 @@ void DatabaseModel::addAggregate(Aggregate *aggreg, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2864,7 +3286,7 @@ void DatabaseModel::removeAggregate(Aggregate *aggreg, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2894,7 +3316,7 @@ void DatabaseModel::addDomain(Domain *domain, int obj_idx)
 					.arg(domain->getTypeName())
 					.arg(this->getName(true))
 					.arg(this->getTypeName());
-			throw Exception(str_aux, ErrorCode::AsgDuplicatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(str_aux, ErrorCode::AsgDuplicatedObject,__exc_origin);
 		}
 
 		try
@@ -2907,7 +3329,7 @@ void DatabaseModel::addDomain(Domain *domain, int obj_idx)
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 		}
 	}
 }
@@ -2920,7 +3342,7 @@ void DatabaseModel::removeDomain(Domain *domain, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2942,7 +3364,7 @@ void DatabaseModel::addOperatorFamily(OperatorFamily *op_family, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2964,7 +3386,7 @@ void DatabaseModel::removeOperatorFamily(OperatorFamily *op_family, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2976,7 +3398,7 @@ void DatabaseModel::addOperatorClass(OperatorClass *op_class, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2988,7 +3410,7 @@ void DatabaseModel::removeOperatorClass(OperatorClass *op_class, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -3010,7 +3432,7 @@ void DatabaseModel::addOperator(Operator *oper, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -3022,7 +3444,7 @@ void DatabaseModel::removeOperator(Operator *oper, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -3061,7 +3483,7 @@ void DatabaseModel::addType(Type *type, int obj_idx)
 					.arg(type->getTypeName())
 					.arg(this->getName(true))
 					.arg(this->getTypeName());
-			throw Exception(str_aux, ErrorCode::AsgDuplicatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(str_aux, ErrorCode::AsgDuplicatedObject,__exc_origin);
 		}
 
 		try
@@ -3073,7 +3495,7 @@ void DatabaseModel::addType(Type *type, int obj_idx)
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 		}
 	}
 }
@@ -3086,7 +3508,7 @@ void DatabaseModel::removeType(Type *type, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -3111,7 +3533,7 @@ void DatabaseModel::removeUserType(BaseObject *object, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -3139,7 +3561,7 @@ void DatabaseModel::addPermissions(const std::vector<Permission *> &perms)
 			itr++;
 		}
 
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -3148,7 +3570,7 @@ void DatabaseModel::addPermission(Permission *perm)
 	try
 	{
 		if(!perm)
-			throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 		TableObject *tab_obj=dynamic_cast<TableObject *>(perm->getObject());
 
@@ -3157,7 +3579,7 @@ void DatabaseModel::addPermission(Permission *perm)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgDuplicatedPermission)
 							.arg(perm->getObject()->getName())
 							.arg(perm->getObject()->getTypeName()),
-							ErrorCode::AsgDuplicatedPermission,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgDuplicatedPermission,__exc_origin);
 		}
 		//Raises an error if the permission is referencing an object that does not exists on model
 		else if(perm->getObject()!=this &&
@@ -3168,11 +3590,14 @@ void DatabaseModel::addPermission(Permission *perm)
 							.arg(perm->getObject()->getTypeName())
 							.arg(perm->getObject()->getName())
 							.arg(perm->getObject()->getTypeName()),
-							ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 		permissions.push_back(perm);
+		addToNamesIndex(perm, permissions.size() - 1);
 		perm->setDatabase(this);
+		perm->setObserver(this);
 		perm->updateDependencies();
+		emit s_objectAdded(perm);
 	}
 	catch(Exception &e)
 	{
@@ -3181,10 +3606,10 @@ void DatabaseModel::addPermission(Permission *perm)
 			Exception(Exception::getErrorMessage(ErrorCode::AsgDuplicatedPermission)
 					  .arg(perm->getObject()->getName())
 					  .arg(perm->getObject()->getTypeName()),
-						ErrorCode::AsgDuplicatedPermission,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+						ErrorCode::AsgDuplicatedPermission,__exc_origin,&e);
 
 		else
-			throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -3196,7 +3621,7 @@ void DatabaseModel::removePermission(Permission *perm)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -3207,7 +3632,7 @@ void DatabaseModel::removePermissions(BaseObject *object)
 	unsigned idx=0;
 
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	itr=permissions.begin();
 	itr_end=permissions.end();
@@ -3221,6 +3646,9 @@ void DatabaseModel::removePermissions(BaseObject *object)
 			invalid_special_objs.push_back(perm);
 
 			permissions.erase(itr);
+			removeFromNamesIndex(perm, idx);
+			perm->setObserver(nullptr);
+			emit s_objectRemoved(perm);
 			itr=itr_end=permissions.end();
 
 			if(!permissions.empty())
@@ -3237,7 +3665,7 @@ void DatabaseModel::getPermissions(BaseObject *object, std::vector<Permission *>
 	Permission *perm=nullptr;
 
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	itr=permissions.begin();
 	itr_end=permissions.end();
@@ -3350,9 +3778,17 @@ int DatabaseModel::getObjectIndex(BaseObject *object)
 	obj_list=getObjectList(obj_type);
 
 	if(!obj_list)
-		throw Exception(ErrorCode::ObtObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::ObtObjectInvalidType,__exc_origin);
 	else
 	{
+		/* Positions are tracked by pointer in the names index, so we use it first and
+		 * only do the linear search in case the stored position is not consistent */
+		auto names_itr = names_idxs.find(obj_type);
+		int pos = names_itr != names_idxs.end() ? names_itr->second.positions.value(object, -1) : -1;
+
+		if(pos >= 0 && pos < static_cast<int>(obj_list->size()) && obj_list->at(pos) == object)
+			return pos;
+
 		itr=obj_list->begin();
 		itr_end=obj_list->end();
 
@@ -3400,6 +3836,24 @@ void DatabaseModel::loadModel(const QString &filename)
 	bool protected_model=false;
 	QStringList pos_str;
 	std::map<ObjectType, QString> def_objs;
+	std::map<QString, unsigned> stages_idx;
+	QElapsedTimer timer;
+
+	/* Accumulates the elapsed time and the amount of objects in the stage identified by name.
+	 * Stages are reported in the order they are first registered */
+	auto register_stage = [&](const QString &name, qint64 elapsed_ns, unsigned obj_count = 0) {
+		if(stages_idx.count(name) == 0)
+		{
+			stages_idx[name] = loading_stages.size();
+			loading_stages.push_back(LoadingStage { name });
+		}
+
+		LoadingStage &stage = loading_stages[stages_idx[name]];
+		stage.obj_count += obj_count;
+		stage.elapsed_ns += elapsed_ns;
+	};
+
+	loading_stages.clear();
 
 	//Configuring the path to the base path for objects DTD
 	dtd_file=GlobalAttributes::getSchemasRootPath() +
@@ -3420,7 +3874,9 @@ void DatabaseModel::loadModel(const QString &filename)
 												 GlobalAttributes::RootDTD);
 
 		//Loads the file validating it against the root DTD
+		timer.start();
 		xmlparser.loadXMLFile(filename);
+		register_stage(tr("XML parsing and validation"), timer.nsecsElapsed());
 
 		//Gets the basic model information
 		xmlparser.getElementAttributes(attribs);
@@ -3529,6 +3985,66 @@ void DatabaseModel::loadModel(const QString &filename)
 		def_objs[ObjectType::Collation]=attribs[Attributes::DefaultCollation];
 		def_objs[ObjectType::Tablespace]=attribs[Attributes::DefaultTablespace];
 
+		/* The root elements are grouped in dependency tiers (see getLoadingTier()) and their attributes are
+		 * extracted by worker threads, the tiers being queued in dependency order so the attributes of the objects
+		 * created first are the first ones to be ready. The objects are still created by this thread in the order
+		 * they appear in the file, which keeps the loading deterministic, and the creation of each object only waits
+		 * for the extraction of its tier. The thread pool is declared after the structures used by the workers
+		 * so, in case of errors, it's destroyed first waiting for the running tasks */
+		std::vector<const xmlNode *> tiers_elems[LoadingTiersCount];
+		std::vector<XmlParser::ElementsAttributes> tiers_attribs[LoadingTiersCount];
+		std::unordered_map<const xmlNode *, std::pair<unsigned, unsigned>> elems_pos;
+		QSemaphore tiers_sems[LoadingTiersCount];
+		unsigned tiers_tasks[LoadingTiersCount] {};
+		bool tiers_ready[LoadingTiersCount] {};
+		std::atomic<qint64> parsing_ns { 0 };
+		QThreadPool thread_pool;
+
+		for(const xmlNode *elem = xmlparser.getCurrentElement()->children; elem; elem = elem->next)
+		{
+			if(elem->type != XML_ELEMENT_NODE)
+				continue;
+
+			elem_name = reinterpret_cast<const char *>(elem->name);
+			obj_type = getObjectType(elem_name);
+
+			//The changelog and the database elements are read directly from the element tree
+			if(elem_name != Attributes::Changelog && obj_type != ObjectType::Database)
+				tiers_elems[getLoadingTier(obj_type)].push_back(elem);
+		}
+
+		for(unsigned tier = 0; tier < LoadingTiersCount; tier++)
+		{
+			std::vector<const xmlNode *> &elems = tiers_elems[tier];
+			std::vector<XmlParser::ElementsAttributes> &elems_attribs = tiers_attribs[tier];
+			QSemaphore &tier_sem = tiers_sems[tier];
+
+			elems_attribs.resize(elems.size());
+
+			for(unsigned idx = 0; idx < elems.size(); idx++)
+				elems_pos[elems[idx]] = { tier, idx };
+
+			//Each task extracts the attributes of a batch of elements to reduce the scheduling overhead
+			for(unsigned start = 0; start < elems.size(); start += LoadingBatchSize)
+			{
+				unsigned end = std::min<unsigned>(start + LoadingBatchSize, elems.size());
+
+				thread_pool.start([&elems, &elems_attribs, &tier_sem, &parsing_ns, start, end](){
+					QElapsedTimer task_timer;
+
+					task_timer.start();
+
+					for(unsigned idx = start; idx < end; idx++)
+						XmlParser::parseSubtreeAttributes(elems[idx], elems_attribs[idx]);
+
+					parsing_ns += task_timer.nsecsElapsed();
+					tier_sem.release();
+				});
+
+				tiers_tasks[tier]++;
+			}
+		}
+
 		if(xmlparser.accessElement(XmlParser::ChildElement))
 		{
 			do
@@ -3567,8 +4083,27 @@ void DatabaseModel::loadModel(const QString &filename)
 					{
 						try
 						{
+							auto pos_itr = elems_pos.find(xmlparser.getCurrentElement());
+
+							//Handing the attributes extracted by the workers to the parser before creating the object
+							if(pos_itr != elems_pos.end())
+							{
+								auto [tier, idx] = pos_itr->second;
+
+								if(!tiers_ready[tier])
+								{
+									timer.restart();
+									tiers_sems[tier].acquire(tiers_tasks[tier]);
+									tiers_ready[tier] = true;
+									register_stage(tr("Waiting for the attributes extraction"), timer.nsecsElapsed());
+								}
+
+								xmlparser.setParsedAttributes(std::move(tiers_attribs[tier][idx]));
+							}
+
 							//Saves the current position of the parser before create any object
 							xmlparser.savePosition();
+							timer.restart();
 							object=createObject(obj_type);
 
 							if(object)
@@ -3576,6 +4111,8 @@ void DatabaseModel::loadModel(const QString &filename)
 								if(!dynamic_cast<TableObject *>(object) && obj_type!=ObjectType::Relationship && obj_type!=ObjectType::BaseRelationship)
 									addObject(object);
 
+								register_stage(BaseObject::getTypeName(obj_type), timer.nsecsElapsed(), 1);
+
 								emit s_objectLoaded((xmlparser.getCurrentBufferLine()/static_cast<double>(xmlparser.getBufferLineCount()))*100,
 																		tr("Loading: `%1' (%2)")
 																				.arg(object->getName())
@@ -3588,7 +4125,7 @@ void DatabaseModel::loadModel(const QString &filename)
 						catch(Exception &e)
 						{
 							QString info_adicional=QString(QObject::tr("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
-							throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
+							throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, info_adicional);
 						}
 					}
 				}
@@ -3596,6 +4133,10 @@ void DatabaseModel::loadModel(const QString &filename)
 			while(xmlparser.accessElement(XmlParser::NextElement));
 		}
 
+		thread_pool.waitForDone();
+		xmlparser.setParsedAttributes(XmlParser::ElementsAttributes());
+		register_stage(tr("Attributes extraction (worker threads)"), parsing_ns, elems_pos.size());
+
 		this->BaseObject::setProtected(protected_model);
 
 		//Validating default objects
@@ -3611,7 +4152,7 @@ void DatabaseModel::loadModel(const QString &filename)
 															.arg(this->getTypeName())
 															.arg(itr.second)
 															.arg(BaseObject::getTypeName(itr.first)),
-													ErrorCode::AsgDuplicatedPermission,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+													ErrorCode::AsgDuplicatedPermission,__exc_origin);
 
 				this->setDefaultObject(object);
 			}
@@ -3625,17 +4166,21 @@ void DatabaseModel::loadModel(const QString &filename)
 		if(!relationships.empty())
 		{
 			emit s_objectLoaded(100, tr("Validating relationships..."), enum_t(ObjectType::Relationship));
+			timer.restart();
 			storeSpecialObjectsXML();
 			disconnectRelationships();
 			validateRelationships();
+			register_stage(tr("Relationships validation"), timer.nsecsElapsed(), relationships.size());
 		}
 
+		timer.restart();
 		this->updateDependencies();
 		this->setInvalidated(false);
 		emit s_objectLoaded(100, tr("Validating relationships..."), enum_t(ObjectType::Relationship));
 
 		updateTablesFKRelationships();
 		restoreFKRelationshipLayers();
+		register_stage(tr("Dependencies and FK relationships update"), timer.nsecsElapsed());
 
 		BaseGraphicObject::setUpdatesEnabled(true);
 		setObjectsModified();
@@ -3653,13 +4198,48 @@ void DatabaseModel::loadModel(const QString &filename)
 				e.getErrorCode() >= ErrorCode::InvalidSyntax)
 		{
 			str_aux=Exception::getErrorMessage(ErrorCode::InvModelFileNotLoaded).arg(filename);
-			throw Exception(str_aux,ErrorCode::InvModelFileNotLoaded,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+			throw Exception(str_aux,ErrorCode::InvModelFileNotLoaded,__exc_origin, &e, extra_info);
 		}
 		else
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, extra_info);
 	}
 }
 
+DatabaseModel::LoadingTier DatabaseModel::getLoadingTier(ObjectType obj_type)
+{
+	switch(obj_type)
+	{
+		case ObjectType::Role:
+		case ObjectType::Tablespace:
+		case ObjectType::Schema:
+			return ClusterObjsTier;
+
+		case ObjectType::Table:
+		case ObjectType::View:
+		case ObjectType::ForeignTable:
+			return TablesTier;
+
+		case ObjectType::Relationship:
+		case ObjectType::BaseRelationship:
+		case ObjectType::Constraint:
+		case ObjectType::Index:
+		case ObjectType::Trigger:
+		case ObjectType::Rule:
+		case ObjectType::Policy:
+		case ObjectType::Permission:
+		case ObjectType::GenericSql:
+			return TableObjsTier;
+
+		default:
+			return SchemaObjsTier;
+	}
+}
+
+std::vector<DatabaseModel::LoadingStage> DatabaseModel::getLoadingStages()
+{
+	return loading_stages;
+}
+
 BaseObject *DatabaseModel::createObject(ObjectType obj_type)
 {
 	if(create_methods.count(obj_type) == 0)
@@ -3671,38 +4251,93 @@ BaseObject *DatabaseModel::createObject(ObjectType obj_type)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
-void DatabaseModel::setBasicAttributes(BaseObject *object)
+void DatabaseModel::getBasicAttributes(attribs_map &attribs)
 {
-	attribs_map attribs, attribs_aux;
+	attribs_map attribs_aux;
 	QString elem_name;
-	BaseObject *tabspc=nullptr, *owner=nullptr, *collation=nullptr;
-	Schema *schema=nullptr;
-	ObjectType obj_type=ObjectType::BaseObject, obj_type_aux;
-	bool has_error=false, protected_obj=false, sql_disabled=false;
+
+	xmlparser.getElementAttributes(attribs);
+
+	/* The attributes below are read from child elements, so any value coming
+	 * from the object's element itself is discarded */
+	for(auto &attr : { Attributes::Comment, Attributes::Schema, Attributes::Tablespace,
+										 Attributes::Owner, Attributes::Collation, Attributes::AppendedSql,
+										 Attributes::PrependedSql, Attributes::XPos, Attributes::YPos })
+		attribs[attr] = "";
+
+	xmlparser.savePosition();
+
+	if(xmlparser.accessElement(XmlParser::ChildElement))
+	{
+		do
+		{
+			if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+			{
+				elem_name=xmlparser.getElementName();
+
+				if(elem_name==Attributes::Comment || elem_name==Attributes::AppendedSql ||
+					 elem_name==Attributes::PrependedSql)
+				{
+					xmlparser.savePosition();
+					xmlparser.accessElement(XmlParser::ChildElement);
+					attribs[elem_name]=xmlparser.getElementContent();
+					xmlparser.restorePosition();
+				}
+				else if(elem_name==Attributes::Schema || elem_name==Attributes::Tablespace ||
+								elem_name==Attributes::Role || elem_name==Attributes::Collation)
+				{
+					xmlparser.getElementAttributes(attribs_aux);
+					attribs[elem_name==Attributes::Role ? Attributes::Owner : elem_name]=attribs_aux[Attributes::Name];
+				}
+				else if(elem_name==Attributes::Position)
+				{
+					xmlparser.getElementAttributes(attribs_aux);
+					attribs[Attributes::XPos]=attribs_aux[Attributes::XPos];
+					attribs[Attributes::YPos]=attribs_aux[Attributes::YPos];
+				}
+			}
+		}
+		while(xmlparser.accessElement(XmlParser::NextElement));
+	}
+
+	xmlparser.restorePosition();
+}
+
+void DatabaseModel::setBasicAttributes(BaseObject *object)
+{
+	attribs_map attribs;
+
+	if(!object)
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
+
+	getBasicAttributes(attribs);
+	setBasicAttributes(object, attribs);
+}
+
+void DatabaseModel::setBasicAttributes(BaseObject *object, attribs_map &attribs)
+{
+	ObjectType obj_type;
+	BaseObject *ref_obj=nullptr;
 	ForeignObject *frn_object = dynamic_cast<ForeignObject *>(object);
 
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
-	xmlparser.getElementAttributes(attribs);
-	obj_type_aux=object->getObjectType();
+	obj_type=object->getObjectType();
 
-	if(obj_type_aux!=ObjectType::Cast && obj_type_aux != ObjectType::UserMapping)
+	if(obj_type!=ObjectType::Cast && obj_type != ObjectType::UserMapping)
 		object->setName(attribs[Attributes::Name]);
 
-	if(BaseGraphicObject::isGraphicObject(obj_type_aux) && !attribs[Attributes::ZValue].isEmpty())
+	if(BaseGraphicObject::isGraphicObject(obj_type) && !attribs[Attributes::ZValue].isEmpty())
 		dynamic_cast<BaseGraphicObject *>(object)->setZValue(attribs[Attributes::ZValue].toInt());
 
-	if(BaseObject::acceptsAlias(obj_type_aux))
+	if(BaseObject::acceptsAlias(obj_type))
 		object->setAlias(attribs[Attributes::Alias]);
 
-	protected_obj=attribs[Attributes::Protected]==Attributes::True;
-	sql_disabled=attribs[Attributes::SqlDisabled]==Attributes::True;
-
 	if(frn_object)
 	{
 		QStringList opt_val;
@@ -3718,114 +4353,63 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 		}
 	}
 
-	xmlparser.savePosition();
+	object->setComment(attribs[Attributes::Comment]);
 
-	if(xmlparser.accessElement(XmlParser::ChildElement))
-	{
-		do
-		{
-			if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-			{
-				elem_name=xmlparser.getElementName();
+	if(!attribs[Attributes::AppendedSql].isEmpty())
+		object->setAppendedSQL(attribs[Attributes::AppendedSql]);
 
-				//Defines the object's comment
-				if(elem_name==Attributes::Comment)
-				{
-					xmlparser.savePosition();
-					xmlparser.accessElement(XmlParser::ChildElement);
-					object->setComment(xmlparser.getElementContent());
-					xmlparser.restorePosition();
-				}
-				//Defines the object's schema
-				else if(elem_name==Attributes::Schema)
-				{
-					obj_type=ObjectType::Schema;
-					xmlparser.getElementAttributes(attribs_aux);
-					schema=dynamic_cast<Schema *>(getObject(attribs_aux[Attributes::Name], obj_type));
-					object->setSchema(schema);
-					has_error=(!schema && !attribs_aux[Attributes::Name].isEmpty());
-				}
-				//Defines the object's tablespace
-				else if(elem_name==Attributes::Tablespace)
-				{
-					obj_type=ObjectType::Tablespace;
-					xmlparser.getElementAttributes(attribs_aux);
-					tabspc=getObject(attribs_aux[Attributes::Name], obj_type);
-					object->setTablespace(tabspc);
-					has_error=(!tabspc && !attribs_aux[Attributes::Name].isEmpty());
-				}
-				//Defines the object's owner
-				else if(elem_name==Attributes::Role)
-				{
-					obj_type=ObjectType::Role;
-					xmlparser.getElementAttributes(attribs_aux);
-					owner=getObject(attribs_aux[Attributes::Name], obj_type);
-					object->setOwner(owner);
-					has_error=(!owner && !attribs_aux[Attributes::Name].isEmpty());
-				}
-				//Defines the object's schema
-				else if(elem_name==Attributes::Collation)
-				{
-					obj_type=ObjectType::Collation;
-					xmlparser.getElementAttributes(attribs_aux);
-					collation=getObject(attribs_aux[Attributes::Name], obj_type);
-					object->setCollation(collation);
-					has_error=(!collation && !attribs_aux[Attributes::Name].isEmpty());
-				}
-				else if(elem_name==Attributes::AppendedSql)
-				{
-					xmlparser.savePosition();
-					xmlparser.accessElement(XmlParser::ChildElement);
-					object->setAppendedSQL(xmlparser.getElementContent());
-					xmlparser.restorePosition();
-				}
-				else if(elem_name==Attributes::PrependedSql)
-				{
-					xmlparser.savePosition();
-					xmlparser.accessElement(XmlParser::ChildElement);
-					object->setPrependedSQL(xmlparser.getElementContent());
-					xmlparser.restorePosition();
-				}
-				//Defines the object's position (only for graphical objects)
-				else if(elem_name==Attributes::Position)
-				{
-					xmlparser.getElementAttributes(attribs);
+	if(!attribs[Attributes::PrependedSql].isEmpty())
+		object->setPrependedSQL(attribs[Attributes::PrependedSql]);
 
-					if(elem_name==Attributes::Position &&
-							(obj_type_aux!=ObjectType::Relationship &&
-							 obj_type_aux!=ObjectType::BaseRelationship))
-					{
-						dynamic_cast<BaseGraphicObject *>(object)->setPosition(QPointF(attribs[Attributes::XPos].toDouble(),
-																				 attribs[Attributes::YPos].toDouble()));
+	for(auto &[attr, ref_type] : std::vector<std::pair<QString, ObjectType>>{ { Attributes::Schema, ObjectType::Schema },
+																																						{ Attributes::Owner, ObjectType::Role },
+																																						{ Attributes::Tablespace, ObjectType::Tablespace },
+																																						{ Attributes::Collation, ObjectType::Collation } })
+	{
+		if(attribs[attr].isEmpty())
+			continue;
 
+		ref_obj=getObject(attribs[attr], ref_type);
 
-					}
-				}
-			}
-		}
-		while(!has_error && xmlparser.accessElement(XmlParser::NextElement));
+		if(!ref_obj)
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
+							.arg(object->getName())
+							.arg(object->getTypeName())
+							.arg(attribs[attr])
+							.arg(BaseObject::getTypeName(ref_type)),
+							ErrorCode::RefObjectInexistsModel,__exc_origin);
+		}
+
+		if(ref_type==ObjectType::Schema)
+			object->setSchema(ref_obj);
+		else if(ref_type==ObjectType::Role)
+			object->setOwner(ref_obj);
+		else if(ref_type==ObjectType::Tablespace)
+			object->setTablespace(ref_obj);
+		else
+			object->setCollation(ref_obj);
 	}
 
-	xmlparser.restorePosition();
-	object->setProtected(protected_obj);
-	object->setSQLDisabled(sql_disabled);
-
-	if(has_error)
+	//Defines the object's position (only for graphical objects)
+	if(BaseGraphicObject::isGraphicObject(obj_type) &&
+		 obj_type!=ObjectType::Relationship && obj_type!=ObjectType::BaseRelationship &&
+		 (!attribs[Attributes::XPos].isEmpty() || !attribs[Attributes::YPos].isEmpty()))
 	{
-		throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
-						.arg(object->getName())
-						.arg(object->getTypeName())
-						.arg(attribs_aux[Attributes::Name])
-				.arg(BaseObject::getTypeName(obj_type)),
-				ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		dynamic_cast<BaseGraphicObject *>(object)->setPosition(QPointF(attribs[Attributes::XPos].toDouble(),
+																																	 attribs[Attributes::YPos].toDouble()));
 	}
+
+	object->setProtected(attribs[Attributes::Protected]==Attributes::True);
+	object->setSQLDisabled(attribs[Attributes::SqlDisabled]==Attributes::True);
+
 	//Schema on extensions are optional
-	else if(!object->getSchema() && (BaseObject::acceptsSchema(obj_type_aux) && obj_type_aux != ObjectType::Extension))
+	if(!object->getSchema() && (BaseObject::acceptsSchema(obj_type) && obj_type != ObjectType::Extension))
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvObjectAllocationNoSchema)
 						.arg(object->getName())
 						.arg(object->getTypeName()),
-						ErrorCode::InvObjectAllocationNoSchema,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::InvObjectAllocationNoSchema,__exc_origin);
 	}
 }
 
@@ -3985,7 +4569,7 @@ Role *DatabaseModel::createRole()
 												.arg(BaseObject::getTypeName(ObjectType::Role))
 												.arg(list[i])
 												.arg(BaseObject::getTypeName(ObjectType::Role)),
-												ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::RefObjectInexistsModel,__exc_origin);
 							}
 
 							role->addRole(role_type, ref_role);
@@ -3999,7 +4583,7 @@ Role *DatabaseModel::createRole()
 	catch(Exception &e)
 	{
 		if(role) delete role;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return role;
@@ -4020,7 +4604,7 @@ Tablespace *DatabaseModel::createTablespace()
 	catch(Exception &e)
 	{
 		if(tabspc) delete tabspc;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return tabspc;
@@ -4045,7 +4629,7 @@ Schema *DatabaseModel::createSchema()
 	catch(Exception &e)
 	{
 		if(schema) delete schema;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return schema;
@@ -4098,7 +4682,7 @@ Language *DatabaseModel::createLanguage()
 												.arg(lang->getTypeName())
 												.arg(signature)
 												.arg(BaseObject::getTypeName(ObjectType::Function)),
-												ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 							if(ref_type==Attributes::ValidatorFunc)
 								lang->setFunction(dynamic_cast<Function *>(func), Language::ValidatorFunc);
@@ -4110,7 +4694,7 @@ Language *DatabaseModel::createLanguage()
 						}
 						else
 							//Raises an error if the function type is invalid
-							throw Exception(ErrorCode::RefFunctionInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ErrorCode::RefFunctionInvalidType,__exc_origin);
 					}
 				}
 			}
@@ -4121,154 +4705,137 @@ Language *DatabaseModel::createLanguage()
 	catch(Exception &e)
 	{
 		if(lang) delete lang;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return lang;
 }
 
-void DatabaseModel::setBasicFunctionAttributes(BaseFunction *func)
+void DatabaseModel::getBasicFunctionAttributes(attribs_map &attribs, std::vector<Parameter> &params)
 {
-	if(!func)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	try
-	{
-		attribs_map attribs, attribs_aux;
-		QString elem;
-		BaseObject *object = nullptr;
-		Parameter param;
-		ObjectType obj_type;
+	attribs_map attribs_aux;
+	QStringList cfg_params;
 
-		setBasicAttributes(func);
-		xmlparser.getElementAttributes(attribs);
+	getBasicAttributes(attribs);
+	params.clear();
 
-		if(!attribs[Attributes::SecurityType].isEmpty())
-			func->setSecurityType(SecurityType(attribs[Attributes::SecurityType]));
+	for(auto &attr : { Attributes::Language, Attributes::Library, Attributes::Symbol,
+										 Attributes::Definition, Attributes::TransformTypes, Attributes::ConfigParams })
+		attribs[attr] = "";
 
-		xmlparser.savePosition();
+	xmlparser.savePosition();
 
-		if(xmlparser.accessElement(XmlParser::ChildElement))
+	if(xmlparser.accessElement(XmlParser::ChildElement))
+	{
+		do
 		{
-			do
+			if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				//Gets the function language
+				if(BaseObject::getObjectType(xmlparser.getElementName())==ObjectType::Language)
 				{
-					elem = xmlparser.getElementName();
-					obj_type = BaseObject::getObjectType(elem);
-
-					//Gets the function language
-					if(obj_type==ObjectType::Language)
-					{
-						xmlparser.getElementAttributes(attribs);
-						object = getObject(attribs[Attributes::Name], obj_type);
-
-						//Raises an error if the function doesn't exisits
-						if(!object)
-							throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
-											.arg(func->getName())
-											.arg(func->getTypeName())
-											.arg(attribs[Attributes::Name])
-								.arg(BaseObject::getTypeName(ObjectType::Language)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+					xmlparser.getElementAttributes(attribs_aux);
+					attribs[Attributes::Language]=attribs_aux[Attributes::Name];
+				}
+				//Gets a function parameter
+				else if(xmlparser.getElementName()==Attributes::Parameter)
+					params.push_back(createParameter());
+				//Gets the function code definition
+				else if(xmlparser.getElementName()==Attributes::Definition)
+				{
+					xmlparser.savePosition();
+					xmlparser.getElementAttributes(attribs_aux);
 
-						func->setLanguage(dynamic_cast<Language *>(object));
-					}
-					//Gets a function parameter
-					else if(xmlparser.getElementName()==Attributes::Parameter)
+					if(!attribs_aux[Attributes::Library].isEmpty())
 					{
-						param = createParameter();
-						func->addParameter(param);
+						attribs[Attributes::Library]=attribs_aux[Attributes::Library];
+						attribs[Attributes::Symbol]=attribs_aux[Attributes::Symbol];
 					}
-					//Gets the function code definition
-					else if(xmlparser.getElementName()==Attributes::Definition)
-					{
-						xmlparser.savePosition();
-						xmlparser.getElementAttributes(attribs_aux);
+					else if(xmlparser.accessElement(XmlParser::ChildElement))
+						attribs[Attributes::Definition]=xmlparser.getElementContent();
 
-						if(!attribs_aux[Attributes::Library].isEmpty())
-						{
-							func->setLibrary(attribs_aux[Attributes::Library]);
-							func->setSymbol(attribs_aux[Attributes::Symbol]);
-						}
-						else if(xmlparser.accessElement(XmlParser::ChildElement))
-							func->setFunctionSource(xmlparser.getElementContent());
-
-						xmlparser.restorePosition();
-					}
-					else if(xmlparser.getElementName() == Attributes::TransformTypes)
-					{
-						xmlparser.savePosition();
-						xmlparser.getElementAttributes(attribs_aux);
-						func->addTransformTypes(attribs_aux[Attributes::Names].split(',', Qt::SkipEmptyParts));
-						xmlparser.restorePosition();
-					}
-					else if(xmlparser.getElementName() == Attributes::Configuration)
-					{
-						xmlparser.savePosition();
-						xmlparser.getElementAttributes(attribs_aux);
-						func->setConfigurationParam(attribs_aux[Attributes::Name], attribs_aux[Attributes::Value]);
-						xmlparser.restorePosition();
-					}
+					xmlparser.restorePosition();
+				}
+				else if(xmlparser.getElementName() == Attributes::TransformTypes)
+				{
+					xmlparser.getElementAttributes(attribs_aux);
+					attribs[Attributes::TransformTypes]=attribs_aux[Attributes::Names];
+				}
+				else if(xmlparser.getElementName() == Attributes::Configuration)
+				{
+					xmlparser.getElementAttributes(attribs_aux);
+					cfg_params.append(attribs_aux[Attributes::Name] + "=" + attribs_aux[Attributes::Value]);
 				}
 			}
-			while(xmlparser.accessElement(XmlParser::NextElement));
 		}
-
-		xmlparser.restorePosition();
+		while(xmlparser.accessElement(XmlParser::NextElement));
 	}
-	catch(Exception &e)
-	{
-		if(e.getErrorCode()==ErrorCode::RefUserTypeInexistsModel)
-			throw Exception(Exception::getErrorMessage(ErrorCode::AsgObjectInvalidDefinition)
-							.arg(func->getName())
-							.arg(func->getTypeName()),
-							ErrorCode::AsgObjectInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, getErrorExtraInfo());
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
-	}
+	xmlparser.restorePosition();
+	attribs[Attributes::ConfigParams]=cfg_params.join(UtilsNs::DataSeparator);
 }
 
-Function *DatabaseModel::createFunction()
+void DatabaseModel::setBasicFunctionAttributes(BaseFunction *func, attribs_map &attribs, const std::vector<Parameter> &params)
 {
-	attribs_map attribs, attribs_aux;
-	Function *func = nullptr;
-	PgSqlType type;
-	QString str_aux;
-	Parameter param;
+	BaseObject *lang=nullptr;
+	int pos=-1;
 
-	try
+	if(!func)
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
+
+	setBasicAttributes(func, attribs);
+
+	if(!attribs[Attributes::SecurityType].isEmpty())
+		func->setSecurityType(SecurityType(attribs[Attributes::SecurityType]));
+
+	if(!attribs[Attributes::Language].isEmpty())
 	{
-		func = new Function;
-		setBasicFunctionAttributes(func);
-		xmlparser.getElementAttributes(attribs);
+		lang=getObject(attribs[Attributes::Language], ObjectType::Language);
 
-		if(!attribs[Attributes::ReturnsSetOf].isEmpty())
-			func->setReturnSetOf(attribs[Attributes::ReturnsSetOf]==
-					Attributes::True);
+		//Raises an error if the language doesn't exisits
+		if(!lang)
+			throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
+							.arg(func->getName())
+							.arg(func->getTypeName())
+							.arg(attribs[Attributes::Language])
+							.arg(BaseObject::getTypeName(ObjectType::Language)),
+							ErrorCode::RefObjectInexistsModel,__exc_origin);
 
-		if(!attribs[Attributes::WindowFunc].isEmpty())
-			func->setWindowFunction(attribs[Attributes::WindowFunc]==
-					Attributes::True);
+		func->setLanguage(dynamic_cast<Language *>(lang));
+	}
 
-		if(!attribs[Attributes::LeakProof].isEmpty())
-			func->setLeakProof(attribs[Attributes::LeakProof]==
-					Attributes::True);
+	for(auto &param : params)
+		func->addParameter(param);
 
-		if(!attribs[Attributes::BehaviorType].isEmpty())
-			func->setBehaviorType(BehaviorType(attribs[Attributes::BehaviorType]));
+	if(!attribs[Attributes::Library].isEmpty())
+	{
+		func->setLibrary(attribs[Attributes::Library]);
+		func->setSymbol(attribs[Attributes::Symbol]);
+	}
+	else if(!attribs[Attributes::Definition].isEmpty())
+		func->setFunctionSource(attribs[Attributes::Definition]);
 
-		if(!attribs[Attributes::FunctionType].isEmpty())
-			func->setFunctionType(FunctionType(attribs[Attributes::FunctionType]));
+	func->addTransformTypes(attribs[Attributes::TransformTypes].split(',', Qt::SkipEmptyParts));
 
-		if(!attribs[Attributes::ParallelType].isEmpty())
-			func->setParalleType(ParallelType(attribs[Attributes::ParallelType]));
+	//Configuration parameters are stored as "name=value" pairs, the value itself may contain '='
+	for(auto &cfg : attribs[Attributes::ConfigParams].split(UtilsNs::DataSeparator, Qt::SkipEmptyParts))
+	{
+		pos=cfg.indexOf('=');
 
-		if(!attribs[Attributes::ExecutionCost].isEmpty())
-			func->setExecutionCost(attribs[Attributes::ExecutionCost].toInt());
+		if(pos > 0)
+			func->setConfigurationParam(cfg.left(pos), cfg.mid(pos + 1));
+	}
+}
+
+Function *DatabaseModel::createFunction()
+{
+	attribs_map attribs;
+	std::vector<Parameter> params, ret_table_cols;
+	PgSqlType ret_type("void");
 
-		if(!attribs[Attributes::RowAmount].isEmpty())
-			func->setRowAmount(attribs[Attributes::RowAmount].toInt());
+	try
+	{
+		getBasicFunctionAttributes(attribs, params);
 
 		if(xmlparser.accessElement(XmlParser::ChildElement))
 		{
@@ -4291,16 +4858,10 @@ Function *DatabaseModel::createFunction()
 								{
 									//when the element found is a TYPE indicates that the function return type is a single one
 									if(xmlparser.getElementName()==Attributes::Type)
-									{
-										type=createPgSQLType();
-										func->setReturnType(type);
-									}
+										ret_type=createPgSQLType();
 									//when the element found is a PARAMETER indicates that the function return type is a table
 									else if(xmlparser.getElementName()==Attributes::Parameter)
-									{
-										param = createParameter();
-										func->addReturnedTableColumn(param.getName(), param.getType());
-									}
+										ret_table_cols.push_back(createParameter());
 								}
 							}
 							while(xmlparser.accessElement(XmlParser::NextElement));
@@ -4310,29 +4871,77 @@ Function *DatabaseModel::createFunction()
 						catch(Exception &e)
 						{
 							xmlparser.restorePosition();
-							throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+							throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 						}
 					}
 				}
 			}
 			while(xmlparser.accessElement(XmlParser::NextElement));
 		}
+
+		return createFunction(attribs, params, ret_type, ret_table_cols);
 	}
 	catch(Exception &e)
 	{
-		if(func)
-		{
-			str_aux = func->getName();
-			delete func;
-		}
-
 		if(e.getErrorCode()==ErrorCode::RefUserTypeInexistsModel)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgObjectInvalidDefinition)
-							.arg(str_aux)
+							.arg(attribs[Attributes::Name])
 							.arg(BaseObject::getTypeName(ObjectType::Function)),
-							ErrorCode::AsgObjectInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, getErrorExtraInfo());
+							ErrorCode::AsgObjectInvalidDefinition,__exc_origin,&e, getErrorExtraInfo());
+		else
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
+	}
+}
+
+Function *DatabaseModel::createFunction(attribs_map &attribs, const std::vector<Parameter> &params,
+																				const PgSqlType &ret_type, const std::vector<Parameter> &ret_table_cols)
+{
+	Function *func = nullptr;
+
+	try
+	{
+		func = new Function;
+		setBasicFunctionAttributes(func, attribs, params);
+
+		if(!attribs[Attributes::ReturnsSetOf].isEmpty())
+			func->setReturnSetOf(attribs[Attributes::ReturnsSetOf]==
+					Attributes::True);
+
+		if(!attribs[Attributes::WindowFunc].isEmpty())
+			func->setWindowFunction(attribs[Attributes::WindowFunc]==
+					Attributes::True);
+
+		if(!attribs[Attributes::LeakProof].isEmpty())
+			func->setLeakProof(attribs[Attributes::LeakProof]==
+					Attributes::True);
+
+		if(!attribs[Attributes::BehaviorType].isEmpty())
+			func->setBehaviorType(BehaviorType(attribs[Attributes::BehaviorType]));
+
+		if(!attribs[Attributes::FunctionType].isEmpty())
+			func->setFunctionType(FunctionType(attribs[Attributes::FunctionType]));
+
+		if(!attribs[Attributes::ParallelType].isEmpty())
+			func->setParalleType(ParallelType(attribs[Attributes::ParallelType]));
+
+		if(!attribs[Attributes::ExecutionCost].isEmpty())
+			func->setExecutionCost(attribs[Attributes::ExecutionCost].toInt());
+
+		if(!attribs[Attributes::RowAmount].isEmpty())
+			func->setRowAmount(attribs[Attributes::RowAmount].toInt());
+
+		if(!ret_table_cols.empty())
+		{
+			for(auto &col : ret_table_cols)
+				func->addReturnedTableColumn(col.getName(), col.getType());
+		}
 		else
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+			func->setReturnType(ret_type);
+	}
+	catch(Exception &e)
+	{
+		if(func) delete func;
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 
 	return func;
@@ -4379,7 +4988,7 @@ Parameter DatabaseModel::createParameter()
 	{
 		QString extra_info=getErrorExtraInfo();
 		xmlparser.restorePosition();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, extra_info);
 	}
 
 	return param;
@@ -4425,7 +5034,7 @@ TypeAttribute DatabaseModel::createTypeAttribute()
 											.arg(tpattrib.getTypeName())
 											.arg(attribs[Attributes::Name])
 									.arg(BaseObject::getTypeName(ObjectType::Collation)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 
 						tpattrib.setCollation(collation);
@@ -4441,7 +5050,7 @@ TypeAttribute DatabaseModel::createTypeAttribute()
 	{
 		QString extra_info=getErrorExtraInfo();
 		xmlparser.restorePosition();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, extra_info);
 	}
 
 	return tpattrib;
@@ -4497,7 +5106,7 @@ PgSqlType DatabaseModel::createPgSQLType()
 	{
 		//Raises an error if the referenced type name doesn't exists
 		if(PgSqlType::getUserTypeIndex(name, nullptr, this) == PgSqlType::Null)
-			throw Exception(ErrorCode::RefUserTypeInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::RefUserTypeInexistsModel,__exc_origin);
 
 		type_idx = PgSqlType::getUserTypeIndex(name, ptype, this);
 		return PgSqlType(type_idx, dimension, length, precision, with_timezone, interv_type, spatial_type);
@@ -4612,7 +5221,7 @@ Type *DatabaseModel::createType()
 											.arg(type->getTypeName())
 											.arg(attribs[Attributes::Name])
 									.arg(BaseObject::getTypeName(ObjectType::Collation)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 
 						type->setCollation(collation);
@@ -4630,7 +5239,7 @@ Type *DatabaseModel::createType()
 											.arg(type->getTypeName())
 											.arg(attribs[Attributes::Name])
 									.arg(BaseObject::getTypeName(ObjectType::OpClass)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 
 						type->setSubtypeOpClass(op_class);
@@ -4650,10 +5259,10 @@ Type *DatabaseModel::createType()
 											.arg(type->getTypeName())
 											.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::Function)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 						//Raises an error if the function type is invalid
 						else if(func_types.count(attribs[Attributes::RefType])==0)
-							throw Exception(ErrorCode::RefFunctionInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ErrorCode::RefFunctionInvalidType,__exc_origin);
 
 						type->setFunction(func_types[attribs[Attributes::RefType]],	dynamic_cast<Function *>(func));
 					}
@@ -4674,9 +5283,9 @@ Type *DatabaseModel::createType()
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgObjectInvalidDefinition)
 							.arg(str_aux)
 							.arg(type->getTypeName()),
-							ErrorCode::AsgObjectInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, getErrorExtraInfo());
+							ErrorCode::AsgObjectInvalidDefinition,__exc_origin,&e, getErrorExtraInfo());
 		else
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return type;
@@ -4729,7 +5338,7 @@ Domain *DatabaseModel::createDomain()
 	catch(Exception &e)
 	{
 		if(domain) delete domain;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return domain;
@@ -4790,7 +5399,7 @@ Cast *DatabaseModel::createCast()
 											.arg(cast->getTypeName())
 											.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::Function)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						cast->setCastFunction(dynamic_cast<Function *>(func));
 					}
@@ -4802,7 +5411,7 @@ Cast *DatabaseModel::createCast()
 	catch(Exception &e)
 	{
 		if(cast) delete cast;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return cast;
@@ -4849,7 +5458,7 @@ Conversion *DatabaseModel::createConversion()
 											.arg(conv->getTypeName())
 											.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::Function)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						conv->setConversionFunction(dynamic_cast<Function *>(func));
 					}
@@ -4861,7 +5470,7 @@ Conversion *DatabaseModel::createConversion()
 	catch(Exception &e)
 	{
 		if(conv) delete conv;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return conv;
@@ -4914,7 +5523,7 @@ Operator *DatabaseModel::createOperator()
 											.arg(oper->getTypeName())
 											.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::Operator)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						oper->setOperator(dynamic_cast<Operator *>(oper_aux),
 											oper_ids[attribs[Attributes::RefType]]);
@@ -4943,7 +5552,7 @@ Operator *DatabaseModel::createOperator()
 											.arg(oper->getTypeName())
 											.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::Function)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						oper->setFunction(dynamic_cast<Function *>(func),
 											func_ids[attribs[Attributes::RefType]]);
@@ -4956,7 +5565,7 @@ Operator *DatabaseModel::createOperator()
 	catch(Exception &e)
 	{
 		if(oper) delete oper;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return oper;
@@ -5006,7 +5615,7 @@ OperatorClass *DatabaseModel::createOperatorClass()
 											.arg(op_class->getTypeName())
 											.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::OpFamily)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						op_class->setFamily(dynamic_cast<OperatorFamily *>(object));
 					}
@@ -5056,7 +5665,7 @@ OperatorClass *DatabaseModel::createOperatorClass()
 													.arg(op_class->getTypeName())
 													.arg(attribs_aux[Attributes::Signature])
 										.arg(BaseObject::getTypeName(ObjectType::OpFamily)),
-										ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 								class_elem.setOperatorFamily(dynamic_cast<OperatorFamily *>(object));
 								xmlparser.restorePosition();
@@ -5074,7 +5683,7 @@ OperatorClass *DatabaseModel::createOperatorClass()
 	catch(Exception &e)
 	{
 		if(op_class) delete op_class;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return op_class;
@@ -5095,7 +5704,7 @@ OperatorFamily *DatabaseModel::createOperatorFamily()
 	catch(Exception &e)
 	{
 		if(op_family) delete op_family;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return op_family;
@@ -5147,7 +5756,7 @@ Aggregate *DatabaseModel::createAggregate()
 											.arg(aggreg->getTypeName())
 											.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::Function)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						if(attribs[Attributes::RefType]==Attributes::TransitionFunc)
 							aggreg->setFunction(Aggregate::TransitionFunc,
@@ -5164,7 +5773,7 @@ Aggregate *DatabaseModel::createAggregate()
 	catch(Exception &e)
 	{
 		if(aggreg) delete aggreg;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return aggreg;
@@ -5188,7 +5797,7 @@ Table *DatabaseModel::createTable()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -5225,7 +5834,7 @@ Column *DatabaseModel::createColumn()
 					.arg(BaseObject::getTypeName(ObjectType::Column))
 					.arg(attribs[Attributes::Sequence])
 					.arg(BaseObject::getTypeName(ObjectType::Sequence)),
-					ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+					ErrorCode::RefObjectInexistsModel,__exc_origin);
 			}
 
 
@@ -5252,7 +5861,7 @@ Column *DatabaseModel::createColumn()
 	catch(Exception &e)
 	{
 		if(column) delete column;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return column;
@@ -5260,25 +5869,99 @@ Column *DatabaseModel::createColumn()
 
 Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 {
-	attribs_map attribs;
+	attribs_map attribs, attribs_aux;
+	Constraint *constr=nullptr;
+	PhysicalTable *table=nullptr;
+	QString elem;
+	ExcludeElement exc_elem;
+
+	try
+	{
+		getBasicAttributes(attribs);
+		attribs[Attributes::SrcColumns]=attribs[Attributes::DstColumns]=attribs[Attributes::Expression]="";
+
+		xmlparser.savePosition();
+
+		if(xmlparser.accessElement(XmlParser::ChildElement))
+		{
+			do
+			{
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				{
+					elem=xmlparser.getElementName();
+
+					if(elem==Attributes::Expression)
+					{
+						xmlparser.savePosition();
+						xmlparser.accessElement(XmlParser::ChildElement);
+						attribs[Attributes::Expression]=xmlparser.getElementContent();
+						xmlparser.restorePosition();
+					}
+					else if(elem==Attributes::Columns)
+					{
+						xmlparser.getElementAttributes(attribs_aux);
+
+						if(attribs_aux[Attributes::RefType]==Attributes::SrcColumns)
+							attribs[Attributes::SrcColumns]=attribs_aux[Attributes::Names];
+						else
+							attribs[Attributes::DstColumns]=attribs_aux[Attributes::Names];
+					}
+				}
+			}
+			while(xmlparser.accessElement(XmlParser::NextElement));
+		}
+
+		xmlparser.restorePosition();
+		constr=createConstraint(parent_obj, attribs, {});
+
+		/* The exclude elements are created only after the constraint because
+		 * they need it to report missing operators and operator classes */
+		if(xmlparser.accessElement(XmlParser::ChildElement))
+		{
+			do
+			{
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE &&
+					 xmlparser.getElementName()==Attributes::ExcludeElement)
+				{
+					createElement(exc_elem, constr, parent_obj ? parent_obj : constr->getParentTable());
+					constr->addExcludeElement(exc_elem);
+				}
+			}
+			while(xmlparser.accessElement(XmlParser::NextElement));
+		}
+
+		if(!parent_obj && constr->getConstraintType()!=ConstraintType::PrimaryKey)
+		{
+			table=dynamic_cast<PhysicalTable *>(constr->getParentTable());
+			table->addConstraint(constr);
+
+			if(this->getObjectIndex(table) >= 0)
+				table->setModified(!loading_model);
+		}
+	}
+	catch(Exception &e)
+	{
+		if(constr) delete constr;
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
+	}
+
+	return constr;
+}
+
+Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj, attribs_map &attribs, const std::vector<ExcludeElement> &exc_elems)
+{
 	Constraint *constr=nullptr;
 	BaseObject *ref_table=nullptr;
 	PhysicalTable *table=nullptr,*table_aux=nullptr;
 	Column *column=nullptr;
 	Relationship *rel=nullptr;
-	QString elem, str_aux;
-	bool deferrable, ins_constr_table=false;
+	QString str_aux;
+	bool deferrable;
 	ConstraintType constr_type;
-	QStringList col_list;
-	int count, i;
-	Constraint::ColumnsId cols_id;
 	ObjectType obj_type;
-	ExcludeElement exc_elem;
 
 	try
 	{
-		xmlparser.getElementAttributes(attribs);
-
 		//If the constraint parent is allocated
 		if(parent_obj)
 		{
@@ -5291,14 +5974,13 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 				rel=dynamic_cast<Relationship *>(parent_obj);
 			else
 				//Raises an error if the user tries to create a constraint in a invalid parent
-				throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ErrorCode::OprObjectInvalidType,__exc_origin);
 		}
 		else
 		{
 			obj_type = ObjectType::Table;
 			table = dynamic_cast<PhysicalTable *>(getObject(attribs[Attributes::Table], {ObjectType::Table, ObjectType::ForeignTable}));
 			parent_obj=table;
-			ins_constr_table=true;
 
 			//Raises an error if the parent table doesn't exists
 			if(!table)
@@ -5309,7 +5991,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 						.arg(attribs[Attributes::Table])
 						.arg(BaseObject::getTypeName(obj_type));
 
-				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 			}
 		}
 
@@ -5333,13 +6015,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 		if(!attribs[Attributes::Factor].isEmpty())
 			constr->setFillFactor(attribs[Attributes::Factor].toUInt());
 
-		setBasicAttributes(constr);
-
-		//Raises an error if the constraint is a primary key and no parent object is specified
-		if(!parent_obj && constr_type==ConstraintType::PrimaryKey)
-			throw Exception(Exception::getErrorMessage(ErrorCode::InvPrimaryKeyAllocation)
-							.arg(constr->getName()),
-							ErrorCode::InvPrimaryKeyAllocation,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		setBasicAttributes(constr, attribs);
 
 		deferrable=(attribs[Attributes::Deferrable]==Attributes::True);
 		constr->setDeferrable(deferrable);
@@ -5360,7 +6036,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 
 			ref_table=getObject(attribs[Attributes::RefTable], ObjectType::Table);
 
-			if(!ref_table && table->getName(true)==attribs[Attributes::RefTable])
+			if(!ref_table && table && table->getName(true)==attribs[Attributes::RefTable])
 				ref_table=table;
 
 			//Raises an error if the referenced table doesn't exists
@@ -5372,7 +6048,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 						.arg(attribs[Attributes::RefTable])
 						.arg(BaseObject::getTypeName(ObjectType::Table));
 
-				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 			}
 
 			constr->setReferencedTable(dynamic_cast<BaseTable *>(ref_table));
@@ -5388,88 +6064,49 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 		else if(constr_type==ConstraintType::Unique)
 			constr->setNullsNotDistinct(attribs[Attributes::NullsNotDistinct]==Attributes::True);
 
-		if(xmlparser.accessElement(XmlParser::ChildElement))
+		for(auto &col_name : attribs[Attributes::SrcColumns].split(',', Qt::SkipEmptyParts))
 		{
-			do
+			if(PhysicalTable::isPhysicalTable(obj_type))
 			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-				{
-					elem=xmlparser.getElementName();
-
-					if(elem==Attributes::ExcludeElement)
-					{
-						createElement(exc_elem, constr, parent_obj);
-						constr->addExcludeElement(exc_elem);
-					}
-					else if(elem==Attributes::Expression)
-					{
-						xmlparser.savePosition();
-						xmlparser.accessElement(XmlParser::ChildElement);
-
-						constr->setExpression(xmlparser.getElementContent());
-
-						xmlparser.restorePosition();
-					}
-					else if(elem==Attributes::Columns)
-					{
-						xmlparser.getElementAttributes(attribs);
+				column=table->getColumn(col_name);
 
-						col_list=attribs[Attributes::Names].split(',');
-						count=col_list.count();
+				//If the column doesn't exists tries to get it searching by the old name
+				if(!column)
+					column=table->getColumn(col_name, true);
+			}
+			else
+				column=dynamic_cast<Column *>(rel->getObject(col_name, ObjectType::Column));
 
-						if(attribs[Attributes::RefType]==Attributes::SrcColumns)
-							cols_id=Constraint::SourceCols;
-						else
-							cols_id=Constraint::ReferencedCols;
+			constr->addColumn(column, Constraint::SourceCols);
+		}
 
-						for(i=0; i < count; i++)
-						{
-							if(cols_id==Constraint::SourceCols)
-							{
-								if(PhysicalTable::isPhysicalTable(obj_type))
-								{
-									column=table->getColumn(col_list[i]);
+		table_aux=dynamic_cast<PhysicalTable *>(ref_table);
 
-									//If the column doesn't exists tries to get it searching by the old name
-									if(!column)
-										column=table->getColumn(col_list[i], true);
-								}
-								else
-									column=dynamic_cast<Column *>(rel->getObject(col_list[i], ObjectType::Column));
-							}
-							else
-							{
-								table_aux=dynamic_cast<PhysicalTable *>(ref_table);
-								column=table_aux->getColumn(col_list[i]);
+		for(auto &col_name : attribs[Attributes::DstColumns].split(',', Qt::SkipEmptyParts))
+		{
+			column=table_aux ? table_aux->getColumn(col_name) : nullptr;
 
-								//If the column doesn't exists tries to get it searching by the old name
-								if(!column)
-									column=table_aux->getColumn(col_list[i], true);
-							}
+			//If the column doesn't exists tries to get it searching by the old name
+			if(!column && table_aux)
+				column=table_aux->getColumn(col_name, true);
 
-							constr->addColumn(column, cols_id);
-						}
-					}
-				}
-			}
-			while(xmlparser.accessElement(XmlParser::NextElement));
+			constr->addColumn(column, Constraint::ReferencedCols);
 		}
 
-		if(ins_constr_table)
+		if(constr_type==ConstraintType::Exclude)
 		{
-			if(constr->getConstraintType()!=ConstraintType::PrimaryKey)
-			{
-				table->addConstraint(constr);
-
-				if(this->getObjectIndex(table) >= 0)
-					table->setModified(!loading_model);
-			}
+			for(auto &elem : exc_elems)
+				constr->addExcludeElement(elem);
 		}
+
+		if((constr_type==ConstraintType::Check || constr_type==ConstraintType::Exclude) &&
+			 !attribs[Attributes::Expression].isEmpty())
+			constr->setExpression(attribs[Attributes::Expression]);
 	}
 	catch(Exception &e)
 	{
 		if(constr) delete constr;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 
 	return constr;
@@ -5525,7 +6162,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 											.arg(tab_obj->getTypeName())
 											.arg(attribs[Attributes::Signature])
 									.arg(BaseObject::getTypeName(ObjectType::OpClass)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 						else
 						{
@@ -5533,7 +6170,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 											.arg(parent_obj->getName())
 											.arg(attribs[Attributes::Signature])
 									.arg(BaseObject::getTypeName(ObjectType::OpClass)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 					}
 
@@ -5553,7 +6190,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 										.arg(tab_obj->getTypeName())
 										.arg(attribs[Attributes::Signature])
 								.arg(BaseObject::getTypeName(ObjectType::Operator)),
-								ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RefObjectInexistsModel,__exc_origin);
 					}
 
 					elem.setOperator(oper);
@@ -5573,7 +6210,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 															.arg(tab_obj->getTypeName())
 															.arg(attribs[Attributes::Name])
 															.arg(BaseObject::getTypeName(ObjectType::Collation)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 						else
 						{
@@ -5581,7 +6218,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 															.arg(parent_obj->getName())
 															.arg(attribs[Attributes::Name])
 															.arg(BaseObject::getTypeName(ObjectType::Collation)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 					}
 
@@ -5624,7 +6261,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 											.arg(tab_obj->getTypeName())
 											.arg(attribs[Attributes::Name])
 									.arg(BaseObject::getTypeName(ObjectType::Column)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 						else
 						{
@@ -5632,7 +6269,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 											.arg(parent_obj->getName())
 											.arg(attribs[Attributes::Name])
 									.arg(BaseObject::getTypeName(ObjectType::Column)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 					}
 				}
@@ -5661,7 +6298,7 @@ QString DatabaseModel::getAlterCode(BaseObject *object)
 	DatabaseModel *db_aux=dynamic_cast<DatabaseModel *>(object);
 
 	if(!db_aux)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	try
 	{
@@ -5687,7 +6324,7 @@ QString DatabaseModel::getAlterCode(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -5717,7 +6354,7 @@ Index *DatabaseModel::createIndex()
 					.arg(attribs[Attributes::Table])
 					.arg(BaseObject::getTypeName(ObjectType::Table));
 
-			throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 		}
 
 		index=new Index;
@@ -5782,7 +6419,7 @@ Index *DatabaseModel::createIndex()
 	catch(Exception &e)
 	{
 		if(index) delete index;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return index;
@@ -5815,7 +6452,7 @@ Rule *DatabaseModel::createRule()
 				.arg(BaseObject::getTypeName(ObjectType::Rule))
 				.arg(attribs[Attributes::Table])
 				.arg(BaseObject::getTypeName(ObjectType::Table)),
-				ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 
 		rule->setExecutionType(attribs[Attributes::ExecType]);
@@ -5862,7 +6499,7 @@ Rule *DatabaseModel::createRule()
 	catch(Exception &e)
 	{
 		if(rule) delete rule;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return rule;
@@ -5898,7 +6535,7 @@ Trigger *DatabaseModel::createTrigger()
 				.arg(BaseObject::getTypeName(ObjectType::Trigger))
 				.arg(attribs[Attributes::Table])
 				.arg(BaseObject::getTypeName(ObjectType::Table)),
-				ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				ErrorCode::RefObjectInexistsModel,__exc_origin);
 		}
 
 		trigger=new Trigger;
@@ -5948,7 +6585,7 @@ Trigger *DatabaseModel::createTrigger()
 								.arg(trigger->getTypeName())
 								.arg(attribs[Attributes::RefTable])
 						.arg(BaseObject::getTypeName(ObjectType::Table)),
-						ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::RefObjectInexistsModel,__exc_origin);
 			}
 
 			trigger->setReferecendTable(dynamic_cast<BaseTable *>(ref_table));
@@ -5976,7 +6613,7 @@ Trigger *DatabaseModel::createTrigger()
 									.arg(attribs[Attributes::Signature])
 									.arg(BaseObject::getTypeName(ObjectType::Function));
 
-							throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 
 						trigger->setFunction(dynamic_cast<Function *>(func));
@@ -6018,7 +6655,7 @@ Trigger *DatabaseModel::createTrigger()
 	catch(Exception &e)
 	{
 		if(trigger) delete trigger;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return trigger;
@@ -6046,7 +6683,7 @@ Policy *DatabaseModel::createPolicy()
 											.arg(BaseObject::getTypeName(ObjectType::Policy))
 											.arg(attribs[Attributes::Table])
 											.arg(BaseObject::getTypeName(ObjectType::Table)),
-				ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 		policy->setPermissive(attribs[Attributes::Permissive] == Attributes::True);
 		policy->setPolicyCommand(PolicyCmdType(attribs[Attributes::Command]));
@@ -6093,7 +6730,7 @@ Policy *DatabaseModel::createPolicy()
 																.arg(policy->getTypeName())
 																.arg(name)
 																.arg(BaseObject::getTypeName(ObjectType::Role)),
-																ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+																ErrorCode::RefObjectInexistsModel,__exc_origin);
 							}
 
 							policy->addRole(role);
@@ -6110,7 +6747,7 @@ Policy *DatabaseModel::createPolicy()
 	catch(Exception &e)
 	{
 		if(policy) delete policy;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return policy;
@@ -6151,7 +6788,7 @@ EventTrigger *DatabaseModel::createEventTrigger()
 											.arg(event_trig->getTypeName())
 											.arg(attribs[Attributes::Signature])
 									.arg(BaseObject::getTypeName(ObjectType::Function)),
-									ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 
 						event_trig->setFunction(dynamic_cast<Function *>(func));
@@ -6170,7 +6807,7 @@ EventTrigger *DatabaseModel::createEventTrigger()
 	catch(Exception &e)
 	{
 		if(event_trig) delete event_trig;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return event_trig;
@@ -6238,7 +6875,7 @@ GenericSQL *DatabaseModel::createGenericSQL()
 															.arg(genericsql->getTypeName())
 															.arg(obj_name)
 															.arg(BaseObject::getTypeName(obj_type)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						genericsql->addReference(Reference(object,
 																								attribs[Attributes::RefName],
@@ -6255,7 +6892,7 @@ GenericSQL *DatabaseModel::createGenericSQL()
 	catch(Exception &e)
 	{
 		if(genericsql) delete genericsql;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return genericsql;
@@ -6305,7 +6942,7 @@ ForeignDataWrapper *DatabaseModel::createForeignDataWrapper()
 												.arg(fdw->getTypeName())
 												.arg(signature)
 												.arg(BaseObject::getTypeName(ObjectType::Function)),
-												ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 							if(ref_type == Attributes::ValidatorFunc)
 								fdw->setValidatorFunction(dynamic_cast<Function *>(func));
@@ -6314,7 +6951,7 @@ ForeignDataWrapper *DatabaseModel::createForeignDataWrapper()
 						}
 						else
 							//Raises an error if the function type is invalid
-							throw Exception(ErrorCode::RefFunctionInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ErrorCode::RefFunctionInvalidType,__exc_origin);
 					}
 				}
 			}
@@ -6326,7 +6963,7 @@ ForeignDataWrapper *DatabaseModel::createForeignDataWrapper()
 		if(fdw)
 			delete fdw;
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return fdw;
@@ -6368,7 +7005,7 @@ ForeignServer *DatabaseModel::createForeignServer()
 															.arg(server->getTypeName())
 															.arg(attribs[Attributes::Name])
 															.arg(BaseObject::getTypeName(ObjectType::ForeignDataWrapper)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						server->setForeignDataWrapper(dynamic_cast<ForeignDataWrapper *>(fdw));
 					}
@@ -6382,7 +7019,7 @@ ForeignServer *DatabaseModel::createForeignServer()
 		if(server)
 			delete server;
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return server;
@@ -6423,7 +7060,7 @@ UserMapping *DatabaseModel::createUserMapping()
 															.arg(user_map->getTypeName())
 															.arg(attribs[Attributes::Name])
 															.arg(BaseObject::getTypeName(ObjectType::ForeignServer)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						user_map->setForeignServer(server);
 						xmlparser.restorePosition();
@@ -6438,7 +7075,7 @@ UserMapping *DatabaseModel::createUserMapping()
 		if(user_map)
 			delete user_map;
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return user_map;
@@ -6479,7 +7116,7 @@ ForeignTable *DatabaseModel::createForeignTable()
 															.arg(ftable->getTypeName())
 															.arg(attribs[Attributes::Name])
 															.arg(BaseObject::getTypeName(ObjectType::ForeignServer)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						ftable->setForeignServer(fserver);
 						xmlparser.restorePosition();
@@ -6495,7 +7132,7 @@ ForeignTable *DatabaseModel::createForeignTable()
 	catch(Exception &e)
 	{
 		if(ftable) delete ftable;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -6541,7 +7178,7 @@ Transform *DatabaseModel::createTransform()
 															.arg(transf->getTypeName())
 															.arg(attribs[Attributes::Name])
 															.arg(BaseObject::getTypeName(ObjectType::Language)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						transf->setLanguage(lang);
 						xmlparser.restorePosition();
@@ -6559,7 +7196,7 @@ Transform *DatabaseModel::createTransform()
 															.arg(transf->getTypeName())
 															.arg(attribs[Attributes::Signature])
 															.arg(BaseObject::getTypeName(ObjectType::Function)),
-															ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+															ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 						if(attribs[Attributes::RefType] == Attributes::FromSqlFunc)
 							transf->setFunction(func, Transform::FromSqlFunc);
@@ -6578,23 +7215,45 @@ Transform *DatabaseModel::createTransform()
 	catch(Exception &e)
 	{
 		if(transf) delete transf;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 Procedure *DatabaseModel::createProcedure()
+{
+	attribs_map attribs;
+	std::vector<Parameter> params;
+
+	try
+	{
+		getBasicFunctionAttributes(attribs, params);
+		return createProcedure(attribs, params);
+	}
+	catch(Exception &e)
+	{
+		if(e.getErrorCode()==ErrorCode::RefUserTypeInexistsModel)
+			throw Exception(Exception::getErrorMessage(ErrorCode::AsgObjectInvalidDefinition)
+							.arg(attribs[Attributes::Name])
+							.arg(BaseObject::getTypeName(ObjectType::Procedure)),
+							ErrorCode::AsgObjectInvalidDefinition,__exc_origin,&e, getErrorExtraInfo());
+		else
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
+	}
+}
+
+Procedure *DatabaseModel::createProcedure(attribs_map &attribs, const std::vector<Parameter> &params)
 {
 	Procedure *proc = nullptr;
 
 	try
 	{
 		proc = new Procedure;
-		setBasicFunctionAttributes(proc);
+		setBasicFunctionAttributes(proc, attribs, params);
 	}
 	catch(Exception &e)
 	{
 		if(proc) delete proc;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 
 	return proc;
@@ -6680,7 +7339,7 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 						.arg(tab_name)
 						.arg(BaseObject::getTypeName(ObjectType::Table));
 
-				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 			}
 
 			column=dynamic_cast<PhysicalTable *>(table)->getColumn(col_name);
@@ -6692,7 +7351,7 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 			if(!column && !ignore_onwer)
 				throw Exception(Exception::getErrorMessage(ErrorCode::AsgInexistentSeqOwnerColumn)
 								.arg(sequence->getName(true)),
-								ErrorCode::AsgInexistentSeqOwnerColumn,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::AsgInexistentSeqOwnerColumn,__exc_origin);
 
 			sequence->setOwnerColumn(column);
 		}
@@ -6700,7 +7359,7 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 	catch(Exception &e)
 	{
 		if(sequence) delete sequence;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return sequence;
@@ -6790,7 +7449,7 @@ View *DatabaseModel::createView()
 																	 BaseObject::getTypeName(ObjectType::View),
 																	 attribs[Attributes::Object],
 																	 BaseObject::getTypeName(ref_obj_type)),
-															 ErrorCode::RefObjectInexistsModel, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+															 ErrorCode::RefObjectInexistsModel, __exc_origin);
 						}
 
 						view_refs.push_back(Reference(ref_object,
@@ -6812,7 +7471,7 @@ View *DatabaseModel::createView()
 												 BaseObject::getTypeName(ObjectType::Table),
 												 aux_attribs[Attributes::Table],
 												BaseObject::getTypeName(ObjectType::Tag))
-									, ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									, ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 
 						view->setTag(dynamic_cast<Tag *>(tag));
@@ -6828,7 +7487,7 @@ View *DatabaseModel::createView()
 	catch(Exception &e)
 	{
 		if(view) delete view;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return view;
@@ -6870,7 +7529,7 @@ Collation *DatabaseModel::createCollation()
 								.arg(BaseObject::getTypeName(ObjectType::Collation))
 								.arg(attribs[Attributes::Collation])
 						.arg(BaseObject::getTypeName(ObjectType::Collation)),
-						ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::RefObjectInexistsModel,__exc_origin);
 			}
 
 			collation->setCollation(dynamic_cast<Collation *>(copy_coll));
@@ -6887,7 +7546,7 @@ Collation *DatabaseModel::createCollation()
 	catch(Exception &e)
 	{
 		if(collation) delete collation;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return collation;
@@ -6932,7 +7591,7 @@ Extension *DatabaseModel::createExtension()
 		if(extension)
 			delete extension;
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return extension;
@@ -6972,7 +7631,7 @@ Tag *DatabaseModel::createTag()
 	catch(Exception &e)
 	{
 		if(tag) delete tag;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 }
 
@@ -7005,7 +7664,7 @@ Textbox *DatabaseModel::createTextbox()
 	catch(Exception &e)
 	{
 		if(txtbox) delete txtbox;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return txtbox;
@@ -7084,7 +7743,7 @@ BaseRelationship *DatabaseModel::createRelationship()
 						.arg(attribs[tab_attribs[i]])
 						.arg(BaseObject::getTypeName(table_types[i]));
 
-				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(str_aux,ErrorCode::RefObjectInexistsModel,__exc_origin);
 			}
 		}
 
@@ -7135,7 +7794,7 @@ BaseRelationship *DatabaseModel::createRelationship()
 						throw Exception(Exception::getErrorMessage(ErrorCode::InvAllocationFKRelationship)
 										.arg(attribs[Attributes::Name])
 									  .arg(src_tab->getName(true)),
-										ErrorCode::InvAllocationFKRelationship,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::InvAllocationFKRelationship,__exc_origin);
 					}
 				}
 			}
@@ -7148,7 +7807,7 @@ BaseRelationship *DatabaseModel::createRelationship()
 								.arg(this->getTypeName())
 								.arg(attribs[Attributes::Name])
 					.arg(BaseObject::getTypeName(ObjectType::BaseRelationship)),
-					ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+					ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 			base_rel->blockSignals(loading_model);
 			base_rel->disconnectRelationship();
@@ -7315,7 +7974,7 @@ BaseRelationship *DatabaseModel::createRelationship()
 		if(base_rel && base_rel->getObjectType()==ObjectType::Relationship)
 			delete base_rel;
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	if(rel)
@@ -7402,7 +8061,7 @@ Permission *DatabaseModel::createPermission()
 			throw Exception(Exception::getErrorMessage(ErrorCode::PermissionRefInexistObject)
 							.arg(obj_name)
 							.arg(BaseObject::getTypeName(obj_type)),
-							ErrorCode::PermissionRefInexistObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::PermissionRefInexistObject,__exc_origin);
 
 		perm=new Permission(object);
 		perm->setRevoke(revoke);
@@ -7425,7 +8084,7 @@ Permission *DatabaseModel::createPermission()
 						throw Exception(Exception::getErrorMessage(ErrorCode::PermissionRefInexistObject)
 										.arg(name)
 										.arg(BaseObject::getTypeName(ObjectType::Role)),
-										ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::RefObjectInexistsModel,__exc_origin);
 
 					}
 
@@ -7486,7 +8145,7 @@ Permission *DatabaseModel::createPermission()
 	catch(Exception &e)
 	{
 		if(perm) delete perm;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, getErrorExtraInfo());
 	}
 
 	return perm;
@@ -7541,7 +8200,7 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -7612,7 +8271,7 @@ QString DatabaseModel::__getSourceCode(SchemaParser::CodeType def_type)
 	{
 		this->appended_sql=bkp_appended_sql;
 		this->prepended_sql=bkp_prepended_sql;
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -7677,7 +8336,7 @@ QString DatabaseModel::getSQLDefinition(const std::vector<BaseObject *> objects,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -7714,11 +8373,31 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type)
 
 QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool export_file)
 {
-	bool is_sql_def = (def_type == SchemaParser::SqlCode);
 	attribs_map attribs_aux;
+
+	try
+	{
+		if(!getObjectsCode(def_type, export_file, attribs_aux,
+											 [&attribs_aux](BaseObject *, const QString &attrib, QString &&code) {
+												 attribs_aux[attrib] += code;
+											 }))
+			return "";
+
+		return getModelCode(attribs_aux, def_type);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+}
+
+bool DatabaseModel::getObjectsCode(SchemaParser::CodeType def_type, bool export_file, attribs_map &attribs,
+																	 const std::function<void (BaseObject *, const QString &, QString &&)> &code_handler)
+{
+	bool is_sql_def = (def_type == SchemaParser::SqlCode);
 	unsigned general_obj_cnt, gen_defs_count;
 	BaseObject *object=nullptr;
-	QString def, search_path="pg_catalog,public",
+	QString search_path="pg_catalog,public",
 			msg=tr("Generating %1 code: `%2' (%3)"),
 			attrib=Attributes::Objects, attrib_aux,
 			def_type_str =(is_sql_def ? "SQL" : "XML");
@@ -7729,30 +8408,40 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 	try
 	{
 		cancel_saving = false;
+
+		/* All the objects' code is generated in the same pass so the schema files
+		 * are checked for modifications only once instead of once per object */
+		SchemaParser::startGenerationPass();
 		objects_map = getCreationOrder(def_type);
 		general_obj_cnt = objects_map.size();
 		gen_defs_count=0;
 
-		attribs_aux[Attributes::ShellTypes]="";
-		attribs_aux[Attributes::Permission]="";
-		attribs_aux[Attributes::Schema]="";
-		attribs_aux[Attributes::Tablespace]="";
-		attribs_aux[Attributes::Role]="";
-		attribs_aux[Attributes::Objects]="";
-		attribs_aux[getSchemaName()] = "";
+		attribs[Attributes::ShellTypes]="";
+		attribs[Attributes::Permission]="";
+		attribs[Attributes::Schema]="";
+		attribs[Attributes::Tablespace]="";
+		attribs[Attributes::Role]="";
+		attribs[Attributes::Objects]="";
+		attribs[getSchemaName()] = "";
 
 		if(is_sql_def)
 		{
-			attribs_aux[Attributes::Function] = (!functions.empty() ? Attributes::True : "");
-			attribs_aux[Attributes::ShellTypes] = configureShellTypes(false);
+			attribs[Attributes::Function] = (!functions.empty() ? Attributes::True : "");
+			attribs[Attributes::ShellTypes] = configureShellTypes(false);
 		}
 
-		setDatabaseModelAttributes(attribs_aux, def_type);
+		setDatabaseModelAttributes(attribs, def_type);
 
 		for(auto &obj_itr : objects_map)
 		{
 			if(cancel_saving)
-				return "";
+			{
+				if(is_sql_def)
+					configureShellTypes(true);
+
+				SchemaParser::finishGenerationPass();
+				return false;
+			}
 
 			object = obj_itr.second;
 			obj_type = object->getObjectType();
@@ -7766,22 +8455,22 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 			if(obj_type == ObjectType::Type && is_sql_def)
 			{
 				usr_type = dynamic_cast<Type *>(object);
-				attribs_aux[attrib] += usr_type->getSourceCode(def_type);
+				code_handler(object, attrib, usr_type->getSourceCode(def_type));
 			}
 			else if(obj_type == ObjectType::Database)
 			{
 				if(is_sql_def)
-					attribs_aux[this->getSchemaName()] += this->__getSourceCode(def_type);
+					code_handler(this, this->getSchemaName(), this->__getSourceCode(def_type));
 				else
-					attribs_aux[attrib] += this->__getSourceCode(def_type);
+					code_handler(this, attrib, this->__getSourceCode(def_type));
 			}
 			else if(obj_type == ObjectType::Permission)
 			{
-				attribs_aux[Attributes::Permission] += dynamic_cast<Permission *>(object)->getSourceCode(def_type);
+				code_handler(object, Attributes::Permission, dynamic_cast<Permission *>(object)->getSourceCode(def_type));
 			}
 			else if(obj_type == ObjectType::Constraint)
 			{
-				attribs_aux[attrib] += dynamic_cast<Constraint *>(object)->getSourceCode(def_type, true);
+				code_handler(object, attrib, dynamic_cast<Constraint *>(object)->getSourceCode(def_type, true));
 			}
 			else if(obj_type == ObjectType::Role || obj_type == ObjectType::Tablespace || obj_type == ObjectType::Schema)
 			{
@@ -7794,7 +8483,7 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 				/* The Tablespace has the SQL code definition disabled when generating the
 				 * code of the entire model because this object cannot be created from a multiline sql command */
 				if(obj_type == ObjectType::Tablespace && !object->isSystemObject() && is_sql_def)
-					attribs_aux[attrib_aux] += object->getSourceCode(def_type);
+					code_handler(object, attrib_aux, object->getSourceCode(def_type));
 
 				//System object doesn't has the XML generated (the only exception is for public schema)
 				else if((obj_type != ObjectType::Schema && !object->isSystemObject()) ||
@@ -7809,18 +8498,13 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 					if((is_sql_def && !object->isSystemObject()) ||
 						 (!is_sql_def && (!object->isSystemObject() || object->getName() == "public")))
 					{
-						//Generates the code definition and concatenates to the others
-						attribs_aux[attrib_aux] += object->getSourceCode(def_type);
+						//Generates the code definition and passes it to the handler
+						code_handler(object, attrib_aux, object->getSourceCode(def_type));
 					}
 				}
 			}
-			else
-			{
-				if(object->isSystemObject())
-					attribs_aux[attrib] += "";
-				else
-					attribs_aux[attrib] += object->getSourceCode(def_type);
-			}
+			else if(!object->isSystemObject())
+				code_handler(object, attrib, object->getSourceCode(def_type));
 
 			gen_defs_count++;
 
@@ -7835,13 +8519,35 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 			}
 		}
 
-		attribs_aux[Attributes::SearchPath]=search_path;
+		attribs[Attributes::SearchPath]=search_path;
+
+		if(is_sql_def)
+			configureShellTypes(true);
+
+		attribs[Attributes::ExportToFile] = (export_file ? Attributes::True : "");
+		SchemaParser::finishGenerationPass();
+	}
+	catch(Exception &e)
+	{
+		SchemaParser::finishGenerationPass();
 
 		if(is_sql_def)
 			configureShellTypes(true);
 
-		attribs_aux[Attributes::ExportToFile] = (export_file ? Attributes::True : "");
-		def = schparser.getSourceCode(Attributes::DbModel, attribs_aux, def_type);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+
+	return true;
+}
+
+QString DatabaseModel::getModelCode(attribs_map &attribs, SchemaParser::CodeType def_type)
+{
+	bool is_sql_def = (def_type == SchemaParser::SqlCode);
+	QString def;
+
+	try
+	{
+		def = schparser.getSourceCode(Attributes::DbModel, attribs, def_type);
 
 		if(prepend_at_bod && is_sql_def)
 			def="-- Prepended SQL commands --\n" + this->prepended_sql + Attributes::DdlEndToken + def;
@@ -7851,13 +8557,9 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 	}
 	catch(Exception &e)
 	{
-		if(is_sql_def)
-			configureShellTypes(true);
-
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 
-
 	return def;
 }
 
@@ -7878,7 +8580,7 @@ void DatabaseModel::setDatabaseModelAttributes(attribs_map &attribs, SchemaParse
 		}
 		catch (Exception &e)
 		{
-			throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 		}
 
 		QStringList act_layers;
@@ -8272,15 +8974,101 @@ std::vector<BaseObject *> DatabaseModel::getCreationOrder(BaseObject *object, bo
 
 void DatabaseModel::saveModel(const QString &filename, SchemaParser::CodeType def_type)
 {
+	if(cancel_saving)
+		return;
+
 	try
 	{
-		if(!cancel_saving)
-			UtilsNs::saveFile(filename, this->getSourceCode(def_type).toUtf8());
+		/* Stores the code of each object (and its UTF-8 encoded form) per attribute of the
+		 * dbmodel template in the same order they were generated. A deque is used so the
+		 * chunks being encoded by the worker threads are not moved while new ones are appended */
+		std::map<QString, std::deque<std::pair<QString, QByteArray>>> chunks;
+
+		/* The thread pool must be destroyed before the chunks so, in case of errors,
+		 * its destructor waits for the running encoding tasks */
+		QThreadPool thread_pool;
+		QSaveFile output(filename);
+		QString marker_id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+		attribs_map attribs;
+		qsizetype pos = 0;
+
+		auto write_buffer = [&output](const QByteArray &buffer) {
+			if(output.write(buffer) < 0)
+			{
+				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+												ErrorCode::FileDirectoryNotWritten,__exc_origin,
+												nullptr, output.errorString());
+			}
+		};
+
+		if(!output.open(QFile::WriteOnly))
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+											ErrorCode::FileDirectoryNotWritten,__exc_origin,
+											nullptr, output.errorString());
+		}
+
+		/* The objects' code is generated in the creation order by this thread (the code
+		 * generation of an object changes attributes of the objects it references) while
+		 * the UTF-8 encoding of the generated chunks is done in parallel */
+		if(!getObjectsCode(def_type, true, attribs,
+											 [&chunks, &thread_pool](BaseObject *, const QString &attrib, QString &&code) {
+												 if(code.isEmpty())
+													 return;
+
+												 auto &chunk = chunks[attrib].emplace_back(std::move(code), QByteArray());
+
+												 thread_pool.start([&chunk](){
+													 chunk.second = chunk.first.toUtf8();
+													 chunk.first.clear();
+												 });
+											 }))
+		{
+			output.cancelWriting();
+			return;
+		}
+
+		/* Each attribute that received code is replaced by a unique marker so the template
+		 * can be rendered without holding a copy of the whole model's code. The rendered
+		 * template is then written by splitting it at the markers and writing the
+		 * respective chunks in their places */
+		for(auto &itr : chunks)
+			attribs[itr.first] = QString("%1:%2;").arg(marker_id, itr.first);
+
+		QString def = getModelCode(attribs, def_type);
+		QRegularExpression marker_regexp(QRegularExpression::escape(marker_id) + ":([^;]+);");
+		QRegularExpressionMatchIterator itr = marker_regexp.globalMatch(def);
+		QRegularExpressionMatch match;
+
+		thread_pool.waitForDone();
+
+		while(itr.hasNext())
+		{
+			match = itr.next();
+			write_buffer(def.mid(pos, match.capturedStart() - pos).toUtf8());
+
+			for(auto &chunk : chunks[match.captured(1)])
+			{
+				write_buffer(chunk.second);
+				chunk.second.clear();
+			}
+
+			pos = match.capturedEnd();
+		}
+
+		write_buffer(def.mid(pos).toUtf8());
+
+		if(!output.commit())
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+											ErrorCode::FileDirectoryNotWritten,__exc_origin,
+											nullptr, output.errorString());
+		}
 	}
 	catch(Exception &e)
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::FileNotWrittenInvalidDefinition).arg(filename),
-										ErrorCode::FileNotWrittenInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+										ErrorCode::FileNotWrittenInvalidDefinition,__exc_origin, &e);
 	}
 }
 
@@ -8319,11 +9107,11 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 
 	if(fi.exists() && !fi.isDir())
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvOutputDirectory).arg(path),
-										ErrorCode::InvOutputDirectory,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::InvOutputDirectory,__exc_origin);
 
 	if(code_gen_mode > GroupByType)
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvCodeGenerationMode).arg(code_gen_mode),
-										ErrorCode::InvCodeGenerationMode,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::InvCodeGenerationMode,__exc_origin);
 
 	if(!fi.exists())
 		dir.mkdir(path);
@@ -8635,7 +9423,7 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 	catch (Exception &e)
 	{
 		configureShellTypes(true);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -8725,7 +9513,7 @@ void DatabaseModel::setCodesInvalidated(std::vector<ObjectType> types)
 		if(list)
 		{
 			for(auto &obj : *list)
-				obj->setCodeInvalidated(true);
+				obj->setCodeInvalidated(true, false);
 		}
 	}
 }
@@ -8741,7 +9529,7 @@ void DatabaseModel::validateSchemaRenaming(Schema *schema, const QString &prev_s
 
 	//Raise an error if the schema is not allocated
 	if(!schema)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	//Get all the objects on the informed schema
 	for(auto &type : types)
@@ -8871,7 +9659,7 @@ std::vector<BaseObject *> DatabaseModel::findObjects(const QStringList &filters,
 		if(values.size() != 3)
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvalidObjectFilter).arg(filter).arg(modes.join('|')),
-											ErrorCode::InvalidObjectFilter,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::InvalidObjectFilter,__exc_origin);
 		}
 
 		obj_type = BaseObject::getObjectType(values[0]);
@@ -8884,7 +9672,7 @@ std::vector<BaseObject *> DatabaseModel::findObjects(const QStringList &filters,
 				pattern.isEmpty() || !modes.contains(mode))
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvalidObjectFilter).arg(filter).arg(modes.join('|')),
-											ErrorCode::InvalidObjectFilter,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::InvalidObjectFilter,__exc_origin);
 		}
 
 		// If we use the "any" filter key word all object types will be retrieved
@@ -9051,7 +9839,7 @@ void DatabaseModel::setDefaultObject(BaseObject *object, ObjectType obj_type)
 {
 	if((!object && default_objs.count(obj_type)==0) ||
 			(object && default_objs.count(object->getObjectType())==0))
-		throw Exception(ErrorCode::RefObjectInvalidType, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidType, __exc_origin);
 
 	if(!object)
 		default_objs[obj_type]=nullptr;
@@ -9133,7 +9921,7 @@ void DatabaseModel::saveObjectsMetadata(const QString &filename, MetaAttrOptions
 
 	if(!output.isOpen())
 		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
-										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::FileDirectoryNotWritten,__exc_origin);
 
 	try
 	{
@@ -9462,7 +10250,7 @@ void DatabaseModel::saveObjectsMetadata(const QString &filename, MetaAttrOptions
 	{
 		if(output.isOpen()) output.close();
 		throw Exception(Exception::getErrorMessage(ErrorCode::FileNotWrittenInvalidDefinition).arg(filename),
-										ErrorCode::FileNotWrittenInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+										ErrorCode::FileNotWrittenInvalidDefinition,__exc_origin, &e);
 	}
 }
 
@@ -9800,7 +10588,7 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, MetaAttrOptions
 		if(xmlparser.getCurrentElement())
 			extra_info=QString(QObject::tr("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, extra_info);
 	}
 }
 
@@ -9883,7 +10671,7 @@ void DatabaseModel::addChangelogEntry(BaseObject *object, Operation::OperType op
 				obj_type =  object ? object->getTypeName() : "";
 
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvChangelogEntryValues).arg(obj_name, obj_type, action, date_time.toString(Qt::ISODate)),
-										ErrorCode::InvChangelogEntryValues, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvChangelogEntryValues, __exc_origin);
 	}
 
 	if(TableObject::isTableObject(object->getObjectType()))
@@ -9907,7 +10695,7 @@ void DatabaseModel::addChangelogEntry(const QString &signature, const QString &t
 		 !date_time.isValid() || !actions.contains(action))
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvChangelogEntryValues).arg(signature, type, action, date),
-										ErrorCode::InvChangelogEntryValues, __PRETTY_FUNCTION__, __FILE__, __LINE__,
+										ErrorCode::InvChangelogEntryValues, __exc_origin,
 										nullptr, QString("%1, %2, %3, %4").arg(signature, type, action, date));
 	}
 
@@ -10056,7 +10844,7 @@ TableClass *DatabaseModel::createPhysicalTable()
 									.arg(BaseObject::getTypeName(ObjectType::Table))
 									.arg(aux_attribs[Attributes::Table])
 									.arg(BaseObject::getTypeName(ObjectType::Tag))
-									, ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									, ErrorCode::RefObjectInexistsModel,__exc_origin);
 						}
 
 						table->setTag(dynamic_cast<Tag *>(tag));
@@ -10145,7 +10933,7 @@ TableClass *DatabaseModel::createPhysicalTable()
 		xmlparser.restorePosition();
 
 		if(table) delete table;
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, extra_info);
 	}
 
 	return table;
@@ -10314,7 +11102,7 @@ void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool
 		{
 			if(finfo.exists() && !finfo.isDir())
 				throw Exception(Exception::getErrorMessage(ErrorCode::InvOutputDirectory).arg(path),
-												ErrorCode::InvOutputDirectory,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::InvOutputDirectory,__exc_origin);
 
 			if(!finfo.exists())
 				dir.mkpath(path);
@@ -10335,7 +11123,7 @@ void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -10378,7 +11166,7 @@ QString DatabaseModel::getChangelogDefinition(bool csv_format)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -31,6 +31,10 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include <QObject>
 #include <QStringList>
 #include <QDateTime>
+#include <QHash>
+#include <QMultiHash>
+#include <QSet>
+#include <QMutex>
 #include "baseobject.h"
 #include "table.h"
 #include "function.h"
@@ -62,14 +66,24 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "transform.h"
 #include "procedure.h"
 #include <algorithm>
+#include <functional>
 #include <locale.h>
 #include "operation.h"
 
 class ModelWidget;
 
-class __libcore DatabaseModel:  public QObject, public BaseObject {
+class __libcore DatabaseModel:  public QObject, public BaseObject, private ObjectsObserver {
 	Q_OBJECT
 
+	public:
+		/*! \brief Stores the elapsed time (in nanoseconds) and the amount of objects processed in
+		 * each stage of the last model loading. See loadModel() and getLoadingStages() */
+		struct LoadingStage {
+			QString name;
+			unsigned obj_count {0};
+			qint64 elapsed_ns {0};
+		};
+
 	private:
 		//! \brief Constants used to access the tuple columns in the internal changelog
 		enum LogFields: unsigned {
@@ -88,6 +102,62 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 * to return the list according to the provided type */
 		std::map<ObjectType, std::vector<BaseObject *> *> obj_lists;
 
+		/*! \brief Stores the objects of a certain type indexed by their signatures (without quotes) and names
+		 * as well as the position of each one in their respective lists. This structure is used by getObject() to avoid
+		 * the linear search on the object lists. The index is kept up to date on every insertion/removal and,
+		 * when an object is renamed (see handleObjectRenamed()), only the entries of that object and the ones of
+		 * the objects which signatures derive from it are replaced. Note that inserting/removing an object in the
+		 * middle of a list costs O(n) since the positions of the objects that come after it are shifted (just like
+		 * the list itself). Note that searches aren't thread-safe even though they don't modify the index since
+		 * computing the keys of an object fills its cached names (see BaseObject::getName()), unless the names
+		 * of the indexed objects were already cached */
+		struct ObjectNamesIndex {
+			QMultiHash<QString, BaseObject *> objects;
+			QHash<BaseObject *, int> positions;
+
+			//! \brief The keys in which each object is currently stored (used to remove them on renaming)
+			QHash<BaseObject *, QStringList> keys;
+		};
+
+		//! \brief Stores the names index of each object type (see getObject())
+		std::map<ObjectType, ObjectNamesIndex> names_idxs;
+
+		//! \brief Stores the objects invalidated since the last call to notifyModifiedObjects() (see handleObjectInvalidated())
+		QSet<BaseObject *> modified_objs;
+
+		//! \brief Indicates that a call to notifyModifiedObjects() is already scheduled to the next event loop pass
+		bool notify_scheduled;
+
+		//! \brief Controls the access to modified_objs since objects can be invalidated by other threads (e.g. during the export)
+		QMutex modified_mutex;
+
+		//! \brief Stores the loading stages timing of the last call to loadModel()
+		std::vector<LoadingStage> loading_stages;
+
+		/*! \brief The dependency tiers in which the root elements of a model file are grouped by loadModel(). The attributes
+		 * of the elements are extracted in parallel tier by tier, so the ones of the objects created first are ready first */
+		enum LoadingTier: unsigned {
+			//! \brief Roles, tablespaces and schemas
+			ClusterObjsTier,
+
+			//! \brief Types, functions and the other objects that tables depend on
+			SchemaObjsTier,
+
+			//! \brief Tables, views and foreign tables
+			TablesTier,
+
+			//! \brief Relationships, constraints, indexes, triggers, permissions and the other objects that depend on tables
+			TableObjsTier,
+
+			LoadingTiersCount
+		};
+
+		//! \brief The amount of root elements which attributes are extracted by each loading task (see loadModel())
+		static constexpr unsigned LoadingBatchSize = 32;
+
+		//! \brief Returns the loading tier of the root elements that represent objects of the provided type
+		static LoadingTier getLoadingTier(ObjectType obj_type);
+
 		/*! \brief Stores the references to the methods that create objects from XML code. This map is used by createObject() in order
 		 * to return the created object */
 		std::map<ObjectType, std::function<BaseObject*(void)>> create_methods;
@@ -230,6 +300,33 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns an object seaching it by its name and type. The third parameter stores the object index
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
 
+		//! \brief Rebuilds the names index of the provided type from its object list
+		void rebuildNamesIndex(ObjectType obj_type);
+
+		//! \brief Returns the keys (signature and name) used to store the object in the names index
+		QStringList getNamesIndexKeys(BaseObject *object);
+
+		/*! \brief Inserts/removes the object in the names index of its type and updates the positions of
+		 * the objects that come after obj_idx in the respective list. These methods must be called
+		 * right after the object insertion/removal in the list */
+		void addToNamesIndex(BaseObject *object, int obj_idx);
+		void removeFromNamesIndex(BaseObject *object, int obj_idx);
+
+		//! \brief Returns if the object is stored in the names index of its type, meaning that it belongs to the model
+		bool isNamesIndexed(BaseObject *object) const;
+
+		/*! \brief Replaces the keys of the object in the names index of its type by its current signature and name.
+		 * Returns true when the keys were changed. Objects that aren't in the names index are ignored */
+		bool updateNamesIndexKeys(BaseObject *object);
+
+		/*! \brief Updates the names index entries of the renamed object and of the objects which signatures
+		 * derive from it (e.g. the objects in a renamed schema or the functions using a renamed type) */
+		virtual void handleObjectRenamed(BaseObject *object) override;
+
+		/*! \brief Stores the provided object, when it belongs to the model, to be notified as modified by
+		 * notifyModifiedObjects() which is scheduled to the next event loop pass */
+		virtual void handleObjectInvalidated(BaseObject *object) override;
+
 		//! \brief Generic method that adds an object to the model
 		void __addObject(BaseObject *object, int obj_idx=-1);
 
@@ -246,6 +343,16 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Creates a IndexElement or ExcludeElement from XML depending on type of the 'elem' param.
 		void createElement(Element &elem, TableObject *tab_obj, BaseObject *parent_obj);
 
+		/*! \brief Generates the code of all objects in the creation order passing each one to the code_handler
+		 *  together with the object and the name of the dbmodel template attribute in which the code must be placed.
+		 *  The remaining template attributes are configured in the provided map. Returns false
+		 *  when the generation was aborted via setCancelSaving() */
+		bool getObjectsCode(SchemaParser::CodeType def_type, bool export_file, attribs_map &attribs,
+												const std::function<void(BaseObject *, const QString &, QString &&)> &code_handler);
+
+		//! \brief Renders the dbmodel template with the provided attributes including the prepended/appended SQL
+		QString getModelCode(attribs_map &attribs, SchemaParser::CodeType def_type);
+
 		//! \brief Returns extra error info when loading database models
 		QString getErrorExtraInfo();
 
@@ -274,8 +381,15 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 *  if one or more special object can't be created */
 		std::vector<Exception> createSpecialObjects();
 
-		//! \brief Updates all the relationships in such a way to create the missing columns/constraints
-		void updateRelsGeneratedObjects();
+		//! \brief Updates the provided relationships in such a way to create the missing columns/constraints
+		void updateRelsGeneratedObjects(const std::vector<Relationship *> &rels);
+
+		/*! \brief Returns the invalidated relationships together with all the relationships that depend on them,
+		 *  this is, the ones that share the same receiver table or use as reference (source of columns) a table changed
+		 *  by another affected relationship. The returned list is sorted in such a way that a relationship
+		 *  that propagates columns to a table comes before the ones that use that table as reference. When
+		 *  no dependency exists between two relationships their creation order is preserved */
+		std::vector<Relationship *> getInvalidRelationshipsSubgraph();
 
 		//! \brief Restore the layer information of FK relationship during loading process
 		void restoreFKRelationshipLayers();
@@ -310,11 +424,17 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 * This method will validate all the provided parameters and in case of invalid values will raise and exception */
 		void addChangelogEntry(const QString &signature, const QString &type, const QString &action, const QString &date);
 
+		/*! \brief Reads the attributes of the current XML element together with the basic attributes stored in
+		 * its children (comment, schema, owner, tablespace, collation, custom SQL and position) in the format
+		 * expected by setBasicAttributes(BaseObject *, attribs_map &) */
+		void getBasicAttributes(attribs_map &attribs);
+
 		//! \brief Loads the basic attributes, common between all children of BaseObject, from XML code
 		void setBasicAttributes(BaseObject *object);
 
-		//! \brief Loads the basic attributes, common between all children of BaseFunction, from XML code
-		void setBasicFunctionAttributes(BaseFunction *func);
+		/*! \brief Reads the attributes common between all children of BaseFunction from XML code in the format
+		 * expected by setBasicFunctionAttributes(BaseFunction *, attribs_map &, const std::vector<Parameter> &) */
+		void getBasicFunctionAttributes(attribs_map &attribs, std::vector<Parameter> &params);
 
 		//! \brief Updates (creating/removing) in the model the extension children objects
 		bool updateExtensionObjects(Extension *ext);
@@ -417,6 +537,11 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		destroyObjects() or delete the entire model */
 		void loadModel(const QString &filename);
 
+		/*! \brief Returns the time spent in each stage of the last call to loadModel(): the XML parsing/validation,
+		 * the attributes extraction made by the worker threads (and the time spent waiting for it), the creation of each
+		 * object type (in the order they first appear in the file) and the relationships validation */
+		std::vector<LoadingStage> getLoadingStages();
+
 		//! \brief Sets the database encoding
 		void setEncoding(EncodingType encod);
 
@@ -728,6 +853,20 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		Schema *createSchema();
 		Language *createLanguage();
 		Function *createFunction();
+
+		/*! \brief Creates a function from an attributes map. The return type is ignored when the
+		 * function returns a table, which is configured by the ret_table_cols */
+		Function *createFunction(attribs_map &attribs, const std::vector<Parameter> &params,
+														 const PgSqlType &ret_type, const std::vector<Parameter> &ret_table_cols);
+
+		/*! \brief Configures the basic attributes, common between all children of BaseObject, from an attributes map.
+		 * The schema, owner, tablespace and collation are referenced by name and must exist in the model */
+		void setBasicAttributes(BaseObject *object, attribs_map &attribs);
+
+		/*! \brief Configures the attributes common between all children of BaseFunction from an attributes map.
+		 * The configuration parameters are stored as name=value pairs separated by UtilsNs::DataSeparator */
+		void setBasicFunctionAttributes(BaseFunction *func, attribs_map &attribs, const std::vector<Parameter> &params);
+
 		Parameter createParameter();
 		TypeAttribute createTypeAttribute();
 		Type *createType();
@@ -749,6 +888,12 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		Textbox *createTextbox();
 		BaseRelationship *createRelationship();
 		Constraint *createConstraint(BaseObject *parent_obj);
+
+		/*! \brief Creates a constraint from an attributes map. The source and referenced columns are
+		 * comma separated lists of names. Unlike createConstraint(BaseObject *) the constraint isn't added
+		 * to its parent table when parent_obj is null, in that case the table is retrieved by its name */
+		Constraint *createConstraint(BaseObject *parent_obj, attribs_map &attribs, const std::vector<ExcludeElement> &exc_elems);
+
 		Rule *createRule();
 		Index *createIndex();
 		Trigger *createTrigger();
@@ -761,6 +906,7 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		ForeignTable *createForeignTable();
 		Transform *createTransform();
 		Procedure *createProcedure();
+		Procedure *createProcedure(attribs_map &attribs, const std::vector<Parameter> &params);
 
 		template<class TableClass>
 		TableClass *createPhysicalTable();
@@ -792,7 +938,7 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		void setObjectsModified(std::vector<BaseObject *> &objects);
 
 		/*! \brief Marks the objects with code invalidated forcing their code regeneration. User can specify only a set of
-		 graphical objects to be marked */
+		 graphical objects to be marked. Since only the cached codes are discarded the objects aren't reported as modified */
 		void setCodesInvalidated(std::vector<ObjectType> types={});
 
 		/*! \brief Updates the user type names which belongs to the passed schema. This method must be executed whenever
@@ -899,6 +1045,10 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Toggles the display of system schemas rectangles
 		void setShowSysSchemasRects(bool value);
 
+		/*! \brief Emits s_objectModified() once for each object invalidated since the last call. This is done automatically
+		 * in the next event loop pass, but the listeners can call this method to receive the pending notifications right away */
+		void notifyModifiedObjects();
+
 	signals:
 		//! \brief Signal emitted when a new object is added to the model
 		void s_objectAdded(BaseObject *object);
@@ -906,6 +1056,11 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Signal emitted when an object is removed from the model
 		void s_objectRemoved(BaseObject *object);
 
+		/*! \brief Signal emitted when the code of an object in the model is invalidated, meaning that it was modified.
+		 * Changes in the children of tables and views are notified as modifications of their parents. The invalidations
+		 * are coalesced, so the signal is emitted once per object in each event loop pass (see notifyModifiedObjects()) */
+		void s_objectModified(BaseObject *object);
+
 		//! \brief Signal emitted when an object is created from a xml code
 		void s_objectLoaded(int progress, QString object_id, unsigned obj_type);
 
@@ -916,6 +1071,7 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 	friend class OperationList;
 	friend class PermissionWidget;
 	friend class ExtensionWidget;
+	friend class ModelJournal;
 };
 
 #endif
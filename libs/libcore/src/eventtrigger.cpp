@@ -40,19 +40,19 @@ void EventTrigger::setFunction(Function *func)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedFunction)
 						.arg(this->getName())
 						.arg(BaseObject::getTypeName(ObjectType::EventTrigger)),
-						ErrorCode::AsgNotAllocatedFunction,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgNotAllocatedFunction,__exc_origin);
 	//Functions with return type other that event_trigger are not accepted
 	else if(func->getReturnType()!="event_trigger")
-		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidTriggerFunction).arg("event_trigger"),__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidTriggerFunction).arg("event_trigger"),__exc_origin);
 	//Functions with one or more parameters are not accepted
 	else if(func->getParameterCount()!=0)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidParamCount)
 						.arg(this->getName())
 						.arg(BaseObject::getTypeName(ObjectType::EventTrigger)),
-						ErrorCode::AsgFunctionInvalidParamCount,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgFunctionInvalidParamCount,__exc_origin);
 	//Functions coded in SQL lang. is not accepted by event triggers
 	else if(func->getLanguage()->getName().toLower() == DefaultLanguages::Sql)
-		throw Exception(ErrorCode::AsgEventTriggerFuncInvalidLang,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgEventTriggerFuncInvalidLang,__exc_origin);
 
 	setCodeInvalidated(function != func);
 	function=func;
@@ -61,7 +61,7 @@ void EventTrigger::setFunction(Function *func)
 void EventTrigger::setFilter(const QString &variable, const QStringList &values)
 {
 	if(variable.toLower()!=Attributes::Tag)
-		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidEventTriggerVariable).arg(variable),__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidEventTriggerVariable).arg(variable),__exc_origin);
 
 	if(!values.isEmpty())
 	{
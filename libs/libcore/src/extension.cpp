@@ -16,11 +16,19 @@ void Extension::setSchema(BaseObject *schema)
 	if(schema && schema->isDependingOn(this))
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvSchemaExtension).arg(schema->getName(), obj_name),
-										ErrorCode::AsgInvSchemaExtension, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::AsgInvSchemaExtension, __exc_origin);
 	}
 
 	if(!schema)
-		this->schema = schema;
+	{
+		setCodeInvalidated(this->schema != schema);
+
+		if(this->schema != schema)
+		{
+			this->schema = schema;
+			notifyNameChanged();
+		}
+	}
 	else
 	{
 		QString new_type_sig;
@@ -46,7 +54,7 @@ void Extension::setSchema(BaseObject *schema)
 				{
 					throw Exception(Exception::getErrorMessage(ErrorCode::AsgSchExtTypeConflict)
 													.arg(schema->getName(), obj_name, ext_obj.getName(), BaseObject::getTypeName(ObjectType::Type)),
-													ErrorCode::AsgSchExtTypeConflict, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+													ErrorCode::AsgSchExtTypeConflict, __exc_origin);
 				}
 			}
 		}
@@ -60,7 +68,7 @@ void Extension::addObject(const ExtObject &ext_obj)
 	if(!ext_obj.isValid())
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvExtensionObject).arg(obj_name),
-										ErrorCode::InvExtensionObject, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
+										ErrorCode::InvExtensionObject, __exc_origin, nullptr,
 										QString(QT_TR_NOOP("Invalid object: %1 (%2)")).arg(ext_obj.getSignature(),
 																																			 BaseObject::getTypeName(ext_obj.getType())));
 	}
@@ -84,7 +92,7 @@ const std::vector<Extension::ExtObject> &Extension::getObjects(ObjectType obj_ty
 {
 	if(obj_type != ObjectType::Type && obj_type != ObjectType::Schema)
 	{
-		throw Exception(ErrorCode::ObtObjectInvalidType, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
+		throw Exception(ErrorCode::ObtObjectInvalidType, __exc_origin, nullptr,
 										QString(QT_TR_NOOP("Invalid object type: %1")).arg(BaseObject::getTypeName(obj_type)));
 	}
 
@@ -94,7 +102,7 @@ const std::vector<Extension::ExtObject> &Extension::getObjects(ObjectType obj_ty
 void Extension::setVersion(VersionId ver, const QString &value)
 {
 	if(ver > OldVersion)
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	setCodeInvalidated(versions[ver] != value);
 	versions[ver]=value;
@@ -103,7 +111,7 @@ void Extension::setVersion(VersionId ver, const QString &value)
 QString Extension::getVersion(VersionId ver)
 {
 	if(ver > OldVersion)
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	return versions[ver];
 }
@@ -177,7 +185,7 @@ QString Extension::getAlterCode(BaseObject *object)
 	Extension *ext=dynamic_cast<Extension *>(object);
 
 	if(!ext)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	try
 	{
@@ -192,7 +200,7 @@ QString Extension::getAlterCode(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
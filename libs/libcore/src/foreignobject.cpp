@@ -32,7 +32,7 @@ ForeignObject::ForeignObject()
 void ForeignObject::setOption(const QString &opt, const QString &value)
 {
 	if(opt.isEmpty())
-		throw Exception(ErrorCode::AsgOptionInvalidName,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgOptionInvalidName,__exc_origin);
 
 	options[opt] = value;
 }
@@ -42,7 +42,7 @@ void ForeignObject::setOptions(const attribs_map &options)
 	for(auto &itr : options)
 	{
 		if(itr.first.isEmpty())
-			throw Exception(ErrorCode::AsgOptionInvalidName,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgOptionInvalidName,__exc_origin);
 	}
 
 	this->options = options;
@@ -70,7 +70,7 @@ void ForeignObject::getAlteredAttributes(ForeignObject *object, attribs_map &fo_
 	QStringList opts;
 
 	if(!fobj)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	// Comparing options (to be modified or added)
 	for(auto &opt : fobj->options)
@@ -79,10 +79,10 @@ int Index::getElementIndex(IndexElement elem)
 void Index::addIndexElement(IndexElement elem)
 {
 	if(getElementIndex(elem) >= 0)
-		throw Exception(ErrorCode::InsDuplicatedElement,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InsDuplicatedElement,__exc_origin);
 
 	if(elem.getExpression().isEmpty() && !elem.getColumn() && !elem.getSimpleColumn().isValid())
-		throw Exception(ErrorCode::AsgInvalidExpressionObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidExpressionObject,__exc_origin);
 
 	idx_elements.push_back(elem);
 	setCodeInvalidated(true);
@@ -97,7 +97,7 @@ void Index::addIndexElement(const QString &expr, Collation *coll, OperatorClass
 
 		//Raises an error if the expression is empty
 		if(expr.isEmpty())
-			throw Exception(ErrorCode::AsgInvalidExpressionObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgInvalidExpressionObject,__exc_origin);
 
 		//Configures the element
 		elem.setExpression(expr);
@@ -108,7 +108,7 @@ void Index::addIndexElement(const QString &expr, Collation *coll, OperatorClass
 		elem.setSortingAttribute(IndexElement::AscOrder, asc_order);
 
 		if(getElementIndex(elem) >= 0)
-			throw Exception(ErrorCode::InsDuplicatedElement,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::InsDuplicatedElement,__exc_origin);
 
 		idx_elements.push_back(elem);
 		setCodeInvalidated(true);
@@ -116,7 +116,7 @@ void Index::addIndexElement(const QString &expr, Collation *coll, OperatorClass
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -131,7 +131,7 @@ void Index::addIndexElement(Column *column, Collation *coll, OperatorClass *op_c
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedColumn)
 							.arg(this->getName(), this->getTypeName()),
-							ErrorCode::AsgNotAllocatedColumn, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgNotAllocatedColumn, __exc_origin);
 		}
 
 		//Configures the element
@@ -143,7 +143,7 @@ void Index::addIndexElement(Column *column, Collation *coll, OperatorClass *op_c
 		elem.setSortingAttribute(IndexElement::AscOrder, asc_order);
 
 		if(getElementIndex(elem) >= 0)
-			throw Exception(ErrorCode::InsDuplicatedElement,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::InsDuplicatedElement,__exc_origin);
 
 		idx_elements.push_back(elem);
 		setCodeInvalidated(true);
@@ -151,7 +151,7 @@ void Index::addIndexElement(Column *column, Collation *coll, OperatorClass *op_c
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -169,14 +169,14 @@ void Index::addIndexElements(std::vector<IndexElement> &elems)
 	catch(Exception &e)
 	{
 		idx_elements = elems_bkp;
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 void Index::removeIndexElement(unsigned idx_elem)
 {
 	if(idx_elem >= idx_elements.size())
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	idx_elements.erase(idx_elements.begin() + idx_elem);
 	setCodeInvalidated(true);
@@ -191,7 +191,7 @@ void Index::removeIndexElements()
 IndexElement Index::getIndexElement(unsigned elem_idx)
 {
 	if(elem_idx >= idx_elements.size())
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	return idx_elements[elem_idx];
 }
@@ -209,7 +209,7 @@ unsigned Index::getIndexElementCount()
 void Index::setIndexAttribute(IndexAttrib attrib_id, bool value)
 {
 	if(attrib_id > NullsNotDistinct)
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	setCodeInvalidated(index_attribs[attrib_id] != value);
 	index_attribs[attrib_id]=value;
@@ -242,7 +242,7 @@ unsigned Index::getFillFactor()
 bool Index::getIndexAttribute(IndexAttrib attrib_id)
 {
 	if(attrib_id > NullsNotDistinct)
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	return index_attribs[attrib_id];
 }
@@ -343,7 +343,7 @@ void Index::addColumn(Column *col)
 	if(!col)
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedColumn).arg(getName(), getTypeName()),
-										ErrorCode::AsgNotAllocatedColumn, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::AsgNotAllocatedColumn, __exc_origin);
 	}
 
 	// We ignore the column if it alread exits in the list
@@ -360,7 +360,7 @@ void Index::addSimpleColumn(const SimpleColumn &col)
 	if(!col.isValid())
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedColumn).arg(getName(), getTypeName()),
-										ErrorCode::AsgNotAllocatedColumn, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::AsgNotAllocatedColumn, __exc_origin);
 	}
 
 	// We ignore the column if it alread exits in the list
@@ -383,7 +383,7 @@ void Index::setColumns(const std::vector<Column *> &cols)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -398,7 +398,7 @@ void Index::setSimpleColumns(const std::vector<SimpleColumn> &cols)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -478,7 +478,7 @@ QString Index::getAlterCode(BaseObject *object)
 	Index *index=dynamic_cast<Index *>(object);
 
 	if(!index)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	try
 	{
@@ -505,7 +505,7 @@ QString Index::getAlterCode(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -555,7 +555,7 @@ QString Index::getDataDictionary(bool md_format, const attribs_map &extra_attrib
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
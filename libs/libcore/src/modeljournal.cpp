@@ -0,0 +1,614 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modeljournal.h"
+#include "utilsns.h"
+#include <QSaveFile>
+#include <QCoreApplication>
+#include <QSignalBlocker>
+#include <QUuid>
+#include <QRegularExpression>
+#include <algorithm>
+
+ModelJournal::ModelJournal(DatabaseModel *model, const QString &filename, QObject *parent) : QObject(parent), lock_file(getLockFilename(filename))
+{
+	if(!model)
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
+
+	this->model = model;
+	this->filename = filename;
+	marker_id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+	changed = true;
+	records_count = 0;
+	next_entry_id = 0;
+	io_pool.setMaxThreadCount(1);
+
+	// The lock is only considered stale when the process that created it is gone
+	lock_file.setStaleLockTime(0);
+	lock_file.tryLock(0);
+
+	auto set_obj_changed = [this](BaseObject *object) {
+		QMutexLocker locker(&changes_mutex);
+		changed_objs.insert(object);
+		changed = true;
+	};
+
+	/* The signals are handled in the thread that emits them since the objects
+	 * can be invalidated by other threads (e.g. during the export) */
+	connect(model, &DatabaseModel::s_objectAdded, this, set_obj_changed, Qt::DirectConnection);
+	connect(model, &DatabaseModel::s_objectModified, this, set_obj_changed, Qt::DirectConnection);
+
+	connect(model, &DatabaseModel::s_objectRemoved, this, [this](BaseObject *object) {
+		QMutexLocker locker(&changes_mutex);
+		changed_objs.erase(object);
+		removed_objs.insert(object);
+		changed = true;
+	}, Qt::DirectConnection);
+}
+
+ModelJournal::~ModelJournal()
+{
+	io_pool.waitForDone();
+}
+
+QString ModelJournal::getJournalFilename(const QString &model_file)
+{
+	return model_file + ".journal";
+}
+
+QString ModelJournal::getLockFilename(const QString &filename)
+{
+	return filename + ".lock";
+}
+
+bool ModelJournal::isInUse(const QString &filename)
+{
+	QLockFile lock(getLockFilename(filename));
+
+	qint64 pid = 0;
+	QString hostname, appname;
+
+	lock.setStaleLockTime(0);
+
+	if(lock.tryLock(0))
+	{
+		lock.unlock();
+		return false;
+	}
+
+	// The journals locked by the current process are not in use by another instance
+	return !lock.getLockInfo(&pid, &hostname, &appname) || pid != QCoreApplication::applicationPid();
+}
+
+QString ModelJournal::getFilename()
+{
+	return filename;
+}
+
+bool ModelJournal::isChanged()
+{
+	// Collecting the modifications not notified by the model yet
+	model->notifyModifiedObjects();
+
+	QMutexLocker locker(&changes_mutex);
+	return changed;
+}
+
+void ModelJournal::setChanged()
+{
+	QMutexLocker locker(&changes_mutex);
+	changed = true;
+}
+
+QString ModelJournal::getMarker(const QString &marker_id, const QString &attrib)
+{
+	return QString("%1:%2;").arg(marker_id, attrib);
+}
+
+QByteArray ModelJournal::createRecord(RecordType rec_type, const std::function<void (QDataStream &)> &writer)
+{
+	QByteArray record, buffer;
+	QDataStream rec_out(&record, QIODevice::WriteOnly), out(&buffer, QIODevice::WriteOnly);
+
+	rec_out.setVersion(QDataStream::Qt_6_0);
+	out.setVersion(QDataStream::Qt_6_0);
+
+	rec_out << static_cast<quint8>(rec_type);
+	writer(rec_out);
+
+	/* Each record is written with its size so an incomplete record
+	 * at the end of the file can be detected while replaying it */
+	out << record;
+
+	return buffer;
+}
+
+QByteArray ModelJournal::createPutRecord(unsigned entry_id, const ObjectCode &obj_code)
+{
+	return createRecord(PutRecord, [&entry_id, &obj_code](QDataStream &out){
+		out << static_cast<quint32>(entry_id) << obj_code.attrib
+				<< std::get<0>(obj_code.order) << std::get<1>(obj_code.order) << std::get<2>(obj_code.order)
+				<< obj_code.code;
+	});
+}
+
+QByteArray ModelJournal::createSnapshot(const QString &marker_id, const QString &frame, const std::map<unsigned, ObjectCode> &objs_code)
+{
+	QByteArray buffer;
+
+	buffer.append(createRecord(FrameRecord, [&marker_id, &frame](QDataStream &out){
+		out << marker_id << frame;
+	}));
+
+	for(auto &[entry_id, obj_code] : objs_code)
+		buffer.append(createPutRecord(entry_id, obj_code));
+
+	return buffer;
+}
+
+void ModelJournal::writeJournal(const std::function<QByteArray ()> &buffer_builder, bool truncate)
+{
+	io_pool.start([this, buffer_builder, truncate](){
+		QByteArray buffer = buffer_builder();
+		QString error;
+
+		if(truncate)
+		{
+			// The snapshot only replaces the current journal file when it's completely written
+			QSaveFile output(filename);
+
+			if(!output.open(QFile::WriteOnly) || output.write(buffer) < 0 || !output.commit())
+				error = output.errorString();
+		}
+		else
+		{
+			QFile output(filename);
+
+			if(!output.open(QFile::WriteOnly | QFile::Append) || output.write(buffer) < 0)
+				error = output.errorString();
+		}
+
+		if(!error.isEmpty())
+		{
+			QMutexLocker locker(&error_mutex);
+			io_error = error;
+		}
+	});
+}
+
+void ModelJournal::writeSnapshot()
+{
+	records_count = objs_code.size() + 1;
+
+	/* The snapshot is serialized by the background thread from copies of the current state.
+	 * Since the objects' code is implicitly shared no string is actually copied here */
+	writeJournal([marker_id = marker_id, frame = frame, objs_code = objs_code](){
+		return createSnapshot(marker_id, frame, objs_code);
+	}, true);
+}
+
+ModelJournal::OrderKey ModelJournal::getOrderKey(BaseObject *object)
+{
+	ObjectType obj_type = object->getObjectType();
+
+	if(obj_type == ObjectType::Constraint &&
+		 dynamic_cast<Constraint *>(object)->getConstraintType() == ConstraintType::ForeignKey)
+	{
+		BaseTable *table = dynamic_cast<Constraint *>(object)->getParentTable();
+
+		return { table->getObjectType() == ObjectType::ForeignTable ? ForeignTableFkGroup : TableFkGroup,
+						 table->getObjectId(), object->getObjectId() };
+	}
+
+	if(obj_type == ObjectType::BaseRelationship &&
+		 dynamic_cast<BaseRelationship *>(object)->getRelationshipType() == BaseRelationship::RelationshipFk)
+		return { FkRelationshipGroup, 0, object->getObjectId() };
+
+	if(obj_type == ObjectType::Permission)
+		return { PermissionGroup, 0, object->getObjectId() };
+
+	return { ObjectsGroup, 0, object->getObjectId() };
+}
+
+QString ModelJournal::getObjectCode(BaseObject *object, QString &attrib)
+{
+	ObjectType obj_type = object->getObjectType();
+
+	attrib = Attributes::Objects;
+
+	if(object == model)
+		return model->__getSourceCode(SchemaParser::XmlCode);
+
+	if(obj_type == ObjectType::Permission)
+	{
+		attrib = Attributes::Permission;
+		return dynamic_cast<Permission *>(object)->getSourceCode(SchemaParser::XmlCode);
+	}
+
+	if(obj_type == ObjectType::Constraint)
+		return dynamic_cast<Constraint *>(object)->getSourceCode(SchemaParser::XmlCode, true);
+
+	//System object doesn't has the XML generated (the only exception is for public schema)
+	if(object->isSystemObject() && (obj_type != ObjectType::Schema || object->getName() != "public"))
+		return "";
+
+	return object->getSourceCode(SchemaParser::XmlCode);
+}
+
+void ModelJournal::putEntry(unsigned entry_id, BaseObject *object, QByteArray *buffer, unsigned &rec_count)
+{
+	ObjectCode obj_code;
+
+	obj_code.code = getObjectCode(object, obj_code.attrib);
+
+	if(obj_code.code.isEmpty())
+	{
+		removeEntry(entry_id, buffer, rec_count);
+		return;
+	}
+
+	obj_code.order = getOrderKey(object);
+
+	auto itr = objs_code.find(entry_id);
+
+	if(itr != objs_code.end())
+	{
+		if(itr->second.attrib == obj_code.attrib && itr->second.order == obj_code.order &&
+			 itr->second.code == obj_code.code)
+			return;
+
+		attribs_count[itr->second.attrib]--;
+	}
+
+	attribs_count[obj_code.attrib]++;
+
+	if(buffer)
+	{
+		buffer->append(createPutRecord(entry_id, obj_code));
+		rec_count++;
+	}
+
+	objs_code[entry_id] = std::move(obj_code);
+}
+
+void ModelJournal::removeEntry(unsigned entry_id, QByteArray *buffer, unsigned &rec_count)
+{
+	auto itr = objs_code.find(entry_id);
+
+	if(itr == objs_code.end())
+		return;
+
+	attribs_count[itr->second.attrib]--;
+	objs_code.erase(itr);
+
+	if(buffer)
+	{
+		buffer->append(createRecord(RemoveRecord, [&entry_id](QDataStream &out){
+			out << static_cast<quint32>(entry_id);
+		}));
+
+		rec_count++;
+	}
+}
+
+void ModelJournal::updateEntries(BaseObject *object, QByteArray *buffer, unsigned &rec_count)
+{
+	auto itr = objs_entries.find(object);
+
+	if(itr == objs_entries.end())
+		itr = objs_entries.emplace(object, next_entry_id++).first;
+
+	unsigned entry_id = itr->second;
+	BaseTable *table = dynamic_cast<BaseTable *>(object);
+	PhysicalTable *phy_table = dynamic_cast<PhysicalTable *>(object);
+	std::vector<BaseObject *> children;
+
+	putEntry(entry_id, object, buffer, rec_count);
+
+	if(!table)
+		return;
+
+	/* The children written apart from their tables are the same ones selected by DatabaseModel::getCreationOrder():
+	 * foreign keys and constraints referencing columns added by relationships, as well as indexes, triggers, rules
+	 * and policies (except the indexes created by relationships). Views have all their children written apart */
+	if(phy_table)
+	{
+		Constraint *constr = nullptr;
+
+		for(auto &tab_obj : *phy_table->getObjectList(ObjectType::Constraint))
+		{
+			constr = dynamic_cast<Constraint *>(tab_obj);
+
+			if(!constr->isAddedByLinking() &&
+				 (constr->getConstraintType() == ConstraintType::ForeignKey ||
+					(constr->getConstraintType() != ConstraintType::PrimaryKey && constr->isReferRelationshipAddedColumns())))
+				children.push_back(constr);
+		}
+
+		for(auto &child : phy_table->getObjects({ ObjectType::Column, ObjectType::Constraint }))
+		{
+			if(child->getObjectType() == ObjectType::Index &&
+				 dynamic_cast<TableObject *>(child)->isAddedByRelationship())
+				continue;
+
+			children.push_back(child);
+		}
+	}
+	else
+		children = table->getObjects();
+
+	/* The children are tracked by address only to reuse their entries, since they are
+	 * removed from the tables without notification the addresses are never dereferenced */
+	std::map<BaseObject *, unsigned> &curr_entries = children_entries[entry_id];
+	std::map<BaseObject *, unsigned> new_entries;
+
+	for(auto &child : children)
+	{
+		auto child_itr = curr_entries.find(child);
+		unsigned child_entry_id = (child_itr != curr_entries.end() ? child_itr->second : next_entry_id++);
+
+		new_entries[child] = child_entry_id;
+		putEntry(child_entry_id, child, buffer, rec_count);
+	}
+
+	for(auto &[child, child_entry_id] : curr_entries)
+	{
+		if(new_entries.count(child) == 0)
+			removeEntry(child_entry_id, buffer, rec_count);
+	}
+
+	curr_entries = std::move(new_entries);
+}
+
+void ModelJournal::removeEntries(BaseObject *object, QByteArray *buffer, unsigned &rec_count)
+{
+	// The removed object can be already destroyed so it's only used as key
+	auto itr = objs_entries.find(object);
+
+	if(itr == objs_entries.end())
+		return;
+
+	auto child_itr = children_entries.find(itr->second);
+
+	if(child_itr != children_entries.end())
+	{
+		for(auto &[child, child_entry_id] : child_itr->second)
+			removeEntry(child_entry_id, buffer, rec_count);
+
+		children_entries.erase(child_itr);
+	}
+
+	removeEntry(itr->second, buffer, rec_count);
+	objs_entries.erase(itr);
+}
+
+void ModelJournal::flush()
+{
+	{
+		QMutexLocker locker(&error_mutex);
+
+		if(!io_error.isEmpty())
+		{
+			QString error = io_error;
+
+			io_error.clear();
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+											ErrorCode::FileDirectoryNotWritten,__exc_origin,
+											nullptr, error);
+		}
+	}
+
+	std::set<BaseObject *> changed_set, removed_set;
+
+	model->notifyModifiedObjects();
+
+	{
+		QMutexLocker locker(&changes_mutex);
+
+		// Nothing changed since the last flush (and the initial snapshot was already written)
+		if(!changed && !frame.isEmpty())
+			return;
+
+		changed_set.swap(changed_objs);
+		removed_set.swap(removed_objs);
+		changed = false;
+	}
+
+	try
+	{
+		// Avoiding the progress signals emitted during the code generation
+		QSignalBlocker blocker(model);
+		attribs_map attribs;
+		QByteArray buffer;
+		QString new_frame;
+		bool snapshot = frame.isEmpty();
+		unsigned rec_count = 0;
+
+		// The snapshot holds the code of all objects so the current state is discarded
+		if(snapshot)
+		{
+			objs_code.clear();
+			objs_entries.clear();
+			children_entries.clear();
+			attribs_count.clear();
+			next_entry_id = 0;
+			changed_set.clear();
+
+			for(auto &[obj_type, obj_list] : model->obj_lists)
+				changed_set.insert(obj_list->begin(), obj_list->end());
+		}
+		else
+		{
+			/* The removed objects are handled first since an object can be removed and added again
+			 * (e.g. undoing its removal) in which case its code is written in a new entry */
+			for(auto &object : removed_set)
+				removeEntries(object, &buffer, rec_count);
+		}
+
+		for(auto &object : changed_set)
+			updateEntries(object, snapshot ? nullptr : &buffer, rec_count);
+
+		// The code of the database object isn't cached so it's generated (and compared) in every flush
+		updateEntries(model, snapshot ? nullptr : &buffer, rec_count);
+
+		model->setDatabaseModelAttributes(attribs, SchemaParser::XmlCode);
+		attribs[Attributes::Objects] = "";
+		attribs[Attributes::Permission] = "";
+
+		for(auto &[attrib, count] : attribs_count)
+		{
+			if(count > 0)
+				attribs[attrib] = getMarker(marker_id, attrib);
+		}
+
+		new_frame = model->getModelCode(attribs, SchemaParser::XmlCode);
+
+		if(new_frame != frame)
+		{
+			frame = new_frame;
+
+			if(!snapshot)
+			{
+				buffer.append(createRecord(FrameRecord, [this](QDataStream &out){
+					out << marker_id << frame;
+				}));
+
+				rec_count++;
+			}
+		}
+
+		/* The journal is compacted when it holds more outdated records than
+		 * the amount of objects, avoiding its indefinite growth */
+		if(snapshot || records_count + rec_count > objs_code.size() + MinCompactRecords)
+			writeSnapshot();
+		else if(!buffer.isEmpty())
+		{
+			records_count += rec_count;
+			writeJournal([buffer](){ return buffer; }, false);
+		}
+	}
+	catch(Exception &e)
+	{
+		// The changes collected here were not written so the next flush writes a new snapshot
+		frame.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+}
+
+void ModelJournal::remove()
+{
+	io_pool.waitForDone();
+	QFile::remove(filename);
+
+	frame.clear();
+	objs_code.clear();
+	objs_entries.clear();
+	children_entries.clear();
+	attribs_count.clear();
+	next_entry_id = 0;
+	records_count = 0;
+
+	QMutexLocker locker(&changes_mutex);
+	changed_objs.clear();
+	removed_objs.clear();
+	changed = true;
+}
+
+QString ModelJournal::replay(const QString &filename)
+{
+	QByteArray buffer, record;
+	std::map<unsigned, ObjectCode> objs_code;
+	std::vector<const ObjectCode *> sorted_code;
+	QString frame, marker_id, code;
+	quint8 rec_type = 0;
+	quint32 entry_id = 0, group = 0, parent_id = 0, obj_id = 0;
+
+	try
+	{
+		buffer = UtilsNs::loadFile(filename);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+
+	QDataStream file_in(buffer);
+	file_in.setVersion(QDataStream::Qt_6_0);
+
+	while(!file_in.atEnd())
+	{
+		file_in >> record;
+
+		// An incomplete record means that the application crashed while writing it
+		if(file_in.status() != QDataStream::Ok)
+			break;
+
+		QDataStream rec_in(record);
+		rec_in.setVersion(QDataStream::Qt_6_0);
+		rec_in >> rec_type;
+
+		if(rec_type == FrameRecord)
+			rec_in >> marker_id >> frame;
+		else if(rec_type == PutRecord)
+		{
+			ObjectCode obj_code;
+			rec_in >> entry_id >> obj_code.attrib >> group >> parent_id >> obj_id >> obj_code.code;
+			obj_code.order = { group, parent_id, obj_id };
+			objs_code[entry_id] = obj_code;
+		}
+		else if(rec_type == RemoveRecord)
+		{
+			rec_in >> entry_id;
+			objs_code.erase(entry_id);
+		}
+	}
+
+	if(frame.isEmpty())
+		return "";
+
+	sorted_code.reserve(objs_code.size());
+
+	for(auto &[id, obj_code] : objs_code)
+		sorted_code.push_back(&obj_code);
+
+	std::stable_sort(sorted_code.begin(), sorted_code.end(), [](const ObjectCode *obj_code1, const ObjectCode *obj_code2){
+		return obj_code1->order < obj_code2->order;
+	});
+
+	QRegularExpression marker_regexp(QRegularExpression::escape(marker_id) + ":([^;]+);");
+	QRegularExpressionMatchIterator itr = marker_regexp.globalMatch(frame);
+	QRegularExpressionMatch match;
+	qsizetype pos = 0;
+
+	while(itr.hasNext())
+	{
+		match = itr.next();
+		code += frame.mid(pos, match.capturedStart() - pos);
+
+		for(auto &obj_code : sorted_code)
+		{
+			if(obj_code->attrib == match.captured(1))
+				code += obj_code->code;
+		}
+
+		pos = match.capturedEnd();
+	}
+
+	code += frame.mid(pos);
+	return code;
+}
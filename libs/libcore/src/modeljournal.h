@@ -0,0 +1,214 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcore
+\class ModelJournal
+\brief Implements an append-only journal of the XML code of a database model used to recover
+the model after an unexpected crash. Instead of saving the whole model periodically, only the
+code of the objects that changed since the last flush is appended to the journal file. The changed
+objects are tracked through the signals emitted by the model when objects are added, removed or
+modified, so the objects that weren't touched aren't even visited in a flush. From time to time the
+journal is compacted into a snapshot holding only the current code of each object.
+All the file writing is done by a background thread.
+*/
+
+#ifndef MODEL_JOURNAL_H
+#define MODEL_JOURNAL_H
+
+#include "databasemodel.h"
+#include <QThreadPool>
+#include <QMutex>
+#include <QDataStream>
+#include <QLockFile>
+#include <set>
+#include <tuple>
+
+class __libcore ModelJournal: public QObject {
+	Q_OBJECT
+
+	private:
+		enum RecordType: quint8 {
+			//! \brief Stores the dbmodel template code with markers in place of the objects' code
+			FrameRecord,
+
+			//! \brief Stores (or replaces) the code of an object
+			PutRecord,
+
+			//! \brief Removes the code of an object
+			RemoveRecord
+		};
+
+		/*! \brief The groups of objects in the creation order of the XML code (see DatabaseModel::getCreationOrder()).
+		 *  Foreign keys, foreign key relationships and permissions are placed after all the other objects. Inside the
+		 *  foreign keys groups the objects are sorted by the ids of their tables instead of the position of the tables
+		 *  in the model, which only differ after swapping the tables' ids, not affecting the loading of the code */
+		enum OrderGroup: quint32 {
+			ObjectsGroup,
+			TableFkGroup,
+			ForeignTableFkGroup,
+			FkRelationshipGroup,
+			PermissionGroup
+		};
+
+		/*! \brief The position of an object's code in the model code: the group, the id of the parent table
+		 *  (only for foreign keys) and the id of the object itself */
+		using OrderKey = std::tuple<quint32, quint32, quint32>;
+
+		//! \brief Stores the code of an object, the dbmodel template attribute in which it is placed and its position
+		struct ObjectCode {
+			QString attrib, code;
+			OrderKey order;
+		};
+
+		/*! \brief The minimum amount of records written since the last compaction that causes a new compaction.
+		 *  The journal is only compacted when it holds more outdated records than the amount of objects */
+		static constexpr unsigned MinCompactRecords = 1000;
+
+		DatabaseModel *model;
+
+		QString filename,
+
+		//! \brief Unique id used to create the markers of the objects' code in the frame
+		marker_id,
+
+		//! \brief The dbmodel template code as written in the last flush
+		frame;
+
+		//! \brief The objects' code (by entry id) as written in the last flush
+		std::map<unsigned, ObjectCode> objs_code;
+
+		/*! \brief The entry ids of the model's objects written in the journal. The objects are tracked by address
+		 *  (and not by id) because the ids can be swapped, changing the position of the objects in the code */
+		std::map<BaseObject *, unsigned> objs_entries;
+
+		//! \brief The entry ids of the children of tables and views written in the journal (by the entry id of the parent)
+		std::map<unsigned, std::map<BaseObject *, unsigned>> children_entries;
+
+		//! \brief The amount of entries written in each dbmodel template attribute
+		std::map<QString, unsigned> attribs_count;
+
+		//! \brief The id of the next entry to be written
+		unsigned next_entry_id;
+
+		/*! \brief The objects added/modified and removed since the last flush. These sets can be modified
+		 *  by other threads (e.g. the code invalidation during the export) so they are guarded by changes_mutex */
+		std::set<BaseObject *> changed_objs, removed_objs;
+
+		QMutex changes_mutex;
+
+		//! \brief Indicates that the model was changed since the last flush
+		bool changed;
+
+		//! \brief The amount of records in the journal file since the last compaction
+		unsigned records_count;
+
+		/*! \brief The thread pool (with a single thread) in which the file writing is done.
+		 *  Having a single thread ensures that the tasks write the file in the order they were started */
+		QThreadPool io_pool;
+
+		QMutex error_mutex;
+
+		/*! \brief Lock held while the journal is in use so other instances of the application
+		 *  don't take it as the journal of a crashed session (see isInUse()) */
+		QLockFile lock_file;
+
+		//! \brief Stores the error raised by the last failed file writing
+		QString io_error;
+
+		//! \brief Returns the marker placed in the frame in place of the code of the provided attribute
+		static QString getMarker(const QString &marker_id, const QString &attrib);
+
+		static QByteArray createRecord(RecordType rec_type, const std::function<void(QDataStream &)> &writer);
+
+		static QByteArray createPutRecord(unsigned entry_id, const ObjectCode &obj_code);
+
+		//! \brief Returns the records that reproduce the provided state
+		static QByteArray createSnapshot(const QString &marker_id, const QString &frame, const std::map<unsigned, ObjectCode> &objs_code);
+
+		//! \brief Returns the position of the object's code in the model code
+		static OrderKey getOrderKey(BaseObject *object);
+
+		/*! \brief Returns the XML code of the object as written by DatabaseModel::getObjectsCode() as well as the
+		 *  dbmodel template attribute in which it is placed. An empty code is returned for the objects that aren't written */
+		QString getObjectCode(BaseObject *object, QString &attrib);
+
+		/*! \brief Stores the code of an object in the provided entry, appending a put record to the buffer (when provided)
+		 *  if the code or its position changed. An empty code removes the entry (see removeEntry()) */
+		void putEntry(unsigned entry_id, BaseObject *object, QByteArray *buffer, unsigned &rec_count);
+
+		//! \brief Removes the code stored in the entry, appending a remove record to the buffer (when provided)
+		void removeEntry(unsigned entry_id, QByteArray *buffer, unsigned &rec_count);
+
+		/*! \brief Stores the code of a model's object and, for tables and views, the code of the children that are
+		 *  written apart from their parent (e.g. indexes, triggers and foreign keys) */
+		void updateEntries(BaseObject *object, QByteArray *buffer, unsigned &rec_count);
+
+		//! \brief Removes the entry of a model's object and the ones of its children
+		void removeEntries(BaseObject *object, QByteArray *buffer, unsigned &rec_count);
+
+		/*! \brief Starts the writing of the journal file in the background. The buffer to be written is
+		 *  returned by buffer_builder (called in the background thread). When truncate is true
+		 *  the file is replaced by the buffer otherwise the buffer is appended to the file */
+		void writeJournal(const std::function<QByteArray()> &buffer_builder, bool truncate);
+
+		//! \brief Starts the writing of a snapshot of the current state replacing the whole journal file
+		void writeSnapshot();
+
+	public:
+		ModelJournal(DatabaseModel *model, const QString &filename, QObject *parent = nullptr);
+
+		//! \brief Waits for the pending file writing tasks
+		virtual ~ModelJournal();
+
+		//! \brief Returns the journal filename of the provided temporary model file
+		static QString getJournalFilename(const QString &model_file);
+
+		//! \brief Returns the name of the lock file of the provided journal
+		static QString getLockFilename(const QString &filename);
+
+		/*! \brief Returns true when the journal is locked by another running instance of the application.
+		 *  Locks left by instances that don't exist anymore (e.g. after a crash) are removed */
+		static bool isInUse(const QString &filename);
+
+		QString getFilename();
+
+		bool isChanged();
+
+		/*! \brief Appends to the journal the code of the objects added, modified or removed since the last flush
+		 *  as well as the code of the database and the dbmodel template, which are generated in every flush.
+		 *  The first flush (and the ones that follow a large amount of appended records) writes
+		 *  a compacted snapshot instead. Raises an error if a previous file writing has failed */
+		void flush();
+
+		/*! \brief Waits for the pending file writing tasks and removes the journal file.
+		 *  The next flush will write a new snapshot */
+		void remove();
+
+		/*! \brief Replays the records of the journal file returning the complete XML code of the model.
+		 *  Incomplete records at the end of the file (e.g. due to a crash while writing them) are ignored.
+		 *  Returns an empty string if the journal has no frame record */
+		static QString replay(const QString &filename);
+
+	public slots:
+		/*! \brief Marks the journal as changed forcing the next flush to generate the code of the database and the dbmodel template.
+		 *  Changes made to the model's objects are tracked by the journal itself */
+		void setChanged();
+};
+
+#endif
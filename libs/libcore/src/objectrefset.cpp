@@ -0,0 +1,175 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "objectrefset.h"
+#include <algorithm>
+#include <iterator>
+
+ObjectRefSet::ObjectRefSet()
+{
+	count = 0;
+	indexed = false;
+}
+
+long long ObjectRefSet::findPosition(BaseObject *object) const
+{
+	if(!object)
+		return -1;
+
+	if(!indexed)
+	{
+		auto itr = std::find(objects.begin(), objects.end(), object);
+		return itr != objects.end() ? std::distance(objects.begin(), itr) : -1;
+	}
+
+	auto range = positions.equal_range(object);
+	long long pos = -1;
+
+	// When the object was inserted more than once the lowest position is the first occurrence
+	for(auto itr = range.first; itr != range.second; itr++)
+	{
+		if(pos < 0 || itr->second < static_cast<size_t>(pos))
+			pos = itr->second;
+	}
+
+	return pos;
+}
+
+void ObjectRefSet::rebuildIndex()
+{
+	positions.clear();
+	indexed = objects.size() >= IndexThreshold;
+
+	if(!indexed)
+		return;
+
+	positions.reserve(objects.size());
+
+	for(size_t idx = 0; idx < objects.size(); idx++)
+	{
+		if(objects[idx])
+			positions.emplace(objects[idx], idx);
+	}
+}
+
+void ObjectRefSet::insert(BaseObject *object)
+{
+	if(!object)
+		return;
+
+	objects.push_back(object);
+	count++;
+
+	if(indexed)
+		positions.emplace(object, objects.size() - 1);
+	else if(objects.size() >= IndexThreshold)
+		rebuildIndex();
+}
+
+bool ObjectRefSet::remove(BaseObject *object)
+{
+	long long pos = findPosition(object);
+
+	if(pos < 0)
+		return false;
+
+	if(indexed)
+	{
+		auto range = positions.equal_range(object);
+
+		for(auto itr = range.first; itr != range.second; itr++)
+		{
+			if(itr->second == static_cast<size_t>(pos))
+			{
+				positions.erase(itr);
+				break;
+			}
+		}
+	}
+
+	objects[pos] = nullptr;
+	count--;
+
+	// Discarding the empty entries at the end of the list so they don't need to be compacted
+	while(!objects.empty() && !objects.back())
+		objects.pop_back();
+
+	/* Compacting the list when the half of it is made of empty entries.
+	 * Since this only happens after many removals the cost is amortized */
+	if(objects.size() > count * 2)
+	{
+		objects.erase(std::remove(objects.begin(), objects.end(), nullptr), objects.end());
+		rebuildIndex();
+	}
+
+	return true;
+}
+
+bool ObjectRefSet::contains(BaseObject *object) const
+{
+	if(!object)
+		return false;
+
+	if(indexed)
+		return positions.count(object) > 0;
+
+	return findPosition(object) >= 0;
+}
+
+bool ObjectRefSet::empty() const
+{
+	return count == 0;
+}
+
+size_t ObjectRefSet::size() const
+{
+	return count;
+}
+
+void ObjectRefSet::clear()
+{
+	objects.clear();
+	positions.clear();
+	count = 0;
+	indexed = false;
+}
+
+std::vector<BaseObject *> ObjectRefSet::toVector() const
+{
+	if(objects.size() == count)
+		return objects;
+
+	std::vector<BaseObject *> list;
+
+	list.reserve(count);
+	std::copy_if(objects.begin(), objects.end(), std::back_inserter(list), [](BaseObject *obj){
+		return obj != nullptr;
+	});
+
+	return list;
+}
+
+ObjectRefSet::ConstIterator ObjectRefSet::begin() const
+{
+	return ConstIterator(&objects, 0);
+}
+
+ObjectRefSet::ConstIterator ObjectRefSet::end() const
+{
+	return ConstIterator(&objects, objects.size());
+}
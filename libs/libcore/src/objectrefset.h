@@ -0,0 +1,120 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcore
+\class ObjectRefSet
+\brief Implements the list of objects linked (references/dependencies) to a BaseObject.
+The objects are kept in the order they were inserted and the removal of an object doesn't shift
+the remaining ones: the removed entry is just emptied and the list is compacted when the amount of
+empty entries grows too much. Large lists are indexed by a hash table so lookups and removals
+take constant time (e.g. the references of the public schema or a common owner role).
+An object can be inserted more than once, in that case each removal erases its first occurrence.
+*/
+
+#ifndef OBJECT_REF_SET_H
+#define OBJECT_REF_SET_H
+
+#include "coreglobal.h"
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+
+class BaseObject;
+
+class __libcore ObjectRefSet {
+	private:
+		//! \brief The amount of entries from which the objects are indexed. Smaller lists are just scanned
+		static constexpr size_t IndexThreshold = 16;
+
+		//! \brief The objects in insertion order. The removed objects are stored as null entries
+		std::vector<BaseObject *> objects;
+
+		//! \brief Stores the position(s) of each object in the list (only for large lists)
+		std::unordered_multimap<BaseObject *, size_t> positions;
+
+		//! \brief The amount of non-null entries in the list
+		size_t count;
+
+		//! \brief Indicates that the positions of the objects are indexed
+		bool indexed;
+
+		//! \brief Returns the position of the first occurrence of the object or -1 if it doesn't exist
+		long long findPosition(BaseObject *object) const;
+
+		//! \brief Rebuilds the index of the objects' positions (or discards it when the list is small)
+		void rebuildIndex();
+
+	public:
+		class ConstIterator {
+			private:
+				const std::vector<BaseObject *> *objects;
+				size_t idx;
+
+				//! \brief Moves the iterator to the next non-null entry
+				void skipEmpty()
+				{
+					while(idx < objects->size() && !(*objects)[idx])
+						idx++;
+				}
+
+			public:
+				ConstIterator(const std::vector<BaseObject *> *objects, size_t idx) : objects(objects), idx(idx)
+				{
+					skipEmpty();
+				}
+
+				BaseObject *operator * () const { return (*objects)[idx]; }
+
+				ConstIterator &operator ++ ()
+				{
+					idx++;
+					skipEmpty();
+					return *this;
+				}
+
+				bool operator != (const ConstIterator &itr) const { return idx != itr.idx; }
+				bool operator == (const ConstIterator &itr) const { return idx == itr.idx; }
+		};
+
+		ObjectRefSet();
+
+		//! \brief Appends the object to the list
+		void insert(BaseObject *object);
+
+		//! \brief Removes the first occurrence of the object returning true if it was found
+		bool remove(BaseObject *object);
+
+		bool contains(BaseObject *object) const;
+
+		bool empty() const;
+
+		size_t size() const;
+
+		void clear();
+
+		//! \brief Returns the objects in the order they were inserted
+		std::vector<BaseObject *> toVector() const;
+
+		/*! \brief Iterators over the objects in the order they were inserted.
+		 *  The list must not be changed while being iterated */
+		ConstIterator begin() const;
+		ConstIterator end() const;
+};
+
+#endif
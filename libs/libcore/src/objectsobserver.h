@@ -0,0 +1,45 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcore
+\class ObjectsObserver
+\brief Implements the interface of the classes that need to be notified about the changes made to a set of objects.
+An object notifies its observer (see BaseObject::setObserver()) when its name, schema or signature may have changed
+and when its code is invalidated. The database model is the observer of the objects it owns.
+*/
+
+#ifndef OBJECTS_OBSERVER_H
+#define OBJECTS_OBSERVER_H
+
+#include "coreglobal.h"
+
+class BaseObject;
+
+class __libcore ObjectsObserver {
+	public:
+		virtual ~ObjectsObserver() = default;
+
+		//! \brief Called when the name, the schema or the signature of the provided object may have changed
+		virtual void handleObjectRenamed(BaseObject *object) = 0;
+
+		//! \brief Called when the code of the provided object is invalidated due to a modification in the object
+		virtual void handleObjectInvalidated(BaseObject *object) = 0;
+};
+
+#endif
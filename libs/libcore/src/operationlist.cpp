@@ -26,7 +26,7 @@ OperationList::OperationList(DatabaseModel *model)
 	/* Raises an error if the user tries to allocate an operation list linked to
 		to an unallocated model */
 	if(!model)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	this->model=model;
 	xmlparser=model->getXMLParser();
@@ -141,7 +141,7 @@ void OperationList::setMaximumSize(unsigned max)
 {
 	//Raises an error if a zero max size is assigned to the list
 	if(max==0)
-		throw Exception(ErrorCode::AsgInvalidMaxSizeOpList,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidMaxSizeOpList,__exc_origin);
 
 	max_size=max;
 }
@@ -155,7 +155,7 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 
 		//Raises an error if the object to be added is not allocated
 		if(!object)
-			throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 		obj_type=object->getObjectType();
 
@@ -168,11 +168,11 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 			if(obj_type!=ObjectType::BaseObject && obj_type!=ObjectType::Database)
 				CoreUtilsNs::copyObject(&copy_obj, object, obj_type);
 			else
-				throw Exception(ErrorCode::AsgObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ErrorCode::AsgObjectInvalidType,__exc_origin);
 
 			//Raises an error if the copy fails (returning a null object)
 			if(!copy_obj)
-				throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 			else
 				//Inserts the copy on the pool
 				object_pool.push_back(copy_obj);
@@ -183,7 +183,7 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -298,7 +298,7 @@ bool OperationList::isObjectOnPool(BaseObject *object)
 	std::vector<BaseObject *>::iterator itr, itr_end;
 
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	itr=object_pool.begin();
 	itr_end=object_pool.end();
@@ -349,18 +349,18 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 	{
 		//Raises an error if the user tries to register an operation with null object
 		if(!object)
-			throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 		obj_type=object->getObjectType();
 		if(tab_obj && !parent_obj)
-			throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 		else if(parent_obj &&
 				(((obj_type==ObjectType::Column || obj_type==ObjectType::Constraint) &&
 					(parent_obj->getObjectType()!=ObjectType::Relationship && !PhysicalTable::isPhysicalTable(parent_obj->getObjectType()))) ||
 
 				 ((obj_type==ObjectType::Trigger || obj_type==ObjectType::Rule || obj_type==ObjectType::Index) && !dynamic_cast<BaseTable *>(parent_obj))))
-			throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::OprObjectInvalidType,__exc_origin);
 
 		//If the operations list is full makes the automatic cleaning before inserting a new operation
 		if(current_index == static_cast<int>(max_size-1))
@@ -458,7 +458,7 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 			}
 			//Raises an error if both parent table / relationship isn't allocated
 			else
-				throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 		}
 		else
 		{
@@ -496,14 +496,14 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 			removeFromPool(object_pool.size()-1);
 			delete operation;
 		}
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
 const Operation *OperationList::getOperation(unsigned oper_idx)
 {
 	if(oper_idx >= operations.size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	return operations[oper_idx];
 }
@@ -600,7 +600,7 @@ void OperationList::undoOperation()
 			  operation->getChainType()!=Operation::NoChain);
 
 		if(error.getErrorCode()!=ErrorCode::Custom)
-			throw Exception(ErrorCode::UndoRedoOperationInvalidObject,__PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
+			throw Exception(ErrorCode::UndoRedoOperationInvalidObject,__exc_origin, &error);
 	}
 }
 
@@ -649,7 +649,7 @@ void OperationList::redoOperation()
 			  operation->getChainType()!=Operation::NoChain);
 
 		if(error.getErrorCode()!=ErrorCode::Custom)
-			throw Exception(ErrorCode::UndoRedoOperationInvalidObject,__PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
+			throw Exception(ErrorCode::UndoRedoOperationInvalidObject,__exc_origin, &error);
 	}
 }
 
@@ -988,7 +988,7 @@ void OperationList::updateObjectIndex(BaseObject *object, unsigned new_idx)
 	Operation *oper=nullptr;
 
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	itr=operations.begin();
 	itr_end=operations.end();
@@ -82,18 +82,19 @@ bool Operator::isValidName(const QString &name)
 void Operator::setName(const QString &name)
 {
 	if(name.isEmpty())
-		throw Exception(ErrorCode::AsgEmptyNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgEmptyNameObject,__exc_origin);
 	else	if(!isValidName(name))
-		throw Exception(ErrorCode::AsgInvalidNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidNameObject,__exc_origin);
 
 	this->obj_name=name;
+	notifyNameChanged();
 }
 
 void Operator::setFunction(Function *func, FunctionId func_id)
 {
 	//Raises an error if the function type is invalid
 	if(func_id > FuncRestrict)
-		throw Exception(ErrorCode::RefFunctionInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefFunctionInvalidType,__exc_origin);
 	else if(func_id==FuncOperator)
 	{
 		//Raises an error if the function is not allocated
@@ -101,14 +102,14 @@ void Operator::setFunction(Function *func, FunctionId func_id)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedFunction)
 							.arg(this->getName(true))
 							.arg(BaseObject::getTypeName(ObjectType::Operator)),
-							ErrorCode::AsgNotAllocatedFunction,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgNotAllocatedFunction,__exc_origin);
 		/* Raises an error if the parameter count is invalid. To be used by the operator
 		 the function must own 1 or 2 parameters */
 		else if(func->getParameterCount()==0 || func->getParameterCount() > 2)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidParamCount)
 							.arg(this->getName())
 							.arg(BaseObject::getTypeName(ObjectType::Operator)),
-							ErrorCode::AsgFunctionInvalidParamCount,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgFunctionInvalidParamCount,__exc_origin);
 		else
 		{
 			unsigned param_count=func->getParameterCount();
@@ -145,7 +146,7 @@ void Operator::setFunction(Function *func, FunctionId func_id)
 				throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidParameters)
 								.arg(this->getName())
 								.arg(BaseObject::getTypeName(ObjectType::Operator)),
-								ErrorCode::AsgFunctionInvalidParameters,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::AsgFunctionInvalidParameters,__exc_origin);
 		}
 	}
 
@@ -157,7 +158,7 @@ void Operator::setArgumentType(PgSqlType arg_type, ArgumentId arg_id)
 {
 	//Raises an error if the argument id is invalid
 	if(arg_id > RightArg)
-		throw Exception(ErrorCode::RefOperatorArgumentInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefOperatorArgumentInvalidType,__exc_origin);
 
 	arg_type.reset();
 	setCodeInvalidated(argument_types[arg_id] != arg_type);
@@ -168,7 +169,7 @@ void Operator::setOperator(Operator *oper, OperatorId op_id)
 {
 	//Raises an error if the operator type is invalid
 	if(op_id > OperNegator)
-		throw Exception(ErrorCode::RefOperatorInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefOperatorInvalidType,__exc_origin);
 	else
 	{
 		/* Validating the Commutator OP: According to the PostgreSQL documentation
@@ -182,7 +183,7 @@ void Operator::setOperator(Operator *oper, OperatorId op_id)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidCommutatorOperator)
 							.arg(oper->getSignature(true))
 							.arg(this->getSignature(true)),
-							ErrorCode::AsgFunctionInvalidParamCount,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgFunctionInvalidParamCount,__exc_origin);
 		}
 		/* Validating Negator OP: According to the PostgreSQL documentation the negator
 		 operator must have its arguments as the same type of arguments from the
@@ -196,7 +197,7 @@ void Operator::setOperator(Operator *oper, OperatorId op_id)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidNegatorOperator)
 							.arg(oper->getSignature(true))
 							.arg(this->getSignature(true)),
-							ErrorCode::AsgFunctionInvalidParamCount,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgFunctionInvalidParamCount,__exc_origin);
 		}
 
 		setCodeInvalidated(operators[op_id] != oper);
@@ -220,7 +221,7 @@ Function *Operator::getFunction(FunctionId func_id)
 {
 	//Raises an error if the function type is invalid
 	if(func_id > FuncRestrict)
-		throw Exception(ErrorCode::RefOperatorInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefOperatorInvalidType,__exc_origin);
 
 	return functions[func_id];
 }
@@ -229,7 +230,7 @@ PgSqlType Operator::getArgumentType(ArgumentId arg_id)
 {
 	//Raises an error if the argument id is invalid
 	if(arg_id > RightArg)
-		throw Exception(ErrorCode::RefOperatorArgumentInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefOperatorArgumentInvalidType,__exc_origin);
 	return argument_types[arg_id];
 }
 
@@ -237,7 +238,7 @@ Operator *Operator::getOperator(OperatorId op_id)
 {
 	//Raises an error if the operator type is invalid
 	if(op_id > OperNegator)
-		throw Exception(ErrorCode::RefFunctionInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefFunctionInvalidType,__exc_origin);
 
 	return operators[op_id];
 }
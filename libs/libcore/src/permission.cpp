@@ -32,12 +32,12 @@ Permission::Permission(BaseObject *obj)
 
 	//Raises an error if the object associated to the permission is no allocated
 	if(!obj)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	/* Raises an error if the object type to be associated to the permission is
 		invalid according to the rule (see class definition) */
 	if(!acceptsPermission(obj->getObjectType()))
-		throw Exception(ErrorCode::AsgObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgObjectInvalidType,__exc_origin);
 
 	this->object=obj;
 	this->obj_type=ObjectType::Permission;
@@ -130,11 +130,11 @@ void Permission::addRole(Role *role)
 {
 	//Raises an error if the role is not allocated
 	if(!role)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	//Raises an error if the role already exists in the permission
 	if(isRoleExists(role))
-		throw Exception(ErrorCode::InsDuplicatedRolePermission,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InsDuplicatedRolePermission,__exc_origin);
 
 	roles.push_back(role);
 	setCodeInvalidated(true);
@@ -147,11 +147,11 @@ void Permission::setPrivilege(PrivilegeId priv_id, bool value, bool grant_op)
 {
 	//Caso o tipo de privilégio sejá inválido dispara uma exceção
 	if(priv_id > PrivUsage)
-		throw Exception(ErrorCode::RefInvalidPrivilegeType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefInvalidPrivilegeType,__exc_origin);
 
 	if(!acceptsPermission(object->getObjectType(), priv_id))
 		//Raises an error if the privilege is invalid according to the object type
-		throw Exception(ErrorCode::AsgInvalidPrivilegeObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidPrivilegeObject,__exc_origin);
 
 	setCodeInvalidated((privileges[priv_id] != value) || grant_option[priv_id] != grant_op);
 	privileges[priv_id]=value;
@@ -212,7 +212,7 @@ bool Permission::isSimilarTo(Permission *perm)
 void Permission::removeRole(unsigned role_idx)
 {
 	if(role_idx > roles.size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	roles.erase(roles.begin() + role_idx);
 	generatePermissionId();
@@ -229,7 +229,7 @@ void Permission::removeRoles()
 Role *Permission::getRole(unsigned role_idx)
 {
 	if(role_idx > roles.size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	return roles[role_idx];
 }
@@ -253,7 +253,7 @@ bool Permission::getPrivilege(PrivilegeId priv_id)
 {
 	//Raises an error if the privilege is invalid
 	if(priv_id > PrivUsage)
-		throw Exception(ErrorCode::RefInvalidPrivilegeType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefInvalidPrivilegeType,__exc_origin);
 
 	return privileges[priv_id];
 }
@@ -262,7 +262,7 @@ bool Permission::getGrantOption(PrivilegeId priv_id)
 {
 	//Raises an error if the privilege is invalid
 	if(priv_id > PrivUsage)
-		throw Exception(ErrorCode::RefInvalidPrivilegeType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefInvalidPrivilegeType,__exc_origin);
 
 	return grant_option[priv_id];
 }
@@ -378,7 +378,13 @@ void Permission::generatePermissionId()
 
 	//Generates an unique name for the permission through md5 hash
 	hash_id = UtilsNs::getStringHash(hash_id);
-	this->obj_name = (!revoke ? "grant_" : "revoke_") + getPermissionString() + '_' + hash_id.mid(0, 10);
+	hash_id = (!revoke ? "grant_" : "revoke_") + getPermissionString() + '_' + hash_id.mid(0, 10);
+
+	if(this->obj_name != hash_id)
+	{
+		this->obj_name = hash_id;
+		notifyNameChanged();
+	}
 }
 
 QString Permission::getSourceCode(SchemaParser::CodeType def_type)
@@ -480,7 +486,7 @@ QString Permission::getDropCode(bool cascade)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
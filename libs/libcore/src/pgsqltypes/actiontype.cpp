@@ -49,6 +49,11 @@ QStringList ActionType::getTypes()
 	return TemplateType<ActionType>::getTypes(type_names);
 }
 
+const QStringList &ActionType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned ActionType::setType(unsigned type_id)
 {
 	return TemplateType<ActionType>::setType(type_id, type_names);
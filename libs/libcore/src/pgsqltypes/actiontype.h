@@ -43,6 +43,7 @@ class __libcore ActionType: public TemplateType<ActionType>{
 		ActionType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
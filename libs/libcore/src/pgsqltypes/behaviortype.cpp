@@ -47,6 +47,11 @@ QStringList BehaviorType::getTypes()
 	return TemplateType<BehaviorType>::getTypes(type_names);
 }
 
+const QStringList &BehaviorType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned BehaviorType::setType(unsigned type_id)
 {
 	return TemplateType<BehaviorType>::setType(type_id, type_names);
@@ -58,6 +58,11 @@ QStringList CategoryType::getTypes()
 	return TemplateType<CategoryType>::getTypes(type_names);
 }
 
+const QStringList &CategoryType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned CategoryType::setType(unsigned type_id)
 {
 	return TemplateType<CategoryType>::setType(type_id, type_names);
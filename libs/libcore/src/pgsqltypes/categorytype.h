@@ -52,6 +52,7 @@ class __libcore CategoryType: public TemplateType<CategoryType>{
 		CategoryType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
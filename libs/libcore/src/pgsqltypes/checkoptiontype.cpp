@@ -34,6 +34,11 @@ QStringList CheckOptionType::getTypes()
 	return TemplateType<CheckOptionType>::getTypes(type_names);
 }
 
+const QStringList &CheckOptionType::getTypeNames()
+{
+	return type_names;
+}
+
 CheckOptionType::CheckOptionType(unsigned type_id)
 {
 	setType(type_id);
@@ -47,6 +47,11 @@ QStringList ConstraintType::getTypes()
 	return TemplateType<ConstraintType>::getTypes(type_names);
 }
 
+const QStringList &ConstraintType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned ConstraintType::setType(unsigned type_id)
 {
 	return TemplateType<ConstraintType>::setType(type_id, type_names);
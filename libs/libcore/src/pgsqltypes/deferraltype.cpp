@@ -44,6 +44,11 @@ QStringList DeferralType::getTypes()
 	return TemplateType<DeferralType>::getTypes(type_names);
 }
 
+const QStringList &DeferralType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned DeferralType::setType(unsigned type_id)
 {
 	return TemplateType<DeferralType>::setType(type_id, type_names);
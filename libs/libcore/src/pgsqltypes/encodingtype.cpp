@@ -52,6 +52,11 @@ QStringList EncodingType::getTypes()
 	return TemplateType<EncodingType>::getTypes(type_names);
 }
 
+const QStringList &EncodingType::getTypeNames()
+{
+	return type_names;
+}
+
 bool EncodingType::operator == (const char *type_name)
 {
 	return ((*this) == QString(type_name));
@@ -37,6 +37,7 @@ class __libcore EncodingType: public TemplateType<EncodingType>{
 		EncodingType(unsigned type_id);
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
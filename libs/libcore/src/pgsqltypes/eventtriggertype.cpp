@@ -36,6 +36,11 @@ QStringList EventTriggerType::getTypes()
 	return TemplateType<EventTriggerType>::getTypes(type_names);
 }
 
+const QStringList &EventTriggerType::getTypeNames()
+{
+	return type_names;
+}
+
 EventTriggerType::EventTriggerType(unsigned type_id)
 {
 	setType(type_id);
@@ -42,6 +42,7 @@ class __libcore EventTriggerType: public TemplateType<EventTriggerType>{
 		EventTriggerType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
@@ -38,6 +38,11 @@ QStringList EventType::getTypes()
 	return TemplateType<EventType>::getTypes(type_names);
 }
 
+const QStringList &EventType::getTypeNames()
+{
+	return type_names;
+}
+
 EventType::EventType(const QString &type_name)
 {
 	setType(type_name);
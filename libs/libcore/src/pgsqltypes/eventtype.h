@@ -43,6 +43,7 @@ class __libcore EventType: public TemplateType<EventType>{
 		EventType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
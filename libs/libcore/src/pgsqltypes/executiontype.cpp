@@ -34,6 +34,11 @@ QStringList ExecutionType::getTypes()
 	return TemplateType<ExecutionType>::getTypes(type_names);
 }
 
+const QStringList &ExecutionType::getTypeNames()
+{
+	return type_names;
+}
+
 ExecutionType::ExecutionType(unsigned type_id)
 {
 	setType(type_id);
@@ -40,6 +40,7 @@ class __libcore ExecutionType: public TemplateType<ExecutionType>{
 		ExecutionType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
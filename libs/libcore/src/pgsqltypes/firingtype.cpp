@@ -35,6 +35,11 @@ QStringList FiringType::getTypes()
 	return TemplateType<FiringType>::getTypes(type_names);
 }
 
+const QStringList &FiringType::getTypeNames()
+{
+	return type_names;
+}
+
 FiringType::FiringType(unsigned type_id)
 {
 	setType(type_id);
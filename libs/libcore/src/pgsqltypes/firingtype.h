@@ -41,6 +41,7 @@ class __libcore FiringType: public TemplateType<FiringType>{
 		FiringType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
@@ -40,6 +40,11 @@ QStringList FunctionType::getTypes()
 	return TemplateType<FunctionType>::getTypes(type_names);
 }
 
+const QStringList &FunctionType::getTypeNames()
+{
+	return type_names;
+}
+
 FunctionType::FunctionType(const QString &type_name)
 {
 	setType(type_name);
@@ -34,6 +34,11 @@ QStringList IdentityType::getTypes()
 	return TemplateType<IdentityType>::getTypes(type_names);
 }
 
+const QStringList &IdentityType::getTypeNames()
+{
+	return type_names;
+}
+
 IdentityType::IdentityType(unsigned type_id)
 {
 	setType(type_id);
@@ -40,6 +40,7 @@ class __libcore IdentityType: public TemplateType<IdentityType>{
 		IdentityType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
@@ -43,6 +43,11 @@ QStringList IndexingType::getTypes()
 	return TemplateType<IndexingType>::getTypes(type_names);
 }
 
+const QStringList &IndexingType::getTypeNames()
+{
+	return type_names;
+}
+
 IndexingType::IndexingType(const QString &type_name)
 {
 	setType(type_name);
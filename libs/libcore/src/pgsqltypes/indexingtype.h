@@ -44,6 +44,7 @@ class __libcore IndexingType: public TemplateType<IndexingType>{
 		IndexingType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
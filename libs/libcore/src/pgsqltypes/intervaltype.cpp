@@ -41,6 +41,11 @@ QStringList IntervalType::getTypes()
 	return TemplateType<IntervalType>::getTypes(type_names);
 }
 
+const QStringList &IntervalType::getTypeNames()
+{
+	return type_names;
+}
+
 IntervalType::IntervalType(const QString &type_name)
 {
 	setType(type_name);
@@ -51,6 +51,7 @@ class __libcore IntervalType: public TemplateType<IntervalType>{
 		IntervalType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
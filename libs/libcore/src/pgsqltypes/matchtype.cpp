@@ -35,6 +35,11 @@ QStringList MatchType::getTypes()
 	return TemplateType<MatchType>::getTypes(type_names);
 }
 
+const QStringList &MatchType::getTypeNames()
+{
+	return type_names;
+}
+
 MatchType::MatchType(const QString &type_name)
 {
 	setType(type_name);
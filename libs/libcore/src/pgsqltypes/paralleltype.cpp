@@ -45,6 +45,11 @@ QStringList ParallelType::getTypes()
 	return TemplateType<ParallelType>::getTypes(type_names);
 }
 
+const QStringList &ParallelType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned ParallelType::setType(unsigned type_id)
 {
 	return TemplateType<ParallelType>::setType(type_id, type_names);
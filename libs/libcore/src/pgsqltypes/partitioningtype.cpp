@@ -35,6 +35,11 @@ QStringList PartitioningType::getTypes()
 	return TemplateType<PartitioningType>::getTypes(type_names);
 }
 
+const QStringList &PartitioningType::getTypeNames()
+{
+	return type_names;
+}
+
 PartitioningType::PartitioningType(unsigned type_id)
 {
 	setType(type_id);
@@ -41,6 +41,7 @@ class __libcore PartitioningType: public TemplateType<PartitioningType> {
 		PartitioningType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
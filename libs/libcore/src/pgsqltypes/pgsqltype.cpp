@@ -78,10 +78,12 @@ const QStringList PgSqlType::type_names {
 };
 
 std::vector<UserTypeConfig> PgSqlType::user_types;
+QMultiHash<QString, unsigned> PgSqlType::user_type_names;
+QHash<BaseObject *, unsigned> PgSqlType::user_type_ptrs;
 
 PgSqlType::PgSqlType()
 {
-	type_idx = type_names.indexOf("smallint");
+	type_idx = getTypeIndex("smallint", type_names);
 	reset(true);
 }
 
@@ -248,7 +250,7 @@ PgSqlType PgSqlType::parseString(const QString &str)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, str);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e, str);
 	}
 }
 
@@ -308,7 +310,7 @@ PgSqlType::TypeCategory PgSqlType::getCategory()
 unsigned PgSqlType::setType(unsigned type_id)
 {
 	if(type_id == Null)
-		throw Exception(ErrorCode::AsgInvalidTypeObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidTypeObject,__exc_origin);
 
 	if(type_id >= static_cast<unsigned>(type_names.size()))
 		return setUserType(type_id);
@@ -324,7 +326,7 @@ unsigned PgSqlType::setType(const QString &type_name)
 	usr_type_id = getUserTypeIndex(type_name, nullptr);
 
 	if(type_id == Null && usr_type_id == Null)
-		throw Exception(ErrorCode::AsgInvalidTypeObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidTypeObject,__exc_origin);
 
 	if(type_id != Null)
 		return TemplateType<PgSqlType>::setType(type_id, type_names);
@@ -448,6 +450,11 @@ QStringList PgSqlType::getTypes()
 	return TemplateType<PgSqlType>::getTypes(type_names);
 }
 
+const QStringList &PgSqlType::getTypeNames()
+{
+	return type_names;
+}
+
 bool PgSqlType::isRegistered(const QString &type, BaseObject *pmodel)
 {
 	if(getBaseTypeIndex(type) != PgSqlType::Null)
@@ -463,7 +470,7 @@ bool PgSqlType::operator == (unsigned type_id)
 
 bool PgSqlType::operator == (const QString &type_name)
 {
-	return (type_idx == static_cast<unsigned>(type_names.indexOf(type_name)));
+	return (type_idx == static_cast<unsigned>(getTypeIndex(type_name, type_names)));
 }
 
 bool PgSqlType::operator != (const QString &type_name)
@@ -549,7 +556,7 @@ unsigned PgSqlType::setUserType(unsigned type_id)
 		return type_idx;
 	}
 	else
-		throw Exception(ErrorCode::AsgInvalidTypeObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidTypeObject,__exc_origin);
 }
 
 unsigned PgSqlType::setUserType(BaseObject *ptype)
@@ -557,7 +564,7 @@ unsigned PgSqlType::setUserType(BaseObject *ptype)
 	int idx = getUserTypeIndex("", ptype);
 
 	if(idx <= 0)
-		throw Exception(ErrorCode::AsgInvalidTypeObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidTypeObject,__exc_origin);
 
 	type_idx = idx;
 	return type_idx;
@@ -577,6 +584,9 @@ void PgSqlType::addUserType(const QString &type_name, BaseObject *ptype, UserTyp
 		cfg.pmodel = ptype->getDatabase();
 		cfg.type_conf = type_conf;
 		PgSqlType::user_types.push_back(cfg);
+
+		user_type_names.insert(cfg.name, user_types.size() - 1);
+		user_type_ptrs[cfg.ptype] = user_types.size() - 1;
 	}
 }
 
@@ -598,6 +608,9 @@ void PgSqlType::removeUserType(const QString &type_name, BaseObject *ptype)
 
 		if(itr!=itr_end)
 		{
+			user_type_names.remove(itr->name, itr - user_types.begin());
+			user_type_ptrs.remove(itr->ptype);
+
 			itr->name="__invalidated_type__";
 			itr->ptype=nullptr;
 			itr->invalidated=true;
@@ -615,6 +628,10 @@ void PgSqlType::renameUserType(const QString &type_name, BaseObject *ptype, cons
 	{
 		if(!tp.invalidated && tp.name == type_name && tp.ptype == ptype)
 		{
+			unsigned idx = &tp - user_types.data();
+
+			user_type_names.remove(tp.name, idx);
+			user_type_names.insert(new_name, idx);
 			tp.name = new_name;
 			break;
 		}
@@ -643,6 +660,22 @@ void PgSqlType::removeUserTypes(BaseObject *pmodel)
 			itr++;
 		}
 	}
+
+	//Since the positions of the remaining types changed the indexes need to be rebuilt
+	user_type_names.clear();
+	user_type_ptrs.clear();
+	idx = 0;
+
+	for(auto &cfg : user_types)
+	{
+		if(!cfg.invalidated)
+		{
+			user_type_names.insert(cfg.name, idx);
+			user_type_ptrs[cfg.ptype] = idx;
+		}
+
+		idx++;
+	}
 }
 
 unsigned PgSqlType::getBaseTypeIndex(const QString &type_name)
@@ -650,7 +683,11 @@ unsigned PgSqlType::getBaseTypeIndex(const QString &type_name)
 	QString aux_name=type_name;
 
 	aux_name.remove("[]");
-	aux_name.remove(QRegularExpression("( )(with)(out)?(.)*"));
+
+	//Removing the timezone modifiers (with time zone / without time zone)
+	if(aux_name.contains(" with"))
+		aux_name.truncate(aux_name.indexOf(" with"));
+
 	aux_name=aux_name.trimmed();
 	return getType(aux_name, type_names);
 }
@@ -660,24 +697,29 @@ unsigned PgSqlType::getUserTypeIndex(const QString &type_name, BaseObject* ptype
 	if(user_types.size() == 0 || (type_name.isEmpty() && !ptype))
 		return PgSqlType::Null;
 
-	std::vector<UserTypeConfig>::iterator itr, itr_end;
-	int idx=0;
+	/* The type is searched in the indexes by name and by reference and, among the candidates
+	 * belonging to the model (when provided), the one registered first is returned */
+	unsigned idx = user_types.size();
 
-	itr=user_types.begin();
-	itr_end=user_types.end();
+	if(!type_name.isEmpty())
+	{
+		for(auto itr = user_type_names.constFind(type_name);
+				itr != user_type_names.constEnd() && itr.key() == type_name; itr++)
+		{
+			if(itr.value() < idx && (!pmodel || user_types[itr.value()].pmodel == pmodel))
+				idx = itr.value();
+		}
+	}
 
-	while(itr!=itr_end)
+	if(ptype && user_type_ptrs.contains(ptype))
 	{
-		if(!itr->invalidated &&
-				(((!type_name.isEmpty() && itr->name==type_name) || (ptype && itr->ptype==ptype)) &&
-				 ((pmodel && itr->pmodel==pmodel) || !pmodel)))
-			break;
+		unsigned ptr_idx = user_type_ptrs.value(ptype);
 
-		idx++;
-		itr++;
+		if(ptr_idx < idx && (!pmodel || user_types[ptr_idx].pmodel == pmodel))
+			idx = ptr_idx;
 	}
 
-	if(itr != itr_end)
+	if(idx < user_types.size())
 		return (PseudoEnd + 1 + idx);
 
 	return PgSqlType::Null;
@@ -1101,7 +1143,7 @@ void PgSqlType::setDimension(unsigned dim)
 		int idx=getUserTypeIndex(~(*this), nullptr) - (PseudoEnd + 1);
 		if(static_cast<unsigned>(idx) < user_types.size() &&
 				user_types[idx].type_conf==UserTypeConfig::SequenceType)
-			throw Exception(ErrorCode::AsgInvalidSequenceTypeArray,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgInvalidSequenceTypeArray,__exc_origin);
 	}
 
 	dimension=dim;
@@ -1119,13 +1161,13 @@ void PgSqlType::setPrecision(int prec)
 		//Raises an error if the user tries to specify a precision > length
 		if(((type_names[type_idx]=="numeric" ||
 			 type_names[type_idx]=="decimal") && prec > static_cast<int>(length)))
-			throw Exception(ErrorCode::AsgInvalidPrecision,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgInvalidPrecision,__exc_origin);
 
 		//Raises an error if the precision is greater thant 6
 		if(((type_names[type_idx]=="time" ||
 					type_names[type_idx]=="timestamp" ||
 					type_names[type_idx]=="interval") && prec > 6))
-			throw Exception(ErrorCode::AsgInvalidPrecisionTimestamp,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgInvalidPrecisionTimestamp,__exc_origin);
 
 		this->precision=prec;
 	}
@@ -50,6 +50,12 @@ class __libcore PgSqlType: public TemplateType<PgSqlType>{
 		//! \brief Configuration for user defined types
 		static std::vector<UserTypeConfig> user_types;
 
+		/*! \brief Indexes the valid (not invalidated) user defined types by their names and by their
+		 *  references, storing their positions in user_types. Since the same name can be used by types
+		 *  of different models the name index can store several positions for each name */
+		static QMultiHash<QString, unsigned> user_type_names;
+		static QHash<BaseObject *, unsigned> user_type_ptrs;
+
 		//! \brief Dimension of the type if it's configured as array
 		unsigned dimension,
 
@@ -313,6 +319,7 @@ class __libcore PgSqlType: public TemplateType<PgSqlType>{
 		QString getTypeSql();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		friend class Type;
 		friend class Domain;
@@ -37,6 +37,11 @@ QStringList PolicyCmdType::getTypes()
 	return TemplateType<PolicyCmdType>::getTypes(type_names);
 }
 
+const QStringList &PolicyCmdType::getTypeNames()
+{
+	return type_names;
+}
+
 PolicyCmdType::PolicyCmdType(unsigned type_id)
 {
 	setType(type_id);
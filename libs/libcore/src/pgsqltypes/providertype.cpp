@@ -44,6 +44,11 @@ QStringList ProviderType::getTypes()
 	return TemplateType<ProviderType>::getTypes(type_names);
 }
 
+const QStringList &ProviderType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned ProviderType::setType(unsigned type_id)
 {
 	return TemplateType<ProviderType>::setType(type_id, type_names);
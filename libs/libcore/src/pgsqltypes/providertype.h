@@ -40,6 +40,7 @@ class __libcore ProviderType: public TemplateType<ProviderType>{
 		ProviderType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
@@ -34,6 +34,11 @@ QStringList SecurityType::getTypes()
 	return TemplateType<SecurityType>::getTypes(type_names);
 }
 
+const QStringList &SecurityType::getTypeNames()
+{
+	return type_names;
+}
+
 SecurityType::SecurityType(const QString &type_name)
 {
 	setType(type_name);
@@ -40,6 +40,7 @@ class __libcore SecurityType: public TemplateType<SecurityType>{
 		SecurityType();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
@@ -121,6 +121,11 @@ QStringList SpatialType::getTypes()
 	return TemplateType<SpatialType>::getTypes(type_names);
 }
 
+const QStringList &SpatialType::getTypeNames()
+{
+	return type_names;
+}
+
 unsigned SpatialType::setType(unsigned type_id)
 {
 	return TemplateType<SpatialType>::setType(type_id, type_names);
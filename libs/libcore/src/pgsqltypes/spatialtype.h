@@ -69,6 +69,7 @@ class __libcore SpatialType: public TemplateType<SpatialType>{
 		QString operator * ();
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
@@ -41,6 +41,11 @@ QStringList StorageType::getTypes()
 	return TemplateType<StorageType>::getTypes(type_names);
 }
 
+const QStringList &StorageType::getTypeNames()
+{
+	return type_names;
+}
+
 StorageType::StorageType(const QString &type_name)
 {
 	setType(type_name);
@@ -42,6 +42,7 @@ class __libcore StorageType: public TemplateType<StorageType>{
 		StorageType(unsigned type_id);
 
 		static QStringList getTypes();
+		static const QStringList &getTypeNames();
 
 		unsigned setType(unsigned type_id) override;
 		unsigned setType(const QString &type_name) override;
@@ -25,7 +25,7 @@ In order to reuse this class' implementation on derived classes we need to
 use CRTP (Curiosly Recurring Template Pattern) which allows Base classes to access Derived classes
 members and attributes. In the particular case of this class we need to create a new static type_names
 attribute for each time the class is derived. See the derived classes any class *Type derived from TemplateType
-to see the CRTP working.
+to see the CRTP working. Each derived class exposes its list of names through the static method getTypeNames().
 
 Interesting readings:
 https://stackoverflow.com/questions/12796580/static-variable-for-each-derived-class
@@ -40,6 +40,7 @@ https://www.fluentcpp.com/2017/05/12/curiously-recurring-template-pattern/
 
 #include "../coreglobal.h"
 #include <QStringList>
+#include <QHash>
 #include "exception.h"
 
 template<class Class>
@@ -59,9 +60,14 @@ class __libcore TemplateType {
 		//! \brief Returns the string list for all types after removing the null ("") reserved item
 		static QStringList getTypes(const QStringList &type_list);
 
-		//! \brief Returns the type id searching by its name. Returns null when not found
+		//! \brief Returns the type id searching by its name in the provided list. Returns null when not found
 		static unsigned getType(const QString &type_name, const QStringList &type_list);
 
+		/*! \brief Returns the position of the type name in the provided list or -1 when not found.
+		 *  When the list is the one of the derived class (Class::getTypeNames()) the name is searched in a hash
+		 *  built only once per derived class, so the lookups don't need any locking. Any other list is searched linearly */
+		static int getTypeIndex(const QString &type_name, const QStringList &type_list);
+
 		//! \brief Returns the type name/string at the specified type_idx
 		static QString getTypeName(unsigned type_id, const QStringList &type_list);
 
@@ -123,10 +129,10 @@ unsigned TemplateType<Class>::setType(unsigned type_id, const QStringList &type_
 {
 	//Raises an error if the type count is invalid
 	if(type_list.isEmpty())
-		throw Exception(ErrorCode::ObtTypesInvalidQuantity,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::ObtTypesInvalidQuantity,__exc_origin);
 	//Raises an error if the type id is invalid
 	else if(!isTypeValid(type_id, type_list))
-		throw Exception(ErrorCode::AsgInvalidTypeObject,__PRETTY_FUNCTION__,__FILE__,__LINE__,
+		throw Exception(ErrorCode::AsgInvalidTypeObject,__exc_origin,
 										nullptr, QString(QT_TR_NOOP("Type id: %1")).arg(static_cast<int>(type_id)));
 
 	type_idx = type_id;
@@ -138,11 +144,11 @@ unsigned TemplateType<Class>::setType(const QString &type_name, const QStringLis
 {
 	try
 	{
-	return setType(static_cast<unsigned>(type_list.indexOf(type_name)), type_list);
+	return setType(static_cast<unsigned>(getTypeIndex(type_name, type_list)), type_list);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e,
 										QString(QT_TR_NOOP("Type name: %1")).arg(type_name));
 	}
 }
@@ -169,7 +175,7 @@ unsigned TemplateType<Class>::getType(const QString &type_name, const QStringLis
 		return Class::Null;
 	else
 	{
-		int idx = type_list.indexOf(type_name);
+		int idx = getTypeIndex(type_name, type_list);
 
 		if(idx >= 0)
 			return static_cast<unsigned>(idx);
@@ -178,11 +184,36 @@ unsigned TemplateType<Class>::getType(const QString &type_name, const QStringLis
 	}
 }
 
+template<class Class>
+int TemplateType<Class>::getTypeIndex(const QString &type_name, const QStringList &type_list)
+{
+	const QStringList &type_names = Class::getTypeNames();
+
+	if(&type_list != &type_names)
+		return type_list.indexOf(type_name);
+
+	/* Each derived class has its own instance of this method and, consequently, its own hash
+	 * which is built from the class' list of names. The initialization of the function-local
+	 * static is thread safe and runs only once */
+	static const QHash<QString, int> type_idxs = [&type_names](){
+		QHash<QString, int> idxs;
+
+		/* Walking the list backwards so in case of duplicated names
+		 * the first occurrence is kept, just like QStringList::indexOf() */
+		for(int idx = type_names.size() - 1; idx >= 0; idx--)
+			idxs[type_names[idx]] = idx;
+
+		return idxs;
+	}();
+
+	return type_idxs.value(type_name, -1);
+}
+
 template<class Class>
 QString TemplateType<Class>::getTypeName(unsigned type_id, const QStringList &type_list)
 {
 	if(type_id > static_cast<unsigned>(type_list.size()))
-		throw Exception(ErrorCode::RefTypeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefTypeInvalidIndex,__exc_origin);
 
 	return type_list[static_cast<int>(type_id)];
 }
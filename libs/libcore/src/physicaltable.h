@@ -340,7 +340,7 @@ class __libcore PhysicalTable: public BaseTable {
 		void setRelObjectsIndexes(const std::vector<QString> &obj_names, const std::vector<unsigned> &idxs, ObjectType obj_type);
 
 		//! \brief Invalidates the cached code forcing the generation of both SQL and XML
-		virtual void setCodeInvalidated(bool value) override;
+		virtual void setCodeInvalidated(bool value, bool notify = true) override;
 
 		/*! \brief Returns the alter definition by comparing the this table against the one provided via parameter
 		 * This is a pure virtual method and must be implemented by children classes */
@@ -30,7 +30,7 @@ const QString	Relationship::SrcColToken {"{sc}"};
 Relationship::Relationship(Relationship *rel) : BaseRelationship(rel)
 {
 	if(!rel)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	(*(this))=(*rel);
 }
@@ -54,7 +54,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvRelTypeForeignTable)
 							.arg(obj_name, src_tab->getName(true), dst_tab->getName(true)),
-							ErrorCode::InvRelTypeForeignTable,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvRelTypeForeignTable,__exc_origin);
 		}
 
 		/* Raises an error if the user tries to create a copy relation in which the receiver table
@@ -64,7 +64,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvCopyRelForeignTable)
 							.arg(obj_name, src_tab->getName(true), dst_tab->getName(true)),
-							ErrorCode::InvCopyRelForeignTable,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvCopyRelForeignTable,__exc_origin);
 		}
 
 		/* Raises an error if the user tries to create a relationship which some
@@ -75,7 +75,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvLinkTablesNoPrimaryKey)
 							.arg(obj_name, src_tab->getName(true), dst_tab->getName(true)),
-							ErrorCode::InvLinkTablesNoPrimaryKey,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvLinkTablesNoPrimaryKey,__exc_origin);
 		}
 
 		// Raises an error if the user tries to create another copy relationship if the table already copies another table
@@ -84,7 +84,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvCopyRelTableDefined)
 							.arg(src_tab->getName(true), dst_tab->getName(true),
 									 dynamic_cast<PhysicalTable *>(src_tab)->getCopyTable()->getName(true)),
-							ErrorCode::InvCopyRelTableDefined,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvCopyRelTableDefined,__exc_origin);
 		}
 
 		/*  If the relationship is partitioning the destination table (partitioned) shoud have
@@ -93,7 +93,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvPartitioningTypePartRel)
 							.arg(src_tab->getSignature(), dst_tab->getSignature()),
-							ErrorCode::InvPartitioningTypePartRel, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvPartitioningTypePartRel, __exc_origin);
 		}
 
 		// Raises an error if the user tries to create a partitioning relationship where one of the tables are already a partition table
@@ -102,7 +102,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvPartRelPartitionedDefined)
 							.arg(src_tab->getName(true), dst_tab->getName(true),
 									 src_tab->getPartitionedTable()->getName(true)),
-							ErrorCode::InvPartRelPartitionedDefined,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvPartRelPartitionedDefined,__exc_origin);
 		}
 
 		/* Raises an error if the user tries to create a generalization or copy relationship in
@@ -119,7 +119,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 							.arg(src_tab->getName(true), dst_tab->getName(true),
 									 src_tab->isPartitioned() || src_tab->isPartition() ?
 									 src_tab->getName(true) : dst_tab->getName(true)),
-							ErrorCode::InvRelTypeForPatitionTables,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvRelTypeForPatitionTables,__exc_origin);
 		}
 
 		fk_index = nullptr;
@@ -190,7 +190,7 @@ Relationship::Relationship(BaseRelationship::RelType rel_type, PhysicalTable *sr
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -212,12 +212,12 @@ void Relationship::setNamePattern(PatternId pat_id, const QString &pattern)
 	if(pat_id > FkIdxPattern)
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::RefInvalidNamePatternId)
-						.arg(this->getName()),__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						.arg(this->getName()),__exc_origin);
 	}
 	else if(!BaseObject::isValidName(aux_name))
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidNamePattern)
-						.arg(this->getName()),__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						.arg(this->getName()),__exc_origin);
 	}
 
 	invalidated = name_patterns[pat_id] != pattern;
@@ -227,7 +227,7 @@ void Relationship::setNamePattern(PatternId pat_id, const QString &pattern)
 QString Relationship::getNamePattern(PatternId pat_id)
 {
 	if(pat_id > FkIdxPattern)
-		throw Exception(ErrorCode::RefInvalidNamePatternId,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefInvalidNamePatternId,__exc_origin);
 
 	return name_patterns[pat_id];
 }
@@ -296,7 +296,7 @@ void Relationship::setIdentifier(bool value)
 			 (rel_type==RelationshipNn ||
 				rel_type==RelationshipGen ||
 				rel_type==RelationshipDep)))
-		throw Exception(ErrorCode::InvIdentifierRelationship,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InvIdentifierRelationship,__exc_origin);
 
 	invalidated = identifier != value;
 	identifier = value;
@@ -309,7 +309,7 @@ void Relationship::setSpecialPrimaryKeyCols(std::vector<unsigned> &cols)
 	if(!cols.empty() && (isSelfRelationship() || isIdentifier()))
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvUseSpecialPrimaryKey)
 						.arg(this->getName()),
-						ErrorCode::InvUseSpecialPrimaryKey,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::InvUseSpecialPrimaryKey,__exc_origin);
 
 	this->column_ids_pk_rel=cols;
 }
@@ -397,7 +397,7 @@ void Relationship::setTableNameRelNN(const QString &name)
 	if(rel_type==RelationshipNn)
 	{
 		if(!BaseObject::isValidName(name))
-			throw Exception(ErrorCode::AsgInvalidNameTableRelNN, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgInvalidNameTableRelNN, __exc_origin);
 
 		invalidated = tab_name_relnn != name;
 		tab_name_relnn = name;
@@ -475,7 +475,7 @@ int Relationship::getObjectIndex(TableObject *object)
 
 	//Raises an error if the object is not allocated
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	//Selecting the correct list using the object type
 	obj_type=object->getObjectType();
@@ -485,7 +485,7 @@ int Relationship::getObjectIndex(TableObject *object)
 		list=&rel_constraints;
 	else
 		//Raises an error if the object type isn't valid (not a column or constraint)
-		throw Exception(ErrorCode::RefObjectInvalidType, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidType, __exc_origin);
 
 	itr=list->begin();
 	itr_end=list->end();
@@ -584,7 +584,7 @@ Class *Relationship::createObject()
 void Relationship::discardObject(TableObject* object)
 {
 	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	ObjectType obj_type = object->getObjectType();
 
@@ -612,7 +612,7 @@ bool Relationship::isColumnExists(Column *column)
 
 	//Raises an error if the column is not allocated
 	if(!column)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	itr=gen_columns.begin();
 	itr_end=gen_columns.end();
@@ -640,7 +640,7 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 			!(tab_obj->isAddedByRelationship() &&
 			  tab_obj->isProtected() &&
 				tab_obj->getObjectType()==ObjectType::Constraint))
-		throw Exception(ErrorCode::AsgObjectInvalidRelationshipType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgObjectInvalidRelationshipType,__exc_origin);
 
 	try
 	{
@@ -652,7 +652,7 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 							.arg(tab_obj->getTypeName())
 							.arg(this->getName(true))
 							.arg(this->getTypeName()),
-							ErrorCode::AsgDuplicatedObject, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgDuplicatedObject, __exc_origin);
 		}
 
 		//Gets the object list according the object type
@@ -663,7 +663,7 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 			obj_list=&rel_constraints;
 		else
 			//Raises an error if the object type isn't valid (not a column or constraint)
-			throw Exception(ErrorCode::AsgObjectInvalidType, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgObjectInvalidType, __exc_origin);
 
 		//Defines the parent table for the object only for validation
 		tab_obj->setParentTable(src_table);
@@ -679,7 +679,7 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 
 			//Raises an error if the user try to add as foreign key to relationship
 			if(rest->getConstraintType()==ConstraintType::ForeignKey)
-				throw Exception(ErrorCode::AsgForeignKeyRelationship,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ErrorCode::AsgForeignKeyRelationship,__exc_origin);
 
 			rest->getSourceCode(SchemaParser::SqlCode);
 		}
@@ -706,9 +706,9 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgObjectInvalidDefinition)
 							.arg(tab_obj->getName())
 							.arg(tab_obj->getTypeName()),
-							ErrorCode::AsgObjectInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+							ErrorCode::AsgObjectInvalidDefinition,__exc_origin, &e);
 		else
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -756,11 +756,11 @@ void Relationship::removeObject(unsigned obj_id, ObjectType obj_type)
 	else if(obj_type==ObjectType::Constraint)
 		obj_list=&rel_constraints;
 	else
-		throw Exception(ErrorCode::RefObjectInvalidType, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidType, __exc_origin);
 
 	//Raises an error if the object index is out of bound
 	if(obj_id >= obj_list->size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	tab_obj=obj_list->at(obj_id);
 	recv_table=this->getReceiverTable();
@@ -796,7 +796,7 @@ void Relationship::removeObject(unsigned obj_id, ObjectType obj_type)
 							.arg(constr->getTypeName())
 							.arg(this->getName(true))
 							.arg(this->getTypeName()),
-							ErrorCode::RemInderectReference,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::RemInderectReference,__exc_origin);
 
 		//Generating the column index inside the special pk column list
 		col_idx=getObjectIndex(col) + gen_columns.size();
@@ -824,7 +824,7 @@ void Relationship::removeObject(unsigned obj_id, ObjectType obj_type)
 void Relationship::removeObject(TableObject *object)
 {
 	if(!object)
-		throw Exception(ErrorCode::RemNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RemNotAllocatedObject,__exc_origin);
 
 	removeObject(getObjectIndex(object),object->getObjectType());
 }
@@ -885,10 +885,10 @@ TableObject *Relationship::getObject(unsigned obj_idx, ObjectType obj_type)
 	else if(obj_type==ObjectType::Constraint)
 		list=&rel_constraints;
 	else
-		throw Exception(ErrorCode::RefObjectInvalidType, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidType, __exc_origin);
 
 	if(obj_idx >= list->size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex, __exc_origin);
 
 	return list->at(obj_idx);
 }
@@ -905,7 +905,7 @@ TableObject *Relationship::getObject(const QString &name, ObjectType obj_type)
 	else if(obj_type==ObjectType::Constraint)
 		list=&rel_constraints;
 	else
-		throw Exception(ErrorCode::RefObjectInvalidType, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidType, __exc_origin);
 
 	itr=list->begin();
 	itr_end=list->end();
@@ -927,7 +927,7 @@ Column *Relationship::getAttribute(unsigned attrib_idx)
 {
 	//Raises an error if the attribute index is out of bound
 	if(attrib_idx >= rel_attributes.size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	return dynamic_cast<Column *>(rel_attributes[attrib_idx]);
 }
@@ -946,7 +946,7 @@ Constraint *Relationship::getConstraint(unsigned constr_idx)
 {
 	//Raises an error if the constraint index is out of bound
 	if(constr_idx >= rel_constraints.size())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	return dynamic_cast<Constraint *>(rel_constraints[constr_idx]);
 }
@@ -978,7 +978,7 @@ unsigned Relationship::getObjectCount(ObjectType obj_type)
 	else if(obj_type==ObjectType::Constraint)
 		return rel_constraints.size();
 	else
-		throw Exception(ErrorCode::RefObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidType,__exc_origin);
 }
 
 void Relationship::addConstraints(PhysicalTable *recv_tab)
@@ -1044,7 +1044,7 @@ void Relationship::addConstraints(PhysicalTable *recv_tab)
 			itr++;
 		}
 
-		throw Exception(e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1083,7 +1083,7 @@ void Relationship::addColumnsRelGenPart(bool missing_only)
 		if(rel_type == RelationshipPart && !dst_tab->isPartitioned())
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvPartitioningTypePartRel)
 						  .arg(src_tab->getSignature()).arg(dst_tab->getSignature()),
-							ErrorCode::InvPartitioningTypePartRel, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvPartitioningTypePartRel, __exc_origin);
 
 		/* This for compares the columns of the receiver table
 		 with the columns of the reference table in order to
@@ -1322,7 +1322,7 @@ void Relationship::addColumnsRelGenPart(bool missing_only)
 					.arg(src_tab->getName(true));
 			}
 
-			throw Exception(msg, err_code,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(msg, err_code,__exc_origin);
 		}
 
 		/* Creates the special primary key if exists and if the receiver table is not a foreign table .
@@ -1339,7 +1339,7 @@ void Relationship::addColumnsRelGenPart(bool missing_only)
 		this->connected=true;
 		this->disconnectRelationship();
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1376,13 +1376,13 @@ void Relationship::addCheckConstrsRelGenPart()
 					throw Exception(Exception::getErrorMessage(ErrorCode::InvInheritRelationshipIncompConstrs)
 									.arg(constr->getName()).arg(parent_tab->getName(false, true))
 									.arg(aux_constr->getName()).arg(child_tab->getName(false, true)),
-									ErrorCode::InvInheritRelationshipIncompConstrs,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::InvInheritRelationshipIncompConstrs,__exc_origin);
 			}
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1481,7 +1481,7 @@ void Relationship::connectRelationship()
 			delete table_relnn;
 			table_relnn=nullptr;
 		}
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1620,7 +1620,7 @@ void Relationship::configureIndentifierRel(PhysicalTable *recv_tab)
 			pk_relident=nullptr;
 		}
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1671,7 +1671,7 @@ void Relationship::addUniqueKey(PhysicalTable *recv_tab)
 			uq_rel11=nullptr;
 		}
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1731,7 +1731,7 @@ void Relationship::addForeignKeyIndex(PhysicalTable *recv_tab)
 			fk_index = nullptr;
 		}
 
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -1862,7 +1862,7 @@ void Relationship::addForeignKey(PhysicalTable *ref_tab, PhysicalTable *recv_tab
 			fk_rel1n=nullptr;
 		}
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1900,7 +1900,7 @@ void Relationship::addAttributes(PhysicalTable *recv_tab)
 			itr++;
 		}
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1924,7 +1924,7 @@ void Relationship::copyColumns(PhysicalTable *ref_tab, PhysicalTable *recv_tab,
 							.arg(this->obj_name)
 							.arg(ref_tab->getName(true))
 							.arg(recv_tab->getName(true)),
-							ErrorCode::InvLinkTablesNoPrimaryKey,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::InvLinkTablesNoPrimaryKey,__exc_origin);
 
 		count=pk->getColumnCount(Constraint::SourceCols);
 
@@ -2020,7 +2020,7 @@ void Relationship::copyColumns(PhysicalTable *ref_tab, PhysicalTable *recv_tab,
 
 		prev_ref_col_names.clear();
 		pk_columns.clear();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2102,7 +2102,7 @@ void Relationship::addColumnsRel11()
 		this->connected=true;
 		this->disconnectRelationship();
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2180,7 +2180,7 @@ void Relationship::addColumnsRel1n()
 		this->connected=true;
 		this->disconnectRelationship();
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2276,7 +2276,7 @@ void Relationship::addColumnsRelNn()
 		//Forcing the relationship as connected to perform the disconnection operations
 		this->connected=true;
 		this->disconnectRelationship();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2666,7 +2666,7 @@ void Relationship::disconnectRelationship(bool rem_tab_objs)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -39,7 +39,7 @@ void Schema::setName(const QString &name)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgReservedName)
 						.arg(this->getName())
 						.arg(BaseObject::getTypeName(ObjectType::Schema)),
-						ErrorCode::AsgReservedName,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgReservedName,__exc_origin);
 
 	BaseObject::setName(name);
 }
@@ -79,7 +79,12 @@ bool Schema::isRectVisible()
 
 QString Schema::getSourceCode(SchemaParser::CodeType def_type)
 {
-	QString code_def=getCachedCode(def_type, false);
+	return getSourceCode(def_type, false);
+}
+
+QString Schema::getSourceCode(SchemaParser::CodeType def_type, bool reduced_form)
+{
+	QString code_def=getCachedCode(def_type, reduced_form);
 	if(!code_def.isEmpty()) return code_def;
 
 	attributes[Attributes::FillColor]=fill_color.name();
@@ -89,5 +94,5 @@ QString Schema::getSourceCode(SchemaParser::CodeType def_type)
 	setFadedOutAttribute();
 	setLayersAttribute();
 
-	return BaseObject::__getSourceCode(def_type);
+	return BaseObject::getSourceCode(def_type, reduced_form);
 }
@@ -54,6 +54,7 @@ class __libcore Schema: public BaseGraphicObject {
 		bool isRectVisible();
 
 		virtual QString getSourceCode(SchemaParser::CodeType def_type) final;
+		virtual QString getSourceCode(SchemaParser::CodeType def_type, bool reduced_form) final;
 };
 
 #endif
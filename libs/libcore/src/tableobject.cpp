@@ -116,15 +116,15 @@ QString TableObject::getHashCode()
 	return hash_code;
 }
 
-void TableObject::setCodeInvalidated(bool value)
+void TableObject::setCodeInvalidated(bool value, bool notify)
 {
 	if(parent_table)
 	{
-		parent_table->BaseObject::setCodeInvalidated(value);
+		parent_table->BaseObject::setCodeInvalidated(value, notify);
 		parent_table->resetHashCode();
 	}
 
-	BaseObject::setCodeInvalidated(value);
+	BaseObject::setCodeInvalidated(value, notify);
 	generateHashCode();
 }
 
@@ -143,7 +143,7 @@ QString TableObject::getAlterCode(BaseObject *object)
 	TableObject *tab_obj = dynamic_cast<TableObject *>(object);
 
 	if(!tab_obj)
-		throw Exception(ErrorCode::OprNotAllocatedObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject, __exc_origin);
 
 	try
 	{
@@ -156,7 +156,7 @@ QString TableObject::getAlterCode(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 
 }
@@ -172,7 +172,7 @@ QString TableObject::getSignature(bool format)
 void TableObject::setParentRelationship(BaseObject *parent_rel)
 {
 	if(parent_rel && parent_rel->getObjectType()!=ObjectType::Relationship)
-		throw Exception(ErrorCode::AsgObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgObjectInvalidType,__exc_origin);
 
 	this->parent_rel = parent_rel;
 }
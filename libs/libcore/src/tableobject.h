@@ -115,7 +115,7 @@ class __libcore TableObject: public BaseObject {
 		//! \brief Returns if the passed type is a table child object (column, constraint, index, rule, trigger)
 		static bool isTableObject(ObjectType type);
 
-		virtual void setCodeInvalidated(bool value) override;
+		virtual void setCodeInvalidated(bool value, bool notify = true) override;
 
 		void operator = (TableObject &object);
 
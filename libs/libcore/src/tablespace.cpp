@@ -35,7 +35,7 @@ void Tablespace::setName(const QString &name)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgReservedName)
 						.arg(this->getName())
 						.arg(BaseObject::getTypeName(ObjectType::Tablespace)),
-						ErrorCode::AsgReservedName,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgReservedName,__exc_origin);
 
 	BaseObject::setName(name);
 }
@@ -50,7 +50,7 @@ void Tablespace::setDirectory(const QString &dir)
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgEmptyDirectoryName).arg(obj_name),
 										ErrorCode::AsgEmptyDirectoryName,
-										__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										__exc_origin);
 	}
 
 	setCodeInvalidated(this->directory != dir_aux);
@@ -64,12 +64,17 @@ QString Tablespace::getDirectory()
 
 QString Tablespace::getSourceCode(SchemaParser::CodeType def_type)
 {
-	QString code_def=getCachedCode(def_type, false);
+	return getSourceCode(def_type, false);
+}
+
+QString Tablespace::getSourceCode(SchemaParser::CodeType def_type, bool reduced_form)
+{
+	QString code_def=getCachedCode(def_type, reduced_form);
 	if(!code_def.isEmpty()) return code_def;
 
 	if(!directory.isEmpty())
 		attributes[Attributes::Directory]="'" + directory + "'";
 
-	return BaseObject::__getSourceCode(def_type);
+	return BaseObject::getSourceCode(def_type, reduced_form);
 }
 
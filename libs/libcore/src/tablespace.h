@@ -50,6 +50,7 @@ class __libcore Tablespace: public BaseObject{
 
 		//! \brief Returns the SQL / XML code for the tablespace
 		virtual QString getSourceCode(SchemaParser::CodeType def_type) final;
+		virtual QString getSourceCode(SchemaParser::CodeType def_type, bool reduced_form) final;
 };
 
 #endif
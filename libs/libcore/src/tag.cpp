@@ -38,11 +38,12 @@ Tag::Tag()
 void Tag::setName(const QString &name)
 {
 	if(name.isEmpty())
-		throw Exception(ErrorCode::AsgEmptyNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgEmptyNameObject,__exc_origin);
 	else if(name.size() > BaseObject::ObjectNameMaxLength)
-		throw Exception(ErrorCode::AsgLongNameObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgLongNameObject ,__exc_origin);
 
 	this->obj_name=name;
+	notifyNameChanged();
 }
 
 QString Tag::getName(bool, bool)
@@ -60,7 +61,7 @@ void Tag::setElementColor(const QString &elem_id, const QColor &color, ColorId c
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -82,7 +83,7 @@ void Tag::setElementColors(const QString &elem_id, const QString &colors)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -95,7 +96,7 @@ QColor Tag::getElementColor(const QString &elem_id, ColorId color_id)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -103,12 +104,12 @@ void Tag::validateElementId(const QString &id, ColorId color_id)
 {
 	if(color_config.count(id) == 0)
 		throw Exception(Exception::getErrorMessage(ErrorCode::OprInvalidElementId).arg(id),
-										ErrorCode::OprInvalidElementId ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::OprInvalidElementId ,__exc_origin);
 	else if((color_id > ColorId::BorderColor) ||
 					(color_id > ColorId::FillColor1 &&
 					 (id==Attributes::TableName || id==Attributes::TableSchemaName)))
 		throw Exception(Exception::getErrorMessage(ErrorCode::RefInvalidElementColorId).arg(id).arg(enum_t(color_id)),
-										ErrorCode::RefInvalidElementColorId ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::RefInvalidElementColorId ,__exc_origin);
 }
 
 QLinearGradient Tag::getFillStyle(const QString &elem_id)
@@ -126,7 +127,7 @@ QLinearGradient Tag::getFillStyle(const QString &elem_id)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -165,7 +166,7 @@ QString Tag::getSourceCode(SchemaParser::CodeType def_type, bool reduced_form)
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 		}
 
 		return BaseObject::getSourceCode(def_type, reduced_form);
@@ -78,7 +78,7 @@ void Textbox::operator = (Textbox &txtbox)
 void Textbox::setTextAttribute(TextAttrib attrib, bool value)
 {
 	if(attrib > UnderlineText)
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	text_attributes[attrib]=value;
 }
@@ -96,7 +96,7 @@ QColor Textbox::getTextColor()
 bool Textbox::getTextAttribute(TextAttrib attrib)
 {
 	if(attrib > UnderlineText)
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	return text_attributes[attrib];
 }
@@ -54,7 +54,7 @@ void Transform::setName(const QString &)
 void Transform::setType(PgSqlType tp)
 {
 	if(tp == PgSqlType::Null)
-		throw Exception(ErrorCode::AsgInvalidTypeObject, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::AsgInvalidTypeObject, __exc_origin);
 
 	try
 	{
@@ -68,14 +68,14 @@ void Transform::setType(PgSqlType tp)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
 void Transform::setLanguage(Language *lang)
 {
 	if(!lang)
-		throw Exception(ErrorCode::AsgNotAllocatedLanguage, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::AsgNotAllocatedLanguage, __exc_origin);
 
 	setCodeInvalidated(language != lang);
 	language = lang;
@@ -92,14 +92,14 @@ void Transform::setFunction(Function *func, FunctionId func_id)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
 void Transform::validateFunction(Function *func, FunctionId func_id)
 {
 	if(func_id > ToSqlFunc)
-		throw Exception(ErrorCode::RefFunctionInvalidType, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefFunctionInvalidType, __exc_origin);
 
 	if(!func)
 		return;
@@ -110,7 +110,7 @@ void Transform::validateFunction(Function *func, FunctionId func_id)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidParamCount)
 						.arg(this->getName())
 						.arg(this->getTypeName()),
-						ErrorCode::AsgFunctionInvalidParamCount,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgFunctionInvalidParamCount,__exc_origin);
 	}
 
 	// The function must have a single parameter of the type "internal"
@@ -119,7 +119,7 @@ void Transform::validateFunction(Function *func, FunctionId func_id)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidParameters)
 						.arg(this->getName())
 						.arg(this->getTypeName()),
-						ErrorCode::AsgFunctionInvalidParameters,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgFunctionInvalidParameters,__exc_origin);
 	}
 
 	/* ToSqlFunc must return a type that is equivalent to the type being handled by the transform
@@ -130,7 +130,7 @@ void Transform::validateFunction(Function *func, FunctionId func_id)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidReturnType)
 						.arg(this->getName())
 						.arg(this->getTypeName()),
-						ErrorCode::AsgFunctionInvalidReturnType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgFunctionInvalidReturnType,__exc_origin);
 	}
 }
 
@@ -147,7 +147,7 @@ Language *Transform::getLanguage()
 Function *Transform::getFunction(FunctionId func_id)
 {
 	if(func_id > ToSqlFunc)
-		throw Exception(ErrorCode::RefFunctionInvalidType, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		throw Exception(ErrorCode::RefFunctionInvalidType, __exc_origin);
 
 	return functions[func_id];
 }
@@ -73,12 +73,12 @@ void Type::setSchema(BaseObject *schema)
 	PgSqlType::renameUserType(prev_name, this, this->getName(true));
 }
 
-void Type::setCodeInvalidated(bool value)
+void Type::setCodeInvalidated(bool value, bool notify)
 {
-	BaseObject::setCodeInvalidated(value);
+	BaseObject::setCodeInvalidated(value, notify);
 
 	for(auto &typ_attr : type_attribs)
-		typ_attr.setCodeInvalidated(value);
+		typ_attr.setCodeInvalidated(value, notify);
 }
 
 int Type::getAttributeIndex(const QString &attrib_name)
@@ -107,14 +107,14 @@ void Type::addAttribute(TypeAttribute attrib)
 {
 	//Raises an error if the attribute has an empty name or null type
 	if(attrib.getName().isEmpty() || attrib.getType()==PgSqlType::Null)
-		throw Exception(ErrorCode::InsInvalidTypeAttribute,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InsInvalidTypeAttribute,__exc_origin);
 	//Raises an error if the passed attribute has the same type as the defining type (this)
 	else if(PgSqlType::getUserTypeIndex(this->getName(true), this) == !attrib.getType())
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvUserTypeSelfReference).arg(this->getName(true)),
-						ErrorCode::InvUserTypeSelfReference,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::InvUserTypeSelfReference,__exc_origin);
 	//Raises an error when the attribute already exists
 	else if(getAttributeIndex(attrib.getName()) >= 0)
-		throw Exception(ErrorCode::InsDuplicatedItems,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InsDuplicatedItems,__exc_origin);
 
 	type_attribs.push_back(attrib);
 	setCodeInvalidated(true);
@@ -124,7 +124,7 @@ void Type::removeAttribute(unsigned attrib_idx)
 {
 	//Raises an error if the attribute index is out of bound
 	if(attrib_idx >= type_attribs.size())
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	type_attribs.erase(type_attribs.begin() + attrib_idx);
 	setCodeInvalidated(true);
@@ -140,14 +140,14 @@ void Type::addEnumeration(const QString &enum_name)
 {
 	//Raises an error if the enumaration name is empty
 	if(enum_name.isEmpty())
-		throw Exception(ErrorCode::InsInvalidEnumerationItem,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InsInvalidEnumerationItem,__exc_origin);
 	//Raises an error if the enumeration name is invalid (exceeds the maximum length)
 	else if(enum_name.size() > BaseObject::ObjectNameMaxLength)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgEnumLongName).arg(enum_name).arg(this->getName(true)),
-						ErrorCode::AsgEnumLongName,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgEnumLongName,__exc_origin);
 	//Raises an error if the enumeration already exists
 	else if(enumerations.contains(enum_name))
-		throw Exception(ErrorCode::InsDuplicatedEnumerationItem,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::InsDuplicatedEnumerationItem,__exc_origin);
 
 	enumerations.append(enum_name);
 	setCodeInvalidated(true);
@@ -156,7 +156,7 @@ void Type::addEnumeration(const QString &enum_name)
 void Type::removeEnumeration(unsigned enum_idx)
 {
 	if(enum_idx >= static_cast<unsigned>(enumerations.size()))
-		throw Exception(ErrorCode::RefEnumerationInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefEnumerationInvalidIndex,__exc_origin);
 
 	enumerations.removeAt(enum_idx);
 	setCodeInvalidated(true);
@@ -172,7 +172,7 @@ void Type::setConfiguration(TypeConfig conf)
 {
 	//Raises an error if the configuration type is invalid
 	if(conf > RangeType)
-		throw Exception(ErrorCode::AsgInvalidTypeConfiguration,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidTypeConfiguration,__exc_origin);
 
 	type_attribs.clear();
 	enumerations.clear();
@@ -202,7 +202,7 @@ void Type::setFunction(FunctionId func_id, Function *func)
 
 	//Raises an error if the function id is invalid
 	if(func_id > SubtypeDiffFunc)
-		throw Exception(ErrorCode::RefFunctionInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefFunctionInvalidType,__exc_origin);
 
 	if(func)
 		param_count=func->getParameterCount();
@@ -211,14 +211,14 @@ void Type::setFunction(FunctionId func_id, Function *func)
 	to the type's configuraiton */
 	if((config==BaseType && func_id >= CanonicalFunc) ||
 			(config==RangeType && func_id <= AnalyzeFunc))
-		throw Exception(ErrorCode::RefInvalidFunctionIdTypeConfig,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefInvalidFunctionIdTypeConfig,__exc_origin);
 	/* Raises an error if the function isn't defined and the function id is INPUT or OUTPUT,
 		because this function is mandatory for base types */
 	else if(!func && (func_id==InputFunc || func_id==OutputFunc))
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgNotAllocatedFunction)
 						.arg(this->getName(true))
 						.arg(BaseObject::getTypeName(ObjectType::Type)),
-						ErrorCode::AsgNotAllocatedFunction,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgNotAllocatedFunction,__exc_origin);
 
 	else if(func)
 	{
@@ -227,7 +227,7 @@ void Type::setFunction(FunctionId func_id, Function *func)
 		if((func_id!=CanonicalFunc && func_id!=SubtypeDiffFunc) &&
 				func->getLanguage()->getName().toLower() != DefaultLanguages::C &&
 				func->getLanguage()->getName().toLower() != DefaultLanguages::Internal)
-			throw Exception(ErrorCode::AsgFunctionInvalidLanguage,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgFunctionInvalidLanguage,__exc_origin);
 
 		/* Raises an error if the parameter count for INPUT and RECV functions
 		 is different from 1 or 3. */
@@ -241,7 +241,7 @@ void Type::setFunction(FunctionId func_id, Function *func)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidParamCount)
 							.arg(this->getName())
 							.arg(BaseObject::getTypeName(ObjectType::Type)),
-							ErrorCode::AsgFunctionInvalidParamCount,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgFunctionInvalidParamCount,__exc_origin);
 		/* Checking the return types of function in relation to type.
 		 INPUT, RECV and CANONICAL functions must return the data type that is being defined according to the
 		 documentation, but to facilitate the implementation the function must return data type
@@ -261,7 +261,7 @@ void Type::setFunction(FunctionId func_id, Function *func)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidReturnType)
 							.arg(this->getName())
 							.arg(BaseObject::getTypeName(ObjectType::Type)),
-							ErrorCode::AsgFunctionInvalidReturnType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgFunctionInvalidReturnType,__exc_origin);
 
 		/* Validating the parameter types of function in relation to the type configuration.
 		 The INPUT function must have parameters with type (cstring, oid, integer).
@@ -293,7 +293,7 @@ void Type::setFunction(FunctionId func_id, Function *func)
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgFunctionInvalidParameters)
 							.arg(this->getName())
 							.arg(this->getTypeName()),
-							ErrorCode::AsgFunctionInvalidParameters,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::AsgFunctionInvalidParameters,__exc_origin);
 
 		func->setProtected(false);
 	}
@@ -363,7 +363,7 @@ void Type::setAlignment(PgSqlType type)
 	//Raises an error if the type assigned to the alignment is invalid according to the rule
 	if(tp!="char" && tp!="smallint" && tp!="integer" && tp!="double precision")
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidAlignmentType).arg(this->getName(true)),
-						ErrorCode::AsgInvalidAlignmentType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgInvalidAlignmentType,__exc_origin);
 
 	setCodeInvalidated(alignment != type);
 	alignment=tp;
@@ -387,12 +387,12 @@ void Type::setElement(PgSqlType elem)
 {
 	if(PgSqlType::getUserTypeIndex(this->getName(true), this) == !elem)
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvUserTypeSelfReference).arg(this->getName(true)),
-						ErrorCode::InvUserTypeSelfReference,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::InvUserTypeSelfReference,__exc_origin);
 	else if(elem!="\"any\"" &&
 			(elem.isOidType() || elem.isPseudoType() ||
 			 elem.isUserType() || elem.isArrayType()))
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidElementType).arg(this->getName(true)),
-						ErrorCode::AsgInvalidElementType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgInvalidElementType,__exc_origin);
 
 	elem.reset();
 	setCodeInvalidated(element != elem);
@@ -461,7 +461,7 @@ void Type::setLikeType(PgSqlType like_type)
 {
 	if(PgSqlType::getUserTypeIndex(this->getName(true), this) == !like_type)
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvUserTypeSelfReference).arg(this->getName(true)),
-						ErrorCode::InvUserTypeSelfReference,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::InvUserTypeSelfReference,__exc_origin);
 
 	like_type.reset();
 	setCodeInvalidated(this->like_type != like_type);
@@ -472,7 +472,7 @@ void Type::setSubtype(PgSqlType subtype)
 {
 	if(PgSqlType::getUserTypeIndex(this->getName(true), this) == !subtype)
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvUserTypeSelfReference).arg(this->getName(true)),
-						ErrorCode::InvUserTypeSelfReference,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::InvUserTypeSelfReference,__exc_origin);
 
 	subtype.reset();
 	setCodeInvalidated(this->subtype != subtype);
@@ -485,7 +485,7 @@ void Type::setSubtypeOpClass(OperatorClass *opclass)
 		throw Exception(Exception::getErrorMessage(ErrorCode::AsgInvalidOpClassObject)
 						.arg(this->getName(true))
 						.arg(this->getTypeName()),
-						ErrorCode::AsgInvalidOpClassObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						ErrorCode::AsgInvalidOpClassObject,__exc_origin);
 
 	setCodeInvalidated(subtype_opclass != opclass);
 	subtype_opclass=opclass;
@@ -494,7 +494,7 @@ void Type::setSubtypeOpClass(OperatorClass *opclass)
 TypeAttribute Type::getAttribute(unsigned attrib_idx)
 {
 	if(attrib_idx >= type_attribs.size())
-		throw Exception(ErrorCode::RefAttributeInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefAttributeInvalidIndex,__exc_origin);
 
 	return type_attribs[attrib_idx];
 }
@@ -507,7 +507,7 @@ unsigned Type::getAttributeCount()
 QString Type::getEnumeration(unsigned idx_enum)
 {
 	if(idx_enum >= static_cast<unsigned>(enumerations.size()))
-		throw Exception(ErrorCode::RefEnumerationInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefEnumerationInvalidIndex,__exc_origin);
 
 	return enumerations[idx_enum];
 }
@@ -520,7 +520,7 @@ unsigned Type::getEnumerationCount()
 Function *Type::getFunction(FunctionId func_id)
 {
 	if(func_id > SubtypeDiffFunc)
-		throw Exception(ErrorCode::RefFunctionInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefFunctionInvalidType,__exc_origin);
 
 	return functions[func_id];
 }
@@ -702,7 +702,7 @@ QString Type::getAlterCode(BaseObject *object)
 	Type *type=dynamic_cast<Type *>(object);
 
 	if(!type)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	try
 	{
@@ -795,7 +795,7 @@ QString Type::getAlterCode(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
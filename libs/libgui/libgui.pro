@@ -106,6 +106,7 @@ src/utils/deletableitemdelegate.cpp \
 src/utils/htmlitemdelegate.cpp \
 	src/utils/matchinfo.cpp \
 	src/utils/objectslistmodel.cpp \
+	src/utils/objectstreemodel.cpp \
 src/utils/plaintextitemdelegate.cpp \
 src/utils/resultsetmodel.cpp \
 src/utils/syntaxhighlighter.cpp \
@@ -232,6 +233,7 @@ src/utils/deletableitemdelegate.h \
 src/utils/htmlitemdelegate.h \
 	src/utils/matchinfo.h \
 	src/utils/objectslistmodel.h \
+	src/utils/objectstreemodel.h \
 src/utils/plaintextitemdelegate.h \
 src/utils/resultsetmodel.h \
 src/utils/syntaxhighlighter.h \
@@ -128,7 +128,7 @@ void AggregateWidget::handleDataType(int row)
 		if(input_types_tab->getCellText(row, 0).isEmpty())
 			input_types_tab->removeRow(row);
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -161,7 +161,7 @@ void AggregateWidget::applyConfiguration()
 	catch(Exception &e)
 	{
 		cancelConfiguration();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
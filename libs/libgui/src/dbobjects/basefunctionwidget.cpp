@@ -157,7 +157,7 @@ void BaseFunctionWidget::showParameterForm(CustomTableWidget *params_tab, bool e
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -184,7 +184,7 @@ Parameter BaseFunctionWidget::getParameter(CustomTableWidget *params_tab, unsign
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 		}
 	}
 
@@ -351,6 +351,6 @@ void BaseFunctionWidget::applyBasicConfiguration(BaseFunction *func)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
@@ -130,7 +130,7 @@ void RoleWidget::showRoleData(Role *role, unsigned table_id, unsigned row)
 		Role *aux_role=nullptr;
 
 		if(table_id > 3)
-			throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 		members_tab[table_id]->setRowData(QVariant::fromValue(reinterpret_cast<void *>(role)), row);
 		members_tab[table_id]->setCellText(role->getName(), row, 0);
@@ -264,7 +264,7 @@ void RoleWidget::applyConfiguration()
 			{
 				throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 												.arg(aux_role->getName(), aux_role->getTypeName()),
-												ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::OprReservedObject,__exc_origin);
 			}
 
 			op_list->registerObject(aux_role, Operation::ObjModified);
@@ -278,6 +278,6 @@ void RoleWidget::applyConfiguration()
 	catch(Exception &e)
 	{
 		cancelConfiguration();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
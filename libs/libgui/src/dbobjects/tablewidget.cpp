@@ -417,7 +417,7 @@ void TableWidget::__setAttributes(DatabaseModel *model, OperationList *op_list,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -490,7 +490,7 @@ void TableWidget::listObjects(ObjectType obj_type)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -532,7 +532,7 @@ void TableWidget::handleObject()
 	catch(Exception &e)
 	{
 		listObjects(obj_type);
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -770,7 +770,7 @@ void TableWidget::removeObjects()
 				throw Exception(Exception::getErrorMessage(ErrorCode::RemProtectedObject)
 								.arg(object->getName())
 								.arg(object->getTypeName()),
-								ErrorCode::RemProtectedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								ErrorCode::RemProtectedObject,__exc_origin);
 		}
 
 		if(obj_type == ObjectType::Constraint)
@@ -794,7 +794,7 @@ void TableWidget::removeObjects()
 			op_list->ignoreOperationChain(false);
 		}
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -822,7 +822,7 @@ void TableWidget::removeObject(int row)
 			throw Exception(Exception::getErrorMessage(ErrorCode::RemProtectedObject)
 							.arg(object->getName())
 							.arg(object->getTypeName()),
-							ErrorCode::RemProtectedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							ErrorCode::RemProtectedObject,__exc_origin);
 
 		if(obj_type == ObjectType::Constraint)
 			updatePkColumnsCheckState(dynamic_cast<Constraint *>(object)->getConstraintType() == ConstraintType::PrimaryKey);
@@ -838,7 +838,7 @@ void TableWidget::removeObject(int row)
 		}
 
 		listObjects(obj_type);
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -909,7 +909,7 @@ void TableWidget::duplicateObject(int sel_row, int new_row)
 		}
 
 		listObjects(obj_type);
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -942,7 +942,7 @@ void TableWidget::swapObjects(int idx1, int idx2)
 	catch(Exception &e)
 	{
 		listObjects(obj_type);
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1095,7 +1095,7 @@ void TableWidget::applyConfiguration()
 			if(e.getErrorCode()==ErrorCode::RemInvalidatedObjects)
 				Messagebox::error(e, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 			else
-				throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 		}
 
 		op_list->finishOperationChain();
@@ -1117,7 +1117,7 @@ void TableWidget::applyConfiguration()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
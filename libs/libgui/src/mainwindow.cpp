@@ -311,7 +311,6 @@ void MainWindow::configureMenusActionsWidgets()
 	oper_list_parent->setVisible(false);
 	obj_search_parent->setVisible(false);
 	model_valid_parent->setVisible(false);
-	bg_saving_wgt->setVisible(false);
 	about_wgt->setVisible(false);
 	donate_wgt->setVisible(false);
 	models_tbw_parent->lower();
@@ -504,7 +503,7 @@ void MainWindow::createMainWidgets()
 	catch(Exception &e)
 	{
 		handleInitializationFailure(e);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -552,7 +551,7 @@ void MainWindow::loadConfigurations()
 	catch(Exception &e)
 	{
 		handleInitializationFailure(e);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -635,7 +634,6 @@ void MainWindow::connectSignalsToSlots()
 		GeneralConfigWidget::saveWidgetGeometry(configuration_form);
 	});
 
-	connect(oper_list_wgt, &OperationListWidget::s_operationExecuted, overview_wgt, qOverload<>(&ModelOverviewWidget::updateOverview));
 	connect(oper_list_wgt, &OperationListWidget::s_operationExecuted, layers_cfg_wgt, &LayersConfigWidget::updateLayersRects);
 	connect(layers_cfg_wgt, &LayersConfigWidget::s_activeLayersChanged, overview_wgt, qOverload<>(&ModelOverviewWidget::updateOverview));
 
@@ -1105,36 +1103,22 @@ void MainWindow::saveTemporaryModels()
 	try
 	{
 		ModelWidget *model=nullptr;
-		int count=models_tbw->count();
 
-		if(count > 0)
+		/* Only the changes made since the last call are written to the models' journals
+		 * (the file writing itself is done in background) so there's no need to
+		 * block the user interface while saving the temporary models */
+		for(int i=0; i < models_tbw->count(); i++)
 		{
-			qApp->setOverrideCursor(Qt::WaitCursor);
-			scene_info_parent->setVisible(false);
-			bg_saving_wgt->setVisible(true);
-			bg_saving_pb->setValue(0);
-			bg_saving_wgt->repaint();
-
-			for(int i=0; i < count; i++)
-			{
-				model=dynamic_cast<ModelWidget *>(models_tbw->widget(i));
-				bg_saving_pb->setValue(((i+1)/static_cast<double>(count)) * 100);
-
-				if(model->isModified())
-					model->getDatabaseModel()->saveModel(model->getTempFilename(), SchemaParser::XmlCode);
-			}
+			model=dynamic_cast<ModelWidget *>(models_tbw->widget(i));
 
-			bg_saving_pb->setValue(100);
-			bg_saving_wgt->setVisible(false);
-			scene_info_parent->setVisible(true);
-			qApp->restoreOverrideCursor();
+			if(model->isModified())
+				model->getModelJournal()->flush();
 		}
 
 		tmpmodel_save_timer.start();
 	}
 	catch(Exception &e)
 	{
-		//qApp->restoreOverrideCursor();
 		Messagebox::error(e, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 		tmpmodel_save_timer.start();
 	}
@@ -1322,7 +1306,7 @@ void MainWindow::addModel(const QString &filename)
 
 				updateToolsState(true);
 
-				throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 			}
 		}
 
@@ -1348,7 +1332,7 @@ void MainWindow::addModel(const QString &filename)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1366,9 +1350,9 @@ void MainWindow::addModel(ModelWidget *model_wgt)
 	try
 	{
 		if(!model_wgt)
-			throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 		else if(model_wgt->parent())
-			throw Exception(ErrorCode::AsgWidgetAlreadyHasParent,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgWidgetAlreadyHasParent,__exc_origin);
 
 		model_nav_wgt->addModel(model_wgt);
 		models_tbw->blockSignals(true);
@@ -1384,7 +1368,7 @@ void MainWindow::addModel(ModelWidget *model_wgt)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1396,7 +1380,7 @@ int MainWindow::getModelCount()
 ModelWidget *MainWindow::getModel(int idx)
 {
 	if(idx < 0 || idx > models_tbw->count())
-		throw Exception(ErrorCode::RefObjectInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefObjectInvalidIndex,__exc_origin);
 
 	return dynamic_cast<ModelWidget *>(models_tbw->widget(idx));
 }
@@ -1444,9 +1428,12 @@ void MainWindow::setCurrentModel()
 	arrange_menu.menuAction()->setEnabled(current_model != nullptr);
 
 	QFile::remove(GlobalAttributes::getTemporaryFilePath(GlobalAttributes::LastModelFile));
+	QFile::remove(GlobalAttributes::getTemporaryFilePath(GlobalAttributes::LastJournalFile));
 
 	if(current_model)
 	{
+		QFile last_journal(GlobalAttributes::getTemporaryFilePath(GlobalAttributes::LastJournalFile));
+
 		/* Each time the current model is changed we have to change the last model link so the
 		 * so the crash handler and bug report form can indentify the last modified model after
 		 * their execution */
@@ -1457,6 +1444,14 @@ void MainWindow::setCurrentModel()
 			QFile::link(current_model->getTempFilename(), GlobalAttributes::getTemporaryFilePath(GlobalAttributes::LastModelFile));
 		#endif
 
+		/* The changes of the model are saved in its journal, so the path to it is stored
+		 * next to the last model in order to be found in any platform */
+		if(last_journal.open(QFile::WriteOnly | QFile::Truncate))
+		{
+			last_journal.write(current_model->getModelJournal()->getFilename().toUtf8());
+			last_journal.close();
+		}
+
 		QToolButton *tool_btn=nullptr;
 		QList<QToolButton *> btns;
 		QFont font;
@@ -1688,9 +1683,10 @@ void MainWindow::closeModel(int model_id)
 
 			disconnect(model, nullptr, nullptr, nullptr);
 
-			//Remove the temporary file related to the closed model
+			//Remove the temporary file and the journal related to the closed model
 			QDir arq_tmp;
 			arq_tmp.remove(model->getTempFilename());
+			model->getModelJournal()->remove();
 
 			//Removing model specific actions from general toolbar
 			removeModelActions();
@@ -1909,7 +1905,7 @@ void MainWindow::saveModel(ModelWidget *model)
 	catch(Exception &e)
 	{
 		stopTimers(false);
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 #endif
 }
@@ -2165,7 +2161,7 @@ void MainWindow::showFixMessage(Exception &e, const QString &filename)
 	Messagebox msg_box;
 
 	msg_box.show(Exception(Exception::getErrorMessage(ErrorCode::ModelFileNotLoaded).arg(filename),
-												 ErrorCode::ModelFileNotLoaded ,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e),
+												 ErrorCode::ModelFileNotLoaded ,__exc_origin, &e),
 							 tr("Could not load the database model file `%1'! Check the error stack to see details. You can try to fix it in order to make it loadable again.").arg(filename),
 							 Messagebox::ErrorIcon, Messagebox::YesNoButtons,
 							 tr("Fix model"), tr("Cancel"), "",
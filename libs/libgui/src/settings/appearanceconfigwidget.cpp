@@ -447,7 +447,7 @@ void AppearanceConfigWidget::loadExampleModel()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -489,7 +489,7 @@ void AppearanceConfigWidget::loadConfiguration()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo());
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, e.getExtraInfo());
 	}
 }
 
@@ -714,7 +714,7 @@ void AppearanceConfigWidget::saveConfiguration()
 			if(!QFile::copy(theme_hl_files[i], orig_hl_files[i]))
 			{
 				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(orig_hl_files[i]),
-												__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr,
+												__exc_origin, nullptr,
 												QFileInfo(theme_hl_files[i]).isReadable() ?
 												tr("The template file `%1' could not be accessed!").arg(theme_hl_files[i]) : "");
 			}
@@ -724,7 +724,7 @@ void AppearanceConfigWidget::saveConfiguration()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -859,7 +859,7 @@ void AppearanceConfigWidget::restoreDefaults()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1009,7 +1009,7 @@ void AppearanceConfigWidget::applySyntaxHighlightTheme()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -1032,7 +1032,7 @@ void AppearanceConfigWidget::applyDesignCodeTheme()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -1048,7 +1048,7 @@ void AppearanceConfigWidget::applyUiStyleSheet()
 	{
 		Messagebox msg;
 		msg.show(Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(ui_style.fileName()),
-											 ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__));
+											 ErrorCode::FileDirectoryNotAccessed,__exc_origin));
 	}
 	else
 	{
@@ -1083,7 +1083,7 @@ void AppearanceConfigWidget::applyUiStyleSheet()
 			{
 				Messagebox msg;
 				msg.show(Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(ico_style_conf),
-														ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__));
+														ErrorCode::FileDirectoryNotAccessed,__exc_origin));
 			}
 			else
 				ui_stylesheet.append(ico_style.readAll());
@@ -24,6 +24,7 @@
 #include "mainwindow.h"
 #include "widgets/numberedtexteditor.h"
 #include "tools/sqlexecutionwidget.h"
+#include "utils/resultsetmodel.h"
 #include "tools/modeldatabasediffform.h"
 #include "tools/databaseimportform.h"
 #include "tools/modelexportform.h"
@@ -104,6 +105,7 @@ GeneralConfigWidget::GeneralConfigWidget(QWidget * parent) : BaseConfigWidget(pa
 	config_params[Attributes::Configuration][Attributes::CodeCompletion]="";
 	config_params[Attributes::Configuration][Attributes::UsePlaceholders]="";
 	config_params[Attributes::Configuration][Attributes::HistoryMaxLength]="";
+	config_params[Attributes::Configuration][Attributes::MaxResultRows]="";
 	config_params[Attributes::Configuration][Attributes::SourceEditorApp]="";
 	config_params[Attributes::Configuration][Attributes::UiLanguage]="";
 	config_params[Attributes::Configuration][Attributes::UseCurvedLines]="";
@@ -212,6 +214,9 @@ void GeneralConfigWidget::loadConfiguration()
 		oplist_size_spb->setValue((config_params[Attributes::Configuration][Attributes::OpListSize]).toUInt());
 		history_max_length_spb->setValue(config_params[Attributes::Configuration][Attributes::HistoryMaxLength].toUInt());
 
+		if(!config_params[Attributes::Configuration][Attributes::MaxResultRows].isEmpty())
+			max_result_rows_spb->setValue(config_params[Attributes::Configuration][Attributes::MaxResultRows].toUInt());
+
 		interv=(config_params[Attributes::Configuration][Attributes::AutoSaveInterval]).toUInt();
 
 		autosave_interv_chk->setChecked(interv > 0);
@@ -304,7 +309,7 @@ void GeneralConfigWidget::loadConfiguration()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo());
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e, e.getExtraInfo());
 	}
 }
 
@@ -444,6 +449,7 @@ void GeneralConfigWidget::saveConfiguration()
 		config_params[Attributes::Configuration][Attributes::CodeCompletion]=(code_completion_chk->isChecked() ? Attributes::True : "");
 		config_params[Attributes::Configuration][Attributes::UsePlaceholders]=(use_placeholders_chk->isChecked() ? Attributes::True : "");
 		config_params[Attributes::Configuration][Attributes::HistoryMaxLength]=QString::number(history_max_length_spb->value());
+		config_params[Attributes::Configuration][Attributes::MaxResultRows]=QString::number(max_result_rows_spb->value());
 		config_params[Attributes::Configuration][Attributes::UseCurvedLines]=(use_curved_lines_chk->isChecked() ? Attributes::True : "");
 
 		config_params[Attributes::Configuration][Attributes::ShowCanvasGrid]=(ObjectsScene::isShowGrid() ? Attributes::True : "");
@@ -559,7 +565,7 @@ void GeneralConfigWidget::saveConfiguration()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -616,6 +622,7 @@ void GeneralConfigWidget::applyConfiguration()
 	BaseObjectView::setShadowHidden(hide_obj_shadows_chk->isChecked());
 
 	SQLExecutionWidget::setSQLHistoryMaxLength(history_max_length_spb->value());
+	ResultSetModel::setRowsLimit(max_result_rows_spb->value());
 	ModelDatabaseDiffForm::setLowVerbosity(low_verbosity_chk->isChecked());
 	DatabaseImportForm::setLowVerbosity(low_verbosity_chk->isChecked());
 	ModelExportForm::setLowVerbosity(low_verbosity_chk->isChecked());
@@ -639,7 +646,7 @@ void GeneralConfigWidget::restoreDefaults()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
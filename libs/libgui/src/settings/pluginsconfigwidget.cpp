@@ -137,7 +137,7 @@ void PluginsConfigWidget::loadConfiguration()
 																 .arg(plugin_name)
 																 .arg(lib)
 																 .arg(plugin_loader.errorString()),
-																 ErrorCode::PluginNotLoaded, __PRETTY_FUNCTION__,__FILE__,__LINE__));
+																 ErrorCode::PluginNotLoaded, __exc_origin));
 		}
 
 		plugins_tab->clearSelection();
@@ -145,7 +145,7 @@ void PluginsConfigWidget::loadConfiguration()
 	}
 
 	if(!errors.empty())
-		throw Exception(ErrorCode::PluginsNotLoaded,__PRETTY_FUNCTION__,__FILE__,__LINE__, errors);
+		throw Exception(ErrorCode::PluginsNotLoaded,__exc_origin, errors);
 }
 
 void PluginsConfigWidget::initPlugins(MainWindow *main_window)
@@ -22,6 +22,8 @@
 #include "messagebox.h"
 #include "guiutilsns.h"
 #include "utilsns.h"
+#include "modeljournal.h"
+#include <QFileInfo>
 
 BugReportForm::BugReportForm(QWidget *parent, Qt::WindowFlags f) : QDialog(parent, f)
 {
@@ -53,7 +55,22 @@ BugReportForm::BugReportForm(QWidget *parent, Qt::WindowFlags f) : QDialog(paren
 
 	try
 	{
-		attachModel(GlobalAttributes::getTemporaryFilePath(GlobalAttributes::LastModelFile));
+		QString last_model = GlobalAttributes::getTemporaryFilePath(GlobalAttributes::LastModelFile),
+				last_journal = GlobalAttributes::getTemporaryFilePath(GlobalAttributes::LastJournalFile),
+				journal, model_def;
+
+		if(QFileInfo::exists(last_journal))
+			journal = QString::fromUtf8(UtilsNs::loadFile(last_journal)).trimmed();
+
+		/* The most recent changes of the last model are stored in its journal so
+		 * the journal is replayed in place of the temporary model file when possible */
+		if(QFileInfo::exists(journal))
+			model_def = ModelJournal::replay(journal);
+
+		if(!model_def.isEmpty())
+			model_txt->setPlainText(model_def);
+		else
+			attachModel(last_model);
 	}
 	catch(Exception &){}
 }
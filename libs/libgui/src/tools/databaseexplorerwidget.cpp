@@ -452,7 +452,7 @@ void DatabaseExplorerWidget::formatOidAttribs(attribs_map &attribs, QStringList
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -478,7 +478,7 @@ void DatabaseExplorerWidget::formatOidAttribs(attribs_map &attribs, QStringList
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -677,7 +677,7 @@ void DatabaseExplorerWidget::formatSequenceAttribs(attribs_map &attribs)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -930,7 +930,6 @@ QString DatabaseExplorerWidget::formatObjectName(attribs_map &attribs)
 		else
 		{
 			ObjectType obj_type=static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt());
-			attribs_map aux_attribs;
 			QString oid=attribs[Attributes::Oid],
 					obj_name=DepNotFound.arg(oid), sch_name;
 
@@ -943,8 +942,7 @@ QString DatabaseExplorerWidget::formatObjectName(attribs_map &attribs)
 			if(!attribs[Attributes::Schema].isEmpty() &&
 					attribs[Attributes::Schema]!="0")
 			{
-				aux_attribs=catalog.getObjectAttributes(ObjectType::Schema, attribs[Attributes::Schema].toUInt());
-				sch_name=BaseObject::formatName(aux_attribs[Attributes::Name], false);
+				sch_name=getObjectName(ObjectType::Schema, attribs[Attributes::Schema]);
 
 				if(!sch_name.isEmpty())
 					obj_name=sch_name + "." + obj_name;
@@ -987,7 +985,7 @@ QString DatabaseExplorerWidget::formatObjectName(attribs_map &attribs)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -999,7 +997,7 @@ QStringList DatabaseExplorerWidget::getObjectsNames(ObjectType obj_type, const Q
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1013,32 +1011,53 @@ QStringList DatabaseExplorerWidget::getObjectsNames(const std::vector<ObjectType
 		{
 			std::vector<attribs_map> attribs_vect;
 			std::vector<unsigned> oids_vect;
-			std::map<QString, attribs_map> attrs_map;
+			std::map<QString, QString> names_map;
 			QStringList names;
+			QString name;
 
-			//Converting the oids to unsigned in order to filter them on Catalog
-			for(auto &oid : oids)
-				oids_vect.push_back(oid.toUInt());
-
-			//Retrieve all the objects by their oids and put them on a auxiliary map in which key is their oids
 			for(auto &type : types)
 			{
+				std::map<QString, QString> &names_cache = obj_names_cache[type];
+
+				//Retrieving from the cache the names of the objects not found yet and collecting the uncached ones
+				oids_vect.clear();
+
+				for(auto &oid : oids)
+				{
+					if(names_map.count(oid))
+						continue;
+
+					auto itr = names_cache.find(getNameCacheKey(oid, sch_name, tab_name));
+
+					if(itr != names_cache.end())
+						names_map[oid] = itr->second;
+					else
+						oids_vect.push_back(oid.toUInt());
+				}
+
+				if(oids_vect.empty())
+					continue;
+
+				//Retrieve all the uncached objects by their oids in a single query and storing their names in the cache
 				attribs_vect = catalog.getObjectsAttributes(type, sch_name, tab_name, oids_vect);
 
-				for(auto & attr : attribs_vect)
-					attrs_map[attr[Attributes::Oid]] = attr;
+				for(auto &attr : attribs_vect)
+				{
+					name = formatObjectName(attr);
+					names_cache[getNameCacheKey(attr[Attributes::Oid], sch_name, tab_name)] = name;
+					names_map[attr[Attributes::Oid]] = name;
+				}
 			}
 
-			//Retreving the names from the auxiliary map using the provided oids
 			for(auto &oid : oids)
-				names.push_back(formatObjectName(attrs_map[oid]));
+				names.push_back(names_map.count(oid) ? names_map[oid] : DepNotDefined);
 
 			return names;
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1050,7 +1069,7 @@ QString DatabaseExplorerWidget::getObjectName(ObjectType obj_type, const QString
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1063,7 +1082,16 @@ QString DatabaseExplorerWidget::getObjectName(const std::vector<ObjectType> &typ
 		else
 		{
 			attribs_map attribs;
-			QString name;
+			QString name, key = getNameCacheKey(oid, sch_name, tab_name);
+
+			//Trying to resolve the name locally before querying the catalog
+			for(auto &type : types)
+			{
+				auto itr = obj_names_cache[type].find(key);
+
+				if(itr != obj_names_cache[type].end())
+					return itr->second;
+			}
 
 			for(auto &type : types)
 			{
@@ -1071,7 +1099,10 @@ QString DatabaseExplorerWidget::getObjectName(const std::vector<ObjectType> &typ
 				name = formatObjectName(attribs);
 
 				if(!name.isEmpty())
+				{
+					obj_names_cache[type][key] = name;
 					return name;
+				}
 			}
 
 			return DepNotDefined;
@@ -1079,7 +1110,72 @@ QString DatabaseExplorerWidget::getObjectName(const std::vector<ObjectType> &typ
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
+	}
+}
+
+QString DatabaseExplorerWidget::getNameCacheKey(const QString &oid, const QString &sch_name, const QString &tab_name)
+{
+	if(sch_name.isEmpty() && tab_name.isEmpty())
+		return oid;
+
+	return QString("%1.%2:%3").arg(sch_name, tab_name, oid);
+}
+
+void DatabaseExplorerWidget::cacheObjectsNames(QTreeWidgetItem *root)
+{
+	if(!root)
+		return;
+
+	static const std::vector<ObjectType> global_types = { ObjectType::Schema, ObjectType::Role,
+																												ObjectType::Tablespace, ObjectType::Language },
+			sch_types = { ObjectType::Table, ObjectType::View, ObjectType::ForeignTable, ObjectType::Sequence };
+
+	QTreeWidgetItem *item = nullptr;
+	ObjectType obj_type;
+	QString oid, sch_name;
+
+	for(int idx = 0; idx < root->childCount(); idx++)
+	{
+		item = root->child(idx);
+		oid = item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toString();
+		obj_type = static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
+
+		/* Objects with id greater than zero are real objects while the ones with zero
+		 * are groups and the ones with negative ids are placeholders/special items */
+		if(item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toInt() > 0)
+		{
+			if(std::find(global_types.begin(), global_types.end(), obj_type) != global_types.end())
+				obj_names_cache[obj_type][oid] = BaseObject::formatName(item->data(DatabaseImportForm::ObjectName, Qt::UserRole).toString(), false);
+			else if(std::find(sch_types.begin(), sch_types.end(), obj_type) != sch_types.end())
+			{
+				sch_name = item->data(DatabaseImportForm::ObjectSchema, Qt::UserRole).toString();
+
+				if(!sch_name.isEmpty())
+				{
+					obj_names_cache[obj_type][oid] = BaseObject::formatName(sch_name, false) + "." +
+																					 BaseObject::formatName(item->data(DatabaseImportForm::ObjectName, Qt::UserRole).toString(), false);
+				}
+			}
+		}
+
+		cacheObjectsNames(item);
+	}
+}
+
+void DatabaseExplorerWidget::uncacheObjectName(unsigned oid)
+{
+	QString oid_str = QString::number(oid), key_suffix = ":" + oid_str;
+
+	for(auto &itr : obj_names_cache)
+	{
+		for(auto name_itr = itr.second.begin(); name_itr != itr.second.end();)
+		{
+			if(name_itr->first == oid_str || name_itr->first.endsWith(key_suffix))
+				name_itr = itr.second.erase(name_itr);
+			else
+				name_itr++;
+		}
 	}
 }
 
@@ -1087,6 +1183,7 @@ void DatabaseExplorerWidget::setConnection(Connection conn, const QString &defau
 {
 	this->connection=conn;
 	this->default_db=(default_db.isEmpty() ? "postgres" : default_db);
+	obj_names_cache.clear();
 }
 
 Connection DatabaseExplorerWidget::getConnection()
@@ -1124,6 +1221,10 @@ void DatabaseExplorerWidget::listObjects()
 
 		DatabaseImportForm::listObjects(import_helper, objects_trw, false, false, true, quick_refresh, sort_column);
 
+		// A full refresh discards all the cached names since the database could have been changed externally
+		obj_names_cache.clear();
+		cacheObjectsNames(objects_trw->invisibleRootItem());
+
 		QTreeWidgetItem *root = new QTreeWidgetItem, *curr_root = nullptr;
 
 		//Changing the root item of the generated tree to be a special item containing info about the connected server
@@ -1151,7 +1252,7 @@ void DatabaseExplorerWidget::listObjects()
 	catch(Exception &e)
 	{
 		//qApp->restoreOverrideCursor();
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1296,7 +1397,7 @@ void DatabaseExplorerWidget::handleSelectedSnippet(const QString &snip_id)
 attribs_map DatabaseExplorerWidget::extractAttributesFromItem(QTreeWidgetItem *item)
 {
 	if(!item)
-		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 
 	ObjectType obj_type=static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
 	QString obj_name=item->text(0);
@@ -1439,6 +1540,13 @@ void DatabaseExplorerWidget::dropObject(QTreeWidgetItem *item, bool cascade)
 				conn.connect();
 				conn.executeDDLCommand(drop_cmd);
 
+				/* In cascade mode other objects may have been dropped as well, so we discard the whole cache
+				 * otherwise only the name of the dropped object is removed */
+				if(cascade)
+					obj_names_cache.clear();
+				else
+					uncacheObjectName(item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toUInt());
+
 				//Updates the object count on the parent item
 				parent=item->parent();
 				if(parent && parent->data(DatabaseImportForm::ObjectId, Qt::UserRole).toUInt()==0)
@@ -1510,7 +1618,7 @@ bool DatabaseExplorerWidget::truncateTable(const QString &sch_name, const QStrin
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin);
 	}
 }
 
@@ -1701,6 +1809,8 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 				gen_items=DatabaseImportForm::updateObjectsTree(import_helper, objects_trw,
 																BaseObject::getChildObjectTypes(obj_type), false, false, root, sch_name, tab_name);
 
+			cacheObjectsNames(root);
+
 			//Creating dummy items for schemas and tables
 			if(obj_type==ObjectType::Schema || BaseTable::isBaseTable(obj_type))
 			{
@@ -1739,7 +1849,7 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 
 		throw Exception(tr("Failed to load the subitems of the object <strong>%1</strong> <em>(%2)</em>! Try to reload them manually by hitting <strong>F6</strong> on each one.")
 										.arg(signature, BaseObject::getTypeName(obj_type)),
-										ErrorCode::Custom, __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+										ErrorCode::Custom, __exc_origin, &e);
 	}
 }
 
@@ -1822,7 +1932,7 @@ void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 	catch(Exception &e)
 	{
 		//qApp->restoreOverrideCursor();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1979,7 +2089,7 @@ void DatabaseExplorerWidget::showObjectProperties(bool force_reload)
 	catch(Exception &e)
 	{
 		//qApp->restoreOverrideCursor();
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -2024,6 +2134,10 @@ void DatabaseExplorerWidget::finishObjectRename()
 			conn.connect();
 			conn.executeDDLCommand(rename_cmd);
 
+			/* The renamed object's name can be part of the names of other objects (e.g. schema qualified names,
+			 * function signatures) so all the cached names are discarded */
+			obj_names_cache.clear();
+
 			rename_item->setFlags(rename_item->flags() ^ Qt::ItemIsEditable);
 			rename_item->setData(DatabaseImportForm::ObjectName, Qt::UserRole, rename_item->text(0));
 			rename_item=nullptr;
@@ -63,6 +63,12 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 		
 		//! \brief Catalog instance used to retrieve object's attributes
 		Catalog catalog;
+
+		/*! \brief Stores the formatted names (signatures) of the objects resolved from their OIDs, per object type.
+		 * This cache is used to format the OID attributes of the objects displayed in the properties panel
+		 * without querying the catalog each time. The keys of the inner map are the OIDs (or schema.table:OID
+		 * when the object is searched in a specific schema/table, e.g., columns) */
+		std::map<ObjectType, std::map<QString, QString>> obj_names_cache;
 		
 		SchemaParser schparser;
 		
@@ -114,6 +120,18 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 		
 		//! \brief Format the object's name based upon the passed attributes
 		QString formatObjectName(attribs_map &attribs);
+
+		//! \brief Returns the key used to store the object's name in the names cache
+		QString getNameCacheKey(const QString &oid, const QString &sch_name, const QString &tab_name);
+
+		/*! \brief Stores in the names cache the names of the objects represented by the root item's subtree.
+		 * Only the objects in which the formatted name can be determined without the full set of attributes
+		 * (schemas, roles, tablespaces, languages, tables, views, etc) are cached here. The others are
+		 * cached as soon as their names are retrieved from catalog */
+		void cacheObjectsNames(QTreeWidgetItem *root);
+
+		//! \brief Removes from the names cache all the entries of the provided OID
+		void uncacheObjectName(unsigned oid);
 		
 		/*! \brief Formats the keys and values for the passed object attributes returning a new map with the formatted attributes.
 		This method do basic formattation on commom attributes and internally call the format[OBJECT]Attribs()
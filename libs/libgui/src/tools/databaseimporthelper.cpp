@@ -20,6 +20,8 @@
 #include "defaultlanguages.h"
 #include "utilsns.h"
 #include "coreutilsns.h"
+#include <QThreadPool>
+#include <set>
 
 const QString DatabaseImportHelper::UnkownObjectOidXml {"\t<!--[ unknown object OID=%1 ]-->\n"};
 
@@ -30,10 +32,12 @@ DatabaseImportHelper::DatabaseImportHelper(QObject *parent) : QObject(parent)
 
 	import_canceled=ignore_errors=import_sys_objs=import_ext_objs=false;
 	comments_as_aliases=rand_rel_colors=update_fk_rels=is_working_model=false;
-	auto_resolve_deps=true;
+	auto_resolve_deps=direct_obj_creation=true;
 	import_filter=Catalog::ListAllObjects | Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs;
 	xmlparser=nullptr;
 	dbmodel=nullptr;
+	import_jobs=1;
+	wrk_queries=wrk_round_trips=0;
 
 	//Binding create methods
 	create_methods = {
@@ -80,7 +84,7 @@ void DatabaseImportHelper::setConnection(Connection &conn)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -99,14 +103,14 @@ void DatabaseImportHelper::setCurrentDatabase(const QString &dbname)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 void DatabaseImportHelper::setSelectedOIDs(DatabaseModel *db_model, const std::map<ObjectType, std::vector<unsigned> > &obj_oids, const std::map<unsigned, std::vector<unsigned> > &col_oids)
 {
 	if(!db_model)
-		throw Exception(ErrorCode::AsgNotAllocattedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject ,__exc_origin);
 
 	dbmodel=db_model;
 	xmlparser=dbmodel->getXMLParser();
@@ -152,6 +156,23 @@ void DatabaseImportHelper::setImportOptions(bool import_sys_objs, bool import_ex
 		import_filter = Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes | Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs;
 }
 
+void DatabaseImportHelper::setDirectObjectCreation(bool value)
+{
+	direct_obj_creation = value;
+}
+
+void DatabaseImportHelper::setImportJobs(unsigned jobs)
+{
+	import_jobs = std::max<unsigned>(jobs, 1);
+}
+
+bool DatabaseImportHelper::isDirectCreation(ObjectType obj_type)
+{
+	return direct_obj_creation && !debug_mode &&
+				 (obj_type == ObjectType::Table || obj_type == ObjectType::Constraint ||
+					obj_type == ObjectType::Function || obj_type == ObjectType::Procedure);
+}
+
 unsigned DatabaseImportHelper::getLastSystemOID()
 {
 	return catalog.getLastSysObjectOID();
@@ -176,7 +197,7 @@ attribs_map DatabaseImportHelper::getObjects(ObjectType obj_type, const QString
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -189,7 +210,7 @@ std::vector<attribs_map> DatabaseImportHelper::getObjects(std::vector<ObjectType
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -264,28 +285,131 @@ void DatabaseImportHelper::retrieveUserObjects()
 	int progress = 0;
 	std::vector<attribs_map> obj_attribs;
 	unsigned i = 0, oid = 0;
-	std::map<unsigned, std::vector<unsigned>>::iterator col_itr;
+	ObjectType obj_type;
 	QStringList names;
 
 	catalog.setQueryFilter(import_filter);
 
-	//Retrieving selected database level objects and table children objects (except columns)
-	for(auto &[obj_type, obj_oids] : object_oids)
+	emit s_progressUpdated(progress, tr("Retrieving objects..."), ObjectType::Database);
+
+	if(import_jobs > 1)
 	{
+		std::vector<std::vector<CatalogQuery>> worker_queries(import_jobs);
+		std::map<QString, std::vector<CatalogQuery>> schema_queries;
+		std::vector<std::pair<unsigned, QString>> schema_loads;
+		std::vector<unsigned> worker_loads(import_jobs, 0);
+		unsigned slice_size = 0, wrk_id = 0, load = 0;
+
+		/* The OIDs of each object type are split in disjoint slices, one per worker,
+		 * since the schemas of the objects are only known after retrieving them */
+		for(auto &[type, obj_oids] : object_oids)
+		{
+			if(obj_oids.empty())
+			{
+				worker_queries[0].push_back({ type, "", "", {}, {} });
+				continue;
+			}
+
+			slice_size = (obj_oids.size() + import_jobs - 1) / import_jobs;
+			wrk_id = 0;
+
+			for(auto itr = obj_oids.begin(); itr != obj_oids.end(); wrk_id++)
+			{
+				auto end_itr = obj_oids.end();
+
+				if(static_cast<unsigned>(std::distance(itr, end_itr)) > slice_size)
+					end_itr = itr + slice_size;
+
+				worker_queries[wrk_id].push_back({ type, "", "", std::vector<unsigned>(itr, end_itr), {} });
+				itr = end_itr;
+			}
+		}
+
+		fetchObjectsAttributes(worker_queries);
+
+		for(auto &queries : worker_queries)
+		{
+			for(auto &qry : queries)
+			{
+				for(auto &attrs : qry.attribs)
+				{
+					oid = attrs[Attributes::Oid].toUInt();
+					user_objs[oid] = attrs;
+				}
+			}
+
+			queries.clear();
+		}
+
 		if(import_canceled)
-			break;
+			return;
+
+		emit s_progressUpdated(progress, tr("Retrieving tables columns..."), ObjectType::Column);
+
+		// The columns are retrieved per schema, each worker handling a disjoint set of schemas
+		for(auto &[tab_oid, col_oids] : column_oids)
+		{
+			names = getObjectName(QString::number(tab_oid)).split(".");
+
+			if(names.size() < 2)
+				continue;
+
+			schema_queries[names[0]].push_back({ ObjectType::Column, names[0], names[1], col_oids, {} });
+		}
+
+		for(auto &[sch_name, queries] : schema_queries)
+		{
+			load = 0;
+
+			for(auto &qry : queries)
+				load += qry.oids.size() + 1;
+
+			schema_loads.push_back({ load, sch_name });
+		}
+
+		/* The biggest schemas are assigned first, always to the least loaded worker,
+		 * so a few large schemas don't end up concentrated in a single connection */
+		std::sort(schema_loads.begin(), schema_loads.end(), std::greater<std::pair<unsigned, QString>>());
+
+		for(auto &[sch_load, sch_name] : schema_loads)
+		{
+			wrk_id = std::distance(worker_loads.begin(), std::min_element(worker_loads.begin(), worker_loads.end()));
+			worker_loads[wrk_id] += sch_load;
+			worker_queries[wrk_id].insert(worker_queries[wrk_id].end(),
+																		schema_queries[sch_name].begin(), schema_queries[sch_name].end());
+		}
+
+		schema_queries.clear();
+		fetchObjectsAttributes(worker_queries);
+
+		for(auto &queries : worker_queries)
+		{
+			for(auto &qry : queries)
+				storeTableColumns(qry.attribs);
+		}
+
+		return;
+	}
+
+	/* Enqueuing the attributes queries of all selected database level objects and table children
+	 * objects (except columns) so they are sent to the server at once instead of paying one
+	 * network round trip per object type */
+	for(auto &[type, obj_oids] : object_oids)
+		catalog.enqueueObjectsAttributes(type, "", "", obj_oids);
+
+	while(catalog.getNextObjectsAttributes(obj_type, obj_attribs))
+	{
+		/* Even if the import is canceled we need to consume all pending results
+		 * in order to leave the connection in a usable state */
+		if(import_canceled)
+			continue;
 
 		emit s_progressUpdated(progress,
 													 tr("Retrieving objects... `%1'").arg(BaseObject::getTypeName(obj_type)),
 													 obj_type);
 
-		obj_attribs = catalog.getObjectsAttributes(obj_type, "", "", obj_oids);
-
 		for(auto &attrs : obj_attribs)
 		{
-			if(import_canceled)
-				break;
-
 			oid = attrs[Attributes::Oid].toUInt();
 			user_objs[oid] = attrs;
 		}
@@ -297,6 +421,8 @@ void DatabaseImportHelper::retrieveUserObjects()
 
 	//Retrieving all selected table columns
 	i = 0;
+	progress = 0;
+
 	for(auto &[tab_oid, col_oids] : column_oids)
 	{
 		if(import_canceled)
@@ -307,36 +433,97 @@ void DatabaseImportHelper::retrieveUserObjects()
 		if(names.size() < 2)
 			continue;
 
-		emit s_progressUpdated(progress,
-													 tr("Retrieving columns of table `%1.%2', oid `%3'...").arg(names[0], names[1]).arg(tab_oid),
-													 ObjectType::Column);
+		catalog.enqueueObjectsAttributes(ObjectType::Column, names[0], names[1], col_oids);
+	}
 
-		retrieveTableColumns(names[0], names[1], col_oids);
+	while(catalog.getNextObjectsAttributes(obj_type, obj_attribs))
+	{
+		if(import_canceled)
+			continue;
 
+		emit s_progressUpdated(progress, tr("Retrieving tables columns..."), ObjectType::Column);
+		storeTableColumns(obj_attribs);
+		obj_attribs.clear();
 		progress=(i/static_cast<double>(column_oids.size()))*100;
 		i++;
 	}
 }
 
+void DatabaseImportHelper::fetchObjectsAttributes(std::vector<std::vector<CatalogQuery>> &worker_queries)
+{
+	QThreadPool thread_pool;
+	std::vector<Exception> errors(worker_queries.size());
+	std::vector<char> failed(worker_queries.size(), false);
+	std::vector<std::pair<unsigned, unsigned>> wrk_stats(worker_queries.size(), { 0, 0 });
+
+	thread_pool.setMaxThreadCount(worker_queries.size());
+
+	for(unsigned wrk_id = 0; wrk_id < worker_queries.size(); wrk_id++)
+	{
+		if(worker_queries[wrk_id].empty())
+			continue;
+
+		thread_pool.start([this, wrk_id, &worker_queries, &errors, &failed, &wrk_stats](){
+			try
+			{
+				// Copying the catalog opens a new connection with the same parameters and filters
+				Catalog wrk_catalog(catalog);
+				ObjectType obj_type;
+
+				for(auto &qry : worker_queries[wrk_id])
+					wrk_catalog.enqueueObjectsAttributes(qry.obj_type, qry.schema, qry.table, qry.oids);
+
+				for(auto &qry : worker_queries[wrk_id])
+					wrk_catalog.getNextObjectsAttributes(obj_type, qry.attribs);
+
+				wrk_stats[wrk_id] = { wrk_catalog.getExecutedQueriesCount(), wrk_catalog.getRoundTripsCount() };
+				wrk_catalog.closeConnection();
+			}
+			catch(Exception &e)
+			{
+				errors[wrk_id] = e;
+				failed[wrk_id] = true;
+			}
+		});
+	}
+
+	thread_pool.waitForDone();
+
+	for(unsigned wrk_id = 0; wrk_id < worker_queries.size(); wrk_id++)
+	{
+		wrk_queries += wrk_stats[wrk_id].first;
+		wrk_round_trips += wrk_stats[wrk_id].second;
+
+		if(failed[wrk_id])
+			throw Exception(errors[wrk_id].getErrorMessage(), errors[wrk_id].getErrorCode(),
+											__exc_origin, &errors[wrk_id]);
+	}
+}
+
 void DatabaseImportHelper::retrieveTableColumns(const QString &sch_name, const QString &tab_name, std::vector<unsigned> col_ids)
 {
 	try
 	{
 		std::vector<attribs_map> cols;
-		unsigned tab_oid=0, col_oid;
 
 		cols=catalog.getObjectsAttributes(ObjectType::Column, sch_name, tab_name, col_ids);
-
-		for(auto &itr : cols)
-		{
-			col_oid=itr.at(Attributes::Oid).toUInt();
-			tab_oid=itr.at(Attributes::Table).toUInt();
-			columns[tab_oid][col_oid]=itr;
-		}
+		storeTableColumns(cols);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+}
+
+void DatabaseImportHelper::storeTableColumns(std::vector<attribs_map> &cols)
+{
+	unsigned tab_oid=0, col_oid=0;
+
+	for(auto &itr : cols)
+	{
+		col_oid=itr.at(Attributes::Oid).toUInt();
+		tab_oid=itr.at(Attributes::Table).toUInt();
+		columns[tab_oid][col_oid]=itr;
 	}
 }
 
@@ -433,7 +620,7 @@ void DatabaseImportHelper::createObjects()
 					{
 						//In case of some error store the oid and the error in separated lists
 						not_created_objs.push_back(*itr);
-						aux_errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+						aux_errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, dumpObjectAttributes(attribs)));
 					}
 
 					progress=(i/static_cast<double>(not_created_objs.size())) * 100;
@@ -452,7 +639,7 @@ void DatabaseImportHelper::createObjects()
 				 that no object was created in this interaction which means error */
 					if(prev_size==not_created_objs.size() && !ignore_errors)
 						throw Exception(aux_errors.back().getErrorMessage(), aux_errors.back().getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, aux_errors);
+										__exc_origin, aux_errors);
 					else if(ignore_errors)
 						errors.insert(errors.end(), aux_errors.begin(), aux_errors.end());
 
@@ -499,9 +686,9 @@ void DatabaseImportHelper::createConstraints()
 		catch(Exception &e)
 		{
 			if(ignore_errors)
-				errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+				errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, dumpObjectAttributes(attribs)));
 			else
-				throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 		}
 
 		progress=(i/static_cast<double>(constraints.size())) * 100;
@@ -563,9 +750,9 @@ void DatabaseImportHelper::createPermissions()
 	catch(Exception &e)
 	{
 		if(ignore_errors)
-			errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+			errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, dumpObjectAttributes(attribs)));
 		else
-			throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -601,7 +788,7 @@ void DatabaseImportHelper::updateFKRelationships()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -610,16 +797,22 @@ void DatabaseImportHelper::importDatabase()
 	try
 	{
 		if(!dbmodel)
-			throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::OprNotAllocatedObject ,__exc_origin);
 
 		BaseGraphicObject::setUpdatesEnabled(false);
 		dbmodel->setObjectListsCapacity(creation_order.size());
 
 		cached_names.clear();
 		cached_signatures.clear();
+		catalog.resetQueriesStats();
+		wrk_queries = wrk_round_trips = 0;
 
 		retrieveSystemObjects();
 		retrieveUserObjects();
+
+		if(!import_canceled)
+			prefetchDependencies();
+
 		createObjects();
 		createTableInheritances();
 		createTablePartitionings();
@@ -650,6 +843,10 @@ void DatabaseImportHelper::importDatabase()
 			swapSequencesTablesIds();
 			assignSequencesToColumns();
 
+			emit s_progressUpdated(100, tr("Catalog queries executed: `%1' using `%2' network round trip(s).")
+														 .arg(catalog.getExecutedQueriesCount() + wrk_queries)
+														 .arg(catalog.getRoundTripsCount() + wrk_round_trips), ObjectType::Database);
+
 			if(!errors.empty())
 			{
 				QString log_name;
@@ -668,7 +865,7 @@ void DatabaseImportHelper::importDatabase()
 				import_log.close();
 
 				emit s_importFinished(Exception(tr("The database import ended but some errors were generated and saved into the log file `%1'. This file will last until pgModeler quit.").arg(log_name),
-												__PRETTY_FUNCTION__,__FILE__,__LINE__));
+												__exc_origin));
 			}
 		}
 		else
@@ -717,10 +914,10 @@ void DatabaseImportHelper::importDatabase()
 		/* When running in a separated thread (other than the main application thread)
 		 * redirects the error in form of signal */
 		if(this->thread() && this->thread() != qApp->thread())
-			emit s_importAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo()));
+			emit s_importAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e, e.getExtraInfo()));
 		else
 			//Redirects any error to the user
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo());
+			throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e, e.getExtraInfo());
 	}
 }
 
@@ -818,19 +1015,30 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 					(BaseGraphicObject::isGraphicObject(obj_type) || TableObject::isTableObject(obj_type)))
 				attribs[Attributes::Alias] = attribs[Attributes::Comment].mid(0, BaseObject::ObjectNameMaxLength - 1);
 
-			attribs[Attributes::Comment]=getComment(attribs);
+			/* Objects built directly from the attributes use the raw comment and the names of
+			 * the dependencies instead of their XML code. Unknown dependencies are discarded
+			 * in the same way the XML parser ignores the comments that denote them */
+			bool direct_creation = isDirectCreation(obj_type);
+
+			auto get_dependency = [&](const QString &dep_oid, ObjectType dep_type) {
+				QString dep = getDependencyObject(dep_oid, dep_type, false, auto_resolve_deps, !direct_creation);
+				return direct_creation && dep == UnkownObjectOidXml.arg(dep_oid) ? "" : dep;
+			};
+
+			if(!direct_creation)
+				attribs[Attributes::Comment]=getComment(attribs);
 
 			if(attribs.count(Attributes::Owner))
-				attribs[Attributes::Owner]=getDependencyObject(attribs[Attributes::Owner], ObjectType::Role, false, auto_resolve_deps);
+				attribs[Attributes::Owner]=get_dependency(attribs[Attributes::Owner], ObjectType::Role);
 
 			if(attribs.count(Attributes::Tablespace))
-				attribs[Attributes::Tablespace]=getDependencyObject(attribs[Attributes::Tablespace], ObjectType::Tablespace, false, auto_resolve_deps);
+				attribs[Attributes::Tablespace]=get_dependency(attribs[Attributes::Tablespace], ObjectType::Tablespace);
 
 			if(attribs.count(Attributes::Schema))
 			{
 				//Here we preserve the schema oid for latter usage in certain methods
 				attribs[Attributes::SchemaOid]=attribs[Attributes::Schema];
-				attribs[Attributes::Schema]=getDependencyObject(attribs[Attributes::Schema], ObjectType::Schema, false, auto_resolve_deps);
+				attribs[Attributes::Schema]=get_dependency(attribs[Attributes::Schema], ObjectType::Schema);
 			}
 
 			/* Due to the object recreation mechanism there are some situations when pgModeler fails to recreate
@@ -875,7 +1083,7 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::ObjectNotImported)
 											.arg(obj_name).arg(BaseObject::getTypeName(obj_type)).arg(attribs[Attributes::Oid]),
-											ErrorCode::ObjectNotImported,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs));
+											ErrorCode::ObjectNotImported,__exc_origin, &e, dumpObjectAttributes(attribs));
 		}
 	}
 }
@@ -893,7 +1101,7 @@ QString DatabaseImportHelper::getComment(attribs_map &attribs)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -911,22 +1119,17 @@ QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType
 
 		/* If the attributes for the dependency does not exists and the automatic dependency
 		resolution is enable, the object's attributes will be retrieved from catalog */
-		if(auto_resolve_deps && obj_attr.empty() &&
-				((import_ext_objs && catalog.isExtensionObject(obj_oid)) ||
-				 (import_sys_objs  && obj_oid <= catalog.getLastSysObjectOID()) ||
-				 (obj_oid > catalog.getLastSysObjectOID() && !catalog.isExtensionObject(obj_oid))))
+		if(auto_resolve_deps && obj_attr.empty() && isDependencyResolvable(obj_oid))
 		{
 			catalog.setQueryFilter(Catalog::ListAllObjects);
-			std::vector<attribs_map> attribs_vect=catalog.getObjectsAttributes(obj_type,"","", { obj_oid });
+			obj_attr = getCatalogAttributes(obj_type, obj_oid);
 
-			if(!attribs_vect.empty())
+			if(!obj_attr.empty())
 			{
 				if(obj_oid <= catalog.getLastSysObjectOID())
-					system_objs[obj_oid]=attribs_vect[0];
+					system_objs[obj_oid]=obj_attr;
 				else
-					user_objs[obj_oid]=attribs_vect[0];
-
-				obj_attr=attribs_vect[0];
+					user_objs[obj_oid]=obj_attr;
 			}
 		}
 
@@ -970,7 +1173,153 @@ QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+}
+
+bool DatabaseImportHelper::isDependencyResolvable(unsigned oid)
+{
+	return ((import_ext_objs && catalog.isExtensionObject(oid)) ||
+					(import_sys_objs && oid <= catalog.getLastSysObjectOID()) ||
+					(oid > catalog.getLastSysObjectOID() && !catalog.isExtensionObject(oid)));
+}
+
+void DatabaseImportHelper::prefetchDependencies()
+{
+	// Attributes holding the OID (or an array of OIDs) of data types
+	static const QStringList type_attrs = {
+		Attributes::Type, Attributes::TypeOid, Attributes::ReturnType, Attributes::ArgTypes,
+		Attributes::TransformTypes, Attributes::Types, Attributes::LeftType, Attributes::RightType,
+		Attributes::StateType, Attributes::SourceType, Attributes::DestType, Attributes::Element
+	};
+
+	// Attributes holding the OID of dependencies resolved by createObject() and the create methods
+	static const std::map<QString, ObjectType> dep_attrs = {
+		{ Attributes::Owner, ObjectType::Role }, { Attributes::Tablespace, ObjectType::Tablespace },
+		{ Attributes::Schema, ObjectType::Schema }, { Attributes::Collation, ObjectType::Collation },
+		{ Attributes::Language, ObjectType::Language }
+	};
+
+	std::map<ObjectType, std::set<unsigned>> pending_oids;
+	std::vector<attribs_map *> attribs_list;
+	std::vector<attribs_map> obj_attribs;
+	Catalog::QueryFilter curr_filter = catalog.getQueryFilter();
+	ObjectType obj_type;
+	QStringList oids;
+	unsigned oid = 0;
+
+	auto is_pending = [&](ObjectType type, unsigned dep_oid) {
+		return dep_oid != 0 && !pending_oids[type].count(dep_oid) &&
+					 (!prefetched_objs.count(type) || !prefetched_objs[type].count(dep_oid));
+	};
+
+	try
+	{
+		emit s_progressUpdated(0, tr("Retrieving dependencies..."), ObjectType::Type);
+
+		for(auto &itr : user_objs)
+			attribs_list.push_back(&itr.second);
+
+		for(auto &[tab_oid, cols] : columns)
+		{
+			for(auto &[col_id, attribs] : cols)
+				attribs_list.push_back(&attribs);
+		}
+
+		catalog.setQueryFilter(Catalog::ListAllObjects);
+
+		/* Each round retrieves the unknown types and dependencies referenced by the objects
+		 * collected in the previous round. The first one is based on the selected objects */
+		while(!attribs_list.empty() && !import_canceled)
+		{
+			pending_oids.clear();
+
+			for(auto &attribs : attribs_list)
+			{
+				for(auto &attr : type_attrs)
+				{
+					auto itr = attribs->find(attr);
+
+					if(itr == attribs->end() || itr->second.isEmpty())
+						continue;
+
+					oids = itr->second.startsWith('{') ? Catalog::parseArrayValues(itr->second) : QStringList { itr->second };
+
+					for(auto &oid_str : oids)
+					{
+						oid = oid_str.toUInt();
+
+						if(!types.count(oid) && is_pending(ObjectType::Type, oid))
+							pending_oids[ObjectType::Type].insert(oid);
+					}
+				}
+
+				if(!auto_resolve_deps)
+					continue;
+
+				for(auto &[attr, dep_type] : dep_attrs)
+				{
+					auto itr = attribs->find(attr);
+
+					if(itr == attribs->end())
+						continue;
+
+					oid = itr->second.toUInt();
+
+					if(!user_objs.count(oid) && !system_objs.count(oid) &&
+						 is_pending(dep_type, oid) && isDependencyResolvable(oid))
+						pending_oids[dep_type].insert(oid);
+				}
+			}
+
+			attribs_list.clear();
+
+			// All the queries of the round are sent at once so they cost a single network round trip
+			for(auto &[type, type_oids] : pending_oids)
+			{
+				if(type_oids.empty())
+					continue;
+
+				for(auto &type_oid : type_oids)
+					prefetched_objs[type][type_oid] = attribs_map();
+
+				catalog.enqueueObjectsAttributes(type, "", "", std::vector<unsigned>(type_oids.begin(), type_oids.end()));
+			}
+
+			while(catalog.getNextObjectsAttributes(obj_type, obj_attribs))
+			{
+				for(auto &attribs : obj_attribs)
+				{
+					oid = attribs[Attributes::Oid].toUInt();
+					prefetched_objs[obj_type][oid] = attribs;
+					attribs_list.push_back(&prefetched_objs[obj_type][oid]);
+				}
+
+				obj_attribs.clear();
+			}
+		}
+
+		catalog.setQueryFilter(curr_filter);
+	}
+	catch(Exception &e)
+	{
+		catalog.setQueryFilter(curr_filter);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+}
+
+attribs_map DatabaseImportHelper::getCatalogAttributes(ObjectType obj_type, unsigned oid)
+{
+	try
+	{
+		if(prefetched_objs.count(obj_type) && prefetched_objs[obj_type].count(oid))
+			return prefetched_objs[obj_type][oid];
+
+		return catalog.getObjectAttributes(obj_type, oid);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -996,7 +1345,7 @@ void DatabaseImportHelper::loadObjectXML(ObjectType obj_type, attribs_map &attri
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xml_buf);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e, xml_buf);
 	}
 }
 
@@ -1008,6 +1357,7 @@ void DatabaseImportHelper::resetImportParameters()
 	column_oids.clear();
 	object_oids.clear();
 	types.clear();
+	prefetched_objs.clear();
 	user_objs.clear();
 	creation_order.clear();
 	seq_tab_swap.clear();
@@ -1069,7 +1419,7 @@ Tablespace *DatabaseImportHelper::createTablespace(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		if(tabspc) delete tabspc;
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1102,7 +1452,7 @@ Schema *DatabaseImportHelper::createSchema(attribs_map &attribs)
 	{
 		if(schema) delete schema;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1136,7 +1486,7 @@ Role *DatabaseImportHelper::createRole(attribs_map &attribs)
 	{
 		if(role) delete role;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1175,7 +1525,7 @@ Domain *DatabaseImportHelper::createDomain(attribs_map &attribs)
 	{
 		if(dom) delete dom;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1241,19 +1591,19 @@ Extension *DatabaseImportHelper::createExtension(attribs_map &attribs)
 	{
 		if(ext) delete ext;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
-void DatabaseImportHelper::configureBaseFunctionAttribs(attribs_map &attribs)
+void DatabaseImportHelper::configureBaseFunctionAttribs(attribs_map &attribs, std::vector<Parameter> &params,
+																												std::vector<Parameter> &ret_table_cols, bool direct_creation)
 {
 	Parameter param;
 	PgSqlType type;
 	QStringList param_types, param_names, param_modes,
 			param_def_vals, param_xmls, used_names, transform_types,
 			config_params, list;
-	QString param_tmpl_name = QString("_param%1"), pname;
-	std::vector<Parameter> parameters;
+	QString param_tmpl_name = QString("_param%1"), pname, lang_oid;
 	attribs_map cfg_attrs;
 
 	try
@@ -1266,19 +1616,23 @@ void DatabaseImportHelper::configureBaseFunctionAttribs(attribs_map &attribs)
 		transform_types = getTypes(attribs[Attributes::TransformTypes], false);
 		attribs[Attributes::TransformTypes] = transform_types.join(',');
 
-		config_params = attribs[Attributes::ConfigParams].split(UtilsNs::DataSeparator, Qt::SkipEmptyParts);
-		attribs[Attributes::ConfigParams] = "";
-
-		for(auto &cfg : config_params)
+		//Functions built directly read the configuration parameters from the raw attribute
+		if(!direct_creation)
 		{
-			list = cfg.split('=');
+			config_params = attribs[Attributes::ConfigParams].split(UtilsNs::DataSeparator, Qt::SkipEmptyParts);
+			attribs[Attributes::ConfigParams] = "";
 
-			if(list.size() < 2)
-				continue;
+			for(auto &cfg : config_params)
+			{
+				list = cfg.split('=');
+
+				if(list.size() < 2)
+					continue;
 
-			cfg_attrs[Attributes::Name] = list[0];
-			cfg_attrs[Attributes::Value] = list[1];
-			attribs[Attributes::ConfigParams] +=	schparser.getSourceCode(Attributes::ConfigParam, cfg_attrs, SchemaParser::XmlCode);
+				cfg_attrs[Attributes::Name] = list[0];
+				cfg_attrs[Attributes::Value] = list[1];
+				attribs[Attributes::ConfigParams] +=	schparser.getSourceCode(Attributes::ConfigParam, cfg_attrs, SchemaParser::XmlCode);
+			}
 		}
 
 		for(int i=0; i < param_types.size(); i++)
@@ -1326,32 +1680,28 @@ void DatabaseImportHelper::configureBaseFunctionAttribs(attribs_map &attribs)
 
 			//If the mode is 't' indicates that the current parameter will be used as a return table colum
 			if(!param_modes.isEmpty() && param_modes[i]=="t")
-				attribs[Attributes::ReturnTable]+=param.getSourceCode(SchemaParser::XmlCode);
+				ret_table_cols.push_back(param);
 			else
-				parameters.push_back(param);
+				params.push_back(param);
 		}
 
-		if(!parameters.empty())
+		//Setting the default values from the last paramenter to the first one. OUT parameters don't receive default values.
+		for(auto ritr = params.rbegin(); ritr != params.rend() && !param_def_vals.isEmpty(); ritr++)
 		{
-			std::vector<Parameter>::reverse_iterator ritr, ritr_end;
-
-			ritr = parameters.rbegin();
-			ritr_end = parameters.rend();
-
-			while(ritr != ritr_end)
+			if(!ritr->isOut() || (ritr->isIn() && ritr->isOut()))
 			{
-				param = *ritr;
-				ritr++;
+				ritr->setDefaultValue(param_def_vals.back());
+				param_def_vals.pop_back();
+			}
+		}
 
-				//Setting the default value for the current paramenter. OUT parameter doesn't receive default values.
-				if(!param_def_vals.isEmpty() && (!param.isOut() || (param.isIn() && param.isOut())))
-				{
-					param.setDefaultValue(param_def_vals.back());
-					param_def_vals.pop_back();
-				}
+		if(!direct_creation)
+		{
+			for(auto &col : ret_table_cols)
+				attribs[Attributes::ReturnTable] += col.getSourceCode(SchemaParser::XmlCode);
 
-				param_xmls.push_front(param.getSourceCode(SchemaParser::XmlCode));
-			}
+			for(auto &aux_param : params)
+				param_xmls.append(aux_param.getSourceCode(SchemaParser::XmlCode));
 
 			attribs[Attributes::Parameters] += param_xmls.join(QChar('\n'));
 		}
@@ -1375,38 +1725,61 @@ void DatabaseImportHelper::configureBaseFunctionAttribs(attribs_map &attribs)
 				attribs[Attributes::Definition].remove(attribs[Attributes::Definition].length() - 1, 1);
 		}
 
-		//Get the language reference code
-		attribs[Attributes::Language] = getDependencyObject(attribs[Attributes::Language], ObjectType::Language);
+		//Get the language reference code (or its name when the function is built directly)
+		lang_oid = attribs[Attributes::Language];
+		attribs[Attributes::Language] = getDependencyObject(lang_oid, ObjectType::Language, false, true, !direct_creation);
+
+		if(direct_creation && attribs[Attributes::Language] == UnkownObjectOidXml.arg(lang_oid))
+			attribs[Attributes::Language] = "";
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
 Function *DatabaseImportHelper::createFunction(attribs_map &attribs)
 {
 	Function *func=nullptr;
+	bool direct_creation = isDirectCreation(ObjectType::Function);
 
 	try
 	{
-		configureBaseFunctionAttribs(attribs);
+		std::vector<Parameter> params, ret_table_cols;
+		bool is_any_ret_type = (attribs[Attributes::RefType] == Attributes::InputFunc ||
+														attribs[Attributes::RefType] == Attributes::RecvFunc ||
+														attribs[Attributes::RefType] == Attributes::CanonicalFunc);
 
-		//Get the return type if there is no return table configured
-		if(attribs[Attributes::ReturnTable].isEmpty())
+		configureBaseFunctionAttribs(attribs, params, ret_table_cols, direct_creation);
+
+		if(direct_creation)
 		{
+			PgSqlType ret_type("void");
+
 			/* If the function is to be used as a user-defined data type support functions
 				 the return type will be renamed to "any" (see rules on Type::setFunction()) */
-			if(attribs[Attributes::RefType] == Attributes::InputFunc ||
-					attribs[Attributes::RefType] == Attributes::RecvFunc ||
-					attribs[Attributes::RefType] == Attributes::CanonicalFunc)
-				attribs[Attributes::ReturnType] = PgSqlType("\"any\"").getSourceCode(SchemaParser::XmlCode);
-			else
-				attribs[Attributes::ReturnType] = getType(attribs[Attributes::ReturnType], true);
+			if(ret_table_cols.empty())
+				ret_type = is_any_ret_type ? PgSqlType("\"any\"") : PgSqlType::parseString(getType(attribs[Attributes::ReturnType], false));
+
+			func = dbmodel->createFunction(attribs, params, ret_type, ret_table_cols);
+		}
+		else
+		{
+			//Get the return type if there is no return table configured
+			if(attribs[Attributes::ReturnTable].isEmpty())
+			{
+				/* If the function is to be used as a user-defined data type support functions
+					 the return type will be renamed to "any" (see rules on Type::setFunction()) */
+				if(is_any_ret_type)
+					attribs[Attributes::ReturnType] = PgSqlType("\"any\"").getSourceCode(SchemaParser::XmlCode);
+				else
+					attribs[Attributes::ReturnType] = getType(attribs[Attributes::ReturnType], true);
+			}
+
+			loadObjectXML(ObjectType::Function, attribs);
+			func = dbmodel->createFunction();
 		}
 
-		loadObjectXML(ObjectType::Function, attribs);
-		func = dbmodel->createFunction();
 		dbmodel->addFunction(func);
 
 		return func;
@@ -1415,19 +1788,30 @@ Function *DatabaseImportHelper::createFunction(attribs_map &attribs)
 	{
 		if(func) delete func;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+										__exc_origin, &e,
+										direct_creation ? dumpObjectAttributes(attribs) : xmlparser->getXMLBuffer());
 	}
 }
 
 Procedure *DatabaseImportHelper::createProcedure(attribs_map &attribs)
 {
 	Procedure *proc=nullptr;
+	bool direct_creation = isDirectCreation(ObjectType::Procedure);
 
 	try
 	{
-		configureBaseFunctionAttribs(attribs);
-		loadObjectXML(ObjectType::Procedure, attribs);
-		proc = dbmodel->createProcedure();
+		std::vector<Parameter> params, ret_table_cols;
+
+		configureBaseFunctionAttribs(attribs, params, ret_table_cols, direct_creation);
+
+		if(direct_creation)
+			proc = dbmodel->createProcedure(attribs, params);
+		else
+		{
+			loadObjectXML(ObjectType::Procedure, attribs);
+			proc = dbmodel->createProcedure();
+		}
+
 		dbmodel->addProcedure(proc);
 
 		return proc;
@@ -1436,7 +1820,8 @@ Procedure *DatabaseImportHelper::createProcedure(attribs_map &attribs)
 	{
 		if(proc) delete proc;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+										__exc_origin, &e,
+										direct_creation ? dumpObjectAttributes(attribs) : xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1475,7 +1860,7 @@ Language *DatabaseImportHelper::createLanguage(attribs_map &attribs)
 	{
 		if(lang) delete lang;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1495,7 +1880,7 @@ OperatorFamily *DatabaseImportHelper::createOperatorFamily(attribs_map &attribs)
 	{
 		if(opfam) delete opfam;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1579,7 +1964,7 @@ OperatorClass *DatabaseImportHelper::createOperatorClass(attribs_map &attribs)
 	{
 		if(opclass) delete opclass;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1642,7 +2027,7 @@ Operator *DatabaseImportHelper::createOperator(attribs_map &attribs)
 	{
 		if(oper) delete oper;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1662,7 +2047,7 @@ Collation *DatabaseImportHelper::createCollation(attribs_map &attribs)
 	{
 		if(coll) delete coll;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1685,7 +2070,7 @@ Cast *DatabaseImportHelper::createCast(attribs_map &attribs)
 	{
 		if(cast) delete cast;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1706,7 +2091,7 @@ Conversion *DatabaseImportHelper::createConversion(attribs_map &attribs)
 	{
 		if(conv) delete conv;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1779,7 +2164,7 @@ Sequence *DatabaseImportHelper::createSequence(attribs_map &attribs)
 	{
 		if(seq) delete seq;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1829,7 +2214,7 @@ Aggregate *DatabaseImportHelper::createAggregate(attribs_map &attribs)
 	{
 		if(agg) delete agg;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -1925,13 +2310,14 @@ Type *DatabaseImportHelper::createType(attribs_map &attribs)
 	{
 		if(type) delete type;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
 Table *DatabaseImportHelper::createTable(attribs_map &attribs)
 {
 	Table *table=nullptr;
+	std::vector<Column *> cols;
 
 	try
 	{
@@ -1940,10 +2326,38 @@ Table *DatabaseImportHelper::createTable(attribs_map &attribs)
 			{ Attributes::XPos, "0" },
 			{ Attributes::YPos, "0" }};
 
-		attribs[Attributes::Position] = schparser.getSourceCode(Attributes::Position, pos_attrib, SchemaParser::XmlCode);
-		attribs[Attributes::Columns] = createColumns(attribs, inh_cols).join(QChar::LineFeed);
-		loadObjectXML(ObjectType::Table, attribs);
-		table=dbmodel->createTable();
+		cols = createColumns(attribs, inh_cols);
+
+		if(isDirectCreation(ObjectType::Table))
+		{
+			/* Configuring the table in the same way DatabaseModel::createTable() does
+			 * but reading the attributes straight from the catalog */
+			table = new Table;
+			dbmodel->setBasicAttributes(table, attribs);
+			table->setPosition(QPointF(0, 0));
+			table->setObjectListsCapacity(attribs[Attributes::MaxObjCount].toUInt());
+			table->setGenerateAlterCmds(!attribs[Attributes::GenAlterCmds].isEmpty());
+			table->setLayers(attribs[Attributes::Layers].split(','));
+			table->setUnlogged(!attribs[Attributes::Unlogged].isEmpty());
+			table->setRLSEnabled(!attribs[Attributes::RlsEnabled].isEmpty());
+			table->setRLSForced(!attribs[Attributes::RlsForced].isEmpty());
+			table->setWithOIDs(!attribs[Attributes::Oids].isEmpty());
+
+			while(!cols.empty())
+			{
+				table->addObject(cols.front());
+				cols.erase(cols.begin());
+			}
+
+			table->setProtected(table->isProtected());
+		}
+		else
+		{
+			attribs[Attributes::Position] = schparser.getSourceCode(Attributes::Position, pos_attrib, SchemaParser::XmlCode);
+			attribs[Attributes::Columns] = getColumnsXML(cols).join(QChar::LineFeed);
+			loadObjectXML(ObjectType::Table, attribs);
+			table=dbmodel->createTable();
+		}
 
 		for(unsigned col_idx : inh_cols)
 			inherited_cols.push_back(table->getColumn(col_idx));
@@ -1967,7 +2381,7 @@ Table *DatabaseImportHelper::createTable(attribs_map &attribs)
 				throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
 												.arg(attribs[Attributes::Name]).arg(BaseObject::getTypeName(ObjectType::Table))
 												.arg(attribs[Attributes::PartitionedTable]).arg(BaseObject::getTypeName(ObjectType::Table)),
-												ErrorCode::RefObjectInexistsModel ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::RefObjectInexistsModel ,__exc_origin);
 			}
 		}
 
@@ -2044,8 +2458,12 @@ Table *DatabaseImportHelper::createTable(attribs_map &attribs)
 			delete table;
 		}
 
+		for(auto &col : cols)
+			delete col;
+
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e,
+						isDirectCreation(ObjectType::Table) ? dumpObjectAttributes(attribs) : xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2166,7 +2584,7 @@ View *DatabaseImportHelper::createView(attribs_map &attribs)
 	{
 		if(view) delete view;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2205,7 +2623,7 @@ Rule *DatabaseImportHelper::createRule(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2233,7 +2651,7 @@ Trigger *DatabaseImportHelper::createTrigger(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2263,7 +2681,7 @@ Index *DatabaseImportHelper::createIndex(attribs_map &attribs)
 				throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
 												.arg(attribs[Attributes::Name]).arg(BaseObject::getTypeName(ObjectType::Index))
 												.arg(tab_name).arg(BaseObject::getTypeName(ObjectType::Table)),
-												ErrorCode::RefObjectInexistsModel ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::RefObjectInexistsModel ,__exc_origin);
 		}
 
 		cols = Catalog::parseArrayValues(attribs[Attributes::Columns]);
@@ -2350,13 +2768,14 @@ Index *DatabaseImportHelper::createIndex(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
 Constraint *DatabaseImportHelper::createConstraint(attribs_map &attribs)
 {
 	Constraint *constr=nullptr;
+	bool direct_creation = isDirectCreation(ObjectType::Constraint);
 
 	try
 	{
@@ -2364,6 +2783,7 @@ Constraint *DatabaseImportHelper::createConstraint(attribs_map &attribs)
 				ref_tab_oid=attribs[Attributes::RefTable],
 				tab_name;
 		PhysicalTable *table=nullptr;
+		std::vector<ExcludeElement> exc_elems;
 
 		//If the table oid is 0 indicates that the constraint is part of a data type like domains
 		if(!table_oid.isEmpty() && table_oid!="0")
@@ -2446,7 +2866,13 @@ Constraint *DatabaseImportHelper::createConstraint(attribs_map &attribs)
 						elem.setSortingAttribute(ExcludeElement::NullsFirst, nulls_first);
 					}
 
-					attribs[Attributes::Elements]+=elem.getSourceCode(SchemaParser::XmlCode);
+					exc_elems.push_back(elem);
+				}
+
+				if(!direct_creation)
+				{
+					for(auto &exc_elem : exc_elems)
+						attribs[Attributes::Elements]+=exc_elem.getSourceCode(SchemaParser::XmlCode);
 				}
 			}
 			else
@@ -2469,12 +2895,21 @@ Constraint *DatabaseImportHelper::createConstraint(attribs_map &attribs)
 			attribs[Attributes::DstColumns] = getColumnNames(ref_tab_oid, attribs[Attributes::DstColumns]).join(',');
 			attribs[Attributes::Table] = tab_name;
 
-			loadObjectXML(ObjectType::Constraint, attribs);
-			constr = dbmodel->createConstraint(nullptr);
-			constr->setSQLDisabled(table->isSQLDisabled());
-
-			if(table &&  constr->getConstraintType()==ConstraintType::PrimaryKey)
+			if(direct_creation)
+			{
+				constr = dbmodel->createConstraint(table, attribs, exc_elems);
+				constr->setSQLDisabled(table->isSQLDisabled());
 				table->addConstraint(constr);
+			}
+			else
+			{
+				loadObjectXML(ObjectType::Constraint, attribs);
+				constr = dbmodel->createConstraint(nullptr);
+				constr->setSQLDisabled(table->isSQLDisabled());
+
+				if(table &&  constr->getConstraintType()==ConstraintType::PrimaryKey)
+					table->addConstraint(constr);
+			}
 
 			table->setModified(true);
 		}
@@ -2484,7 +2919,8 @@ Constraint *DatabaseImportHelper::createConstraint(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e,
+						direct_creation ? dumpObjectAttributes(attribs) : xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2504,7 +2940,7 @@ Policy *DatabaseImportHelper::createPolicy(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2528,7 +2964,7 @@ EventTrigger *DatabaseImportHelper::createEventTrigger(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2555,7 +2991,7 @@ ForeignDataWrapper *DatabaseImportHelper::createForeignDataWrapper(attribs_map &
 	{
 		if(fdw) delete fdw;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+										__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2578,7 +3014,7 @@ ForeignServer *DatabaseImportHelper::createForeignServer(attribs_map &attribs)
 	{
 		if(server) delete server;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+										__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2601,7 +3037,7 @@ UserMapping *DatabaseImportHelper::createUserMapping(attribs_map &attribs)
 	{
 		if(usr_map) delete usr_map;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+										__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2612,6 +3048,7 @@ ForeignTable *DatabaseImportHelper::createForeignTable(attribs_map &attribs)
 	try
 	{
 		std::vector<unsigned> inh_cols;
+		std::vector<Column *> cols;
 		attribs_map pos_attrib={
 			{ Attributes::XPos, "0" },
 			{ Attributes::YPos, "0" }};
@@ -2620,7 +3057,8 @@ ForeignTable *DatabaseImportHelper::createForeignTable(attribs_map &attribs)
 		attribs[Attributes::Options] = Catalog::parseArrayValues(attribs[Attributes::Options]).join(ForeignDataWrapper::OptionsSeparator);
 		attribs[Attributes::Position]=schparser.getSourceCode(Attributes::Position, pos_attrib, SchemaParser::XmlCode);
 
-		attribs[Attributes::Columns] = createColumns(attribs, inh_cols).join(QChar::LineFeed);
+		cols = createColumns(attribs, inh_cols);
+		attribs[Attributes::Columns] = getColumnsXML(cols).join(QChar::LineFeed);
 		loadObjectXML(ObjectType::ForeignTable, attribs);
 		ftable=dbmodel->createForeignTable();
 
@@ -2646,7 +3084,7 @@ ForeignTable *DatabaseImportHelper::createForeignTable(attribs_map &attribs)
 				throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
 												.arg(attribs[Attributes::Name]).arg(BaseObject::getTypeName(ObjectType::Table))
 												.arg(attribs[Attributes::PartitionedTable]).arg(BaseObject::getTypeName(ObjectType::Table)),
-												ErrorCode::RefObjectInexistsModel ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::RefObjectInexistsModel ,__exc_origin);
 			}
 		}
 
@@ -2663,7 +3101,7 @@ ForeignTable *DatabaseImportHelper::createForeignTable(attribs_map &attribs)
 			delete ftable;
 		}
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+										__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2687,7 +3125,7 @@ Transform *DatabaseImportHelper::createTransform(attribs_map &attribs)
 	{
 		if(transf) delete transf;
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+										__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -2765,7 +3203,7 @@ void DatabaseImportHelper::createPermission(attribs_map &attribs)
 													.arg(perm_str)
 													.arg(BaseObject::getTypeName(ObjectType::Permission))
 													.arg("n/d"),
-													ErrorCode::ObjectNotImported,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+													ErrorCode::ObjectNotImported,__exc_origin, &e,
 													dumpObjectAttributes(attribs));
 				}
 			}
@@ -2776,7 +3214,7 @@ void DatabaseImportHelper::createPermission(attribs_map &attribs)
 				throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
 								.arg(QString("%1").arg(perm_str)).arg(BaseObject::getTypeName(ObjectType::Permission))
 								.arg(role_name).arg(BaseObject::getTypeName(ObjectType::Role))
-								,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+								,__exc_origin);
 			else
 			{
 				try
@@ -2809,9 +3247,9 @@ void DatabaseImportHelper::createPermission(attribs_map &attribs)
 						delete permission;
 
 					if(ignore_errors)
-						errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+						errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, dumpObjectAttributes(attribs)));
 					else
-						throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+						throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 				}
 			}
 		}
@@ -2836,7 +3274,7 @@ void DatabaseImportHelper::createTableInheritances()
 			if(ignore_errors)
 				errors.push_back(e);
 			else
-				throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 		}
 	}
 }
@@ -2879,7 +3317,7 @@ void DatabaseImportHelper::createTablePartitionings()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2922,7 +3360,7 @@ void DatabaseImportHelper::destroyDetachedColumns()
 			if(ignore_errors)
 				errors.push_back(e);
 			else
-				throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+				throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 		}
 	}
 
@@ -2941,6 +3379,7 @@ void DatabaseImportHelper::createColumns()
 		PhysicalTable *tab = nullptr;
 		Column *col = nullptr;
 		QStringList col_xmls;
+		std::vector<Column *> cols;
 		ObjectType obj_type;
 
 		for(auto &[tab_oid, _] : columns)
@@ -2952,10 +3391,8 @@ void DatabaseImportHelper::createColumns()
 			if(obj_type == ObjectType::View)
 				continue;
 
-			/* Configuring the XML of the columns to be created in the table,
-			 * after calling this method, the code is stored in the attribute
-			 * Attributes::Columns of the tab_attr */
-			col_xmls = createColumns(tab_attr, inh_cols);
+			// Configuring the columns to be created in the table
+			cols = createColumns(tab_attr, inh_cols);
 
 			/* Retrieving the instance of table in the database model
 			 * that will receive the columns */
@@ -2964,10 +3401,44 @@ void DatabaseImportHelper::createColumns()
 
 			if(!tab)
 			{
+				for(auto &aux_col : cols)
+					delete aux_col;
+
 				throw Exception(tr("Trying to create column(s) in the table `%1' that doesn't exist in the model!").arg(tab_signature),
-												ErrorCode::Custom, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+												ErrorCode::Custom, __exc_origin);
+			}
+
+			if(isDirectCreation(obj_type))
+			{
+				while(!cols.empty())
+				{
+					col = cols.front();
+					cols.erase(cols.begin());
+
+					try
+					{
+						// If the column already exists we just ignore it
+						if(tab->getColumn(col->getName()))
+							delete col;
+						else
+							tab->addColumn(col);
+					}
+					catch(Exception &e)
+					{
+						delete col;
+
+						for(auto &aux_col : cols)
+							delete aux_col;
+
+						throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
+					}
+				}
+
+				continue;
 			}
 
+			col_xmls = getColumnsXML(cols);
+
 			for(auto &col_xml : col_xmls)
 			{
 				if(debug_mode)
@@ -2996,25 +3467,25 @@ void DatabaseImportHelper::createColumns()
 					if(col)
 						delete col;
 
-					throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+					throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 				}
 			}
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
-QStringList DatabaseImportHelper::createColumns(attribs_map &attribs, std::vector<unsigned> &inh_cols)
+std::vector<Column *> DatabaseImportHelper::createColumns(attribs_map &attribs, std::vector<unsigned> &inh_cols)
 {
 	unsigned tab_oid=attribs[Attributes::Oid].toUInt(), type_oid=0, col_idx=0;
 	bool is_type_registered=false;
-	Column col;
+	Column *col = nullptr;
 	QString type_name, def_val;
 	std::map<unsigned, attribs_map>::iterator itr, itr1, itr_end;
-	QStringList col_xmls;
+	std::vector<Column *> cols;
 
 	if(tab_oid == 0)
 		return {};
@@ -3030,139 +3501,179 @@ QStringList DatabaseImportHelper::createColumns(attribs_map &attribs, std::vecto
 	itr_end = columns[attribs[Attributes::Oid].toUInt()].end();
 	attribs[Attributes::MaxObjCount] = QString::number(columns[attribs[Attributes::Oid].toUInt()].size());
 
-	//Creating columns
-	while(itr!=itr_end)
+	try
 	{
-		if(itr->second.count(Attributes::Permission) &&
-				!itr->second.at(Attributes::Permission).isEmpty())
-			col_perms[tab_oid].push_back(itr->second[Attributes::Oid].toUInt());
+		//Creating columns
+		while(itr!=itr_end)
+		{
+			col = new Column;
 
-		if(itr->second[Attributes::Inherited]==Attributes::True)
-			inh_cols.push_back(col_idx);
+			if(itr->second.count(Attributes::Permission) &&
+					!itr->second.at(Attributes::Permission).isEmpty())
+				col_perms[tab_oid].push_back(itr->second[Attributes::Oid].toUInt());
 
-		col.setName(itr->second[Attributes::Name]);
-		type_oid=itr->second[Attributes::TypeOid].toUInt();
+			if(itr->second[Attributes::Inherited]==Attributes::True)
+				inh_cols.push_back(col_idx);
 
-		/* If the type has an entry on the types map and its OID is greater than system object oids,
-		 * means that it's a user defined type, thus, there is the need to check if the type
-		 * is registered. */
-		if(types.count(type_oid) !=0 && type_oid > catalog.getLastSysObjectOID())
-		{
-			/* Building the type name prepending the schema name in order to search it on
-			 * the user defined types list at PgSQLType class */
-			QString sch_name = BaseObject::formatName(getObjectName(types[type_oid][Attributes::Schema], true), false);
-			sch_name += ".";
-			type_name.clear();
+			col->setName(itr->second[Attributes::Name]);
+			type_oid=itr->second[Attributes::TypeOid].toUInt();
 
-			/* Special verification for PostGiS types: if the current type is a gis based one
-			 * (geometry, geography, box3d or box2d) we override the usage of the current type
-			 * and force the use of the pgModeler built-in one. */
-			if((PgSqlType::isPostGisGeoType(types[type_oid][Attributes::Name]) ||
-					PgSqlType::isPostGisBoxType(types[type_oid][Attributes::Name])) &&
-				 types[type_oid][Attributes::Configuration] == Attributes::BaseType &&
-				 types[type_oid][Attributes::Category] == ~CategoryType(CategoryType::UserDefined))
-			{
-				type_name = itr->second[Attributes::Type];
-				type_name.remove(sch_name);
-				is_type_registered = true;
-			}
-			else
+			/* If the type has an entry on the types map and its OID is greater than system object oids,
+			 * means that it's a user defined type, thus, there is the need to check if the type
+			 * is registered. */
+			if(types.count(type_oid) !=0 && type_oid > catalog.getLastSysObjectOID())
 			{
-				if(types[type_oid][Attributes::Category] == ~CategoryType(CategoryType::Array))
+				/* Building the type name prepending the schema name in order to search it on
+				 * the user defined types list at PgSQLType class */
+				QString sch_name = BaseObject::formatName(getObjectName(types[type_oid][Attributes::Schema], true), false);
+				sch_name += ".";
+				type_name.clear();
+
+				/* Special verification for PostGiS types: if the current type is a gis based one
+				 * (geometry, geography, box3d or box2d) we override the usage of the current type
+				 * and force the use of the pgModeler built-in one. */
+				if((PgSqlType::isPostGisGeoType(types[type_oid][Attributes::Name]) ||
+						PgSqlType::isPostGisBoxType(types[type_oid][Attributes::Name])) &&
+					 types[type_oid][Attributes::Configuration] == Attributes::BaseType &&
+					 types[type_oid][Attributes::Category] == ~CategoryType(CategoryType::UserDefined))
 				{
-					int dim = types[type_oid][Attributes::Name].count("[]");
-					QString aux_name = types[type_oid][Attributes::Name].remove("[]");
-					type_name+=BaseObject::formatName(aux_name, false);
-					type_name+=QString("[]").repeated(dim);
-					type_name.prepend(sch_name);
+					type_name = itr->second[Attributes::Type];
+					type_name.remove(sch_name);
+					is_type_registered = true;
 				}
 				else
-					type_name = getType(QString::number(type_oid), false);
+				{
+					if(types[type_oid][Attributes::Category] == ~CategoryType(CategoryType::Array))
+					{
+						int dim = types[type_oid][Attributes::Name].count("[]");
+						QString aux_name = types[type_oid][Attributes::Name].remove("[]");
+						type_name+=BaseObject::formatName(aux_name, false);
+						type_name+=QString("[]").repeated(dim);
+						type_name.prepend(sch_name);
+					}
+					else
+						type_name = getType(QString::number(type_oid), false);
 
-				is_type_registered=PgSqlType::isRegistered(type_name, dbmodel);
+					is_type_registered=PgSqlType::isRegistered(type_name, dbmodel);
+				}
+			}
+			else
+			{
+				type_name = itr->second[Attributes::Type];
+				is_type_registered=(types.count(type_oid)!=0 && PgSqlType::isRegistered(type_name, dbmodel));
 			}
-		}
-		else
-		{
-			type_name = itr->second[Attributes::Type];
-			is_type_registered=(types.count(type_oid)!=0 && PgSqlType::isRegistered(type_name, dbmodel));
-		}
-
-		/* Checking if the type used by the column exists (is registered),
-		 * if not it'll be created when auto_resolve_deps is checked. */
-		if(auto_resolve_deps && !is_type_registered &&
-			 type_oid > catalog.getLastSysObjectOID())
-		{
-			// Try to create the missing data type
-			getType(itr->second[Attributes::TypeOid], false);
-		}
 
-		col.setIdentityType(IdentityType::Null);
-		col.setGenerated(false);
-		col.setType(PgSqlType::parseString(type_name));
-		col.setNotNull(!itr->second[Attributes::NotNull].isEmpty());
-		col.setComment(itr->second[Attributes::Comment]);
+			/* Checking if the type used by the column exists (is registered),
+			 * if not it'll be created when auto_resolve_deps is checked. */
+			if(auto_resolve_deps && !is_type_registered &&
+				 type_oid > catalog.getLastSysObjectOID())
+			{
+				// Try to create the missing data type
+				getType(itr->second[Attributes::TypeOid], false);
+			}
 
-		if(comments_as_aliases)
-			col.setAlias(col.getComment().mid(0, BaseObject::ObjectNameMaxLength - 1));
+			col->setIdentityType(IdentityType::Null);
+			col->setGenerated(false);
+			col->setType(PgSqlType::parseString(type_name));
+			col->setNotNull(!itr->second[Attributes::NotNull].isEmpty());
+			col->setComment(itr->second[Attributes::Comment]);
 
-		//Overriding the default value if the column is identity
-		if(!itr->second[Attributes::IdentityType].isEmpty())
-			col.setIdentityType(itr->second[Attributes::IdentityType]);
-		else if(itr->second[Attributes::Generated] == Attributes::True)
-		{
-			col.setGenerated(true);
-			def_val = itr->second[Attributes::DefaultValue];
+			if(comments_as_aliases)
+				col->setAlias(col->getComment().mid(0, BaseObject::ObjectNameMaxLength - 1));
 
-			if(def_val.startsWith('(') && def_val.endsWith(')'))
+			//Overriding the default value if the column is identity
+			if(!itr->second[Attributes::IdentityType].isEmpty())
+				col->setIdentityType(itr->second[Attributes::IdentityType]);
+			else if(itr->second[Attributes::Generated] == Attributes::True)
 			{
-				def_val.remove(0, 1);
-				def_val.remove(def_val.length() - 1, 1);
+				col->setGenerated(true);
+				def_val = itr->second[Attributes::DefaultValue];
+
+				if(def_val.startsWith('(') && def_val.endsWith(')'))
+				{
+					def_val.remove(0, 1);
+					def_val.remove(def_val.length() - 1, 1);
+				}
+
+				col->setDefaultValue(def_val);
 			}
+			else
+			{
+				/* Removing extra/forced type casting in the retrieved default value.
+				 This is done in order to avoid unnecessary entries in the diff results.
 
-			col.setDefaultValue(def_val);
-		}
-		else
-		{
-			/* Removing extra/forced type casting in the retrieved default value.
-			 This is done in order to avoid unnecessary entries in the diff results.
+				 For instance: say in the model we have a column with the following configutation:
+				 > varchar(3) default 'foo'
 
-			 For instance: say in the model we have a column with the following configutation:
-			 > varchar(3) default 'foo'
+				 Now, when importing the same column the default value for it will be something like:
+				 > varchar(3) default 'foo'::character varying
 
-			 Now, when importing the same column the default value for it will be something like:
-			 > varchar(3) default 'foo'::character varying
+				 Since the extra chars in the default value of the imported column are redundant (casting
+				 varchar to character varying) we remove the '::character varying'. The idea here is to eliminate
+				 the cast if the casting is equivalent to the column type. */
+				def_val = itr->second[Attributes::DefaultValue];
 
-			 Since the extra chars in the default value of the imported column are redundant (casting
-			 varchar to character varying) we remove the '::character varying'. The idea here is to eliminate
-			 the cast if the casting is equivalent to the column type. */
-			def_val = itr->second[Attributes::DefaultValue];
+				if(!def_val.startsWith("nextval(") && def_val.contains("::"))
+				{
+					QStringList values = def_val.split("::");
 
-			if(!def_val.startsWith("nextval(") && def_val.contains("::"))
-			{
-				QStringList values = def_val.split("::");
+					if(values.size() > 1 &&
+						 ((~col->getType() == values[1]) ||
+							(~col->getType() == "char" && values[1] == "bpchar") ||
+							(col->getType().isUserType() && (~col->getType()).endsWith(values[1]))))
+						def_val=values[0];
+				}
 
-				if(values.size() > 1 &&
-					 ((~col.getType() == values[1]) ||
-						(~col.getType() == "char" && values[1] == "bpchar") ||
-						(col.getType().isUserType() && (~col.getType()).endsWith(values[1]))))
-					def_val=values[0];
+				col->setDefaultValue(def_val);
 			}
 
-			col.setDefaultValue(def_val);
+			//Checking if the collation used by the column exists, if not it'll be created when auto_resolve_deps is checked
+			if(auto_resolve_deps && !itr->second[Attributes::Collation].isEmpty())
+				getDependencyObject(itr->second[Attributes::Collation], ObjectType::Collation);
+
+			col->setCollation(dbmodel->getObject(getObjectName(itr->second[Attributes::Collation]),ObjectType::Collation));
+			cols.push_back(col);
+			col = nullptr;
+			itr++;
+			col_idx++;
 		}
+	}
+	catch(Exception &e)
+	{
+		if(col)
+			delete col;
 
-		//Checking if the collation used by the column exists, if not it'll be created when auto_resolve_deps is checked
-		if(auto_resolve_deps && !itr->second[Attributes::Collation].isEmpty())
-			getDependencyObject(itr->second[Attributes::Collation], ObjectType::Collation);
+		for(auto &created_col : cols)
+			delete created_col;
 
-		col.setCollation(dbmodel->getObject(getObjectName(itr->second[Attributes::Collation]),ObjectType::Collation));
-		//attribs[Attributes::Columns]+=col.getSourceCode(SchemaParser::XmlCode);
-		col_xmls.append(col.getSourceCode(SchemaParser::XmlCode));
-		itr++;
-		col_idx++;
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+
+	return cols;
+}
+
+QStringList DatabaseImportHelper::getColumnsXML(std::vector<Column *> &cols)
+{
+	QStringList col_xmls;
+
+	try
+	{
+		for(auto &col : cols)
+			col_xmls.append(col->getSourceCode(SchemaParser::XmlCode));
 	}
+	catch(Exception &e)
+	{
+		for(auto &col : cols)
+			delete col;
+
+		cols.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+
+	for(auto &col : cols)
+		delete col;
 
+	cols.clear();
 	return col_xmls;
 }
 
@@ -3296,7 +3807,7 @@ void DatabaseImportHelper::__createTableInheritances()
 					if(!parent_tab)
 						throw Exception(Exception::getErrorMessage(ErrorCode::InvInheritParentTableNotFound)
 														.arg(child_tab->getSignature()).arg(inh_oid),
-														ErrorCode::InvInheritParentTableNotFound,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+														ErrorCode::InvInheritParentTableNotFound,__exc_origin);
 
 					//Create the inheritance relationship
 					rel = new Relationship(Relationship::RelationshipGen, child_tab, parent_tab);
@@ -3314,7 +3825,7 @@ void DatabaseImportHelper::__createTableInheritances()
 					if(ignore_errors)
 						errors.push_back(e);
 					else
-						throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+						throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 				}
 			}
 		}
@@ -3335,7 +3846,7 @@ void DatabaseImportHelper::configureDatabase(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+						__exc_origin, &e, xmlparser->getXMLBuffer());
 	}
 }
 
@@ -3526,7 +4037,7 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 			Catalog::QueryFilter curr_filter = catalog.getQueryFilter();
 
 			catalog.setQueryFilter(Catalog::ListAllObjects);
-			type_attr = catalog.getObjectAttributes(ObjectType::Type, type_oid);
+			type_attr = getCatalogAttributes(ObjectType::Type, type_oid);
 			catalog.setQueryFilter(curr_filter);
 
 			/* Formatting/Quoting the name of the type (if necessary) in order to avoid
@@ -3550,7 +4061,7 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 				 * and store its attributes in the types map, so the original type can be also
 				 * created if needed */
 				elem_tp_oid = type_attr[Attributes::Element].toUInt();
-				types[elem_tp_oid] = catalog.getObjectAttributes(ObjectType::Type, elem_tp_oid);
+				types[elem_tp_oid] = getCatalogAttributes(ObjectType::Type, elem_tp_oid);
 			}
 			else
 				type_attr[Attributes::Name] = BaseObject::formatName(type_attr[Attributes::Name]);
@@ -3677,7 +4188,7 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
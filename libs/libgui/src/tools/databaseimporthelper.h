@@ -37,6 +37,16 @@ class __libgui DatabaseImportHelper: public QObject {
 	Q_OBJECT
 
 	private:	
+		//! \brief Describes a catalog query executed by one of the parallel import workers (see fetchObjectsAttributes())
+		struct CatalogQuery {
+			ObjectType obj_type;
+			QString schema, table;
+			std::vector<unsigned> oids;
+
+			//! \brief Stores the attributes retrieved by the worker
+			std::vector<attribs_map> attribs;
+		};
+
 		//! \brief Random number generator engine used to generate random colors for imported schemas
 		std::default_random_engine rand_num_engine;
 		
@@ -88,8 +98,20 @@ class __libgui DatabaseImportHelper: public QObject {
 		/*! \brief Indicates to the importer that the database model in which the objects must be created
 		 * is the working one. This flag changes the behavior of the importer, causing duplicated objects
 		 * to be ignored. See createObjects() */
-		is_working_model;
+		is_working_model,
+
+		/*! \brief Indicates that the objects that support it are built straight from the catalog attributes
+		 * instead of generating their XML code and parsing it back in the database model. This flag
+		 * is ignored in debug mode, where the XML path is always used so the code can be inspected */
+		direct_obj_creation;
 		
+		//! \brief Amount of connections used in parallel to retrieve the objects attributes from the catalog
+		unsigned import_jobs,
+
+		/*! \brief Amount of catalog queries and round trips used by the parallel workers in the current import.
+		 *  These are summed to the catalog's own counters when reporting the import statistics */
+		wrk_queries, wrk_round_trips;
+
 		//! \brief Stores the selected objects oids to be imported
 		std::map<ObjectType, std::vector<unsigned>> object_oids;
 		
@@ -100,24 +122,14 @@ class __libgui DatabaseImportHelper: public QObject {
 		//! \brief Stores the selected objects oids to be imported
 		std::vector<unsigned> creation_order;
 			
-		//! \brief Stores the user defined objects attributes
-		std::map<unsigned, attribs_map> user_objs;
-		
-		//! \brief Stores the system catalog objects attributes
-		std::map<unsigned, attribs_map> system_objs;
-		
-		//! \brief Stores all defined types attributes
-		std::map<unsigned, attribs_map> types;
+		/*! \brief Stores the attributes of the types and dependencies referenced by the selected objects, per type and OID,
+		 *  which were retrieved in advance by prefetchDependencies(). An empty attributes map indicates that the object
+		 *  was queried but not found in the catalog, so it is not queried again (see getCatalogAttributes()) */
+		std::map<ObjectType, std::map<unsigned, attribs_map>> prefetched_objs;
 
 		//! \brief Stores all constraints attributes
 		std::vector<attribs_map> constraints;
 
-		//! \brief Stores the OIDs of the objects successfully created
-		std::vector<unsigned> created_objs;
-
-		//! \brief Stores all selected columns attributes
-		std::map<unsigned, std::map<unsigned, attribs_map>> columns;
-		
 		//! \brief Stores the oids of all objects that has permissions to be created
 		std::vector<unsigned> obj_perms;
 		
@@ -154,10 +166,13 @@ class __libgui DatabaseImportHelper: public QObject {
 		
 		SchemaParser schparser;
 		
-		void configureBaseFunctionAttribs(attribs_map &attribs);
+		/*! \brief Configures the attributes shared by functions and procedures filling the parameters and the
+		 * returned table columns vectors. The XML code of these objects is generated only when the function
+		 * isn't built directly (see direct_creation) */
+		void configureBaseFunctionAttribs(attribs_map &attribs, std::vector<Parameter> &params,
+																			std::vector<Parameter> &ret_table_cols, bool direct_creation);
 		void configureDatabase(attribs_map &attribs);
 
-		void createObject(attribs_map &attribs);
 		Tablespace *createTablespace(attribs_map &attribs);
 		Schema *createSchema(attribs_map &attribs);
 		Role *createRole(attribs_map &attribs);
@@ -198,9 +213,20 @@ class __libgui DatabaseImportHelper: public QObject {
 		void setObjectPgOid(BaseObject *obj, attribs_map &attribs);
 
 		/*! \brief Create the list of columns of the table represented by the passed attributes.
-		 * The returned list contains the XML code of each column.
+		 * The returned columns are not assigned to any table, so the caller must take their ownership.
 		 * The inh_cols is used to hold the id of inherited columns to be managed later */
-		QStringList createColumns(attribs_map &attribs, std::vector<unsigned> &inh_cols);
+		std::vector<Column *> createColumns(attribs_map &attribs, std::vector<unsigned> &inh_cols);
+
+		//! \brief Returns the XML code of each provided column destroying them afterwards
+		QStringList getColumnsXML(std::vector<Column *> &cols);
+
+		/*! \brief Executes the queries of each worker (one list per worker) using a dedicated catalog connection
+		 * per worker. The retrieved attributes are stored in the queries themselves so the caller can process
+		 * them in the current thread in a deterministic order. The first error raised by a worker is rethrown */
+		void fetchObjectsAttributes(std::vector<std::vector<CatalogQuery>> &worker_queries);
+
+		//! \brief Returns if objects of the provided type must be built without the XML round-trip
+		bool isDirectCreation(ObjectType obj_type);
 
 		/*! \brief Creates the columns in the map of columns in their respective tables.
 		 * This version of the method is used when importing objects to an working model
@@ -244,6 +270,19 @@ class __libgui DatabaseImportHelper: public QObject {
 		QString getDependencyObject(const QString &oid, ObjectType dep_type, bool use_signature=false,
 									bool recursive_dep_res=true, bool generate_xml=true, attribs_map extra_attribs=attribs_map());
 		
+		//! \brief Returns true when the dependency identified by the oid can be retrieved from the catalog when auto_resolve_deps is set
+		bool isDependencyResolvable(unsigned oid);
+
+		/*! \brief Collects the OIDs of all the types and dependencies referenced by the retrieved objects and columns
+		 *  which attributes are not known yet and retrieves them with a single catalog query per object type, storing
+		 *  the results in prefetched_objs. This avoids querying the catalog once per object in getType() and
+		 *  getDependencyObject(). The step is repeated for the dependencies of the prefetched objects until no new OID is found */
+		void prefetchDependencies();
+
+		/*! \brief Returns the attributes of the object retrieved in advance by prefetchDependencies() or, if the
+		 *  object wasn't prefetched, queries them in the catalog using its current filter */
+		attribs_map getCatalogAttributes(ObjectType obj_type, unsigned oid);
+
 		//! \brief Returns the xml defintion for the object's comment
 		QString getComment(attribs_map &attribs);
 		
@@ -262,6 +301,25 @@ class __libgui DatabaseImportHelper: public QObject {
 		 *  See createTable() and createForeignTable() */
 		void removeInheritedCols(PhysicalTable *tab);
 
+	protected:
+		//! \brief Stores the user defined objects attributes
+		std::map<unsigned, attribs_map> user_objs;
+
+		//! \brief Stores the system catalog objects attributes
+		std::map<unsigned, attribs_map> system_objs;
+
+		//! \brief Stores all defined types attributes
+		std::map<unsigned, attribs_map> types;
+
+		//! \brief Stores all selected columns attributes
+		std::map<unsigned, std::map<unsigned, attribs_map>> columns;
+
+		//! \brief Stores the OIDs of the objects successfully created
+		std::vector<unsigned> created_objs;
+
+		//! \brief Creates an object from the attributes retrieved from the catalog calling the proper create method
+		void createObject(attribs_map &attribs);
+
 	public:
 		DatabaseImportHelper(QObject *parent = nullptr);
 		
@@ -282,6 +340,14 @@ class __libgui DatabaseImportHelper: public QObject {
 		void setImportOptions(bool import_sys_objs, bool import_ext_objs, bool auto_resolve_deps, bool ignore_errors, bool debug_mode,
 													bool rand_rel_colors, bool update_fk_rels, bool comments_as_aliases, bool is_working_model = false);
 		
+		/*! \brief Toggles the creation of objects straight from the catalog attributes (default).
+		 *  When disabled, all objects are created by parsing their XML code like in debug mode */
+		void setDirectObjectCreation(bool value);
+
+		/*! \brief Defines the amount of connections used in parallel to retrieve the objects attributes.
+		 *  The objects are still created in the model in the same order regardless of the amount of jobs */
+		void setImportJobs(unsigned jobs);
+
 		//! \brief Returns the last system OID value for the current database
 		unsigned getLastSystemOID();
 		
@@ -314,6 +380,9 @@ class __libgui DatabaseImportHelper: public QObject {
 		void retrieveSystemObjects();
 		void retrieveUserObjects();
 		void retrieveTableColumns(const QString &sch_name, const QString &tab_name, std::vector<unsigned> col_ids={});
+
+		//! \brief Stores the retrieved columns attributes in the columns map indexing them by table oid and column oid
+		void storeTableColumns(std::vector<attribs_map> &cols);
 		void createObjects();
 		void createConstraints();
 		void createPermissions();
@@ -360,7 +360,7 @@ void DataGridWidget::listColumns(const std::vector<attribs_map> &cols)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -513,7 +513,7 @@ void DataGridWidget::retrieveData()
 		//qApp->restoreOverrideCursor();
 		conn_sql.close();
 		catalog.closeConnection();
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -783,7 +783,7 @@ void DataGridWidget::retrievePKColumns(Catalog &catalog)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -910,7 +910,7 @@ void DataGridWidget::retrieveFKColumns(Catalog &catalog)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1414,7 +1414,7 @@ QString DataGridWidget::getDMLCommand(int row)
 				{
 					throw Exception(Exception::getErrorMessage(ErrorCode::MalformedUnescapedValue)
 													.arg(row + 1).arg(col_name),
-													ErrorCode::MalformedUnescapedValue, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+													ErrorCode::MalformedUnescapedValue, __exc_origin);
 				}
 
 				col_list.push_back(QString("\"%1\"").arg(col_name));
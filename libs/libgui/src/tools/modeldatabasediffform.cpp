@@ -542,7 +542,7 @@ void ModelDatabaseDiffForm::listDatabases()
 		db_cmb->clear();
 		db_cmb->setEnabled(false);
 		db_lbl->setEnabled(false);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -638,7 +638,7 @@ void ModelDatabaseDiffForm::importDatabase(ThreadId thread_id)
 	try
 	{
 		if(thread_id != SrcImportThread && thread_id != ImportThread)
-			throw Exception(ErrorCode::AllocationObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AllocationObjectInvalidType,__exc_origin);
 
 		createThread(thread_id);
 
@@ -727,7 +727,7 @@ void ModelDatabaseDiffForm::importDatabase(ThreadId thread_id)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1241,7 +1241,7 @@ void ModelDatabaseDiffForm::saveConfiguration()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -1474,7 +1474,7 @@ void ModelDatabaseDiffForm::savePreset()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
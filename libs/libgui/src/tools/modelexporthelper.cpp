@@ -2,9 +2,11 @@
 #include "utilsns.h"
 #include <QSvgGenerator>
 #include "pgsqlversions.h"
+#include "sqlscriptparser.h"
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
+	stmts_batch_size = 1;
 	resetExportParams();
 }
 
@@ -31,24 +33,34 @@ void ModelExportHelper::abortExport(Exception &e)
 
 	//When running in a separated thread (other than the main application thread) redirects the error in form of signal
 	if(this->thread() && this->thread()!=qApp->thread())
-		emit s_exportAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+		emit s_exportAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e));
 	else
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
+}
+
+bool ModelExportHelper::isIgnoredError(const QString &error_code, bool ignore_dup)
+{
+	return ignored_errors.indexOf(error_code) >= 0 ||
+				 (ignore_dup && isDuplicationError(error_code));
 }
 
 void ModelExportHelper::handleSQLError(Exception &e, const QString &sql_cmd, bool ignore_dup)
 {
 	//Ignoring the error if it is in the ignored list
-	if(ignored_errors.indexOf(e.getExtraInfo()) >= 0 ||
-			(ignore_dup && isDuplicationError(e.getExtraInfo())))
+	if(isIgnoredError(e.getExtraInfo(), ignore_dup))
 		emit s_errorIgnored(e.getExtraInfo(), e.getErrorMessage(), sql_cmd);
 	//Raises an excpetion if the error returned by the database is not listed in the ignored list of errors
 	else if(ignored_errors.indexOf(e.getExtraInfo()) < 0)
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, sql_cmd);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin,&e, sql_cmd);
 	else
 		errors.push_back(e);
 }
 
+void ModelExportHelper::setStatementsBatchSize(unsigned batch_size)
+{
+	stmts_batch_size = std::max<unsigned>(batch_size, 1);
+}
+
 void ModelExportHelper::setIgnoredErrors(const QStringList &err_codes)
 {
 	QRegularExpression valid_code = QRegularExpression(QRegularExpression::anchoredPattern("([a-z]|[A-Z]|[0-9])+"));
@@ -67,7 +79,7 @@ void ModelExportHelper::setIgnoredErrors(const QStringList &err_codes)
 void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool gen_drop_file)
 {
 	if(!db_model)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	connect(db_model, &DatabaseModel::s_objectLoaded, this, &ModelExportHelper::updateProgress);
 
@@ -99,7 +111,7 @@ void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &file
 	catch(Exception &e)
 	{
 		disconnect(db_model, nullptr, this, nullptr);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 
 	disconnect(db_model, nullptr, this, nullptr);
@@ -108,11 +120,11 @@ void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &file
 void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page, bool override_bg_color, QGraphicsView *viewp)
 {
 	if(!scene)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	try
 	{
-		bool prev_show_grd = false, prev_show_dlm = false;
+		bool prev_show_grd = false, prev_show_dlm = false, prev_lod = false;
 		QGraphicsView *view = nullptr;
 		QColor bg_color;
 
@@ -131,6 +143,11 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		prev_show_grd = ObjectsScene::isShowGrid();
 		prev_show_dlm = ObjectsScene::isShowPageDelimiters();
 		bg_color = ObjectsScene::getCanvasColor();
+		prev_lod = BaseObjectView::isLevelOfDetailEnabled();
+
+		/* The level of detail rendering is disabled so the objects are fully
+		 * drawn in the resulting image no matter the zoom factor used */
+		BaseObjectView::setLevelOfDetailEnabled(false);
 
 		//Sets the options passed by the user
 		if(override_bg_color)
@@ -218,10 +235,11 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 
 				ObjectsScene::setShowGrid(prev_show_grd);
 				ObjectsScene::setShowPageDelimiters(prev_show_dlm);
+				BaseObjectView::setLevelOfDetailEnabled(prev_lod);
 				scene->update();
 
 				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(file),
-												ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::FileDirectoryNotWritten,__exc_origin);
 			}
 		}
 
@@ -231,6 +249,7 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 
 		ObjectsScene::setShowGrid(prev_show_grd);
 		ObjectsScene::setShowPageDelimiters(prev_show_dlm);
+		BaseObjectView::setLevelOfDetailEnabled(prev_lod);
 		scene->setShowSceneLimits(true);
 		scene->update();
 
@@ -247,14 +266,14 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
 void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim)
 {
 	if(!scene)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	bool prev_show_dlm=false, prev_show_grd=false;
 	QSvgGenerator svg_gen;
@@ -334,7 +353,7 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 	if(!fi.exists() || !fi.isWritable() || !fi.isReadable())
 	{
 			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
-											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::FileDirectoryNotWritten,__exc_origin);
 	}
 
 	emit s_progressUpdated(100, tr("Output file `%1' successfully written.").arg(filename), ObjectType::BaseObject);
@@ -357,15 +376,15 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 	try
 	{
 		if(!db_model)
-			throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 		/* If the export is called using ignore duplications or drop database and simulation mode at same time
 		an error is raised because the simulate mode (mainly used as SQL validation) cannot
 		undo column addition (this can be changed in the future) */
 		if(simulate && (ignore_dup || drop_db || drop_objs || transactional))
-			throw Exception(ErrorCode::MixingIncompExportOptions,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::MixingIncompExportOptions,__exc_origin);
 		else if(drop_db && drop_objs)
-			throw Exception(ErrorCode::MixingIncompDropOptions,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::MixingIncompDropOptions,__exc_origin);
 
 		connect(db_model, &DatabaseModel::s_objectLoaded, this, &ModelExportHelper::updateProgress, Qt::DirectConnection);
 
@@ -399,7 +418,7 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 			generateTempObjectNames(db_model);
 		}
 		else if(use_tmp_names)
-			throw Exception(ErrorCode::InvUsageTempNamesExportOption,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::InvUsageTempNamesExportOption,__exc_origin);
 
 		if(db_model->isSQLDisabled())
 		{
@@ -411,7 +430,7 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 			}
 			else
 				throw Exception(Exception::getErrorMessage(ErrorCode::ExportFailureDbSQLDisabled).arg(db_model->getName()),
-												ErrorCode::ExportFailureDbSQLDisabled, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+												ErrorCode::ExportFailureDbSQLDisabled, __exc_origin);
 		}
 
 		if(ignore_dup)
@@ -602,17 +621,17 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 		if(this->thread() && this->thread()!=qApp->thread())
 		{
 			errors.push_back(e);
-			emit s_exportAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, errors));
+			emit s_exportAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, errors));
 		}
 		else
 		{
 			//Redirects any error to terrorsr
 			if(errors.empty())
-				throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 			else
 			{
 				errors.push_back(e);
-				throw Exception(e.getErrorMessage(),__PRETTY_FUNCTION__,__FILE__,__LINE__, errors);
+				throw Exception(e.getErrorMessage(),__exc_origin, errors);
 			}
 		}
 	}
@@ -621,7 +640,7 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split, bool md_format)
 {
 	if(!db_model)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	connect(db_model, &DatabaseModel::s_objectLoaded, this, &ModelExportHelper::updateProgress);
 
@@ -640,7 +659,7 @@ void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString
 	catch(Exception &e)
 	{
 		disconnect(db_model, nullptr, this, nullptr);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 
 	disconnect(db_model, nullptr, this, nullptr);
@@ -820,40 +839,19 @@ bool ModelExportHelper::isDuplicationError(const QString &error_code)
 	return err_codes.contains(error_code);
 }
 
-void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs, bool transactional)
+QString ModelExportHelper::getCommandProgressMessage(const QString &sql_cmd, ObjectType &obj_type, ObjectType &msg_obj_type)
 {
-	Connection aux_conn;
-	QString sql_buf=buffer, sql_cmd, aux_cmd, lin, msg,
-			obj_name, obj_tp_name, tab_name, orig_conn_db_name,
-			alter_tab="ALTER TABLE";
-	std::vector<QString> db_sql_cmds;
-	QTextStream ts;
-	ObjectType obj_type=ObjectType::BaseObject;
-	bool ddl_tk_found=false, is_create=false, is_drop=false, in_transaction = false;
-	unsigned aux_prog=0, curr_size=0, buf_size=sql_buf.size(),
-			factor=(db_name.isEmpty() ? 70 : 90);
-	int pos=0, pos1=0, comm_cnt=0;
+	static const QString alter_tab="ALTER TABLE";
 
 	//Regexp used to extract the object being created
-	QRegularExpression obj_reg("(CREATE|DROP|ALTER)(.)+(\n)", QRegularExpression::DontCaptureOption),
+	static const QRegularExpression obj_reg("(CREATE|DROP|ALTER)(.)+(\n)", QRegularExpression::DontCaptureOption),
 
 			tab_obj_reg(QString("^(%1)(.)+(ADD|DROP)( )(COLUMN|CONSTRAINT)( )*").arg(alter_tab),
 									QRegularExpression::DontCaptureOption),
 
-			drop_reg("^((\\-\\-)+( )*)+(DROP)(.)+",
-							 QRegularExpression::DontCaptureOption),
-
-			drop_tab_obj_reg(QString("^((\\-\\-)+( )*)+(%1)(.)+(DROP)(.)+").arg(alter_tab),
-											 QRegularExpression::DontCaptureOption),
-			reg_aux,
-
-			name_rx("^((\".+\")|(\\w|_|\\d)+)(\\.((\".+\")|(\\w|_|\\d)+))*"),
+			name_rx("^((\".+\")|(\\w|_|\\d)+)(\\.((\".+\")|(\\w|_|\\d)+))*");
 
-			comm_regexp = QRegularExpression(QString("^(%1)|((--\\s)(%2|object|ALTER|DROP)(.)+)$").arg(Attributes::DdlEndToken, "\\*"),
-																			 QRegularExpression::DontCaptureOption);
-	QRegularExpressionMatch match;
-
-	std::vector<ObjectType> obj_types={ ObjectType::Role, ObjectType::Function, ObjectType::Trigger, ObjectType::Index,
+	static const std::vector<ObjectType> obj_types={ ObjectType::Role, ObjectType::Function, ObjectType::Trigger, ObjectType::Index,
 																 ObjectType::Policy, ObjectType::Rule,	ObjectType::Table, ObjectType::View, ObjectType::Domain,
 																 ObjectType::Schema,	ObjectType::Aggregate, ObjectType::OpFamily,
 																 ObjectType::OpClass, ObjectType::Operator,  ObjectType::Sequence,
@@ -863,285 +861,300 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 																 ObjectType::UserMapping, ObjectType::ForeignTable, ObjectType::Transform,
 																 ObjectType::Procedure, ObjectType::Database, ObjectType::BaseObject };
 
-	/* Extract each SQL command from the buffer and execute them separately. This is done
-   to permit the user, in case of error, identify what object is wrongly configured. */
-	ts.setString(&sql_buf);
+	QString aux_cmd, lin, msg, obj_name, obj_tp_name, tab_name;
+	QRegularExpression reg_aux;
+	QRegularExpressionMatch match;
+	bool is_create=false, is_drop=false;
+	int pos=0, pos1=0;
 
-	if(!conn.isStablished())
+	//Checking if the command is a column or constraint creation via ALTER TABLE
+	aux_cmd = sql_cmd;
+
+	if(tab_obj_reg.match(aux_cmd).hasMatch())
 	{
-		orig_conn_db_name = conn.getConnectionParam(Connection::ParamDbName);
+		aux_cmd.remove("IF EXISTS ");
+		obj_type=(aux_cmd.contains("COLUMN") ? ObjectType::Column : ObjectType::Constraint);
+		reg_aux.setPattern("(COLUMN|CONSTRAINT)( )+");
 
-		if(!db_name.isEmpty())
-			conn.setConnectionParam(Connection::ParamDbName, db_name);
+		//Extracting the table name
+		pos = aux_cmd.indexOf(alter_tab) + alter_tab.size();
+		pos1 = aux_cmd.indexOf("ADD");
 
-		conn.connect();
-	}
+		if(pos1 < 0)
+		{
+			pos1=aux_cmd.indexOf("DROP");
+			is_drop=true;
+		}
+
+		tab_name=aux_cmd.mid(pos, pos1 - pos).simplified();
+
+		//Extracting the child object name (column | constraint) the one between
+		match = reg_aux.match(aux_cmd, pos1);
+		pos = match.capturedStart();
+		pos += match.capturedLength();
+
+		pos1=aux_cmd.indexOf(" ", pos);
+		obj_name=aux_cmd.mid(pos, pos1 - pos).simplified();
+
+		//Creating a fully qualified name for the object (schema.table.name)
+		obj_name=tab_name + "." + obj_name;
+
+		if(is_drop)
+			msg=tr("Dropping object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
+		else
+			msg=tr("Creating object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
 
-	while(!ts.atEnd() && !export_canceled)
+		msg_obj_type = obj_type;
+	}
+	//Check if the regex matches the sql command
+	else if(obj_reg.match(sql_cmd).hasMatch())
 	{
-		try
+		//Get the fisrt line of the sql command, that contains the CREATE/DROP/ALTER ... statement
+		lin=sql_cmd.mid(0, sql_cmd.indexOf('\n'));
+
+		for(ObjectType obj_tp : obj_types)
 		{
-			//Cleanup single line comments
-			lin=ts.readLine();
-			curr_size+=lin.size();
-			aux_prog=progress + ((curr_size/static_cast<double>(buf_size)) * factor);
-
-			/* If the simulation mode is off and the drop objects option is checked,
-			 * check if the current line matches one of the accepted drop commands
-			 * (DROP [OBJECT] or ALTER TABLE...DROP) */
-			if(drop_objs && (drop_reg.match(lin).hasMatch() || drop_tab_obj_reg.match(lin).hasMatch()))
-			{
-				comm_cnt = lin.count("--");
-				lin = lin.remove("--").trimmed();
+			if(export_canceled) break;
+
+			obj_type=obj_tp;
 
-				/* If the count of comment indicators (--) is 1 indicates that the DDL of the
-				 * object related to the DROP is enabled, so the DROP is executed otherwise ignored */
-				if(comm_cnt == 1)
+			//Removing/replacing noisy keywords in order to extract more easily the object's name
+			if(lin.startsWith("CREATE") || lin.startsWith("ALTER"))
+			{
+				if(lin.contains("OR REPLACE"))
+				{
+					lin.remove("OR REPLACE");
+				}
+				else if(obj_tp == ObjectType::Index)
+				{
+					lin.remove("UNIQUE");
+					lin.remove("CONCURRENTLY");
+				}
+				else if(obj_tp == ObjectType::View)
+				{
+					lin.remove("MATERIALIZED");
+					lin.remove("RECURSIVE");
+				}
+				else if(obj_tp == ObjectType::Table)
+				{
+					lin.remove("UNLOGGED");
+				}
+				else if(obj_tp == ObjectType::Transform)
 				{
-					sql_cmd = lin + "\n";
-					ddl_tk_found = true;
+					lin.remove(" FOR");
+					lin.replace(" LANGUAGE ", "_");
+					lin.replace(QRegularExpression("(TRANSFORM)(.)+(\\.)"), "TRANSFORM ");
 				}
 			}
-			else
+			else if(lin.startsWith("DROP"))
 			{
-				ddl_tk_found = lin.contains(Attributes::DdlEndToken);
-				lin.remove(comm_regexp);
-
-				//If the line isn't empty after cleanup it will be included on sql command
-				if(!lin.isEmpty())
-					sql_cmd += lin + "\n";
+				lin.remove("IF EXISTS");
+				lin.remove("MATERIALIZED");
 			}
 
-			//If the ddl end token is found
-			if(ddl_tk_found || (!sql_cmd.isEmpty() && ts.atEnd()))
-			{
-				//Checking if the command is a column or constraint creation via ALTER TABLE
-				aux_cmd = sql_cmd;
+			lin = lin.simplified();
 
-				if(tab_obj_reg.match(aux_cmd).hasMatch())
-				{
-					aux_cmd.remove("IF EXISTS ");
-					obj_type=(aux_cmd.contains("COLUMN") ? ObjectType::Column : ObjectType::Constraint);
-					reg_aux.setPattern("(COLUMN|CONSTRAINT)( )+");
+			//Check if the keyword for the current object exists on string
+			reg_aux.setPattern(QString("(CREATE|DROP|ALTER)( )(%1)").arg(BaseObject::getSQLName(obj_tp)));
+			match = reg_aux.match(lin);
+
+			if(match.hasMatch())
+			{
+				is_create = lin.startsWith("CREATE");
+				is_drop = (!is_create && lin.startsWith("DROP"));
 
-					//Extracting the table name
-					pos = aux_cmd.indexOf(alter_tab) + alter_tab.size();
-					pos1 = aux_cmd.indexOf("ADD");
+				//Extracts from the line the string starting with the object's name
+				lin = lin.mid(match.capturedLength(), sql_cmd.indexOf('\n')).simplified();
 
-					if(pos1 < 0)
+				if(obj_tp != ObjectType::BaseObject)
+				{
+					if(obj_tp != ObjectType::Cast && obj_tp != ObjectType::UserMapping)
 					{
-						pos1=aux_cmd.indexOf("DROP");
-						is_drop=true;
-					}
+						match = name_rx.match(lin);
+						obj_name = lin.mid(match.capturedStart(), match.capturedLength());
 
-					tab_name=aux_cmd.mid(pos, pos1 - pos).simplified();
+						if(obj_tp != ObjectType::Function && obj_tp != ObjectType::Procedure)
+						{
+							obj_name = obj_name.remove('(').simplified();
+							obj_name = obj_name.remove(')').simplified();
+						}
 
-					//Extracting the child object name (column | constraint) the one between
-					match = reg_aux.match(aux_cmd, pos1);
-					pos = match.capturedStart();
-					pos += match.capturedLength();
+						if(obj_tp == ObjectType::Trigger || obj_tp == ObjectType::Index)
+						{
+							int on_idx = sql_cmd.indexOf("ON ") + 3,
+									lb_idx = sql_cmd.indexOf('\n', on_idx);
 
-					pos1=aux_cmd.indexOf(" ", pos);
-					obj_name=aux_cmd.mid(pos, pos1 - pos).simplified();
+							// Extracting the table name from command so it'll be prepended to object name
+							lin = sql_cmd.mid(on_idx, lb_idx - on_idx);
+							match = name_rx.match(lin);
+							obj_name.prepend(lin.mid(match.capturedStart(), match.capturedLength()) + '.');
+						}
+					}
+					else if(obj_tp == ObjectType::UserMapping)
+					{
+						obj_name.prepend(lin.remove("FOR").trimmed() + "@");
+					}
+					else
+					{
+						obj_name="cast" + lin.replace(" AS ",",");
+					}
 
-					//Creating a fully qualified name for the object (schema.table.name)
-					obj_name=tab_name + "." + obj_name;
+					//Stores the object type name
+					obj_tp_name = BaseObject::getTypeName(obj_tp);
+					obj_name.remove(';');
 
-					if(is_drop)
-						msg=tr("Dropping object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
+					if(is_create)
+						msg = tr("Creating object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
+					else if(is_drop)
+						msg = tr("Dropping object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
 					else
-						msg=tr("Creating object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
-
-					emit s_progressUpdated(aux_prog, msg, obj_type, sql_cmd);
-					is_drop=false;
+						msg = tr("Changing object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
 				}
-				//Check if the regex matches the sql command
-				else if(obj_reg.match(sql_cmd).hasMatch())
+				// If the type of the object being create can't be identified
+				else
 				{
-					//Get the fisrt line of the sql command, that contains the CREATE/DROP/ALTER ... statement
-					lin=sql_cmd.mid(0, sql_cmd.indexOf('\n'));
+					QString aux_cmd_type;
 
-					for(ObjectType obj_tp : obj_types)
-					{
-						if(export_canceled) break;
+					if(is_create)
+						aux_cmd_type = "CREATE";
+					else if(is_drop)
+						aux_cmd_type = "DROP";
+					else
+						aux_cmd_type = "ALTER";
 
-						obj_type=obj_tp;
+					msg=tr("Running auxiliary `%1' command...").arg(aux_cmd_type);
+				}
 
-						//Removing/replacing noisy keywords in order to extract more easily the object's name
-						if(lin.startsWith("CREATE") || lin.startsWith("ALTER"))
-						{
-							if(lin.contains("OR REPLACE"))
-							{
-								lin.remove("OR REPLACE");
-							}
-							else if(obj_tp == ObjectType::Index)
-							{
-								lin.remove("UNIQUE");
-								lin.remove("CONCURRENTLY");
-							}
-							else if(obj_tp == ObjectType::View)
-							{
-								lin.remove("MATERIALIZED");
-								lin.remove("RECURSIVE");
-							}
-							else if(obj_tp == ObjectType::Table)
-							{
-								lin.remove("UNLOGGED");
-							}
-							else if(obj_tp == ObjectType::Transform)
-							{
-								lin.remove(" FOR");
-								lin.replace(" LANGUAGE ", "_");
-								lin.replace(QRegularExpression("(TRANSFORM)(.)+(\\.)"), "TRANSFORM ");
-							}
-						}
-						else if(lin.startsWith("DROP"))
-						{
-							lin.remove("IF EXISTS");
-							lin.remove("MATERIALIZED");
-						}
+				break;
+			}
+		}
 
-						lin = lin.simplified();
+		msg_obj_type = obj_type;
+	}
+	else if(!sql_cmd.trimmed().isEmpty())
+	{
+		//General commands like grant, revoke or set aren't explicitly shown
+		msg = tr("Running auxiliary command.");
+		msg_obj_type = ObjectType::BaseObject;
+	}
 
-						//Check if the keyword for the current object exists on string
-						reg_aux.setPattern(QString("(CREATE|DROP|ALTER)( )(%1)").arg(BaseObject::getSQLName(obj_tp)));
-						match = reg_aux.match(lin);
+	return msg;
+}
 
-						if(match.hasMatch())
-						{
-							is_create = lin.startsWith("CREATE");
-							is_drop = (!is_create && lin.startsWith("DROP"));
+void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs, bool transactional)
+{
+	Connection aux_conn;
+	SqlScriptParser script_parser;
+	QString sql_cmd, failed_cmd, orig_conn_db_name, progress_msg;
+	std::vector<QString> db_sql_cmds;
+	std::vector<BatchCommand> batch_cmds;
+	ObjectType obj_type=ObjectType::BaseObject, msg_obj_type=ObjectType::BaseObject;
+	bool in_transaction = false, script_end = false,
+			pipelined = stmts_batch_size > 1 && Connection::isPipelineSupported();
+	unsigned aux_prog=0, buf_size=buffer.size(),
+			factor=(db_name.isEmpty() ? 70 : 90);
 
-							//Extracts from the line the string starting with the object's name
-							lin = lin.mid(match.capturedLength(), sql_cmd.indexOf('\n')).simplified();
+	/* Extract each SQL command from the buffer and execute them separately. This is done
+   to permit the user, in case of error, identify what object is wrongly configured.
+	 In pipelined mode the commands are still executed separately but sent to the server in batches */
+	script_parser.setParseDropCommands(drop_objs);
+	script_parser.loadBuffer(buffer);
 
-							if(obj_tp != ObjectType::BaseObject)
-							{
-								if(obj_tp != ObjectType::Cast && obj_tp != ObjectType::UserMapping)
-								{
-									match = name_rx.match(lin);
-									obj_name = lin.mid(match.capturedStart(), match.capturedLength());
-
-									if(obj_tp != ObjectType::Function && obj_tp != ObjectType::Procedure)
-									{
-										obj_name = obj_name.remove('(').simplified();
-										obj_name = obj_name.remove(')').simplified();
-									}
-
-									if(obj_tp == ObjectType::Trigger || obj_tp == ObjectType::Index)
-									{
-										int on_idx = sql_cmd.indexOf("ON ") + 3,
-												lb_idx = sql_cmd.indexOf('\n', on_idx);
-
-										// Extracting the table name from command so it'll be prepended to object name
-										lin = sql_cmd.mid(on_idx, lb_idx - on_idx);
-										match = name_rx.match(lin);
-										obj_name.prepend(lin.mid(match.capturedStart(), match.capturedLength()) + '.');
-									}
-								}
-								else if(obj_tp == ObjectType::UserMapping)
-								{
-									obj_name.prepend(lin.remove("FOR").trimmed() + "@");
-								}
-								else
-								{
-									obj_name="cast" + lin.replace(" AS ",",");
-								}
-
-								//Stores the object type name
-								obj_tp_name = BaseObject::getTypeName(obj_tp);
-								obj_name.remove(';');
-
-								if(is_create)
-									msg = tr("Creating object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
-								else if(is_drop)
-									msg = tr("Dropping object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
-								else
-									msg = tr("Changing object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
-							}
-							// If the type of the object being create can't be identified
-							else
-							{
-								QString aux_cmd_type;
+	if(!conn.isStablished())
+	{
+		orig_conn_db_name = conn.getConnectionParam(Connection::ParamDbName);
 
-								if(is_create)
-									aux_cmd_type = "CREATE";
-								else if(is_drop)
-									aux_cmd_type = "DROP";
-								else
-									aux_cmd_type = "ALTER";
+		if(!db_name.isEmpty())
+			conn.setConnectionParam(Connection::ParamDbName, db_name);
 
-								msg=tr("Running auxiliary `%1' command...").arg(aux_cmd_type);
-							}
+		conn.connect();
+	}
 
-							break;
-						}
-					}
+	while(!script_end && !export_canceled)
+	{
+		try
+		{
+			sql_cmd = script_parser.getNextCommand();
+			aux_prog = progress + ((script_parser.getCurrentPosition()/static_cast<double>(buf_size)) * factor);
 
-					emit s_progressUpdated(aux_prog, msg, obj_type, sql_cmd);
-					is_create=is_drop=false;
-					msg.clear();
-				}
-				else if(!sql_cmd.trimmed().isEmpty())
-				{
-					//General commands like grant, revoke or set aren't explicitly shown
-					emit s_progressUpdated(aux_prog, tr("Running auxiliary command."), ObjectType::BaseObject, sql_cmd);
-				}
+			if(!sql_cmd.isEmpty())
+			{
+				progress_msg = getCommandProgressMessage(sql_cmd, obj_type, msg_obj_type);
+
+				/* In pipelined mode the progress of the commands sent in batches is emitted
+				 * only when their results are retrieved (see executeCommandsBatch()) */
+				if(!progress_msg.isEmpty() && (!pipelined || obj_type == ObjectType::Database))
+					emit s_progressUpdated(aux_prog, progress_msg, msg_obj_type, sql_cmd);
+			}
 
-				//Executes the extracted SQL command
-				if(!sql_cmd.isEmpty() && !export_canceled)
+			//Executes the extracted SQL command
+			if(!sql_cmd.isEmpty() && !export_canceled)
+			{
+				if(obj_type != ObjectType::Database)
 				{
-					if(obj_type != ObjectType::Database)
+					if(transactional && !in_transaction)
 					{
-						if(transactional && !in_transaction)
-						{
-							emit s_progressUpdated(aux_prog, tr("Starting transaction."), ObjectType::BaseObject, "");
-							conn.executeDDLCommand("BEGIN");
-							in_transaction = true;
-						}
-
-						conn.executeDDLCommand(sql_cmd);
+						emit s_progressUpdated(aux_prog, tr("Starting transaction."), ObjectType::BaseObject, "");
+						conn.executeDDLCommand("BEGIN");
+						in_transaction = true;
 					}
+
+					if(pipelined)
+						batch_cmds.push_back({ sql_cmd, progress_msg, static_cast<int>(aux_prog), msg_obj_type });
 					else
-						//If it's a database level command (e.g. ALTER DATABASE ... RENAME TO ...)
-						db_sql_cmds.push_back(sql_cmd);
+						conn.executeDDLCommand(sql_cmd);
 				}
-
-				sql_cmd.clear();
-				ddl_tk_found=false;
+				else
+					//If it's a database level command (e.g. ALTER DATABASE ... RENAME TO ...)
+					db_sql_cmds.push_back(sql_cmd);
 			}
 
-			if(ts.atEnd() && in_transaction)
+			sql_cmd.clear();
+
+			//Sending the batch when it's full or when there are no more commands to be read
+			if(!batch_cmds.empty() && !export_canceled &&
+				 (batch_cmds.size() >= stmts_batch_size || !script_parser.hasNextCommand()))
+				executeCommandsBatch(conn, batch_cmds, in_transaction, failed_cmd);
+
+			if(!script_parser.hasNextCommand() && batch_cmds.empty())
 			{
-				if(export_canceled)
-				{
-					emit s_progressUpdated(aux_prog, tr("Rolling back changes."), ObjectType::BaseObject, "");
-					conn.executeDDLCommand("ROLLBACK");
-				}
-				else
+				script_end = true;
+
+				if(in_transaction)
 				{
-					emit s_progressUpdated(aux_prog, tr("Committing changes."), ObjectType::BaseObject, "");
-					conn.executeDDLCommand("COMMIT");
+					if(export_canceled)
+					{
+						emit s_progressUpdated(aux_prog, tr("Rolling back changes."), ObjectType::BaseObject, "");
+						conn.executeDDLCommand("ROLLBACK");
+					}
+					else
+					{
+						emit s_progressUpdated(aux_prog, tr("Committing changes."), ObjectType::BaseObject, "");
+						conn.executeDDLCommand("COMMIT");
+					}
 				}
-			}
 
-			//Executing the pending database level commands
-			if(ts.atEnd() && !db_sql_cmds.empty() && !export_canceled)
-			{
-				conn.close();
-				aux_conn=conn;
+				//Executing the pending database level commands
+				if(!db_sql_cmds.empty() && !export_canceled)
+				{
+					conn.close();
+					aux_conn=conn;
 
-				if(!orig_conn_db_name.isEmpty())
-					aux_conn.setConnectionParam(Connection::ParamDbName, orig_conn_db_name);
+					if(!orig_conn_db_name.isEmpty())
+						aux_conn.setConnectionParam(Connection::ParamDbName, orig_conn_db_name);
 
-				aux_conn.connect();
-				for(QString cmd : db_sql_cmds)
-					aux_conn.executeDDLCommand(cmd);
+					aux_conn.connect();
+					for(QString cmd : db_sql_cmds)
+						aux_conn.executeDDLCommand(cmd);
+				}
 			}
 		}
 		catch(Exception &e)
 		{
-			if(conn.isStablished() && in_transaction)
+			/* Errors raised by commands sent in batches don't abort the transaction since each command
+			 * runs under a savepoint, so the transaction is rolled back only if the error is not ignored */
+			if(conn.isStablished() && in_transaction &&
+				 (failed_cmd.isEmpty() || !isIgnoredError(e.getExtraInfo(), ignore_dup)))
 			{
 				try
 				{
@@ -1154,13 +1167,151 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 				}
 			}
 
-			if(ddl_tk_found) ddl_tk_found=false;
+			if(!failed_cmd.isEmpty())
+			{
+				sql_cmd = failed_cmd;
+				failed_cmd.clear();
+			}
+
 			handleSQLError(e, sql_cmd, ignore_dup);
 			sql_cmd.clear();
 		}
 	}
 }
 
+bool ModelExportHelper::isPipelinable(const QString &sql_cmd)
+{
+	/* Commands that can't run inside a transaction block, or whose effects can't be used
+	 * by the following commands of the same transaction (new enum values), are not pipelined */
+	static const QRegularExpression no_tx_cmd_reg("^(VACUUM|ALTER( )+SYSTEM|(CREATE|DROP)( )+(DATABASE|TABLESPACE))",
+																								QRegularExpression::DontCaptureOption | QRegularExpression::MultilineOption);
+
+	return !sql_cmd.contains("CONCURRENTLY") && !sql_cmd.contains("ADD VALUE") &&
+				 !no_tx_cmd_reg.match(sql_cmd).hasMatch() && !SqlScriptParser::hasMultipleCommands(sql_cmd);
+}
+
+void ModelExportHelper::executeCommandsBatch(Connection &conn, std::vector<BatchCommand> &batch_cmds, bool in_transaction, QString &failed_cmd)
+{
+	static const QString SavepointCmd { "SAVEPOINT pgmodeler_export" },
+			ReleaseCmd { "RELEASE SAVEPOINT pgmodeler_export" },
+			RollbackCmd { "ROLLBACK TO SAVEPOINT pgmodeler_export" };
+
+	ResultSet res;
+	unsigned cmd_idx = 0, cmd_count = 0;
+	bool begin_ok = false;
+
+	auto emit_progress = [this](const BatchCommand &batch_cmd) {
+		if(!batch_cmd.progress_msg.isEmpty())
+			emit s_progressUpdated(batch_cmd.progress, batch_cmd.progress_msg, batch_cmd.obj_type, batch_cmd.sql_cmd);
+	};
+
+	/* Executes a single command in the usual way. In transactional mode the command
+	 * runs under a savepoint as well so a failure doesn't abort the whole transaction */
+	auto exec_command = [&conn, in_transaction](const QString &sql_cmd) {
+		if(!in_transaction)
+		{
+			conn.executeDDLCommand(sql_cmd);
+			return;
+		}
+
+		conn.executeDDLCommand(SavepointCmd);
+
+		try
+		{
+			conn.executeDDLCommand(sql_cmd);
+			conn.executeDDLCommand(ReleaseCmd);
+		}
+		catch(Exception &e)
+		{
+			conn.executeDDLCommand(RollbackCmd);
+			conn.executeDDLCommand(ReleaseCmd);
+			throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, e.getExtraInfo());
+		}
+	};
+
+	failed_cmd.clear();
+
+	while(!batch_cmds.empty() && !export_canceled)
+	{
+		//Commands that can't be pipelined are executed in the usual way
+		if(!isPipelinable(batch_cmds.front().sql_cmd))
+		{
+			emit_progress(batch_cmds.front());
+			failed_cmd = batch_cmds.front().sql_cmd;
+			batch_cmds.erase(batch_cmds.begin());
+			exec_command(failed_cmd);
+			failed_cmd.clear();
+			continue;
+		}
+
+		/* Sending all the pipelinable commands at the beginning of the list at once.
+		 * Each command is preceded by a savepoint so when one of them fails the ones
+		 * that succeeded are preserved and the remaining ones can be sent again */
+		cmd_idx = cmd_count = 0;
+		begin_ok = in_transaction;
+
+		if(!in_transaction)
+			conn.sendDMLCommand("BEGIN");
+
+		while(cmd_count < batch_cmds.size() && isPipelinable(batch_cmds[cmd_count].sql_cmd))
+		{
+			conn.sendDMLCommand(SavepointCmd);
+			conn.sendDMLCommand(batch_cmds[cmd_count].sql_cmd);
+			conn.sendDMLCommand(ReleaseCmd);
+			cmd_count++;
+		}
+
+		if(!in_transaction)
+			conn.sendDMLCommand("COMMIT");
+
+		try
+		{
+			//Retrieving the results in the same order the commands were sent
+			if(!in_transaction)
+			{
+				conn.getNextResult(res);
+				begin_ok = true;
+			}
+
+			for(cmd_idx = 0; cmd_idx < cmd_count; cmd_idx++)
+			{
+				for(unsigned i = 0; i < 3; i++)
+					conn.getNextResult(res);
+
+				//The progress is reported only after the server has executed the command
+				emit_progress(batch_cmds[cmd_idx]);
+			}
+
+			if(!in_transaction)
+				conn.getNextResult(res);
+
+			batch_cmds.erase(batch_cmds.begin(), batch_cmds.begin() + cmd_count);
+		}
+		catch(Exception &e)
+		{
+			// Errors not related to a specific command (BEGIN/COMMIT) discard the whole batch
+			if(!begin_ok || cmd_idx >= cmd_count)
+			{
+				batch_cmds.erase(batch_cmds.begin(), batch_cmds.begin() + cmd_count);
+				throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, e.getExtraInfo());
+			}
+
+			emit_progress(batch_cmds[cmd_idx]);
+			failed_cmd = batch_cmds[cmd_idx].sql_cmd;
+			batch_cmds.erase(batch_cmds.begin(), batch_cmds.begin() + cmd_idx + 1);
+
+			//Undoing only the failed command, keeping the ones executed before it
+			conn.executeDDLCommand(RollbackCmd);
+			conn.executeDDLCommand(ReleaseCmd);
+
+			if(!in_transaction)
+				conn.executeDDLCommand("COMMIT");
+
+			throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, e.getExtraInfo());
+		}
+	}
+}
+
 void ModelExportHelper::updateProgress(int prog, QString object_id, unsigned obj_type)
 {
 	int aux_prog = progress + (prog/progress);
@@ -32,6 +32,14 @@ class __libgui ModelExportHelper: public QObject {
 	Q_OBJECT
 
 	private:
+		/*! \brief Stores a command to be sent in a pipeline (see executeCommandsBatch()) as well as the progress
+		 *  information that is emitted only when the command's result is retrieved from the server */
+		struct BatchCommand {
+			QString sql_cmd, progress_msg;
+			int progress;
+			ObjectType obj_type;
+		};
+
 		//! \brief  Stores the total progress
 		int progress,
 
@@ -111,6 +119,10 @@ class __libgui ModelExportHelper: public QObject {
 		//! \brief List of ignored error codes
 		QStringList ignored_errors;
 
+		/*! \brief Amount of commands sent at once to the server when exporting a buffer to the DBMS.
+		 *  Values greater than 1 enable the pipelined mode (see executeCommandsBatch()) */
+		unsigned stmts_batch_size;
+
 		std::vector<Exception> errors;
 
 		/*! \brief Indicates which role / tablespaces were created on server (only dbms export).
@@ -151,9 +163,29 @@ class __libgui ModelExportHelper: public QObject {
 		//! \brief Exports the contents of the buffer to a previously opened connection
 		void exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs=false, bool transactional = false);
 
+		/*! \brief Returns the progress message describing the object being handled by the command or an empty
+		 *  string when there's nothing to be reported. The obj_type parameter receives the type of the object,
+		 *  keeping its current value when the command doesn't create, change or drop a known object (e.g. GRANT, COMMENT).
+		 *  The msg_obj_type parameter receives the type of object to be used in the progress signal */
+		QString getCommandProgressMessage(const QString &sql_cmd, ObjectType &obj_type, ObjectType &msg_obj_type);
+
+		/*! \brief Executes the commands sending them to the server in a single pipeline. Each command runs under
+		 *  a savepoint so, when one of them fails, the previous ones are kept and only the failed one is undone.
+		 *  In that case, the failed command is stored in failed_cmd, the remaining ones are kept in batch_cmds and
+		 *  the error is raised. When not in a transaction the batch is wrapped by its own transaction block.
+		 *  The progress of each command is emitted when its result is retrieved */
+		void executeCommandsBatch(Connection &conn, std::vector<BatchCommand> &batch_cmds, bool in_transaction, QString &failed_cmd);
+
+		/*! \brief Returns if the command can be sent to the server in a pipeline inside a transaction block.
+		 *  Commands holding multiple statements are never pipelined since the server rejects them in pipeline mode */
+		static bool isPipelinable(const QString &sql_cmd);
+
 		//! \brief Returns if the error code is one of the treated by the export process as object duplication error
 		bool isDuplicationError(const QString &error_code);
 
+		//! \brief Returns if the error code is ignored by the export process (see setIgnoredErrors())
+		bool isIgnoredError(const QString &error_code, bool ignore_dup);
+
 		//! \brief Restore the export parameters to their default values
 		void resetExportParams();
 
@@ -176,6 +208,11 @@ class __libgui ModelExportHelper: public QObject {
 		Error catalog is available at: postgresql.org/docs/current/static/errcodes-appendix.html */
 		void setIgnoredErrors(const QStringList &err_codes);
 
+		/*! \brief Defines the amount of commands sent at once to the server when exporting to the DBMS.
+		 *  When the value is greater than 1 and libpq supports pipeline mode the commands are sent in
+		 *  batches avoiding one network round trip per command. Errors are still reported per command */
+		void setStatementsBatchSize(unsigned batch_size);
+
 		//! \brief Exports the model to a named SQL file. The PostgreSQL version syntax must be specified.
 		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool gen_drop_file);
 
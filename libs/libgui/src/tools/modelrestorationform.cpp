@@ -19,8 +19,11 @@
 #include "modelrestorationform.h"
 #include "utilsns.h"
 #include "globalattributes.h"
+#include "modeljournal.h"
+#include "messagebox.h"
 #include <QDir>
 #include <QFileInfo>
+#include <algorithm>
 
 ModelRestorationForm::ModelRestorationForm(QWidget *parent, Qt::WindowFlags f) : QDialog(parent, f)
 {
@@ -31,8 +34,50 @@ ModelRestorationForm::ModelRestorationForm(QWidget *parent, Qt::WindowFlags f) :
 	connect(tmp_files_tbw, &QTableWidget::itemSelectionChanged, this, &ModelRestorationForm::enableRestoration);
 }
 
+void ModelRestorationForm::replayJournals()
+{
+	QStringList journals = QDir(GlobalAttributes::getTemporaryPath(),
+															"*" + ModelJournal::getJournalFilename(GlobalAttributes::DbModelExt),
+															QDir::Name, QDir::Files | QDir::NoDotAndDotDot).entryList();
+	QString tmp_model, model_def, journal_file;
+	QFileInfo model_fi;
+
+	for(auto &journal : journals)
+	{
+		tmp_model = journal.chopped(ModelJournal::getJournalFilename("").size());
+		journal_file = GlobalAttributes::getTemporaryFilePath(journal);
+
+		// Journals of models opened in other running instances are not touched
+		if(ignored_files.contains(tmp_model) || ModelJournal::isInUse(journal_file))
+			continue;
+
+		// The journal was already replayed into the temporary model
+		model_fi.setFile(GlobalAttributes::getTemporaryFilePath(tmp_model));
+
+		if(model_fi.exists() && model_fi.lastModified() >= QFileInfo(journal_file).lastModified())
+			continue;
+
+		try
+		{
+			model_def = ModelJournal::replay(journal_file);
+
+			/* The journal is kept until the user restores or discards the temporary
+			 * model (see removeTemporaryModel()). Journals without a complete snapshot
+			 * don't produce any model code, so they're left untouched */
+			if(!model_def.isEmpty())
+				UtilsNs::saveFile(model_fi.absoluteFilePath(), model_def.toUtf8());
+		}
+		catch(Exception &e)
+		{
+			Messagebox::error(e, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+		}
+	}
+}
+
 QStringList ModelRestorationForm::getTemporaryModels()
 {
+	replayJournals();
+
 	//Returns if there is some .dbm file on the tmp dir
 	QStringList list = QDir(GlobalAttributes::getTemporaryPath(),
 													"*" + GlobalAttributes::DbModelExt,
@@ -41,6 +86,11 @@ QStringList ModelRestorationForm::getTemporaryModels()
 	for(auto &file : ignored_files)
 		list.removeAll(file);
 
+	// Models opened in other running instances can't be restored
+	list.removeIf([](const QString &file) {
+		return ModelJournal::isInUse(GlobalAttributes::getTemporaryFilePath(ModelJournal::getJournalFilename(file)));
+	});
+
 	return list;
 }
 
@@ -110,10 +160,27 @@ void ModelRestorationForm::removeTemporaryFiles()
 {
 	QDir tmp_file;
 	QStringList tmp_files = QDir(GlobalAttributes::getTemporaryPath(), "*",
-															 QDir::Name, QDir::Files | QDir::NoDotAndDotDot).entryList();
+															 QDir::Name, QDir::Files | QDir::NoDotAndDotDot).entryList(),
+			in_use_files;
 
+	/* The temporary models (and their journals) of other running instances are preserved.
+	 * The journal of each of them is matched by its name prefix */
 	for(auto &file : tmp_files)
+	{
+		if(file.endsWith(ModelJournal::getJournalFilename(GlobalAttributes::DbModelExt)) &&
+			 ModelJournal::isInUse(GlobalAttributes::getTemporaryFilePath(file)))
+			in_use_files.append(file.chopped(ModelJournal::getJournalFilename("").size()));
+	}
+
+	for(auto &file : tmp_files)
+	{
+		if(std::any_of(in_use_files.begin(), in_use_files.end(), [&file](const QString &model_file) {
+				 return file.startsWith(model_file);
+			 }))
+			continue;
+
 		tmp_file.remove(GlobalAttributes::getTemporaryFilePath(file));
+	}
 }
 
 void ModelRestorationForm::removeTemporaryModels()
@@ -122,7 +189,10 @@ void ModelRestorationForm::removeTemporaryModels()
 	QDir tmp_file;
 
 	for(auto &file : file_list)
+	{
 		tmp_file.remove(GlobalAttributes::getTemporaryFilePath(file));
+		tmp_file.remove(GlobalAttributes::getTemporaryFilePath(ModelJournal::getJournalFilename(file)));
+	}
 }
 
 void ModelRestorationForm::removeTemporaryModel(const QString &tmp_model)
@@ -130,6 +200,7 @@ void ModelRestorationForm::removeTemporaryModel(const QString &tmp_model)
 	QDir tmp_file;
 	QString file=QFileInfo(tmp_model).fileName();
 	tmp_file.remove(GlobalAttributes::getTemporaryFilePath(file));
+	tmp_file.remove(GlobalAttributes::getTemporaryFilePath(ModelJournal::getJournalFilename(file)));
 }
 
 void ModelRestorationForm::enableRestoration()
@@ -34,6 +34,12 @@ class __libgui ModelRestorationForm: public QDialog, public Ui::ModelRestoration
 	private:
 		QStringList ignored_files;
 
+		/*! \brief Replays the journals found in the tmp/ dir writing the resulting code in their
+		 *  respective temporary models. Journals of ignored files, journals locked by other running
+		 *  instances and journals older than their temporary models are not replayed. The journals are
+		 *  kept until the temporary models are restored or discarded */
+		void replayJournals();
+
 	public:
 		ModelRestorationForm(QWidget * parent = nullptr, Qt::WindowFlags f = Qt::Widget);
 
@@ -55,7 +61,7 @@ class __libgui ModelRestorationForm: public QDialog, public Ui::ModelRestoration
 		//! \brief Clears the tmp/ dir removing all temporary models (*.dbm)
 		void removeTemporaryModels();
 
-		//! \brief Remove only the specified temp model
+		//! \brief Remove only the specified temp model (and its journal)
 		void removeTemporaryModel(const QString &tmp_model);
 
 		//! \brief Checks if there is at least one temporary file on tmp/ dir
@@ -18,6 +18,7 @@
 
 #include "modelsdiffhelper.h"
 #include <QThread>
+#include <QThreadPool>
 #include "utilsns.h"
 #include <QDate>
 #include "connection.h"
@@ -44,6 +45,7 @@ const QStringList	ModelsDiffHelper::ObjectsIgnoredTags {
 ModelsDiffHelper::ModelsDiffHelper()
 {
 	diff_canceled=false;
+	parallel_jobs=1;
 	pgsql_version=PgSqlVersions::DefaulVersion;
 	source_model=imported_model=nullptr;
 	resetDiffCounter();
@@ -67,7 +69,7 @@ ModelsDiffHelper::~ModelsDiffHelper()
 void ModelsDiffHelper::setDiffOption(DiffOptions opt_id, bool value)
 {
 	if(opt_id > OptDropMissingColsConstr)
-		throw Exception(ErrorCode::RefElementInvalidIndex,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex,__exc_origin);
 
 	if(opt_id == OptDropMissingColsConstr)
 		diff_opts[opt_id]=value & !diff_opts[OptDropMissingColsConstr];
@@ -88,7 +90,7 @@ void ModelsDiffHelper::setForcedRecreateTypeNames(const QStringList &forced_rec_
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -113,7 +115,7 @@ void ModelsDiffHelper::setForcedRecreateTypes(const std::vector<ObjectType> &for
 			if(type == ObjectType::BaseObject)
 				type_name = QString::number(enum_t(type)) + " " + tr("(unrecognized id)");
 
-			throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr,
+			throw Exception(ErrorCode::OprObjectInvalidType,__exc_origin, nullptr,
 											tr("Object type id: %1").arg(type_name));
 		}
 	}
@@ -133,6 +135,16 @@ void ModelsDiffHelper::setPgSQLVersion(const QString pgsql_ver)
 	this->pgsql_version=pgsql_ver;
 }
 
+void ModelsDiffHelper::setParallelJobs(unsigned jobs)
+{
+	parallel_jobs=jobs;
+}
+
+unsigned ModelsDiffHelper::getParallelJobs()
+{
+	return parallel_jobs;
+}
+
 void ModelsDiffHelper::resetDiffCounter()
 {  
 	diffs_counter[ObjectsDiffInfo::AlterObject]=0;
@@ -277,7 +289,7 @@ QStringList ModelsDiffHelper::getRelationshipFilters(const std::vector<BaseObjec
 unsigned ModelsDiffHelper::getDiffTypeCount(ObjectsDiffInfo::DiffType diff_type)
 {
 	if(diff_type >= ObjectsDiffInfo::NoDifference)
-		throw Exception(ErrorCode::RefElementInvalidIndex ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::RefElementInvalidIndex ,__exc_origin);
 
 	return diffs_counter[diff_type];
 }
@@ -287,7 +299,7 @@ void ModelsDiffHelper::diffModels()
 	try
 	{
 		if(!source_model || !imported_model)
-			throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::OprNotAllocatedObject ,__exc_origin);
 
 		//First, we need to detect the objects to be dropped
 		diffModels(ObjectsDiffInfo::DropObject);
@@ -304,7 +316,7 @@ void ModelsDiffHelper::diffModels()
 	}
 	catch(Exception &e)
 	{
-		emit s_diffAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo()));
+		emit s_diffAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e, e.getExtraInfo()));
 	}
 
 	destroyTempObjects();
@@ -347,7 +359,7 @@ void ModelsDiffHelper::diffColsInheritance(PhysicalTable *parent_tab, PhysicalTa
 	}
 }
 
-void ModelsDiffHelper::diffTables(PhysicalTable *src_table, PhysicalTable *imp_table, ObjectsDiffInfo::DiffType diff_type)
+void ModelsDiffHelper::diffTables(PhysicalTable *src_table, PhysicalTable *imp_table, ObjectsDiffInfo::DiffType diff_type, std::vector<PendingDiffInfo> &infos)
 {
 	ObjectType types[2]={ ObjectType::Column, ObjectType::Constraint };
 	std::vector<TableObject *> *tab_objs=nullptr;
@@ -384,7 +396,7 @@ void ModelsDiffHelper::diffTables(PhysicalTable *src_table, PhysicalTable *imp_t
 				 (constr && constr->isAddedByGeneralization() &&
 					constr->getConstraintType()==ConstraintType::Check))
 			{
-				generateDiffInfo(ObjectsDiffInfo::IgnoreObject, tab_obj);
+				infos.push_back({ ObjectsDiffInfo::IgnoreObject, tab_obj, nullptr });
 			}
 			else
 			{
@@ -399,7 +411,7 @@ void ModelsDiffHelper::diffTables(PhysicalTable *src_table, PhysicalTable *imp_t
 				{
 					//If there are some differences on the XML code of the objects
 					if(tab_obj->isCodeDiffersFrom(aux_obj, TableObjsIgnoredAttribs))
-						generateDiffInfo(ObjectsDiffInfo::AlterObject, tab_obj, aux_obj);
+						infos.push_back({ ObjectsDiffInfo::AlterObject, tab_obj, aux_obj });
 
 				}
 				/*	If the object does not exists it will generate a drop info and the original
@@ -409,9 +421,9 @@ void ModelsDiffHelper::diffTables(PhysicalTable *src_table, PhysicalTable *imp_t
 					if(diff_type!=ObjectsDiffInfo::DropObject ||
 						 (diff_type==ObjectsDiffInfo::DropObject && !diff_opts[OptDontDropMissingObjs]) ||
 						 (diff_type==ObjectsDiffInfo::DropObject && diff_opts[OptDropMissingColsConstr]))
-						generateDiffInfo(diff_type, tab_obj);
+						infos.push_back({ diff_type, tab_obj, nullptr });
 					else
-						generateDiffInfo(ObjectsDiffInfo::IgnoreObject, tab_obj);
+						infos.push_back({ ObjectsDiffInfo::IgnoreObject, tab_obj, nullptr });
 				}
 			}
 
@@ -429,12 +441,14 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 	try
 	{
 		std::map<unsigned, BaseObject *> obj_order;
-		BaseObject *object=nullptr, *aux_object=nullptr;
+		std::vector<BaseObject *> objects;
+		std::vector<char> processed;
+		std::vector<ObjectComparison> comparisons;
+		std::map<BaseObject *, std::vector<unsigned>> schema_objs;
+		BaseObject *object=nullptr, *schema=nullptr;
 		ObjectType obj_type;
-		QString obj_name;
-		unsigned idx=0, factor=0, prog=0;
+		unsigned factor=0, prog=0;
 		DatabaseModel *aux_model=nullptr;
-		bool objs_differs=false, xml_differs=false;
 
 		if(diff_type == ObjectsDiffInfo::DropObject)
 		{
@@ -463,215 +477,441 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 		{
 			object = obj_itr.second;
 			obj_type = object->getObjectType();
-			idx++;
+			objects.push_back(object);
 
 			/* If this checking the following objects are discarded:
 			 * 1) ObjectType::ObjBaseRelationship objects
 			 * 2) Objects which SQL code is disabled or system objects
 			 * 3) Cluster objects such as roles and tablespaces (when the operatoin is DROP and keep_cluster_objs is true) */
-			if(obj_type != ObjectType::BaseRelationship &&
-					!object->isSystemObject() && !object->isSQLDisabled() &&
+			processed.push_back(obj_type != ObjectType::BaseRelationship &&
+													!object->isSystemObject() && !object->isSQLDisabled() &&
 
-				 ((diff_type == ObjectsDiffInfo::DropObject &&
-						(!diff_opts[OptKeepClusterObjs] ||
-						 (diff_opts[OptKeepClusterObjs] && obj_type != ObjectType::Role && obj_type != ObjectType::Tablespace))) ||
+													((diff_type == ObjectsDiffInfo::DropObject &&
+														(!diff_opts[OptKeepClusterObjs] ||
+														 (diff_opts[OptKeepClusterObjs] && obj_type != ObjectType::Role && obj_type != ObjectType::Tablespace))) ||
 
-					 (diff_type != ObjectsDiffInfo::DropObject)))
+													 (diff_type != ObjectsDiffInfo::DropObject)));
+		}
+
+		comparisons.resize(objects.size());
+
+		/* In the DROP detection the objects are only searched in the source model
+		 * so there's nothing worth to be compared in separated threads */
+		if(parallel_jobs > 1 && diff_type != ObjectsDiffInfo::DropObject)
+		{
+			cacheObjectsCode(source_model);
+			cacheObjectsCode(imported_model);
+
+			/* Grouping the objects by schema (table children are grouped with their parent tables) so
+			 * an object and its children are always compared by the same thread. Permissions, relationships
+			 * and the database itself are processed further by this thread */
+			for(unsigned pos = 0; pos < objects.size(); pos++)
 			{
-				emit s_progressUpdated(prog + ((idx/static_cast<double>(obj_order.size())) * factor),
-															 tr("Processing object `%1' (%2)...").arg(object->getSignature()).arg(object->getTypeName()),
-															 object->getObjectType());
+				object = objects[pos];
+				obj_type = object->getObjectType();
 
-				//Processing objects that are not database, table child object (they are processed further)
-				if(obj_type != ObjectType::Database && !TableObject::isTableObject(obj_type))
-				{
-					/* Processing permissions. If the operation is DROP and keep_obj_perms is true the
-					 * the permission is ignored */
-					if(obj_type == ObjectType::Permission &&
+				if(!processed[pos] || obj_type == ObjectType::Database ||
+					 obj_type == ObjectType::Permission || obj_type == ObjectType::Relationship ||
+					 !isParallelComparable(object))
+					continue;
 
-							((diff_type == ObjectsDiffInfo::DropObject &&
-								!diff_opts[OptKeepObjectPerms]) ||
+				BaseObject *aux_object = getComparedObject(object, diff_type, aux_model);
 
-							 (diff_type == ObjectsDiffInfo::CreateObject &&
-								(aux_model->getPermissionIndex(dynamic_cast<Permission *>(object), true) < 0 ||
-								 !diff_opts[OptKeepObjectPerms]))))
-					{
-						generateDiffInfo(diff_type, object);
-					}
-					//Processing relationship (in this case only generalization and patitioning ones are considered)
-					else if(obj_type==ObjectType::Relationship)
-					{
-						PhysicalTable *ref_tab=nullptr, *rec_tab=nullptr;
-						Relationship *rel=dynamic_cast<Relationship *>(object);
+				if(aux_object && !isParallelComparable(aux_object))
+					continue;
 
-						rec_tab=dynamic_cast<PhysicalTable *>(aux_model->getObject(rel->getReceiverTable()->getName(true),
-																																				{ObjectType::Table, ObjectType::ForeignTable}));
+				if(obj_type == ObjectType::Schema)
+					schema = object;
+				else if(TableObject::isTableObject(obj_type))
+					schema = dynamic_cast<TableObject *>(object)->getParentTable()->getSchema();
+				else
+					schema = object->getSchema();
 
-						if(rel->getRelationshipType()==BaseRelationship::RelationshipGen ||
-							 rel->getRelationshipType()==BaseRelationship::RelationshipPart)
-						{
-							Relationship *aux_rel = nullptr;
+				schema_objs[schema].push_back(pos);
+			}
+		}
 
-							ref_tab = dynamic_cast<PhysicalTable *>(aux_model->getObject(rel->getReferenceTable()->getName(true), {ObjectType::Table, ObjectType::ForeignTable}));
-							aux_rel = dynamic_cast<Relationship *>(aux_model->getRelationship(ref_tab, rec_tab));
+		if(!schema_objs.empty())
+		{
+			/* The thread pool is declared after the data structures used by the workers,
+			 * so in case of errors it's destroyed first waiting for the running tasks */
+			QThreadPool thread_pool;
 
-							/* If the receiver table exists on the model generates a info for the relationship,
-									otherwise, the generalization will be created automatically when the table is
-									created (see table's code defintion) */
-							if(rec_tab && !aux_rel)
-							{
-								diffColsInheritance(ref_tab, rec_tab);
-								generateDiffInfo(diff_type, rel);
-							}
-							/* Special case for partitioning: we detach (drop) and reattach (create) the partition
-							 * if the partition bound expression differs from a model to another. This is done only
-							 * if the receiver table (partition) exists in the imported model. */
-							else if(rel->getRelationshipType()==BaseRelationship::RelationshipPart &&
-											rec_tab &&
-											aux_model == imported_model &&
-											aux_rel && rel->getPartitionBoundingExpr().simplified() !=
-											aux_rel->getPartitionBoundingExpr().simplified())
-							{
-								generateDiffInfo(ObjectsDiffInfo::DropObject, rel);
-								generateDiffInfo(ObjectsDiffInfo::CreateObject, rel);
-							}
+			emit s_progressUpdated(prog, tr("Comparing the objects using %1 parallel jobs...").arg(parallel_jobs));
+			thread_pool.setMaxThreadCount(parallel_jobs);
+
+			for(auto &itr : schema_objs)
+			{
+				std::vector<unsigned> *positions = &itr.second;
+
+				thread_pool.start([this, positions, diff_type, aux_model, &objects, &comparisons](){
+					for(auto &pos : *positions)
+					{
+						if(diff_canceled)
+							break;
+
+						try
+						{
+							diffObject(objects[pos], getComparedObject(objects[pos], diff_type, aux_model),
+												 diff_type, comparisons[pos].infos);
+							comparisons[pos].compared = true;
+						}
+						catch(Exception &e)
+						{
+							comparisons[pos].error = e;
+							comparisons[pos].failed = true;
+							break;
 						}
 					}
-					else if(obj_type != ObjectType::Permission)
-					{
-						//Get the object from the database
-						obj_name = object->getSignature();
-						aux_object = aux_model->getObject(obj_name, obj_type);
+				});
+			}
 
-						//Special case for many-to-many relationships
-						if(obj_type == ObjectType::Table && !aux_object)
-							aux_object = getRelNNTable(obj_name, aux_model);
+			thread_pool.waitForDone();
+		}
 
-						if(diff_type != ObjectsDiffInfo::DropObject && aux_object)
-						{
-							/* Try to get a diff from the retrieve object and the current object,
-							 * comparing only basic attributes like schema, tablespace and owner
-							 * this is why the BaseObject::getAlterCode is called */
-							objs_differs = !aux_object->BaseObject::getAlterCode(object).isEmpty();
+		/* The diff infos are generated in the creation order by this thread only, so the
+		 * resulting diff is the same regardless the objects were compared in parallel or not */
+		for(unsigned pos = 0; pos < objects.size(); pos++)
+		{
+			object = objects[pos];
+			obj_type = object->getObjectType();
 
-							//If the objects does not differ, try to compare their XML definition
-							if(!objs_differs)
-							{
-								xml_differs = object->isCodeDiffersFrom(aux_object,	ObjectsIgnoredAttribs,
-																												obj_type != ObjectType::Role ? ObjectsIgnoredTags : RolesIgnoredTags);
-							}
+			if(processed[pos])
+			{
+				emit s_progressUpdated(prog + (((pos + 1)/static_cast<double>(objects.size())) * factor),
+															 tr("Processing object `%1' (%2)...").arg(object->getSignature()).arg(object->getTypeName()),
+															 object->getObjectType());
 
-							//If a difference was detected between the objects
-							if(objs_differs || xml_differs)
-							{
-								generateDiffInfo(ObjectsDiffInfo::AlterObject, object, aux_object);
+				/* Processing permissions. If the operation is DROP and keep_obj_perms is true the
+				 * the permission is ignored */
+				if(obj_type == ObjectType::Permission)
+				{
+					if((diff_type == ObjectsDiffInfo::DropObject &&
+							!diff_opts[OptKeepObjectPerms]) ||
 
-								//If the object is a table, do additional comparision between their child objects
-								if(!isForcedRecreateType(object->getObjectType()) &&
-									 PhysicalTable::isPhysicalTable(object->getObjectType()))
-								{
-									PhysicalTable *tab=dynamic_cast<PhysicalTable *>(object),
-											*aux_tab=dynamic_cast<PhysicalTable *>(aux_object);
+						 (diff_type == ObjectsDiffInfo::CreateObject &&
+							(aux_model->getPermissionIndex(dynamic_cast<Permission *>(object), true) < 0 ||
+							 !diff_opts[OptKeepObjectPerms])))
+					{
+						generateDiffInfo(diff_type, object);
+					}
+				}
+				//Processing relationship (in this case only generalization and patitioning ones are considered)
+				else if(obj_type==ObjectType::Relationship)
+				{
+					PhysicalTable *ref_tab=nullptr, *rec_tab=nullptr;
+					Relationship *rel=dynamic_cast<Relationship *>(object);
 
-									diffTables(tab, aux_tab, ObjectsDiffInfo::DropObject);
-									diffTables(tab, aux_tab, ObjectsDiffInfo::CreateObject);
-								}
+					rec_tab=dynamic_cast<PhysicalTable *>(aux_model->getObject(rel->getReceiverTable()->getName(true),
+																																			{ObjectType::Table, ObjectType::ForeignTable}));
 
-								objs_differs=xml_differs=false;
-							}
+					if(rel->getRelationshipType()==BaseRelationship::RelationshipGen ||
+						 rel->getRelationshipType()==BaseRelationship::RelationshipPart)
+					{
+						Relationship *aux_rel = nullptr;
+
+						ref_tab = dynamic_cast<PhysicalTable *>(aux_model->getObject(rel->getReferenceTable()->getName(true), {ObjectType::Table, ObjectType::ForeignTable}));
+						aux_rel = dynamic_cast<Relationship *>(aux_model->getRelationship(ref_tab, rec_tab));
+
+						/* If the receiver table exists on the model generates a info for the relationship,
+								otherwise, the generalization will be created automatically when the table is
+								created (see table's code defintion) */
+						if(rec_tab && !aux_rel)
+						{
+							diffColsInheritance(ref_tab, rec_tab);
+							generateDiffInfo(diff_type, rel);
 						}
-						else if(!aux_object)
+						/* Special case for partitioning: we detach (drop) and reattach (create) the partition
+						 * if the partition bound expression differs from a model to another. This is done only
+						 * if the receiver table (partition) exists in the imported model. */
+						else if(rel->getRelationshipType()==BaseRelationship::RelationshipPart &&
+										rec_tab &&
+										aux_model == imported_model &&
+										aux_rel && rel->getPartitionBoundingExpr().simplified() !=
+										aux_rel->getPartitionBoundingExpr().simplified())
 						{
-							if(diff_type != ObjectsDiffInfo::DropObject ||
-								 (diff_type == ObjectsDiffInfo::DropObject && !diff_opts[OptDontDropMissingObjs]))
-								generateDiffInfo(diff_type, object);
-							else
-								generateDiffInfo(ObjectsDiffInfo::IgnoreObject, object);
+							generateDiffInfo(ObjectsDiffInfo::DropObject, rel);
+							generateDiffInfo(ObjectsDiffInfo::CreateObject, rel);
 						}
 					}
 				}
-				//Comparison for constraints (fks), triggers, rules, indexes
-				else if(TableObject::isTableObject(obj_type))
-					diffTableObject(dynamic_cast<TableObject *>(object), diff_type);
 				//Comparison between model db and the imported db
-				else if(diff_type == ObjectsDiffInfo::CreateObject)
+				else if(obj_type == ObjectType::Database)
 				{
-					if(!source_model->getAlterCode(imported_model).isEmpty())
+					if(diff_type == ObjectsDiffInfo::CreateObject &&
+						 !source_model->getAlterCode(imported_model).isEmpty())
 						generateDiffInfo(ObjectsDiffInfo::AlterObject, source_model, imported_model);
 				}
+				else
+				{
+					ObjectComparison &cmp = comparisons[pos];
+
+					if(cmp.failed)
+						throw Exception(cmp.error.getErrorMessage(), cmp.error.getErrorCode(), __exc_origin, &cmp.error);
 
-				if(diff_canceled)
-					break;
+					//Objects that weren't compared in parallel are compared right here
+					if(!cmp.compared)
+						diffObject(object, getComparedObject(object, diff_type, aux_model), diff_type, cmp.infos);
+
+					for(auto &info : cmp.infos)
+						generateDiffInfo(info.diff_type, info.object, info.old_object);
+				}
 			}
 			else
 			{
 				generateDiffInfo(ObjectsDiffInfo::IgnoreObject, object);
 
-				emit s_progressUpdated(prog + ((idx/static_cast<double>(obj_order.size())) * factor),
+				emit s_progressUpdated(prog + (((pos + 1)/static_cast<double>(objects.size())) * factor),
 															 tr("Skipping object `%1' (%2)...").arg(object->getSignature(), object->getTypeName()),
 															 object->getObjectType());
-
-				if(diff_canceled)
-					break;
 			}
+
+			if(diff_canceled)
+				break;
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
-void ModelsDiffHelper::diffTableObject(TableObject *tab_obj, ObjectsDiffInfo::DiffType diff_type)
+BaseObject *ModelsDiffHelper::getComparedObject(BaseObject *object, ObjectsDiffInfo::DiffType diff_type, DatabaseModel *aux_model)
 {
-	BaseTable *base_tab=nullptr, *aux_base_tab=nullptr;
-	ObjectType obj_type=tab_obj->getObjectType();
-	QString tab_name, obj_name=tab_obj->getName(true);
-	BaseObject *aux_tab_obj=nullptr;
+	ObjectType obj_type = object->getObjectType();
+	BaseObject *aux_object = nullptr;
 
-	//Get the parent table of the object
-	base_tab=tab_obj->getParentTable();
-	tab_name=base_tab->getSignature();
-
-	//If the operation is a DROP, try to get the table from the source mode
-	if(diff_type==ObjectsDiffInfo::DropObject)
+	if(TableObject::isTableObject(obj_type))
 	{
-		aux_base_tab=dynamic_cast<BaseTable *>(source_model->getObject(tab_name, base_tab->getObjectType()));
+		TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+		BaseTable *base_tab = tab_obj->getParentTable(), *aux_base_tab = nullptr;
+		QString tab_name = base_tab->getSignature(), obj_name = tab_obj->getName(true);
+
+		//Get the parent table of the object from the other model
+		aux_base_tab = dynamic_cast<BaseTable *>(aux_model->getObject(tab_name, base_tab->getObjectType()));
 
 		//If the table was not found, try to find it between the many-to-many relationships
 		if(!aux_base_tab)
-			aux_base_tab=dynamic_cast<BaseTable *>(getRelNNTable(tab_name, source_model));
+		{
+			aux_base_tab = dynamic_cast<BaseTable *>(getRelNNTable(diff_type == ObjectsDiffInfo::DropObject ? tab_name : obj_name,
+																																aux_model));
+		}
+
+		if(aux_base_tab)
+		{
+			if(obj_type == ObjectType::Constraint)
+			{
+				PhysicalTable *aux_table = dynamic_cast<PhysicalTable *>(aux_base_tab);
+				aux_object = aux_table->getObject(obj_name, obj_type);
+			}
+			else
+				aux_object = aux_base_tab->getObject(obj_name, obj_type);
+		}
 	}
-	else if(diff_type==ObjectsDiffInfo::CreateObject || diff_type==ObjectsDiffInfo::AlterObject)
+	else
 	{
-		aux_base_tab=dynamic_cast<BaseTable *>(imported_model->getObject(tab_name, base_tab->getObjectType()));
+		QString obj_name = object->getSignature();
 
-		//If the table was not found, try to find it between the many-to-many relationships
-		if(!aux_base_tab)
-			aux_base_tab=dynamic_cast<BaseTable *>(getRelNNTable(obj_name, imported_model));
+		aux_object = aux_model->getObject(obj_name, obj_type);
+
+		//Special case for many-to-many relationships
+		if(obj_type == ObjectType::Table && !aux_object)
+			aux_object = getRelNNTable(obj_name, aux_model);
 	}
 
-	if(aux_base_tab)
+	return aux_object;
+}
+
+void ModelsDiffHelper::diffObject(BaseObject *object, BaseObject *aux_object, ObjectsDiffInfo::DiffType diff_type, std::vector<PendingDiffInfo> &infos)
+{
+	ObjectType obj_type = object->getObjectType();
+
+	//Comparison for constraints (fks), triggers, rules, indexes
+	if(TableObject::isTableObject(obj_type))
+		diffTableObject(dynamic_cast<TableObject *>(object), aux_object, diff_type, infos);
+	else if(diff_type != ObjectsDiffInfo::DropObject && aux_object)
 	{
-		if(obj_type==ObjectType::Constraint)
+		bool objs_differs = false, xml_differs = false;
+
+		/* Try to get a diff from the retrieve object and the current object,
+		 * comparing only basic attributes like schema, tablespace and owner
+		 * this is why the BaseObject::getAlterCode is called */
+		objs_differs = !aux_object->BaseObject::getAlterCode(object).isEmpty();
+
+		//If the objects does not differ, try to compare their XML definition
+		if(!objs_differs)
 		{
-			PhysicalTable *aux_table=dynamic_cast<PhysicalTable *>(aux_base_tab);
-			aux_tab_obj=aux_table->getObject(obj_name, obj_type);
+			xml_differs = object->isCodeDiffersFrom(aux_object,	ObjectsIgnoredAttribs,
+																							obj_type != ObjectType::Role ? ObjectsIgnoredTags : RolesIgnoredTags);
 		}
+
+		//If a difference was detected between the objects
+		if(objs_differs || xml_differs)
+		{
+			infos.push_back({ ObjectsDiffInfo::AlterObject, object, aux_object });
+
+			//If the object is a table, do additional comparision between their child objects
+			if(!isForcedRecreateType(obj_type) && PhysicalTable::isPhysicalTable(obj_type))
+			{
+				PhysicalTable *tab=dynamic_cast<PhysicalTable *>(object),
+						*aux_tab=dynamic_cast<PhysicalTable *>(aux_object);
+
+				diffTables(tab, aux_tab, ObjectsDiffInfo::DropObject, infos);
+				diffTables(tab, aux_tab, ObjectsDiffInfo::CreateObject, infos);
+			}
+		}
+	}
+	else if(!aux_object)
+	{
+		if(diff_type != ObjectsDiffInfo::DropObject ||
+			 (diff_type == ObjectsDiffInfo::DropObject && !diff_opts[OptDontDropMissingObjs]))
+			infos.push_back({ diff_type, object, nullptr });
 		else
-			aux_tab_obj=aux_base_tab->getObject(obj_name, obj_type);
+			infos.push_back({ ObjectsDiffInfo::IgnoreObject, object, nullptr });
 	}
+}
 
+void ModelsDiffHelper::diffTableObject(TableObject *tab_obj, BaseObject *aux_tab_obj, ObjectsDiffInfo::DiffType diff_type, std::vector<PendingDiffInfo> &infos)
+{
 	if(!aux_tab_obj)
 	{
 		if(diff_type!=ObjectsDiffInfo::DropObject ||
 			 (diff_type==ObjectsDiffInfo::DropObject && !diff_opts[OptDontDropMissingObjs]))
-			generateDiffInfo(diff_type, tab_obj);
+			infos.push_back({ diff_type, tab_obj, nullptr });
 		else
-			generateDiffInfo(ObjectsDiffInfo::IgnoreObject, tab_obj);
+			infos.push_back({ ObjectsDiffInfo::IgnoreObject, tab_obj, nullptr });
 	}
 	else if(diff_type!=ObjectsDiffInfo::DropObject && tab_obj->isCodeDiffersFrom(aux_tab_obj, TableObjsIgnoredAttribs))
-		generateDiffInfo(ObjectsDiffInfo::AlterObject, tab_obj, aux_tab_obj);
+		infos.push_back({ ObjectsDiffInfo::AlterObject, tab_obj, aux_tab_obj });
+}
+
+bool ModelsDiffHelper::isParallelComparable(BaseObject *object)
+{
+	/* Objects that reference functions or operators (directly or through other objects)
+	 * since their code changes the reduced code of the referenced ones */
+	static const std::vector<ObjectType> serial_types {
+		ObjectType::Aggregate, ObjectType::Cast, ObjectType::Conversion,
+		ObjectType::EventTrigger, ObjectType::Transform, ObjectType::Operator,
+		ObjectType::OpClass, ObjectType::ForeignDataWrapper, ObjectType::ForeignServer,
+		ObjectType::UserMapping, ObjectType::ForeignTable, ObjectType::Trigger
+	};
+
+	ObjectType obj_type = object->getObjectType();
+
+	if(std::find(serial_types.begin(), serial_types.end(), obj_type) != serial_types.end())
+		return false;
+
+	//Only enumerations and composite types don't reference functions
+	if(obj_type == ObjectType::Type)
+	{
+		Type::TypeConfig config = dynamic_cast<Type *>(object)->getConfiguration();
+		return config == Type::EnumerationType || config == Type::CompositeType;
+	}
+
+	if(obj_type == ObjectType::Language)
+	{
+		Language *lang = dynamic_cast<Language *>(object);
+
+		return !lang->getFunction(Language::ValidatorFunc) &&
+					 !lang->getFunction(Language::HandlerFunc) &&
+					 !lang->getFunction(Language::InlineFunc);
+	}
+
+	if(obj_type == ObjectType::Function || obj_type == ObjectType::Procedure)
+	{
+		BaseObject *lang = dynamic_cast<BaseFunction *>(object)->getLanguage();
+		return !lang || isParallelComparable(lang);
+	}
+
+	if(obj_type == ObjectType::Index)
+	{
+		for(auto &elem : dynamic_cast<Index *>(object)->getIndexElements())
+		{
+			if(elem.getOperatorClass())
+				return false;
+		}
+	}
+	else if(obj_type == ObjectType::Constraint)
+	{
+		for(auto &elem : dynamic_cast<Constraint *>(object)->getExcludeElements())
+		{
+			if(elem.getOperator() || elem.getOperatorClass())
+				return false;
+		}
+	}
+	else if(obj_type == ObjectType::Table)
+	{
+		PhysicalTable *tab = dynamic_cast<PhysicalTable *>(object);
+
+		for(auto &part_key : tab->getPartitionKeys())
+		{
+			if(part_key.getOperatorClass())
+				return false;
+		}
+
+		//The code of the table embeds the code of its constraints
+		for(auto &constr : *tab->getObjectList(ObjectType::Constraint))
+		{
+			if(!isParallelComparable(constr))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void ModelsDiffHelper::cacheObjectsCode(DatabaseModel *model)
+{
+	std::vector<BaseObject *> objects = { model }, *obj_list = nullptr;
+	Relationship *rel = nullptr;
+	BaseTable *tab = nullptr;
+	ObjectType obj_type;
+
+	for(auto &type : BaseObject::getObjectTypes(false))
+	{
+		obj_list = model->getObjectList(type);
+
+		if(obj_list)
+			objects.insert(objects.end(), obj_list->begin(), obj_list->end());
+	}
+
+	//The tables generated by many-to-many relationships aren't stored in the model's lists
+	for(auto &obj : *model->getObjectList(ObjectType::Relationship))
+	{
+		rel = dynamic_cast<Relationship *>(obj);
+
+		if(rel->getRelationshipType() == BaseRelationship::RelationshipNn && rel->getGeneratedTable())
+			objects.push_back(rel->getGeneratedTable());
+	}
+
+	auto cache_names = [](BaseObject *obj) {
+		obj->getName();
+		obj->getName(true, false);
+		obj->getName(true);
+		obj->getSignature(false);
+		obj->getSignature(true);
+	};
+
+	for(auto &obj : objects)
+	{
+		obj_type = obj->getObjectType();
+		tab = dynamic_cast<BaseTable *>(obj);
+		cache_names(obj);
+
+		if(tab)
+		{
+			for(auto &child : tab->getObjects())
+				cache_names(child);
+		}
+
+		/* Objects which reduced code is used by their referrers. The reduced code of functions and
+		 * operators is not cached since it depends on the referrer (see isParallelComparable()) */
+		if(obj_type == ObjectType::Schema || obj_type == ObjectType::Role ||
+			 obj_type == ObjectType::Tablespace || obj_type == ObjectType::Collation ||
+			 obj_type == ObjectType::Tag ||
+			 (obj_type == ObjectType::Language && isParallelComparable(obj)))
+			obj->getSourceCode(SchemaParser::XmlCode, true);
+	}
 }
 
 BaseObject *ModelsDiffHelper::getRelNNTable(const QString &obj_name, DatabaseModel *model)
@@ -700,8 +940,6 @@ void ModelsDiffHelper::generateDiffInfo(ObjectsDiffInfo::DiffType diff_type, Bas
 	{
 		if(object)
 		{
-			ObjectsDiffInfo diff_info;
-
 			/* If the info is for ALTER and there is a DROP info on the list,
 			 * the object will be recreated instead of modified */
 			if((!isForcedRecreateType(object->getObjectType()) ||
@@ -710,10 +948,7 @@ void ModelsDiffHelper::generateDiffInfo(ObjectsDiffInfo::DiffType diff_type, Bas
 				 isDiffInfoExists(ObjectsDiffInfo::DropObject, old_object, nullptr) &&
 				 !isDiffInfoExists(ObjectsDiffInfo::CreateObject, object, nullptr))
 			{
-				diff_info=ObjectsDiffInfo(ObjectsDiffInfo::CreateObject, object, nullptr);
-				diff_infos.push_back(diff_info);
-				diffs_counter[ObjectsDiffInfo::CreateObject]++;
-				emit s_objectsDiffInfoGenerated(diff_info);
+				addDiffInfo(ObjectsDiffInfo(ObjectsDiffInfo::CreateObject, object, nullptr));
 			}
 			else if(!isDiffInfoExists(diff_type, object, old_object))
 			{
@@ -762,19 +997,13 @@ void ModelsDiffHelper::generateDiffInfo(ObjectsDiffInfo::DiffType diff_type, Bas
 							 !old_col->getSequence() ||
 							 (old_col->getSequence() && old_col->getSequence()->getSignature() != seq->getSignature()))))
 					{
-						diff_info=ObjectsDiffInfo(ObjectsDiffInfo::AlterObject, aux_col, col);
-						diff_infos.push_back(diff_info);
-						diffs_counter[ObjectsDiffInfo::AlterObject]++;
-						emit s_objectsDiffInfoGenerated(diff_info);
+						addDiffInfo(ObjectsDiffInfo(ObjectsDiffInfo::AlterObject, aux_col, col));
 					}
 
 					if(!diff_opts[OptReuseSequences] || imported_model->getObjectIndex(seq->getSignature(), ObjectType::Sequence) < 0)
 					{
 						//Creates a CREATE info with the sequence
-						diff_info=ObjectsDiffInfo(ObjectsDiffInfo::CreateObject, seq, nullptr);
-						diff_infos.push_back(diff_info);
-						diffs_counter[ObjectsDiffInfo::CreateObject]++;
-						emit s_objectsDiffInfoGenerated(diff_info);
+						addDiffInfo(ObjectsDiffInfo(ObjectsDiffInfo::CreateObject, seq, nullptr));
 					}
 					else if(diff_opts[OptReuseSequences])
 					{
@@ -788,7 +1017,7 @@ void ModelsDiffHelper::generateDiffInfo(ObjectsDiffInfo::DiffType diff_type, Bas
 									itr->getObject()->getObjectType()==ObjectType::Sequence &&
 									itr->getObject()->getSignature()==seq->getSignature())
 							{
-								diff_infos.erase(itr);
+								removeDiffInfo(itr);
 								break;
 							}
 
@@ -803,10 +1032,7 @@ void ModelsDiffHelper::generateDiffInfo(ObjectsDiffInfo::DiffType diff_type, Bas
 				}
 				else
 				{
-					diff_info=ObjectsDiffInfo(diff_type, object, old_object);
-					diff_infos.push_back(diff_info);
-					diffs_counter[diff_type]++;
-					emit s_objectsDiffInfoGenerated(diff_info);
+					addDiffInfo(ObjectsDiffInfo(diff_type, object, old_object));
 				}
 
 				/* If the info is for DROP, generate the drop for referer objects of the
@@ -839,28 +1065,68 @@ void ModelsDiffHelper::generateDiffInfo(ObjectsDiffInfo::DiffType diff_type, Bas
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
 bool ModelsDiffHelper::isDiffInfoExists(ObjectsDiffInfo::DiffType  diff_type, BaseObject *object, BaseObject *old_object, bool exact_match)
 {
-	bool found_diff=false;
-	ObjectsDiffInfo aux_diff(diff_type, object, old_object);
-
-	for(ObjectsDiffInfo diff : diff_infos)
+	if(exact_match)
 	{
-		if((exact_match && diff==aux_diff) ||
-				(!exact_match &&
-				 ((object && diff.getObject()==object) ||
-				  (old_object && diff.getOldObject()==old_object))))
-		{
-			found_diff=true;
-			break;
-		}
+		return diff_info_keys.count(diff_type) &&
+					 diff_info_keys[diff_type].contains(std::make_pair(object, old_object));
 	}
 
-	return found_diff;
+	return (object && diff_objects.contains(object)) ||
+				 (old_object && diff_old_objects.contains(old_object));
+}
+
+void ModelsDiffHelper::addDiffInfo(ObjectsDiffInfo diff_info)
+{
+	diff_infos.push_back(diff_info);
+	diff_info_keys[diff_info.getDiffType()][std::make_pair(diff_info.getObject(), diff_info.getOldObject())]++;
+
+	if(diff_info.getObject())
+		diff_objects[diff_info.getObject()]++;
+
+	if(diff_info.getOldObject())
+		diff_old_objects[diff_info.getOldObject()]++;
+
+	diffs_counter[diff_info.getDiffType()]++;
+	emit s_objectsDiffInfoGenerated(diff_info);
+}
+
+void ModelsDiffHelper::removeDiffInfo(std::vector<ObjectsDiffInfo>::iterator itr)
+{
+	if(itr == diff_infos.end())
+		return;
+
+	/* Decrements the amount of diff infos for the key
+	 * removing it from the index when it reaches zero */
+	auto unindex = [](auto &index, const auto &key) {
+		auto idx_itr = index.find(key);
+
+		if(idx_itr != index.end() && --idx_itr.value() == 0)
+			index.erase(idx_itr);
+	};
+
+	unindex(diff_info_keys[itr->getDiffType()], std::make_pair(itr->getObject(), itr->getOldObject()));
+
+	if(itr->getObject())
+		unindex(diff_objects, itr->getObject());
+
+	if(itr->getOldObject())
+		unindex(diff_old_objects, itr->getOldObject());
+
+	diff_infos.erase(itr);
+}
+
+void ModelsDiffHelper::clearDiffInfos()
+{
+	diff_infos.clear();
+	diff_info_keys.clear();
+	diff_objects.clear();
+	diff_old_objects.clear();
 }
 
 void ModelsDiffHelper::processDiffInfos()
@@ -1191,7 +1457,7 @@ void ModelsDiffHelper::processDiffInfos()
 		for(Type *type : types)
 			type->convertFunctionParameters(true);
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1236,7 +1502,7 @@ QString ModelsDiffHelper::getSourceCode(BaseObject *object, bool drop_cmd)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -1251,7 +1517,7 @@ void ModelsDiffHelper::destroyTempObjects()
 		delete tmp_obj;
 	}
 
-	diff_infos.clear();
+	clearDiffInfos();
 }
 
 void ModelsDiffHelper::recreateObject(BaseObject *object, std::vector<BaseObject *> &drop_objs, std::vector<BaseObject *> &create_objs)
@@ -26,6 +26,7 @@
 #define MODELS_DIFF_HELPER_H
 
 #include <QObject>
+#include <QHash>
 #include "databasemodel.h"
 #include "objectsdiffinfo.h"
 
@@ -60,7 +61,10 @@ class __libgui ModelsDiffHelper: public QObject {
 		diff_opts[10];
 
 		//! \brief Stores the count of objects to be dropped, changed or created
-		unsigned diffs_counter[4];
+		unsigned diffs_counter[4],
+
+		//! \brief Number of threads used to compare the objects of different schemas (see setParallelJobs())
+		parallel_jobs;
 
 		//! \brief Reference model from which all changes are generated
 		DatabaseModel *source_model,
@@ -71,6 +75,14 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Stores all generated diff information during the process
 		std::vector<ObjectsDiffInfo> diff_infos;
 
+		/*! \brief Indexes the diff infos in diff_infos by diff type and the pair (object, old object)
+		 *  storing how many infos exist for each key. Used for exact lookups in isDiffInfoExists() */
+		std::map<ObjectsDiffInfo::DiffType, QHash<std::pair<BaseObject *, BaseObject *>, unsigned>> diff_info_keys;
+
+		/*! \brief Indexes the diff infos in diff_infos by their object and by their old object storing how many
+		 *  infos reference each one of them. Used for non-exact lookups in isDiffInfoExists() */
+		QHash<BaseObject *, unsigned> diff_objects, diff_old_objects;
+
 		//! \brief Stores all temporary objects created during the diff process
 		std::vector<BaseObject *> tmp_objects;
 
@@ -81,18 +93,53 @@ class __libgui ModelsDiffHelper: public QObject {
 		 *  by the option OptForceRecreation */
 		std::vector<ObjectType> forced_recreate_types;
 
+		/*! \brief Stores the parameters of a diff info to be generated. The comparison of the objects only
+		 *  collects the infos in this form so it can run in a separated thread while the infos themselves are
+		 *  generated afterwards, in the creation order, by the calling thread (see generateDiffInfo()) */
+		struct PendingDiffInfo {
+			ObjectsDiffInfo::DiffType diff_type;
+			BaseObject *object, *old_object;
+		};
+
+		//! \brief Stores the result of the comparison of a single object
+		struct ObjectComparison {
+			std::vector<PendingDiffInfo> infos;
+			bool compared {false}, failed {false};
+			Exception error;
+		};
+
 		/*! note The parameter diff_type in any methods below is one of the values in
 		ObjectsDiffInfo::CreateObject|AlterObject|DropObject */
 
-		//! \brief Compares two tables storing the diff between them in the diff_infos vector.
-		void diffTables(PhysicalTable *src_table, PhysicalTable *imp_table, ObjectsDiffInfo::DiffType diff_type);
+		//! \brief Compares two tables storing the diff infos to be generated in the infos vector.
+		void diffTables(PhysicalTable *src_table, PhysicalTable *imp_table, ObjectsDiffInfo::DiffType diff_type, std::vector<PendingDiffInfo> &infos);
 
 		//! \brief Compares the two models storing the diff between them in the diff_infos vector.
 		void diffModels(ObjectsDiffInfo::DiffType diff_type);
 
-		/*! \brief Compares the specified table object against the ones on the source model or imported
+		/*! \brief Returns the object in aux_model which corresponds to the provided one. For table objects
+		 *  the parent table is searched first and then the object is searched in it */
+		BaseObject *getComparedObject(BaseObject *object, ObjectsDiffInfo::DiffType diff_type, DatabaseModel *aux_model);
+
+		/*! \brief Compares the object (except permissions, relationships and database) to its counterpart in
+		 *  the other model (aux_object) storing the diff infos to be generated in the infos vector. This method
+		 *  doesn't change the diff infos list so it can be called by different threads as long as the objects being
+		 *  compared have their names and reduced code already cached (see diffModels()) */
+		void diffObject(BaseObject *object, BaseObject *aux_object, ObjectsDiffInfo::DiffType diff_type, std::vector<PendingDiffInfo> &infos);
+
+		/*! \brief Compares the specified table object against its counterpart in the source model or imported
 		model depending on the diff_type parameter. */
-		void diffTableObject(TableObject *tab_obj, ObjectsDiffInfo::DiffType diff_type);
+		void diffTableObject(TableObject *tab_obj, BaseObject *aux_tab_obj, ObjectsDiffInfo::DiffType diff_type, std::vector<PendingDiffInfo> &infos);
+
+		/*! \brief Returns if the object can be compared in a separated thread. Objects which code embeds the reduced
+		 *  code of functions or operators can't, since the reduced code of those objects is changed by each referrer
+		 *  (see Aggregate::getSourceCode() for instance), so they are compared by the calling thread */
+		bool isParallelComparable(BaseObject *object);
+
+		/*! \brief Caches the names and signatures of all objects in the model as well as the reduced code of the
+		 *  objects that are referenced by others (schemas, roles, tablespaces, etc). This way, the comparison of
+		 *  the objects in separated threads only changes the objects being compared */
+		void cacheObjectsCode(DatabaseModel *model);
 
 		/*! \brief Compares the two tables' columns and if needed generates the CREATE statments for the missing ones in child_tab.
 		 * This is used when a new inheritance relationship is detected between two tables that previously were not parent and child.
@@ -103,6 +150,16 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Creates a diff info instance storing in o diff_infos vector
 		void generateDiffInfo(ObjectsDiffInfo::DiffType diff_type, BaseObject *object, BaseObject *old_object=nullptr);
 
+		/*! \brief Stores the diff info in diff_infos updating the indexes and the diff counters.
+		 *  This method also emits the signal s_objectsDiffInfoGenerated() */
+		void addDiffInfo(ObjectsDiffInfo diff_info);
+
+		//! \brief Removes the diff info at the specified position of diff_infos updating the indexes
+		void removeDiffInfo(std::vector<ObjectsDiffInfo>::iterator itr);
+
+		//! \brief Removes all the diff infos and clears their indexes
+		void clearDiffInfos();
+
 		/*! \brief Processes the generated diff infos resulting in a SQL buffer with the needed commands
 		to synchronize both model and database */
 		void processDiffInfos();
@@ -197,6 +254,14 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Configures the PostgreSQL version used in the diff generation
 		void setPgSQLVersion(const QString pgsql_ver);
 
+		/*! \brief Configures the number of threads used to compare the objects. The objects are grouped by schema
+		 *  and each group is compared in a separated thread. The generated diff is the same regardless the number of
+		 *  jobs since the diff infos are generated in the creation order. Values lower than 2 disable the parallel comparison */
+		void setParallelJobs(unsigned jobs);
+
+		//! \brief Returns the number of threads used to compare the objects
+		unsigned getParallelJobs();
+
 		//! \brief Returns the count of diff infos of the specified diff_type
 		unsigned getDiffTypeCount(ObjectsDiffInfo::DiffType diff_type);
 
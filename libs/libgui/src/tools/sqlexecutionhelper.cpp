@@ -17,11 +17,14 @@
 */
 
 #include "sqlexecutionhelper.h"
+#include "sqlscriptparser.h"
+#include <QCoreApplication>
 
 SQLExecutionHelper::SQLExecutionHelper() : QObject(nullptr)
 {
-	cancelled = false;
+	cancelled = cancel_at_limit = truncated = false;
 	result_model = nullptr;
+	stream_col_count = streamed_rows = 0;
 }
 
 void SQLExecutionHelper::setConnection(Connection conn)
@@ -74,14 +77,59 @@ void SQLExecutionHelper::executeCommand()
 			//The connection will break the execution if it keeps idle for one hour or more
 			connection.setSQLExecutionTimout(3600);
 		}
+		else
+			stopStreaming();
+
+		/* Commands containing multiple statements can't be executed in streaming mode (the extended
+		 * protocol rejects them) so they're run in the usual way. This is decided before sending the
+		 * command since a failed attempt would abort the transaction opened by the user (if any) */
+		if(SqlScriptParser::hasMultipleCommands(command))
+			connection.executeDMLCommand(command, res);
+		else
+		{
+			/* Running the command in streaming mode so only the first batch of rows is retrieved
+			 * now, the remaining ones are fetched as they are requested by the result model */
+			connection.sendStreamedDMLCommand(command);
+			connection.getNextStreamedResult(res);
+		}
 
-		connection.executeDMLCommand(command, res);
 		notices = connection.getNotices();
 
-		if(!res.isEmpty())
+		if(res.isSingleTuple())
+		{
+			QStringList rows_data;
+			int fetched = 0;
+
+			/* Read-only queries are cancelled once the rows limit of the model is reached, the
+			 * data-changing ones (e.g. UPDATE ... RETURNING) run until their end keeping their effects */
+			cancel_at_limit = SqlScriptParser::isReadOnlyCommand(command);
+			truncated = false;
+			stream_col_count = res.getColumnCount();
+			streamed_rows = 1;
+
 			result_model = new ResultSetModel(res, catalog);
+			fetched = readStreamedRows(ResultSetModel::getFetchBatchSize() - 1, rows_data);
+			notices = connection.getNotices();
+
+			/* The connection is only accessed in this thread, the model receives
+			 * the remaining rows via signals once it's moved to the main thread */
+			result_model->startStreaming();
+			result_model->appendStreamedRows(rows_data, fetched, truncated);
+
+			if(!connection.isStreaming())
+				result_model->finishStreaming();
 
-		emit s_executionFinished(res.getTupleCount());
+			result_model->moveToThread(QCoreApplication::instance()->thread());
+		}
+		else
+		{
+			connection.discardStreamedResults();
+
+			if(!res.isEmpty())
+				result_model = new ResultSetModel(res, catalog);
+		}
+
+		emit s_executionFinished(result_model ? result_model->rowCount() : res.getTupleCount());
 	}
 	catch(Exception &e)
 	{
@@ -98,3 +146,98 @@ void SQLExecutionHelper::cancelCommand()
 		cancelled = true;
 	}
 }
+
+void SQLExecutionHelper::stopStreaming()
+{
+	if(!connection.isStreaming())
+		return;
+
+	try
+	{
+		if(cancel_at_limit)
+			connection.cancelStreamedCommand();
+	}
+	catch(Exception &)
+	{
+		/* A failed cancellation is ignored here since
+		 * the remaining results are discarded anyway */
+	}
+
+	connection.discardStreamedResults();
+}
+
+int SQLExecutionHelper::readStreamedRows(unsigned max_rows, QStringList &rows_data)
+{
+	ResultSet res;
+	int fetched = 0;
+	bool limit_reached = false;
+
+	while(connection.isStreaming())
+	{
+		limit_reached = static_cast<unsigned>(streamed_rows) >= ResultSetModel::getRowsLimit();
+
+		/* The reading stops once the requested rows are received unless the rows limit was reached,
+		 * in that case the remaining rows are read just to be discarded so the connection is released */
+		if((max_rows == 0 && !limit_reached) || !connection.getNextStreamedResult(res))
+			break;
+
+		//Results with no tuples only indicate the end of the streamed rows
+		if(!res.isSingleTuple() || !res.accessTuple(ResultSet::FirstTuple))
+			continue;
+
+		if(limit_reached)
+		{
+			/* Read-only commands are cancelled so the exceeding rows aren't even transferred,
+			 * the other ones run until their end in the server keeping their effects */
+			truncated = true;
+
+			if(cancel_at_limit)
+				connection.cancelStreamedCommand();
+
+			continue;
+		}
+
+		for(int col = 0; col < stream_col_count; col++)
+		{
+			rows_data.push_back(col < res.getColumnCount() ?
+														res.getColumnValue(col) : "");
+		}
+
+		fetched++;
+		streamed_rows++;
+		max_rows--;
+	}
+
+	return fetched;
+}
+
+void SQLExecutionHelper::fetchStreamedRows(unsigned max_rows)
+{
+	try
+	{
+		QStringList rows_data;
+		int fetched = 0;
+
+		//The rows are delivered in batches so the view is updated while large amounts of rows are retrieved
+		while(connection.isStreaming() && max_rows > 0)
+		{
+			rows_data.clear();
+			fetched = readStreamedRows(std::min(max_rows, ResultSetModel::getFetchBatchSize()), rows_data);
+			max_rows -= fetched;
+
+			if(fetched > 0 || truncated)
+				emit s_streamedRowsFetched(rows_data, fetched, truncated);
+
+			if(fetched == 0)
+				break;
+		}
+
+		if(!connection.isStreaming())
+			emit s_streamingFinished();
+	}
+	catch(Exception &e)
+	{
+		emit s_streamingFinished();
+		emit s_streamingAborted(e);
+	}
+}
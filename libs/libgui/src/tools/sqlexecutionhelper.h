@@ -46,6 +46,24 @@ class __libgui SQLExecutionHelper : public QObject {
 
 		QStringList notices;
 
+		/*! \brief Indicates that the streamed command only reads data so it can be cancelled in the server once the
+		 *  rows limit of the result model is reached. Otherwise, the exceeding rows are read and discarded */
+		bool cancel_at_limit;
+
+		//! \brief Indicates that rows of the streamed command were discarded due to the rows limit of the result model
+		bool truncated;
+
+		//! \brief The amount of columns and rows of the streamed command delivered to the result model so far
+		int stream_col_count, streamed_rows;
+
+		/*! \brief Reads at most max_rows of the streamed command storing their values in rows_data and returning
+		 *  the amount of rows read. Once the rows limit of the result model is reached the remaining rows are
+		 *  discarded (cancelling the command when possible). This method blocks until the rows arrive */
+		int readStreamedRows(unsigned max_rows, QStringList &rows_data);
+
+		//! \brief Stops the streamed command of the previous execution (if any) so the connection can be reused
+		void stopStreaming();
+
 	public:
 		SQLExecutionHelper();
 
@@ -55,7 +73,9 @@ class __libgui SQLExecutionHelper : public QObject {
 
 		QString getCommand();
 
-		//! \brief Returns the result set model created in the execution. This object is not deleted after the execution.
+		/*! \brief Returns the result set model created in the execution. This object is not deleted after the execution.
+		 *  The model never accesses the connection, the remaining rows of a streamed command are requested via
+		 *  ResultSetModel::s_rowsRequested() and delivered by s_streamedRowsFetched(), both connected by the caller */
 		ResultSetModel *getResultSetModel();
 
 		bool isCancelled();
@@ -67,9 +87,22 @@ class __libgui SQLExecutionHelper : public QObject {
 		void executeCommand();
 		void cancelCommand();
 
+		/*! \brief Retrieves at most max_rows of the streamed command in the helper's thread, delivering them in
+		 *  batches via s_streamedRowsFetched(). s_streamingFinished() is emitted when all the rows were retrieved */
+		void fetchStreamedRows(unsigned max_rows);
+
 	signals:
 		void s_executionFinished(int rows_affected);
 		void s_executionAborted(Exception e);
+
+		//! \brief Signal emitted when rows of the streamed command are retrieved (see ResultSetModel::appendStreamedRows())
+		void s_streamedRowsFetched(QStringList rows_data, int rows_count, bool truncated);
+
+		//! \brief Signal emitted when all the rows of the streamed command were retrieved or discarded
+		void s_streamingFinished();
+
+		//! \brief Signal emitted when an error is raised while retrieving the rows of the streamed command
+		void s_streamingAborted(Exception e);
 };
 
 #endif
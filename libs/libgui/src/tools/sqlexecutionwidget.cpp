@@ -25,6 +25,7 @@
 #include "messagebox.h"
 #include "pgmodelerguiplugin.h"
 #include <QClipboard>
+#include <QEventLoop>
 
 std::map<QString, QString> SQLExecutionWidget::cmd_history;
 int SQLExecutionWidget::cmd_history_max_len {1000};
@@ -201,12 +202,18 @@ SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 	stop_tb->setVisible(false);
 	sql_exec_hlp.moveToThread(&sql_exec_thread);
 
-	connect(&sql_exec_thread, &QThread::started, &sql_exec_hlp, &SQLExecutionHelper::executeCommand);
 	connect(&sql_exec_hlp, &SQLExecutionHelper::s_executionFinished, this, &SQLExecutionWidget::finishExecution);
-	connect(&sql_exec_hlp, &SQLExecutionHelper::s_executionAborted, &sql_exec_thread, &QThread::quit);
 	connect(&sql_exec_hlp, &SQLExecutionHelper::s_executionAborted, this, &SQLExecutionWidget::handleExecutionAborted);
 	connect(stop_tb, &QToolButton::clicked, &sql_exec_hlp, &SQLExecutionHelper::cancelCommand, Qt::DirectConnection);
 
+	connect(&sql_exec_hlp, &SQLExecutionHelper::s_streamingAborted, this, [](Exception e){
+		Messagebox::error(e, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	});
+
+	/* The helper's thread keeps running while the widget exists since the connection is only accessed
+	 * there, both by the executed commands and by the retrieval of the remaining rows of streamed results */
+	sql_exec_thread.start();
+
 	// After completing the SQLExecutionWidget construction we install the plugins features
 	for(auto &p_wgt : PgModelerGuiPlugin::getPluginsWidgets(this))
 		installPluginWidgets(p_wgt.button, p_wgt.widget);
@@ -214,12 +221,9 @@ SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 
 SQLExecutionWidget::~SQLExecutionWidget()
 {
-	if(sql_exec_thread.isRunning())
-	{
-		sql_exec_hlp.cancelCommand();
-		sql_exec_thread.quit();
-		sql_exec_thread.wait();
-	}
+	sql_exec_hlp.cancelCommand();
+	sql_exec_thread.quit();
+	sql_exec_thread.wait();
 
 	destroyResultModel();
 }
@@ -265,7 +269,7 @@ void SQLExecutionWidget::reloadHighlightConfigs()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -375,7 +379,7 @@ void SQLExecutionWidget::resizeEvent(QResizeEvent *event)
 void SQLExecutionWidget::fillResultsTable(Catalog &catalog, ResultSet &res, QTableWidget *results_tbw, bool store_data)
 {
 	if(!results_tbw)
-		throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject ,__exc_origin);
 
 	try
 	{
@@ -463,7 +467,7 @@ void SQLExecutionWidget::fillResultsTable(Catalog &catalog, ResultSet &res, QTab
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -541,8 +545,28 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 
 		if(!empty)
 		{
-			output_tbw->setTabText(0, tr("Results (%1)").arg(res_model->rowCount()));
+			/* The rows count only covers the rows fetched so far since the
+			 * remaining rows of a streamed result are retrieved on demand */
+			auto update_tab_text = [this, res_model](){
+				output_tbw->setTabText(0, res_model->isTruncated() ?
+																		tr("Results (first %1 rows)").arg(res_model->rowCount()) :
+																		tr("Results (%1 fetched)").arg(res_model->rowCount()));
+			};
+
+			update_tab_text();
 			output_tbw->setCurrentIndex(0);
+
+			//Updating the rows count as the remaining rows of a streamed result are fetched
+			connect(res_model, &ResultSetModel::rowsInserted, this, update_tab_text);
+			connect(res_model, &ResultSetModel::s_streamingFinished, this, update_tab_text);
+
+			//The remaining rows of a streamed result are retrieved by the helper in its own thread
+			if(res_model->isStreaming())
+			{
+				connect(res_model, &ResultSetModel::s_rowsRequested, &sql_exec_hlp, &SQLExecutionHelper::fetchStreamedRows);
+				connect(&sql_exec_hlp, &SQLExecutionHelper::s_streamedRowsFetched, res_model, &ResultSetModel::appendStreamedRows);
+				connect(&sql_exec_hlp, &SQLExecutionHelper::s_streamingFinished, res_model, &ResultSetModel::finishStreaming);
+			}
 		}
 		else
 		{
@@ -563,7 +587,7 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 																				UtilsNs::formatMessage(tr("[%1]: SQL command successfully executed in <em><strong>%2</strong></em>. <em>%3 <strong>%4</strong></em>")
 																																		 .arg(QTime::currentTime().toString("hh:mm:ss.zzz"))
 																																		 .arg(total_exec >= 1000 ? QString("%1 s").arg(total_exec/1000.0) : QString("%1 ms").arg(total_exec))
-																																		 .arg(!res_model ? tr("Rows affected") :  tr("Rows retrieved"))
+																																		 .arg(!res_model ? tr("Rows affected") :  tr("Rows fetched"))
 																																		 .arg(rows_affected)),
 																				QPixmap(GuiUtilsNs::getIconPath("info")));
 
@@ -571,7 +595,6 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 	}
 
 	switchToExecutionMode(false);
-	sql_exec_thread.quit();
 	qApp->alert(this);
 }
 
@@ -715,11 +738,23 @@ void SQLExecutionWidget::runSQLCommand()
 
 void SQLExecutionWidget::runSQLCommand(const QString &cmd)
 {
+	ResultSetModel *result_model = dynamic_cast<ResultSetModel *>(results_tbw->model());
+
+	/* Detaching the current results from the helper since its connection will be used by the new command,
+	 * so no pending streamed rows are requested by the view anymore. The streamed command itself is stopped
+	 * by the helper before running the new one */
+	if(result_model)
+	{
+		result_model->stopStreaming();
+		disconnect(&sql_exec_hlp, nullptr, result_model, nullptr);
+		disconnect(result_model, &ResultSetModel::s_rowsRequested, &sql_exec_hlp, nullptr);
+	}
+
 	output_tb->setChecked(true);
 	msgoutput_lst->clear();
 	sql_exec_hlp.setCommand(cmd);
 	start_exec = QDateTime::currentDateTime().toMSecsSinceEpoch();
-	sql_exec_thread.start();
+	QMetaObject::invokeMethod(&sql_exec_hlp, &SQLExecutionHelper::executeCommand, Qt::QueuedConnection);
 
 	switchToExecutionMode(true);
 	clearOutput();
@@ -807,6 +842,27 @@ void SQLExecutionWidget::exportResults(QTableView *results_tbw, bool csv_format)
 			qApp->setOverrideCursor(Qt::WaitCursor);
 			results_tbw->setUpdatesEnabled(false);
 			results_tbw->blockSignals(true);
+
+			ResultSetModel *res_model = dynamic_cast<ResultSetModel *>(results_tbw->model());
+
+			/* Retrieving the rows of a streamed result not yet fetched by the view so all of them are exported.
+			 * The rows are read as they arrive so the event loop keeps running while waiting for the server */
+			if(res_model && res_model->isStreaming())
+			{
+				QEventLoop event_loop;
+
+				connect(res_model, &ResultSetModel::s_streamingFinished, &event_loop, &QEventLoop::quit);
+				connect(res_model, &ResultSetModel::destroyed, &event_loop, &QEventLoop::quit);
+				res_model->fetchAllStreamedRows();
+
+				if(res_model->isStreaming())
+				{
+					results_tbw->setEnabled(false);
+					event_loop.exec();
+					results_tbw->setEnabled(true);
+				}
+			}
+
 			results_tbw->selectAll();
 
 			UtilsNs::saveFile(sel_files.at(0),
@@ -868,7 +924,7 @@ QByteArray SQLExecutionWidget::generateTextBuffer(QTableView *results_tbw, bool
 QByteArray SQLExecutionWidget::generateBuffer(QTableView *results_tbw, QChar separator, bool incl_col_names, bool csv_format)
 {
 	if(!results_tbw)
-		throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedObject ,__exc_origin);
 
 	if((results_tbw->model() && results_tbw->model()->rowCount() == 0) ||
 		 !results_tbw->selectionModel())
@@ -1162,7 +1218,7 @@ void SQLExecutionWidget::enableSQLExecution(bool enable)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
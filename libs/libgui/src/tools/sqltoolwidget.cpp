@@ -259,7 +259,7 @@ void SQLToolWidget::connectToServer()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -342,7 +342,7 @@ DatabaseExplorerWidget *SQLToolWidget::browseDatabase()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -372,7 +372,7 @@ SQLExecutionWidget *SQLToolWidget::addSQLExecutionTab(const QString &sql_cmd)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 	}
 }
 
@@ -387,7 +387,7 @@ void SQLToolWidget::addSQLExecutionTab(const QString &conn_id, const QString &da
 	{
 		throw Exception(tr("Failed to load the file `%1' in SQL tool because the connection ID `%2' was not found!")
 										.arg(sql_file).arg(conn_id),
-										ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::Custom,__exc_origin);
 	}
 
 	buf.append(UtilsNs::loadFile(sql_file));
@@ -622,7 +622,7 @@ void SQLToolWidget::dropDatabase(int database_idx)
 		{
 			/* throw Exception(Exception::getErrorMessage(ErrorCode::DropCurrentDBDefault)
 											.arg(dbname, conn.getConnectionParam(Connection::ParamAlias)),
-											ErrorCode::DropCurrentDBDefault,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e); */
+											ErrorCode::DropCurrentDBDefault,__exc_origin, &e); */
 			Messagebox::error(Exception::getErrorMessage(ErrorCode::DropCurrentDBDefault).arg(dbname, conn.getConnectionParam(Connection::ParamAlias)),
 												ErrorCode::DropCurrentDBDefault,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 		}
@@ -27,10 +27,10 @@ ValidationInfo::ValidationInfo()
 ValidationInfo::ValidationInfo(ValType val_type, BaseObject *object, std::vector<BaseObject *> references)
 {
 	if(val_type >= SqlValidationError)
-		throw Exception(ErrorCode::AsgInvalidTypeObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgInvalidTypeObject,__exc_origin);
 	else if((val_type==NoUniqueName || val_type==BrokenReference) &&
 			(!object || references.empty()))
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	this->val_type=val_type;
 	this->object=object;
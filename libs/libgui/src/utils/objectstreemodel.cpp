@@ -0,0 +1,1198 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "objectstreemodel.h"
+#include "guiutilsns.h"
+#include "customtablewidget.h"
+#include <QFont>
+#include <QIcon>
+#include <QRegularExpression>
+#include <algorithm>
+
+ObjectsTreeModel::ObjectsTreeModel(QObject *parent) : QAbstractItemModel(parent)
+{
+	db_model = nullptr;
+	filter_by_id = false;
+	root = std::make_unique<TreeNode>(nullptr, ObjectNode, nullptr, ObjectType::BaseObject);
+}
+
+QString ObjectsTreeModel::getObjectText(BaseObject *object)
+{
+	if(!object)
+		return "";
+
+	ObjectType obj_type = object->getObjectType();
+	QString obj_name;
+
+	if(BaseFunction::isBaseFunction(obj_type))
+	{
+		BaseFunction *func = dynamic_cast<BaseFunction *>(object);
+		func->createSignature(false);
+		obj_name = func->getSignature();
+		func->createSignature(true);
+	}
+	else if(obj_type == ObjectType::Operator)
+		obj_name = dynamic_cast<Operator *>(object)->getSignature(false);
+	else if(obj_type == ObjectType::OpClass || obj_type == ObjectType::OpFamily)
+	{
+		obj_name = object->getSignature(false);
+		obj_name.replace(QRegularExpression("( )+(USING)( )+"), " [");
+		obj_name += QChar(']');
+	}
+	else
+		obj_name = object->getName();
+
+	return obj_name;
+}
+
+void ObjectsTreeModel::setDatabaseModel(DatabaseModel *db_model)
+{
+	beginResetModel();
+
+	if(this->db_model)
+		disconnect(this->db_model, nullptr, this, nullptr);
+
+	this->db_model = db_model;
+	root = std::make_unique<TreeNode>(nullptr, ObjectNode, nullptr, ObjectType::BaseObject);
+	filter_matches.clear();
+	filter_parents.clear();
+	filter_groups.clear();
+	clearSchemaObjects();
+
+	if(db_model)
+	{
+		connect(db_model, &DatabaseModel::s_objectAdded, this, &ObjectsTreeModel::handleObjectAdded);
+		connect(db_model, &DatabaseModel::s_objectRemoved, this, &ObjectsTreeModel::handleObjectRemoved);
+
+		/* The modified objects are only collected here, in the thread that emits the signals, and
+		 * evaluated against the filter in the next synchronization (see filterModifiedObjects()) */
+		connect(db_model, &DatabaseModel::s_objectModified, this, [this](BaseObject *object) {
+			QMutexLocker locker(&modified_mutex);
+			modified_objs.insert(object);
+		}, Qt::DirectConnection);
+
+		connect(db_model, &DatabaseModel::s_objectRemoved, this, [this](BaseObject *object) {
+			QMutexLocker locker(&modified_mutex);
+			modified_objs.erase(object);
+		}, Qt::DirectConnection);
+
+		if(isFilterActive())
+			applyFilter(getAllObjects());
+	}
+
+	endResetModel();
+
+	//The database item is always created so the view has something to display
+	fetchMore(QModelIndex());
+}
+
+DatabaseModel *ObjectsTreeModel::getDatabaseModel()
+{
+	return db_model;
+}
+
+void ObjectsTreeModel::setObjectsVisible(const std::map<ObjectType, bool> &visible_objs)
+{
+	this->visible_objs = visible_objs;
+	setDatabaseModel(db_model);
+}
+
+const std::map<ObjectType, bool> &ObjectsTreeModel::getObjectsVisible()
+{
+	return visible_objs;
+}
+
+void ObjectsTreeModel::setFilter(const QString &pattern, bool by_id)
+{
+	/* If the new pattern only narrows down the current one (e.g. "ta" -> "tab") there's
+	 * no need to scan the whole database model again since the new matches (and the owners of
+	 * matching groups) are necessarily a subset of the current matches and parents */
+	bool narrowing = !filter_pattern.isEmpty() && by_id == filter_by_id &&
+									 pattern.size() > filter_pattern.size() &&
+									 pattern.startsWith(filter_pattern, Qt::CaseInsensitive);
+
+	filter_pattern = pattern;
+	filter_by_id = by_id;
+	clearSchemaObjects();
+
+	if(pattern.isEmpty())
+	{
+		filter_matches.clear();
+		filter_parents.clear();
+		filter_groups.clear();
+	}
+	else if(narrowing)
+	{
+		std::vector<BaseObject *> candidates(filter_matches.begin(), filter_matches.end());
+		candidates.insert(candidates.end(), filter_parents.begin(), filter_parents.end());
+		applyFilter(candidates);
+	}
+	else
+		applyFilter(getAllObjects());
+
+	updateModel();
+}
+
+bool ObjectsTreeModel::isFilterActive() const
+{
+	return !filter_pattern.isEmpty();
+}
+
+std::vector<BaseObject *> ObjectsTreeModel::getFilterMatches()
+{
+	return std::vector<BaseObject *>(filter_matches.begin(), filter_matches.end());
+}
+
+bool ObjectsTreeModel::isFilterPath(const QModelIndex &index) const
+{
+	if(!isFilterActive() || !index.isValid())
+		return false;
+
+	TreeNode *node = getNode(index);
+
+	//Under filtering the group items are only created when they contain matches
+	if(node->node_type == GroupNode)
+		return true;
+
+	return node->node_type == ObjectNode && filter_parents.count(node->object);
+}
+
+bool ObjectsTreeModel::ownsFilterGroups(BaseObject *object) const
+{
+	if(filter_groups.empty())
+		return false;
+
+	ObjectType obj_type = object->getObjectType();
+
+	for(auto &type : getGroupTypes(obj_type))
+	{
+		if(filter_groups.count(type))
+			return true;
+	}
+
+	return filter_groups.count(ObjectType::Permission) && Permission::acceptsPermission(obj_type);
+}
+
+void ObjectsTreeModel::filterObject(BaseObject *object)
+{
+	if(matchesFilter(object))
+	{
+		filter_matches.insert(object);
+		addFilterParents(object);
+	}
+
+	/* The objects owning groups that match the filter are handled as parents
+	 * so their items are created (and expanded) to reveal the groups */
+	if(ownsFilterGroups(object))
+	{
+		filter_parents.insert(object);
+		addFilterParents(object);
+	}
+}
+
+bool ObjectsTreeModel::matchesFilter(BaseObject *object) const
+{
+	QString text = filter_by_id ? QString::number(object->getObjectId()) : getObjectText(object);
+	return text.startsWith(filter_pattern, Qt::CaseInsensitive);
+}
+
+void ObjectsTreeModel::addFilterParents(BaseObject *object)
+{
+	TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+	BaseTable *table = dynamic_cast<BaseTable *>(object);
+	BaseObject *parent = object;
+
+	if(tab_obj && tab_obj->getParentTable())
+	{
+		parent = tab_obj->getParentTable();
+		filter_parents.insert(parent);
+	}
+
+	//Tables are also listed as references of their tags
+	if(table && table->getTag())
+		filter_parents.insert(table->getTag());
+
+	if(parent->getSchema())
+		filter_parents.insert(parent->getSchema());
+
+	if(object != db_model)
+		filter_parents.insert(db_model);
+}
+
+void ObjectsTreeModel::applyFilter(const std::vector<BaseObject *> &candidates)
+{
+	//All the candidates are evaluated so the pending modified objects don't need to be evaluated again
+	modified_mutex.lock();
+	modified_objs.clear();
+	modified_mutex.unlock();
+
+	filter_matches.clear();
+	filter_parents.clear();
+	filter_groups.clear();
+
+	//The group items are matched by the name of the type of the objects they list (the id filter doesn't apply to them)
+	if(!filter_by_id)
+	{
+		for(auto &type : BaseObject::getObjectTypes(true))
+		{
+			if(isTypeVisible(type) && BaseObject::getTypeName(type).startsWith(filter_pattern, Qt::CaseInsensitive))
+				filter_groups.insert(type);
+		}
+	}
+
+	for(auto &obj : candidates)
+		filterObject(obj);
+}
+
+void ObjectsTreeModel::filterModifiedObjects()
+{
+	std::set<BaseObject *> objects;
+
+	// Collecting the modifications not notified by the model yet
+	db_model->notifyModifiedObjects();
+
+	modified_mutex.lock();
+	objects.swap(modified_objs);
+	modified_mutex.unlock();
+
+	if(!isFilterActive())
+		return;
+
+	for(auto &obj : objects)
+	{
+		//A renamed object may not match the filter anymore
+		filter_matches.erase(obj);
+		filterObject(obj);
+
+		//Changes in the children of tables and views are notified as modifications of their parents
+		if(BaseTable::isBaseTable(obj->getObjectType()))
+		{
+			for(auto &child_type : BaseObject::getChildObjectTypes(obj->getObjectType()))
+			{
+				for(auto &tab_obj : getGroupObjects(obj, child_type))
+				{
+					filter_matches.erase(tab_obj);
+					filterObject(tab_obj);
+				}
+			}
+		}
+	}
+}
+
+std::vector<BaseObject *> ObjectsTreeModel::getAllObjects() const
+{
+	std::vector<BaseObject *> objects;
+
+	if(!db_model)
+		return objects;
+
+	std::vector<BaseObject *> *obj_list = nullptr;
+	std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Database),
+			sch_types = BaseObject::getChildObjectTypes(ObjectType::Schema);
+
+	types.insert(types.end(), sch_types.begin(), sch_types.end());
+	types.insert(types.end(), { ObjectType::Tag, ObjectType::GenericSql, ObjectType::Textbox,
+															ObjectType::Relationship, ObjectType::BaseRelationship });
+
+	objects.push_back(db_model);
+
+	for(auto &type : types)
+	{
+		obj_list = db_model->getObjectList(type);
+
+		if(obj_list)
+			objects.insert(objects.end(), obj_list->begin(), obj_list->end());
+	}
+
+	for(auto &type : { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View })
+	{
+		for(auto &tab : *db_model->getObjectList(type))
+		{
+			for(auto &child_type : BaseObject::getChildObjectTypes(type))
+			{
+				for(auto &tab_obj : getGroupObjects(tab, child_type))
+					objects.push_back(tab_obj);
+			}
+		}
+	}
+
+	return objects;
+}
+
+bool ObjectsTreeModel::isTypeVisible(ObjectType obj_type) const
+{
+	auto itr = visible_objs.find(obj_type);
+	return itr != visible_objs.end() && itr->second;
+}
+
+bool ObjectsTreeModel::isObjectAccepted(BaseObject *object) const
+{
+	return !isFilterActive() || filter_matches.count(object) || filter_parents.count(object);
+}
+
+std::vector<ObjectType> ObjectsTreeModel::getGroupTypes(ObjectType obj_type) const
+{
+	std::vector<ObjectType> types, grp_types;
+
+	if(obj_type == ObjectType::Database)
+	{
+		types = BaseObject::getChildObjectTypes(ObjectType::Database);
+		types.insert(types.end(), { ObjectType::Tag, ObjectType::GenericSql,
+																ObjectType::Textbox, ObjectType::Relationship });
+	}
+	else
+		types = BaseObject::getChildObjectTypes(obj_type);
+
+	for(auto &type : types)
+	{
+		if(isTypeVisible(type))
+			grp_types.push_back(type);
+	}
+
+	return grp_types;
+}
+
+std::vector<BaseObject *> ObjectsTreeModel::getGroupObjects(BaseObject *owner, ObjectType obj_type) const
+{
+	std::vector<BaseObject *> objects;
+
+	if(!owner || !db_model)
+		return objects;
+
+	if(owner == db_model)
+	{
+		std::vector<BaseObject *> *obj_list = db_model->getObjectList(obj_type);
+
+		if(obj_list)
+			objects = *obj_list;
+
+		//Special case for relationship, merging the base relationship list to the relationship list
+		if(obj_type == ObjectType::Relationship)
+		{
+			obj_list = db_model->getObjectList(ObjectType::BaseRelationship);
+			objects.insert(objects.end(), obj_list->begin(), obj_list->end());
+		}
+	}
+	else if(owner->getObjectType() == ObjectType::Schema)
+	{
+		const std::map<BaseObject *, std::vector<BaseObject *>> &sch_objs = getSchemaObjects(obj_type);
+		auto itr = sch_objs.find(owner);
+
+		if(itr != sch_objs.end())
+			objects = itr->second;
+	}
+	else
+	{
+		std::vector<TableObject *> *tab_objs = nullptr;
+
+		if(PhysicalTable::isPhysicalTable(owner->getObjectType()))
+			tab_objs = dynamic_cast<PhysicalTable *>(owner)->getObjectList(obj_type);
+		else if(owner->getObjectType() == ObjectType::View)
+			tab_objs = dynamic_cast<View *>(owner)->getObjectList(obj_type);
+
+		if(tab_objs)
+			objects.assign(tab_objs->begin(), tab_objs->end());
+	}
+
+	return objects;
+}
+
+size_t ObjectsTreeModel::getGroupObjectCount(BaseObject *owner, ObjectType obj_type) const
+{
+	if(!owner || !db_model)
+		return 0;
+
+	if(owner->getObjectType() == ObjectType::Schema)
+	{
+		const std::map<BaseObject *, std::vector<BaseObject *>> &sch_objs = getSchemaObjects(obj_type);
+		auto itr = sch_objs.find(owner);
+
+		return itr != sch_objs.end() ? itr->second.size() : 0;
+	}
+
+	return getGroupObjects(owner, obj_type).size();
+}
+
+const std::map<BaseObject *, std::vector<BaseObject *>> &ObjectsTreeModel::getSchemaObjects(ObjectType obj_type) const
+{
+	auto itr = schema_objs.find(obj_type);
+
+	if(itr != schema_objs.end())
+		return itr->second;
+
+	std::map<BaseObject *, std::vector<BaseObject *>> &sch_objs = schema_objs[obj_type];
+	std::vector<BaseObject *> *obj_list = db_model ? db_model->getObjectList(obj_type) : nullptr;
+
+	//Distributing the objects among their schemas keeping the order of the model's list
+	if(obj_list)
+	{
+		for(auto &obj : *obj_list)
+			sch_objs[obj->getSchema()].push_back(obj);
+	}
+
+	return sch_objs;
+}
+
+void ObjectsTreeModel::clearSchemaObjects()
+{
+	schema_objs.clear();
+}
+
+void ObjectsTreeModel::updateSchemaObjects(BaseObject *object, bool removed)
+{
+	ObjectType obj_type = object->getObjectType();
+	auto itr = schema_objs.find(obj_type);
+
+	//A removed schema doesn't own objects anymore
+	if(removed && obj_type == ObjectType::Schema)
+	{
+		for(auto &[type, sch_objs] : schema_objs)
+			sch_objs.erase(object);
+	}
+
+	//The lists of the type were not created yet, they'll be created from the database model when needed
+	if(itr == schema_objs.end())
+		return;
+
+	std::vector<BaseObject *> &objects = itr->second[object->getSchema()];
+
+	if(!removed)
+	{
+		objects.push_back(object);
+		return;
+	}
+
+	auto obj_itr = std::find(objects.begin(), objects.end(), object);
+
+	/* If the object is not in its schema's list (e.g. it was moved to another schema
+	 * before being removed) only the lists of the object's type are discarded */
+	if(obj_itr != objects.end())
+		objects.erase(obj_itr);
+	else
+		schema_objs.erase(itr);
+}
+
+std::vector<ObjectsTreeModel::NodeSpec> ObjectsTreeModel::getChildrenSpecs(TreeNode *node) const
+{
+	std::vector<NodeSpec> specs;
+
+	if(!db_model || !node)
+		return specs;
+
+	if(node == root.get())
+	{
+		if(isTypeVisible(ObjectType::Database) && isObjectAccepted(db_model))
+			specs.push_back({ ObjectNode, db_model, ObjectType::Database });
+	}
+	else if(node->node_type == ObjectNode)
+	{
+		for(auto &type : getGroupTypes(node->obj_type))
+		{
+			if(!isFilterActive() || filter_groups.count(type))
+				specs.push_back({ GroupNode, node->object, type });
+			else
+			{
+				//While filtering, the groups without matching objects (and not matching the filter themselves) are not created
+				for(auto &obj : getGroupObjects(node->object, type))
+				{
+					if(isObjectAccepted(obj))
+					{
+						specs.push_back({ GroupNode, node->object, type });
+						break;
+					}
+				}
+			}
+		}
+
+		if(node->obj_type == ObjectType::Tag)
+		{
+			for(auto &ref : node->object->getReferences())
+			{
+				if(!isFilterActive() || filter_matches.count(ref))
+					specs.push_back({ ReferenceNode, ref, ref->getObjectType() });
+			}
+		}
+
+		if((!isFilterActive() || filter_groups.count(ObjectType::Permission)) &&
+			 isTypeVisible(ObjectType::Permission) && Permission::acceptsPermission(node->obj_type))
+			specs.push_back({ PermissionNode, node->object, ObjectType::Permission });
+	}
+	else if(node->node_type == GroupNode)
+	{
+		for(auto &obj : getGroupObjects(node->object, node->obj_type))
+		{
+			if(isObjectAccepted(obj))
+				specs.push_back({ ObjectNode, obj, obj->getObjectType() });
+		}
+	}
+
+	return specs;
+}
+
+bool ObjectsTreeModel::configureNode(TreeNode *node) const
+{
+	QString text, tooltip, icon, item_id;
+	QColor fg_color;
+	bool italic = false, strikeout = false, has_children = false;
+	size_t obj_count = 0;
+	BaseObject *object = node->object;
+
+	if(node->node_type == GroupNode)
+	{
+		obj_count = getGroupObjectCount(object, node->obj_type);
+		text = QString("%1 (%2)").arg(BaseObject::getTypeName(node->obj_type)).arg(obj_count);
+		icon = GuiUtilsNs::getIconPath(BaseObject::getSchemaName(node->obj_type));
+		item_id = QString("%1_%2_grp").arg(object->getObjectId()).arg(BaseObject::getSchemaName(node->obj_type));
+		italic = true;
+	}
+	else if(node->node_type == PermissionNode)
+	{
+		std::vector<Permission *> perms;
+
+		db_model->getPermissions(object, perms);
+		obj_count = perms.size();
+		text = QString("%1 (%2)").arg(BaseObject::getTypeName(ObjectType::Permission)).arg(obj_count);
+		icon = GuiUtilsNs::getIconPath("permission");
+		item_id = QString("%1_%2").arg(object->getObjectId()).arg(BaseObject::getSchemaName(ObjectType::Permission));
+		italic = true;
+	}
+	else
+	{
+		TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+		int sub_type = -1;
+
+		text = getObjectText(object);
+		tooltip = QString("%1 (id: %2)").arg(text).arg(object->getObjectId());
+		item_id = QString("%1_%2").arg(object->getObjectId()).arg(object->getSchemaName());
+		strikeout = object->isSQLDisabled() && !object->isSystemObject();
+
+		if(tab_obj && tab_obj->isAddedByRelationship())
+		{
+			italic = true;
+			fg_color = CustomTableWidget::getTableItemColor(CustomTableWidget::RelAddedItemAltFgColor);
+		}
+		else if(object->isProtected() || object->isSystemObject())
+		{
+			italic = true;
+			fg_color = CustomTableWidget::getTableItemColor(CustomTableWidget::ProtItemAltFgColor);
+		}
+
+		if(node->obj_type == ObjectType::BaseRelationship || node->obj_type == ObjectType::Relationship)
+			sub_type = dynamic_cast<BaseRelationship *>(object)->getRelationshipType();
+		else if(node->obj_type == ObjectType::Constraint)
+			sub_type = dynamic_cast<Constraint *>(object)->getConstraintType().getTypeId();
+
+		icon = GuiUtilsNs::getIconPath(node->obj_type, sub_type);
+
+		if(node->node_type == ObjectNode)
+		{
+			has_children = !getGroupTypes(node->obj_type).empty() ||
+										 (node->obj_type == ObjectType::Tag && !object->getReferences().empty()) ||
+										 (isTypeVisible(ObjectType::Permission) && Permission::acceptsPermission(node->obj_type));
+		}
+	}
+
+	if(node->text == text && node->tooltip == tooltip && node->icon == icon &&
+		 node->item_id == item_id && node->fg_color == fg_color &&
+		 node->italic == italic && node->strikeout == strikeout &&
+		 node->has_children == has_children && node->obj_count == obj_count)
+		return false;
+
+	node->text = text;
+	node->tooltip = tooltip;
+	node->icon = icon;
+	node->item_id = item_id;
+	node->fg_color = fg_color;
+	node->italic = italic;
+	node->strikeout = strikeout;
+	node->has_children = has_children;
+	node->obj_count = obj_count;
+
+	return true;
+}
+
+void ObjectsTreeModel::updateRows(TreeNode *parent, int start_row)
+{
+	for(int row = start_row; row < static_cast<int>(parent->children.size()); row++)
+		parent->children[row]->row = row;
+}
+
+void ObjectsTreeModel::insertNodes(TreeNode *parent, std::vector<std::unique_ptr<TreeNode>> &nodes)
+{
+	auto less_than = [](const std::unique_ptr<TreeNode> &node1, const std::unique_ptr<TreeNode> &node2) {
+		return node1->text < node2->text;
+	};
+
+	std::vector<std::unique_ptr<TreeNode>> &children = parent->children;
+	QModelIndex parent_idx = getNodeIndex(parent);
+	size_t node_idx = 0, run_end = 0;
+	int row = 0;
+
+	std::stable_sort(nodes.begin(), nodes.end(), less_than);
+
+	/* Merging the new nodes into the (already sorted) children list. Each run of consecutive
+	 * new nodes is inserted at once so the amount of notifications is proportional to the
+	 * amount of gaps between existing nodes and not to the amount of new nodes */
+	while(node_idx < nodes.size())
+	{
+		while(row < static_cast<int>(children.size()) && !less_than(nodes[node_idx], children[row]))
+			row++;
+
+		run_end = node_idx;
+
+		while(run_end < nodes.size() &&
+					(row == static_cast<int>(children.size()) || less_than(nodes[run_end], children[row])))
+			run_end++;
+
+		beginInsertRows(parent_idx, row, row + static_cast<int>(run_end - node_idx) - 1);
+
+		for(size_t idx = node_idx; idx < run_end; idx++)
+			nodes[idx]->parent = parent;
+
+		children.insert(children.begin() + row,
+										std::make_move_iterator(nodes.begin() + node_idx),
+										std::make_move_iterator(nodes.begin() + run_end));
+		updateRows(parent, row);
+		endInsertRows();
+
+		row += static_cast<int>(run_end - node_idx);
+		node_idx = run_end;
+	}
+
+	nodes.clear();
+}
+
+void ObjectsTreeModel::removeNodes(TreeNode *parent, int first_row, int last_row)
+{
+	beginRemoveRows(getNodeIndex(parent), first_row, last_row);
+	parent->children.erase(parent->children.begin() + first_row,
+												 parent->children.begin() + last_row + 1);
+	updateRows(parent, first_row);
+	endRemoveRows();
+}
+
+void ObjectsTreeModel::repositionNode(TreeNode *node)
+{
+	TreeNode *parent = node->parent;
+	std::vector<std::unique_ptr<TreeNode>> &children = parent->children;
+	QModelIndex parent_idx = getNodeIndex(parent);
+	int old_row = node->row, new_row = 0;
+
+	for(auto &child : children)
+	{
+		if(child.get() != node && !(node->text < child->text))
+			new_row++;
+	}
+
+	if(new_row == old_row)
+		return;
+
+	beginMoveRows(parent_idx, old_row, old_row, parent_idx, new_row > old_row ? new_row + 1 : new_row);
+
+	std::unique_ptr<TreeNode> aux_node = std::move(children[old_row]);
+	children.erase(children.begin() + old_row);
+	children.insert(children.begin() + new_row, std::move(aux_node));
+	updateRows(parent, std::min(old_row, new_row));
+
+	endMoveRows();
+}
+
+void ObjectsTreeModel::syncNode(TreeNode *node, bool recursive)
+{
+	if(!node || !node->populated)
+		return;
+
+	std::vector<NodeSpec> specs = getChildrenSpecs(node);
+	std::set<NodeSpec> new_specs(specs.begin(), specs.end()), curr_specs;
+	std::vector<std::unique_ptr<TreeNode>> new_nodes;
+	std::vector<TreeNode *> curr_nodes;
+	int row = 0, last_row = 0;
+	QString prev_text;
+	QModelIndex index;
+
+	/* Removing the nodes that don't exist in the database model anymore. Note that
+	 * the objects of these nodes are never accessed since they can be already destroyed */
+	row = static_cast<int>(node->children.size()) - 1;
+
+	while(row >= 0)
+	{
+		last_row = row;
+
+		while(row >= 0 && !new_specs.count(node->children[row]->getSpec()))
+			row--;
+
+		if(row < last_row)
+			removeNodes(node, row + 1, last_row);
+
+		row--;
+	}
+
+	//Updating the remaining nodes
+	for(auto &child : node->children)
+	{
+		curr_specs.insert(child->getSpec());
+		curr_nodes.push_back(child.get());
+	}
+
+	for(auto &child : curr_nodes)
+	{
+		prev_text = child->text;
+
+		if(configureNode(child))
+		{
+			index = getNodeIndex(child);
+			emit dataChanged(index, index);
+
+			if(prev_text != child->text)
+				repositionNode(child);
+		}
+
+		if(recursive)
+			syncNode(child, true);
+	}
+
+	//Creating the nodes of new objects
+	for(auto &spec : specs)
+	{
+		if(curr_specs.count(spec))
+			continue;
+
+		new_nodes.push_back(std::make_unique<TreeNode>(node, spec.node_type, spec.object, spec.obj_type));
+		configureNode(new_nodes.back().get());
+	}
+
+	if(!new_nodes.empty())
+		insertNodes(node, new_nodes);
+}
+
+void ObjectsTreeModel::updateModel()
+{
+	if(!db_model)
+		return;
+
+	clearSchemaObjects();
+	filterModifiedObjects();
+	syncNode(root.get(), true);
+}
+
+ObjectsTreeModel::TreeNode *ObjectsTreeModel::getChildNode(TreeNode *parent, NodeType node_type, BaseObject *object, ObjectType obj_type) const
+{
+	if(!parent)
+		return nullptr;
+
+	for(auto &child : parent->children)
+	{
+		if(child->node_type == node_type && child->object == object && child->obj_type == obj_type)
+			return child.get();
+	}
+
+	return nullptr;
+}
+
+ObjectsTreeModel::TreeNode *ObjectsTreeModel::getGroupNode(BaseObject *object) const
+{
+	ObjectType obj_type = object->getObjectType();
+	BaseObject *schema = object->getSchema();
+	TreeNode *owner_node = getChildNode(root.get(), ObjectNode, db_model, ObjectType::Database);
+
+	if(obj_type == ObjectType::BaseRelationship)
+		obj_type = ObjectType::Relationship;
+
+	if(schema)
+	{
+		owner_node = getChildNode(getChildNode(owner_node, GroupNode, db_model, ObjectType::Schema),
+													 ObjectNode, schema, ObjectType::Schema);
+	}
+
+	return getChildNode(owner_node, GroupNode, schema ? schema : db_model, obj_type);
+}
+
+void ObjectsTreeModel::updateGroupNode(BaseObject *object)
+{
+	TreeNode *grp_node = getGroupNode(object);
+	QModelIndex index;
+
+	/* While filtering, the group item may not exist yet or may become empty,
+	 * so the item that owns the group is also synchronized */
+	if(isFilterActive())
+	{
+		TreeNode *owner_node = grp_node ? grp_node->parent : nullptr;
+
+		if(!owner_node)
+		{
+			BaseObject *schema = object->getSchema();
+			owner_node = getChildNode(root.get(), ObjectNode, db_model, ObjectType::Database);
+
+			if(schema)
+				owner_node = getChildNode(getChildNode(owner_node, GroupNode, db_model, ObjectType::Schema),
+															 ObjectNode, schema, ObjectType::Schema);
+		}
+
+		syncNode(owner_node, false);
+		grp_node = getGroupNode(object);
+	}
+
+	if(!grp_node)
+		return;
+
+	if(configureNode(grp_node))
+	{
+		index = getNodeIndex(grp_node);
+		emit dataChanged(index, index);
+	}
+
+	syncNode(grp_node, false);
+}
+
+void ObjectsTreeModel::handleObjectAdded(BaseObject *object)
+{
+	if(!object || object->getObjectType() == ObjectType::Permission)
+		return;
+
+	updateSchemaObjects(object, false);
+
+	if(isFilterActive())
+		filterObject(object);
+
+	updateGroupNode(object);
+}
+
+void ObjectsTreeModel::handleObjectRemoved(BaseObject *object)
+{
+	if(!object || object->getObjectType() == ObjectType::Permission)
+		return;
+
+	updateSchemaObjects(object, true);
+	filter_matches.erase(object);
+	filter_parents.erase(object);
+	updateGroupNode(object);
+}
+
+ObjectsTreeModel::TreeNode *ObjectsTreeModel::getNode(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return root.get();
+
+	return static_cast<TreeNode *>(index.internalPointer());
+}
+
+QModelIndex ObjectsTreeModel::getNodeIndex(TreeNode *node) const
+{
+	if(!node || node == root.get())
+		return QModelIndex();
+
+	return createIndex(node->row, 0, node);
+}
+
+ObjectsTreeModel::TreeNode *ObjectsTreeModel::findNode(TreeNode *parent, BaseObject *object) const
+{
+	for(auto &child : parent->children)
+	{
+		if(child->node_type == ObjectNode && child->object == object)
+			return child.get();
+
+		TreeNode *node = findNode(child.get(), object);
+
+		if(node)
+			return node;
+	}
+
+	return nullptr;
+}
+
+ObjectsTreeModel::TreeNode *ObjectsTreeModel::findNode(TreeNode *parent, const QString &item_id) const
+{
+	for(auto &child : parent->children)
+	{
+		if(child->item_id == item_id)
+			return child.get();
+
+		TreeNode *node = findNode(child.get(), item_id);
+
+		if(node)
+			return node;
+	}
+
+	return nullptr;
+}
+
+QModelIndex ObjectsTreeModel::getIndex(BaseObject *object) const
+{
+	if(!object)
+		return QModelIndex();
+
+	return getNodeIndex(findNode(root.get(), object));
+}
+
+QModelIndex ObjectsTreeModel::getIndex(const QString &item_id) const
+{
+	if(item_id.isEmpty())
+		return QModelIndex();
+
+	return getNodeIndex(findNode(root.get(), item_id));
+}
+
+QModelIndex ObjectsTreeModel::revealObject(BaseObject *object)
+{
+	if(!object || !db_model)
+		return QModelIndex();
+
+	std::vector<BaseObject *> path;
+	TableObject *tab_obj = nullptr;
+	BaseObject *obj = object, *owner = db_model;
+	TreeNode *node = root.get();
+	ObjectType grp_type;
+
+	//Building the path from the outermost container (schema) to the object itself
+	while(obj && obj != db_model)
+	{
+		path.insert(path.begin(), obj);
+		tab_obj = dynamic_cast<TableObject *>(obj);
+		obj = tab_obj ? tab_obj->getParentTable() : obj->getSchema();
+	}
+
+	clearSchemaObjects();
+	populateNode(root.get());
+	node = getChildNode(node, ObjectNode, db_model, ObjectType::Database);
+
+	for(auto &path_obj : path)
+	{
+		if(!node)
+			break;
+
+		grp_type = path_obj->getObjectType() == ObjectType::BaseRelationship ?
+								 ObjectType::Relationship : path_obj->getObjectType();
+
+		populateNode(node);
+		node = getChildNode(node, GroupNode, owner, grp_type);
+
+		if(node)
+		{
+			populateNode(node);
+			node = getChildNode(node, ObjectNode, path_obj, path_obj->getObjectType());
+		}
+
+		owner = path_obj;
+	}
+
+	return getNodeIndex(node);
+}
+
+BaseObject *ObjectsTreeModel::getObject(const QModelIndex &index)
+{
+	if(!index.isValid())
+		return nullptr;
+
+	TreeNode *node = static_cast<TreeNode *>(index.internalPointer());
+
+	//Group items have no object associated
+	if(node->node_type == GroupNode)
+		return nullptr;
+
+	return node->object;
+}
+
+BaseObject *ObjectsTreeModel::getValidObject(const QModelIndex &index) const
+{
+	if(!index.isValid() || getNode(index)->node_type == GroupNode ||
+		 !isNodeObjectValid(getNode(index)))
+		return nullptr;
+
+	return getObject(index);
+}
+
+bool ObjectsTreeModel::isNodeObjectValid(TreeNode *node) const
+{
+	if(!db_model || !node || node == root.get())
+		return false;
+
+	//The object of a permission item is the one that owns the permissions (the parent item's object)
+	if(node->node_type == PermissionNode)
+		node = node->parent;
+
+	if(node->node_type != ObjectNode && node->node_type != ReferenceNode)
+		return false;
+
+	if(node->object == db_model)
+		return true;
+
+	//Table children are searched in their tables, which are validated first
+	if(TableObject::isTableObject(node->obj_type))
+	{
+		TreeNode *grp_node = node->parent;
+		std::vector<BaseObject *> objects;
+
+		if(!grp_node || grp_node->node_type != GroupNode || !isNodeObjectValid(grp_node->parent))
+			return false;
+
+		objects = getGroupObjects(grp_node->object, node->obj_type);
+		return std::find(objects.begin(), objects.end(), node->object) != objects.end();
+	}
+
+	std::vector<BaseObject *> *obj_list = db_model->getObjectList(node->obj_type);
+	return obj_list && std::find(obj_list->begin(), obj_list->end(), node->object) != obj_list->end();
+}
+
+QModelIndexList ObjectsTreeModel::getPopulatedIndexes(const QModelIndex &parent) const
+{
+	QModelIndexList indexes;
+	TreeNode *node = getNode(parent);
+
+	for(auto &child : node->children)
+	{
+		indexes.append(getNodeIndex(child.get()));
+		indexes.append(getPopulatedIndexes(indexes.back()));
+	}
+
+	return indexes;
+}
+
+int ObjectsTreeModel::rowCount(const QModelIndex &parent) const
+{
+	if(parent.column() > 0)
+		return 0;
+
+	return static_cast<int>(getNode(parent)->children.size());
+}
+
+int ObjectsTreeModel::columnCount(const QModelIndex &) const
+{
+	return 1;
+}
+
+QModelIndex ObjectsTreeModel::index(int row, int column, const QModelIndex &parent) const
+{
+	TreeNode *node = getNode(parent);
+
+	if(column != 0 || row < 0 || row >= static_cast<int>(node->children.size()))
+		return QModelIndex();
+
+	return createIndex(row, column, node->children[row].get());
+}
+
+QModelIndex ObjectsTreeModel::parent(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return QModelIndex();
+
+	return getNodeIndex(getNode(index)->parent);
+}
+
+QVariant ObjectsTreeModel::data(const QModelIndex &index, int role) const
+{
+	if(!index.isValid())
+		return QVariant();
+
+	TreeNode *node = getNode(index);
+
+	if(role == Qt::DisplayRole)
+		return node->text;
+
+	if(role == Qt::ToolTipRole && !node->tooltip.isEmpty())
+		return node->tooltip;
+
+	if(role == Qt::DecorationRole)
+		return QIcon(node->icon);
+
+	if(role == Qt::ForegroundRole && node->fg_color.isValid())
+		return node->fg_color;
+
+	if(role == Qt::FontRole)
+	{
+		QFont font;
+		font.setItalic(node->italic);
+		font.setStrikeOut(node->strikeout);
+		return font;
+	}
+
+	if(role == ObjectRole)
+		return QVariant::fromValue<void *>(reinterpret_cast<void *>(getObject(index)));
+
+	if(role == ObjectTypeRole)
+		return enum_t(node->obj_type);
+
+	if(role == ItemIdRole)
+		return node->item_id;
+
+	if(role == NodeTypeRole)
+		return enum_t(node->node_type);
+
+	return QVariant();
+}
+
+Qt::ItemFlags ObjectsTreeModel::flags(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return Qt::NoItemFlags;
+
+	return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+bool ObjectsTreeModel::hasChildren(const QModelIndex &parent) const
+{
+	TreeNode *node = getNode(parent);
+
+	if(node->populated || node == root.get())
+		return !node->children.empty() || !node->populated;
+
+	/* Guessing if the item has children without creating them. This is called for each
+	 * visible item (even before a pending sync) so only the values cached in the node are
+	 * used here, the node's object is never dereferenced since it may be already destroyed */
+	if(node->node_type == GroupNode)
+		return node->obj_count > 0;
+
+	if(node->node_type == ObjectNode)
+	{
+		if(isFilterActive())
+			return filter_parents.count(node->object) > 0;
+
+		return node->has_children;
+	}
+
+	return false;
+}
+
+bool ObjectsTreeModel::canFetchMore(const QModelIndex &parent) const
+{
+	return !getNode(parent)->populated;
+}
+
+void ObjectsTreeModel::fetchMore(const QModelIndex &parent)
+{
+	clearSchemaObjects();
+	populateNode(getNode(parent));
+}
+
+void ObjectsTreeModel::populateNode(TreeNode *node)
+{
+	std::vector<std::unique_ptr<TreeNode>> new_nodes;
+
+	if(!node || node->populated)
+		return;
+
+	node->populated = true;
+
+	for(auto &spec : getChildrenSpecs(node))
+	{
+		new_nodes.push_back(std::make_unique<TreeNode>(node, spec.node_type, spec.object, spec.obj_type));
+		configureNode(new_nodes.back().get());
+	}
+
+	if(!new_nodes.empty())
+		insertNodes(node, new_nodes);
+}
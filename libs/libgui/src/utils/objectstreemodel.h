@@ -0,0 +1,325 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class ObjectsTreeModel
+\brief Implements a lazy tree model over a database model. The children of each
+item are only created when the item is expanded in the view for the first time and
+the model changes are applied to the already created items by fine-grained row insertions/removals.
+*/
+
+#ifndef OBJECTS_TREE_MODEL_H
+#define OBJECTS_TREE_MODEL_H
+
+#include "guiglobal.h"
+#include <QAbstractItemModel>
+#include <QColor>
+#include <QMutex>
+#include <memory>
+#include <tuple>
+#include <set>
+#include "databasemodel.h"
+
+class __libgui ObjectsTreeModel: public QAbstractItemModel {
+	Q_OBJECT
+
+	public:
+		enum NodeType: unsigned {
+			//! \brief Node that represents a database object
+			ObjectNode,
+
+			//! \brief Node that groups the objects of a certain type (e.g. "Tables (10)")
+			GroupNode,
+
+			//! \brief Node that represents an object referenced by a tag (has no children)
+			ReferenceNode,
+
+			//! \brief Node that represents the permissions of an object (e.g. "Permissions (2)")
+			PermissionNode
+		};
+
+		enum DataRole: int {
+			//! \brief Returns the object related to the item (or the owner object in case of permission items)
+			ObjectRole = Qt::UserRole,
+
+			//! \brief Returns the object type of the item (the type of the children for group items)
+			ObjectTypeRole,
+
+			//! \brief Returns the item's unique id used to save/restore the tree state
+			ItemIdRole,
+
+			//! \brief Returns the node type (see NodeType)
+			NodeTypeRole
+		};
+
+	private:
+		//! \brief Describes a node that must exist as child of another one
+		struct NodeSpec {
+			NodeType node_type;
+			BaseObject *object;
+			ObjectType obj_type;
+
+			bool operator < (const NodeSpec &spec) const {
+				return std::tie(node_type, object, obj_type) < std::tie(spec.node_type, spec.object, spec.obj_type);
+			}
+		};
+
+		struct TreeNode {
+			TreeNode *parent;
+
+			NodeType node_type;
+
+			//! \brief The object represented by the node or the owner of group/permission nodes
+			BaseObject *object;
+
+			//! \brief The type of the object or the type of the children objects in a group
+			ObjectType obj_type;
+
+			//! \brief The node's position in the parent node's children list
+			int row;
+
+			/*! \brief Indicates that the children of the node were already created.
+			 *  Only populated nodes are kept in sync with the database model */
+			bool populated;
+
+			/*! \brief The display attributes of the node. They are cached during node
+			 *  creation/update so the data() method never dereferences the object
+			 *  (which may be already destroyed when the view repaints before a sync) */
+			QString text, tooltip, icon, item_id;
+
+			QColor fg_color;
+
+			bool italic, strikeout;
+
+			/*! \brief Indicates if an object node can have children. Computed in configureNode(), while the object
+			 *  is known to be valid, so hasChildren() doesn't need to touch the object of unpopulated nodes */
+			bool has_children;
+
+			//! \brief The amount of objects listed by group/permission nodes
+			size_t obj_count;
+
+			std::vector<std::unique_ptr<TreeNode>> children;
+
+			TreeNode(TreeNode *parent, NodeType node_type, BaseObject *object, ObjectType obj_type) :
+				parent(parent), node_type(node_type), object(object), obj_type(obj_type),
+				row(0), populated(false), italic(false), strikeout(false), has_children(false), obj_count(0) {}
+
+			NodeSpec getSpec() const {
+				return NodeSpec { node_type, object, obj_type };
+			}
+		};
+
+		DatabaseModel *db_model;
+
+		//! \brief The invisible root node of the tree
+		std::unique_ptr<TreeNode> root;
+
+		//! \brief Stores which object types are visible on the tree
+		std::map<ObjectType, bool> visible_objs;
+
+		QString filter_pattern;
+
+		bool filter_by_id;
+
+		/*! \brief Stores the objects matching the current filter and the objects that
+		 *  contain them (database, schemas, tables, views and tags). While filtering,
+		 *  only the nodes of these objects are created */
+		std::set<BaseObject *> filter_matches, filter_parents;
+
+		/*! \brief Stores the types of the group items whose names match the current filter.
+		 *  These groups are listed (together with the objects that own them) even if none
+		 *  of their children matches the filter */
+		std::set<ObjectType> filter_groups;
+
+		/*! \brief Stores the objects of each schema per object type. Each entry is built with a single pass over
+		 *  the model's list of that type so counting/listing the objects of several schemas doesn't scan the list
+		 *  once per schema. The cache is discarded at the beginning of each operation that reads the database model */
+		mutable std::map<ObjectType, std::map<BaseObject *, std::vector<BaseObject *>>> schema_objs;
+
+		/*! \brief Stores the objects modified since the last synchronization so only them are evaluated
+		 *  against the current filter in updateModel(). Since objects can be modified in secondary threads
+		 *  (e.g. during the export) the set is filled in the emitting thread and guarded by the modified_mutex */
+		std::set<BaseObject *> modified_objs;
+
+		QMutex modified_mutex;
+
+		//! \brief Returns the node related to the index (the root node when the index is invalid)
+		TreeNode *getNode(const QModelIndex &index) const;
+
+		QModelIndex getNodeIndex(TreeNode *node) const;
+
+		//! \brief Returns the objects listed by a group node (not filtered)
+		std::vector<BaseObject *> getGroupObjects(BaseObject *owner, ObjectType obj_type) const;
+
+		//! \brief Returns the amount of objects listed by a group node (not filtered)
+		size_t getGroupObjectCount(BaseObject *owner, ObjectType obj_type) const;
+
+		//! \brief Returns the objects of the provided type grouped by schema (see schema_objs)
+		const std::map<BaseObject *, std::vector<BaseObject *>> &getSchemaObjects(ObjectType obj_type) const;
+
+		//! \brief Discards the objects cached per schema so they are retrieved again from the database model
+		void clearSchemaObjects();
+
+		/*! \brief Inserts/removes the object in the list of its schema in the objects cached per schema (see schema_objs)
+		 *  so an insertion/removal in the database model doesn't discard the lists of all the other objects */
+		void updateSchemaObjects(BaseObject *object, bool removed);
+
+		//! \brief Returns the types of the groups created for objects of the provided type
+		std::vector<ObjectType> getGroupTypes(ObjectType obj_type) const;
+
+		//! \brief Returns the specs of all the nodes that must be children of the provided node
+		std::vector<NodeSpec> getChildrenSpecs(TreeNode *node) const;
+
+		bool isTypeVisible(ObjectType obj_type) const;
+
+		//! \brief Returns if the node of the provided object must exist considering the current filter
+		bool isObjectAccepted(BaseObject *object) const;
+
+		bool matchesFilter(BaseObject *object) const;
+
+		//! \brief Stores in the filter parents set all the objects that contain the provided one
+		void addFilterParents(BaseObject *object);
+
+		//! \brief Returns if the object owns one of the groups matching the filter (see filter_groups)
+		bool ownsFilterGroups(BaseObject *object) const;
+
+		//! \brief Stores the object in the filter matches/parents sets if it matches the filter or owns matching groups
+		void filterObject(BaseObject *object);
+
+		//! \brief Collects the objects matching the filter from the candidates list
+		void applyFilter(const std::vector<BaseObject *> &candidates);
+
+		//! \brief Evaluates again against the current filter the objects modified since the last synchronization
+		void filterModifiedObjects();
+
+		//! \brief Returns all the objects of the database model that can be listed in the tree
+		std::vector<BaseObject *> getAllObjects() const;
+
+		//! \brief Configures the display attributes of the node. Returns true when at least one of them changed
+		bool configureNode(TreeNode *node) const;
+
+		/*! \brief Creates/removes/updates the children of a populated node (and of its populated
+		 *  descendants when recursive is true) so they reflect the current state of the database model */
+		void syncNode(TreeNode *node, bool recursive);
+
+		//! \brief Inserts the nodes in the children list of the parent keeping the list sorted by the nodes' texts
+		void insertNodes(TreeNode *parent, std::vector<std::unique_ptr<TreeNode>> &nodes);
+
+		void removeNodes(TreeNode *parent, int first_row, int last_row);
+
+		//! \brief Moves the node to the correct position in the parent's list after its text was changed
+		void repositionNode(TreeNode *node);
+
+		void updateRows(TreeNode *parent, int start_row);
+
+		//! \brief Returns the direct child of the parent node that matches the provided attributes
+		TreeNode *getChildNode(TreeNode *parent, NodeType node_type, BaseObject *object, ObjectType obj_type) const;
+
+		//! \brief Returns the group node (if created) in which the provided object is listed
+		TreeNode *getGroupNode(BaseObject *object) const;
+
+		//! \brief Updates the group node in which the object is listed after its insertion/removal in the database model
+		void updateGroupNode(BaseObject *object);
+
+		//! \brief Creates the children of the node (if not created yet)
+		void populateNode(TreeNode *node);
+
+		/*! \brief Returns if the object of the node still exists in the database model. The check is done only by
+		 *  comparing pointers (starting from the outermost container) so a destroyed object is never dereferenced */
+		bool isNodeObjectValid(TreeNode *node) const;
+
+		//! \brief Returns the node of the object searching only the already created nodes
+		TreeNode *findNode(TreeNode *parent, BaseObject *object) const;
+
+		TreeNode *findNode(TreeNode *parent, const QString &item_id) const;
+
+	public:
+		explicit ObjectsTreeModel(QObject *parent = nullptr);
+
+		virtual ~ObjectsTreeModel() = default;
+
+		//! \brief Returns the text displayed for the object in the tree
+		static QString getObjectText(BaseObject *object);
+
+		void setDatabaseModel(DatabaseModel *db_model);
+
+		DatabaseModel *getDatabaseModel();
+
+		//! \brief Changes the visible object types. This will recreate the whole tree
+		void setObjectsVisible(const std::map<ObjectType, bool> &visible_objs);
+
+		const std::map<ObjectType, bool> &getObjectsVisible();
+
+		/*! \brief Filters the objects by name (or id when by_id is true). If the new pattern
+		 *  narrows down the current one, only the currently matched objects are evaluated again.
+		 *  The already created nodes are updated via row insertions/removals, never by a model reset */
+		void setFilter(const QString &pattern, bool by_id);
+
+		bool isFilterActive() const;
+
+		//! \brief Returns the objects matching the current filter
+		std::vector<BaseObject *> getFilterMatches();
+
+		/*! \brief Returns true when the index is an item that contains filter matches and
+		 *  should be expanded in order to reveal them */
+		bool isFilterPath(const QModelIndex &index) const;
+
+		//! \brief Returns the index of the object searching only the already created nodes
+		QModelIndex getIndex(BaseObject *object) const;
+
+		//! \brief Returns the index of the item with the provided id searching only the already created nodes
+		QModelIndex getIndex(const QString &item_id) const;
+
+		/*! \brief Returns the index of the object creating (if needed) all the items in the
+		 *  path from the database item to the object's item */
+		QModelIndex revealObject(BaseObject *object);
+
+		/*! \brief Returns the object related to the index. The returned object may be already destroyed
+		 *  if the item was not synchronized yet, use getValidObject() before accessing it */
+		static BaseObject *getObject(const QModelIndex &index);
+
+		/*! \brief Returns the object related to the index only if it still exists in the database model.
+		 *  Returns null for group items or when the object was removed but the item wasn't synchronized yet */
+		BaseObject *getValidObject(const QModelIndex &index) const;
+
+		//! \brief Returns all the already created indexes in pre-order (used to save the tree state)
+		QModelIndexList getPopulatedIndexes(const QModelIndex &parent = QModelIndex()) const;
+
+		virtual int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+		virtual int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+		virtual QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+		virtual QModelIndex parent(const QModelIndex &index) const override;
+		virtual QVariant data(const QModelIndex &index, int role) const override;
+		virtual Qt::ItemFlags flags(const QModelIndex &index) const override;
+		virtual bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+		virtual bool canFetchMore(const QModelIndex &parent) const override;
+		virtual void fetchMore(const QModelIndex &parent) override;
+
+	public slots:
+		/*! \brief Synchronizes the created nodes with the current state of the database model.
+		 *  Only the populated nodes are visited so the cost is proportional to the expanded items.
+		 *  While filtering, only the objects modified since the last call are evaluated against the filter */
+		void updateModel();
+
+	private slots:
+		void handleObjectAdded(BaseObject *object);
+		void handleObjectRemoved(BaseObject *object);
+};
+
+#endif
@@ -20,8 +20,14 @@
 #include "guiutilsns.h"
 #include <pgsqltypes/pgsqltype.h>
 
+unsigned ResultSetModel::fetch_batch_size {1000};
+unsigned ResultSetModel::rows_limit {100000};
+
 ResultSetModel::ResultSetModel(ResultSet &res, Catalog &catalog, QObject *parent) : QAbstractTableModel(parent)
 {
+	streaming = truncated = false;
+	pending_rows = 0;
+
 	try
 	{
 		Catalog aux_cat = catalog;
@@ -78,7 +84,7 @@ ResultSetModel::ResultSetModel(ResultSet &res, Catalog &catalog, QObject *parent
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -168,7 +174,7 @@ void ResultSetModel::append(ResultSet &res)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -177,6 +183,99 @@ bool ResultSetModel::isEmpty()
 	return (row_count <= 0);
 }
 
+void ResultSetModel::startStreaming()
+{
+	streaming = true;
+	pending_rows = 0;
+}
+
+void ResultSetModel::stopStreaming()
+{
+	if(streaming)
+		finishStreaming();
+}
+
+void ResultSetModel::finishStreaming()
+{
+	streaming = false;
+	pending_rows = 0;
+	emit s_streamingFinished();
+}
+
+void ResultSetModel::appendStreamedRows(const QStringList &rows_data, int rows_count, bool truncated)
+{
+	//Rows arriving after the streaming was stopped are ignored
+	if(!streaming)
+		return;
+
+	this->truncated = this->truncated || truncated;
+
+	if(rows_count <= 0)
+		return;
+
+	beginInsertRows(QModelIndex(), row_count, row_count + rows_count - 1);
+	item_data.append(rows_data);
+	row_count += rows_count;
+	endInsertRows();
+
+	pending_rows = pending_rows > static_cast<unsigned>(rows_count) ? pending_rows - rows_count : 0;
+}
+
+void ResultSetModel::fetchAllStreamedRows()
+{
+	if(!streaming)
+		return;
+
+	pending_rows = static_cast<unsigned>(row_count) < rows_limit ? rows_limit - row_count : 0;
+	emit s_rowsRequested(pending_rows);
+}
+
+bool ResultSetModel::canFetchMore(const QModelIndex &parent) const
+{
+	//While the rows of a previous request are being received no more rows are requested
+	return !parent.isValid() && streaming &&
+				 pending_rows == 0 && static_cast<unsigned>(row_count) < rows_limit;
+}
+
+void ResultSetModel::fetchMore(const QModelIndex &parent)
+{
+	if(parent.isValid() || !streaming || pending_rows > 0)
+		return;
+
+	pending_rows = fetch_batch_size;
+	emit s_rowsRequested(pending_rows);
+}
+
+bool ResultSetModel::isStreaming()
+{
+	return streaming;
+}
+
+bool ResultSetModel::isTruncated()
+{
+	return truncated;
+}
+
+void ResultSetModel::setFetchBatchSize(unsigned size)
+{
+	fetch_batch_size = size > 0 ? size : 1;
+}
+
+unsigned ResultSetModel::getFetchBatchSize()
+{
+	return fetch_batch_size;
+}
+
+void ResultSetModel::setRowsLimit(unsigned limit)
+{
+	rows_limit = limit > 0 ? limit : 1;
+}
+
+unsigned ResultSetModel::getRowsLimit()
+{
+	return rows_limit;
+}
+
 QString ResultSetModel::getPgTypeIconName(const QString &type)
 {
 	try
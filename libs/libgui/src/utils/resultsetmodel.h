@@ -41,6 +41,23 @@ class __libgui ResultSetModel: public QAbstractTableModel {
 
 		QList<QIcon> header_icons;
 
+		/*! \brief Indicates that the model holds the rows of a streamed command which were not completely retrieved.
+		 *  The remaining rows are requested via s_rowsRequested() and delivered by appendStreamedRows() */
+		bool streaming;
+
+		//! \brief The maximum amount of rows retrieved from a streamed command each time fetchMore() is called
+		static unsigned fetch_batch_size;
+
+		/*! \brief The maximum amount of rows of a streamed command kept in the model. The rows
+		 *  exceeding this limit are discarded as they arrive so the memory used by the model is bounded */
+		static unsigned rows_limit;
+
+		//! \brief Indicates that rows of the streamed command were discarded due to the rows limit
+		bool truncated;
+
+		//! \brief The amount of rows requested via s_rowsRequested() that were not yet received
+		unsigned pending_rows;
+
 		void insertColumn(int, const QModelIndex &){}
 		void insertRow(int, const QModelIndex &){}
 
@@ -56,7 +73,48 @@ class __libgui ResultSetModel: public QAbstractTableModel {
 		void append(ResultSet &res);
 		bool isEmpty();
 
+		/*! \brief Marks the model as holding the first rows of a streamed command. The model doesn't access the connection
+		 *  in which the command runs, the remaining rows are requested through s_rowsRequested() as the view needs them */
+		void startStreaming();
+
+		//! \brief Stops requesting rows of the streamed command, emitting s_streamingFinished()
+		void stopStreaming();
+
+		/*! \brief Requests all the remaining rows of the streamed command (up to the rows limit).
+		 *  The rows are appended as they arrive and s_streamingFinished() is emitted once the command ends */
+		void fetchAllStreamedRows();
+
+		//! \brief Returns true when there's a streamed command which rows were not completely retrieved
+		bool isStreaming();
+
+		//! \brief Returns true when the remaining rows of the streamed command were discarded due to the rows limit
+		bool isTruncated();
+
+		virtual bool canFetchMore(const QModelIndex &parent) const;
+		virtual void fetchMore(const QModelIndex &parent);
+
+		static void setFetchBatchSize(unsigned size);
+		static unsigned getFetchBatchSize();
+
+		static void setRowsLimit(unsigned limit);
+		static unsigned getRowsLimit();
+
 		static QString getPgTypeIconName(const QString &type);
+
+	public slots:
+		/*! \brief Appends the rows retrieved from the streamed command. The rows_data holds the values of rows_count rows
+		 *  in sequence, the truncated flag indicates that rows were discarded due to the rows limit */
+		void appendStreamedRows(const QStringList &rows_data, int rows_count, bool truncated);
+
+		//! \brief Indicates that all the rows of the streamed command were retrieved, emitting s_streamingFinished()
+		void finishStreaming();
+
+	signals:
+		//! \brief Signal emitted when all the results of the streamed command were retrieved or the streaming was stopped
+		void s_streamingFinished();
+
+		//! \brief Signal emitted when more rows of the streamed command are needed
+		void s_rowsRequested(unsigned max_rows);
 };
 
 #endif
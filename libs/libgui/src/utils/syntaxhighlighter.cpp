@@ -29,7 +29,7 @@ QFont SyntaxHighlighter::default_font {"Source Code Pro", 12};
 SyntaxHighlighter::SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mode, bool use_custom_tab_width, qreal custom_fnt_size) : QSyntaxHighlighter(parent)
 {
 	if(!parent)
-		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__exc_origin);
 
 	code_field_txt = parent;
 
@@ -611,13 +611,13 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 						if(group_confs.contains(group))
 						{
 							throw Exception(Exception::getErrorMessage(ErrorCode::DefDuplicatedGroup).arg(group),
-															 ErrorCode::DefDuplicatedGroup, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+															 ErrorCode::DefDuplicatedGroup, __exc_origin);
 						}
 						//Raises an error if the group does not have children element
 						else if(!xmlparser.hasElement(XmlParser::ChildElement))
 						{
 							throw Exception(Exception::getErrorMessage(ErrorCode::DefEmptyGroup).arg(group),
-															ErrorCode::DefEmptyGroup, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+															ErrorCode::DefEmptyGroup, __exc_origin);
 						}
 
 						case_sensitive = attribs[Attributes::CaseSensitive] == Attributes::True;
@@ -705,19 +705,19 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 								if(!regexp.isValid())
 								{
 									throw Exception(Exception::getErrorMessage(ErrorCode::InvGroupRegExpPattern).arg(group, filename, regexp.errorString()),
-																	ErrorCode::InvGroupRegExpPattern, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
+																	ErrorCode::InvGroupRegExpPattern, __exc_origin, nullptr,
 																	tr("Pattern: %1").arg(regexp.pattern()));
 								}
 								else if(group_cfg.persistent && (initial_expr || final_expr))
 								{
 									throw Exception(Exception::getErrorMessage(ErrorCode::InvExprPersistentGroup).arg(group, filename),
-																	 ErrorCode::InvExprPersistentGroup, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
+																	 ErrorCode::InvExprPersistentGroup, __exc_origin, nullptr,
 																	 tr("Pattern: %1").arg(regexp.pattern()));
 								}
 								else if(initial_expr && final_expr)
 								{
 									throw Exception(Exception::getErrorMessage(ErrorCode::InvExprMultilineGroup).arg(group, filename),
-																	 ErrorCode::InvExprMultilineGroup, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
+																	 ErrorCode::InvExprMultilineGroup, __exc_origin, nullptr,
 																	 tr("Pattern: %1").arg(regexp.pattern()));
 								}
 
@@ -747,7 +747,7 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e, filename);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, filename);
 	}
 }
 
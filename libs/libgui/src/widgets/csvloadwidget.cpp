@@ -69,7 +69,7 @@ CsvDocument CsvLoadWidget::loadCsvFromBuffer(const QString &csv_buffer, const QC
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
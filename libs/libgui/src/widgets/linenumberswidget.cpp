@@ -29,7 +29,7 @@ QColor LineNumbersWidget::bg_color { Qt::black };
 LineNumbersWidget::LineNumbersWidget(QPlainTextEdit * parent) : QWidget(parent)
 {
 	if(!parent)
-		throw Exception(ErrorCode::AsgNotAllocattedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgNotAllocattedObject ,__exc_origin);
 
 	parent_edt = qobject_cast<QPlainTextEdit *>(parent);
 	first_line = line_count=start_sel_pos=0;
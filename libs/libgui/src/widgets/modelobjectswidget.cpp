@@ -17,10 +17,8 @@
 */
 
 #include "modelobjectswidget.h"
-#include "tools/databaseimportform.h"
 #include "guiutilsns.h"
 #include "settings/generalconfigwidget.h"
-#include "customtablewidget.h"
 #include <QScrollBar>
 
 ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) : QWidget(parent)
@@ -29,6 +27,8 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	obj_types_wgt = nullptr;
 	model_wgt=nullptr;
 	db_model=nullptr;
+	objects_tree_mdl = new ObjectsTreeModel(this);
+	objectstree_view->setModel(objects_tree_mdl);
 	setModel(db_model);
 
 	title_wgt->setVisible(!simplified_view);
@@ -42,30 +42,29 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	visibleobjects_grp->setVisible(false);
 	filter_wgt->setVisible(simplified_view);
 
-	connect(objectstree_tw, &QTreeWidget::itemPressed, this, &ModelObjectsWidget::selectObject);
-	connect(objectstree_tw, &QTreeWidget::itemPressed, this, &ModelObjectsWidget::showObjectMenu);
-	//connect(objectstree_tw, &QTreeWidget::itemSelectionChanged, this, &ModelObjectsWidget::selectObject);
+	connect(objectstree_view, &QTreeView::pressed, this, &ModelObjectsWidget::selectObject);
+	connect(objectstree_view, &QTreeView::pressed, this, &ModelObjectsWidget::showObjectMenu);
 
-	connect(objectstree_tw, &QTreeWidget::itemCollapsed, this, [this](){
-		objectstree_tw->resizeColumnToContents(0);
+	connect(objectstree_view, &QTreeView::collapsed, this, [this](){
+		objectstree_view->resizeColumnToContents(0);
 	});
 
-	connect(objectstree_tw, &QTreeWidget::itemExpanded, this, [this](){
-		objectstree_tw->resizeColumnToContents(0);
+	connect(objectstree_view, &QTreeView::expanded, this, [this](){
+		objectstree_view->resizeColumnToContents(0);
 	});
 
 	connect(expand_all_tb, &QToolButton::clicked,  this, [this](){
-		objectstree_tw->blockSignals(true);
-		objectstree_tw->expandAll();
-		objectstree_tw->blockSignals(false);
-		objectstree_tw->resizeColumnToContents(0);
+		objectstree_view->blockSignals(true);
+		objectstree_view->expandAll();
+		objectstree_view->blockSignals(false);
+		objectstree_view->resizeColumnToContents(0);
 	});
 
 	connect(collapse_all_tb, &QToolButton::clicked,  this, [this](){
-		objectstree_tw->blockSignals(true);
-		objectstree_tw->collapseAll();
-		objectstree_tw->blockSignals(false);
-		objectstree_tw->resizeColumnToContents(0);
+		objectstree_view->blockSignals(true);
+		objectstree_view->collapseAll();
+		objectstree_view->blockSignals(false);
+		objectstree_view->resizeColumnToContents(0);
 	});
 
 	if(!simplified_view)
@@ -84,12 +83,12 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 			setAllObjectsVisible(state == Qt::Checked);
 		});
 
-		connect(objectstree_tw, &QTreeWidget::itemDoubleClicked, this, &ModelObjectsWidget::editObject);
+		connect(objectstree_view, &QTreeView::doubleClicked, this, &ModelObjectsWidget::editObject);
 		connect(hide_tb, &QToolButton::clicked, this, &ModelObjectsWidget::hide);
 
 		setAllObjectsVisible(true);	
-		objectstree_tw->installEventFilter(this);
-		objectstree_tw->setSelectionMode(QAbstractItemView::ExtendedSelection);
+		objectstree_view->installEventFilter(this);
+		objectstree_view->setSelectionMode(QAbstractItemView::ExtendedSelection);
 	}
 	else
 	{
@@ -98,7 +97,7 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 		setMinimumSize(250, 300);
 		setWindowFlags(Qt::Dialog | Qt::WindowCloseButtonHint | Qt::WindowTitleHint);
 		setWindowModality(Qt::ApplicationModal);
-		connect(objectstree_tw, &QTreeWidget::itemDoubleClicked, this, &ModelObjectsWidget::close);
+		connect(objectstree_view, &QTreeView::doubleClicked, this, &ModelObjectsWidget::close);
 		connect(select_tb, &QToolButton::clicked, this, &ModelObjectsWidget::close);
 		connect(cancel_tb, &QToolButton::clicked, this, &ModelObjectsWidget::close);
 	}
@@ -109,7 +108,7 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 
 bool ModelObjectsWidget::eventFilter(QObject *object, QEvent *event)
 {
-	if(event->type() == QEvent::FocusOut && object==objectstree_tw)
+	if(event->type() == QEvent::FocusOut && object==objectstree_view)
 	{
 		QFocusEvent *evnt=dynamic_cast<QFocusEvent *>(event);
 
@@ -165,10 +164,17 @@ void ModelObjectsWidget::editObject()
 {
 	if(selected_objs.size() == 1 && model_wgt && !simplified_view)
 	{
+		QModelIndex curr_idx = objectstree_view->currentIndex();
+
 		//If the user double-clicked the item "Permission (n)" on tree view
-		if(sender()==objectstree_tw && objectstree_tw->currentItem() &&
-			 objectstree_tw->currentItem()->data(1, Qt::UserRole).toUInt() == enum_t(ObjectType::Permission))
-			model_wgt->showObjectForm(ObjectType::Permission, getTreeItemData(objectstree_tw->currentItem()));
+		if(sender()==objectstree_view && curr_idx.isValid() &&
+			 curr_idx.data(ObjectsTreeModel::NodeTypeRole).toUInt() == ObjectsTreeModel::PermissionNode)
+		{
+			BaseObject *perm_owner = objects_tree_mdl->getValidObject(curr_idx);
+
+			if(perm_owner)
+				model_wgt->showObjectForm(ObjectType::Permission, perm_owner);
+		}
 		//If the user double-clicked a permission on  list view
 		else
 			model_wgt->editObject();
@@ -182,7 +188,7 @@ void ModelObjectsWidget::selectObject()
 	BaseObject *selected_obj = nullptr;
 	ObjectType obj_type = ObjectType::BaseObject;
 	ModelWidget *model_wgt = nullptr;
-	QList<QTreeWidgetItem *> sel_items = objectstree_tw->selectedItems();
+	QModelIndexList sel_indexes = objectstree_view->selectionModel()->selectedIndexes();
 
 	if(!simplified_view && this->model_wgt)
 		model_wgt = this->model_wgt;
@@ -190,15 +196,15 @@ void ModelObjectsWidget::selectObject()
 		model_wgt = db_model->getModelWidget();
 
 	selected_objs.clear();
-	QTreeWidgetItem *tree_item = objectstree_tw->currentItem();
+	QModelIndex curr_idx = objectstree_view->currentIndex();
 
-	if(tree_item)
+	if(curr_idx.isValid())
 	{
-		obj_type = static_cast<ObjectType>(tree_item->data(1, Qt::UserRole).toUInt());
+		obj_type = static_cast<ObjectType>(curr_idx.data(ObjectsTreeModel::ObjectTypeRole).toUInt());
 
-		for(auto &item : sel_items)
+		for(auto &index : sel_indexes)
 		{
-			selected_obj = getTreeItemData(item);
+			selected_obj = objects_tree_mdl->getValidObject(index);
 
 			if(selected_obj)
 				selected_objs.push_back(selected_obj);
@@ -262,97 +268,6 @@ void ModelObjectsWidget::selectObject()
 	}
 }
 
-BaseObject *ModelObjectsWidget::getTreeItemData(QTreeWidgetItem *item)
-{
- if(!item)
-	 return nullptr;
-
- return reinterpret_cast<BaseObject *>(item->data(0,Qt::UserRole).value<void *>());
-}
-
-QVariant ModelObjectsWidget::generateItemData(BaseObject *object)
-{
-	return QVariant::fromValue(reinterpret_cast<void *>(object));
-}
-
-QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTreeWidgetItem *root, bool update_perms)
-{
-	QTreeWidgetItem *item=nullptr;
-	QFont font;
-	ObjectType obj_type;
-	TableObject *tab_obj=nullptr;
-	QString obj_name;
-
-	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	obj_type=object->getObjectType();
-	tab_obj=dynamic_cast<TableObject *>(object);
-	item=new QTreeWidgetItem(root);
-
-	if(BaseFunction::isBaseFunction(obj_type))
-	{
-		BaseFunction *func = dynamic_cast<BaseFunction *>(object);
-		func->createSignature(false);
-		item->setText(0,func->getSignature());
-		obj_name = func->getSignature();
-		func->createSignature(true);
-	}
-	else if(obj_type==ObjectType::Operator)
-	{
-		Operator *oper=dynamic_cast<Operator *>(object);
-		item->setText(0, oper->getSignature(false));
-		obj_name=oper->getSignature(false);
-	}
-	else if(obj_type==ObjectType::OpClass || obj_type == ObjectType::OpFamily)
-	{
-		obj_name=object->getSignature(false);
-		obj_name.replace(QRegularExpression("( )+(USING)( )+"), " [");
-		obj_name+=QChar(']');
-		item->setText(0,obj_name);
-	}
-	else
-	{
-		item->setText(0,object->getName());
-		obj_name=object->getName();
-	}
-
-	item->setToolTip(0, QString("%1 (id: %2)").arg(obj_name).arg(object->getObjectId()));
-	item->setData(0, Qt::UserRole, generateItemData(object));
-	item->setData(2, Qt::UserRole, QString("%1_%2").arg(object->getObjectId()).arg(object->getSchemaName()));
-
-	if(update_perms)
-		updatePermissionTree(item, object);
-
-	font=item->font(0);
-	font.setStrikeOut(object->isSQLDisabled() && !object->isSystemObject());
-
-	if(tab_obj && tab_obj->isAddedByRelationship())
-	{
-		font.setItalic(true);
-		item->setForeground(0, CustomTableWidget::getTableItemColor(CustomTableWidget::RelAddedItemAltFgColor));
-	}
-	else if(object->isProtected() || object->isSystemObject())
-	{
-		font.setItalic(true);
-		item->setForeground(0, CustomTableWidget::getTableItemColor(CustomTableWidget::ProtItemAltFgColor));
-	}
-
-	item->setFont(0,font);
-
-	int sub_type = -1;
-
-	if(obj_type == ObjectType::BaseRelationship || obj_type == ObjectType::Relationship)
-		sub_type = dynamic_cast<BaseRelationship *>(object)->getRelationshipType();
-	else if(obj_type == ObjectType::Constraint)
-		sub_type = dynamic_cast<Constraint *>(object)->getConstraintType().getTypeId();
-
-	item->setIcon(0, QIcon(GuiUtilsNs::getIconPath(obj_type, sub_type)));
-	item->setData(2, Qt::UserRole, QString("%1_%2").arg(object->getObjectId()).arg(object->getSchemaName()));
-
-	return item;
-}
-
 void ModelObjectsWidget::setObjectVisible(ObjectType obj_type, bool visible)
 {
 	if(obj_type!=ObjectType::BaseObject && obj_type!=ObjectType::BaseTable)
@@ -400,343 +315,99 @@ void ModelObjectsWidget::changeObjectsView()
 
 void ModelObjectsWidget::collapseAll()
 {
-	QTreeWidgetItem *root=objectstree_tw->topLevelItem(0);
-	objectstree_tw->collapseAll();
+	objectstree_view->collapseAll();
+	expandDatabaseItem();
+}
 
-	if(root)
-		root->setExpanded(true);
+void ModelObjectsWidget::expandDatabaseItem()
+{
+	objectstree_view->expand(objects_tree_mdl->index(0, 0));
 }
 
 void ModelObjectsWidget::filterObjects()
 {
-	DatabaseImportForm::filterObjects(objectstree_tw, filter_edt->text(), (by_id_chk->isChecked() ? 1 : 0), simplified_view);
+	objects_tree_mdl->setFilter(filter_edt->text(), by_id_chk->isChecked());
+	showFilterMatches();
 }
 
-void ModelObjectsWidget::updateObjectsView()
+void ModelObjectsWidget::showFilterMatches()
 {
-	selected_objs.clear();
-	updateDatabaseTree();
+	std::vector<BaseObject *> matches;
 
-	if(!filter_edt->text().isEmpty())
-		filterObjects();
-}
+	objectstree_view->blockSignals(true);
+	objectstree_view->collapseAll();
+	objectstree_view->clearSelection();
 
-void ModelObjectsWidget::updateSchemaTree(QTreeWidgetItem *root)
-{
-	if(db_model && visible_objs_map[ObjectType::Schema])
+	if(filter_edt->text().isEmpty())
+		expandDatabaseItem();
+	else
 	{
-		BaseObject *schema=nullptr;
-		std::vector<BaseObject *> obj_list;
-		QFont font;
-		QTreeWidgetItem *item = nullptr, *item1=nullptr, *item2=nullptr;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Schema);
-		int count = 0;
-		QPixmap group_icon=QPixmap(GuiUtilsNs::getIconPath(QString(BaseObject::getSchemaName(ObjectType::Schema))));
-
-		//Removing the ObjectType::Table and ObjectType::View types since they are handled separetedly
-		types.erase(std::find(types.begin(), types.end(), ObjectType::Table));
-		types.erase(std::find(types.begin(), types.end(), ObjectType::ForeignTable));
-		types.erase(std::find(types.begin(), types.end(), ObjectType::View));
-
-		//Get the current schema count on database
-		count = (db_model->getObjectCount(ObjectType::Schema));
-		item = new QTreeWidgetItem(root);
-		item->setIcon(0,group_icon);
-		item->setData(1, Qt::UserRole, QVariant(enum_t(ObjectType::Schema)));
-
-		//Create the schema group item
-		item->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(ObjectType::Schema)).arg(count));
-		item->setData(2, Qt::UserRole, QString("%1_grp").arg(BaseObject::getSchemaName(ObjectType::Schema)));
-
-		font = item->font(0);
-		font.setItalic(true);
-		item->setFont(0, font);
-
-		try
-		{
-			for(auto &sch_obj : *db_model->getObjectList(ObjectType::Schema))
-			{
-				schema = dynamic_cast<Schema *>(sch_obj);
-				item1 = createItemForObject(schema, item);
-
-				//Updates the table subtree for the current schema
-				updateTableTree(item1, schema, ObjectType::Table);
-
-				//Updates the foreign table subtree for the current schema
-				updateTableTree(item1, schema, ObjectType::ForeignTable);
-
-				//Updates the view subtree for the current schema
-				updateViewTree(item1, schema);
-
-				//Creates the object group at schema level (function, domain, sequences, etc)
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item2 = new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-
-						//Get the objects that belongs to the current schema
-						obj_list = db_model->getObjects(type, schema);
-						item2->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(type)).arg(obj_list.size()));
-						item2->setData(1, Qt::UserRole, QVariant(enum_t(type)));
-						item2->setData(2, Qt::UserRole, QString("%1_%2_grp").arg(schema->getObjectId()).arg(BaseObject::getSchemaName(type)));
-
-						font = item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						for(auto &obj : obj_list)
-							createItemForObject(obj, item2);
-					}
-				}
-			}
-		}
-		catch(Exception &e)
-		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
-	}
-}
+		expandFilteredItems(QModelIndex());
+		matches = objects_tree_mdl->getFilterMatches();
 
-void ModelObjectsWidget::updateTableTree(QTreeWidgetItem *root, BaseObject *schema, ObjectType table_type)
-{
-	if(db_model && PhysicalTable::isPhysicalTable(table_type) && visible_objs_map[table_type])
-	{
-		std::vector<BaseObject *> obj_list;
-		PhysicalTable *table = nullptr;
-		QTreeWidgetItem *item = nullptr, *item1 = nullptr, *item2 = nullptr;
-		QFont font;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(table_type);
-		QPixmap group_icon = QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(table_type)));
-
-		try
+		//Selecting the single leaf item found
+		if(simplified_view && matches.size() == 1)
 		{
-			//Get all tables that belongs to the specified schema
-			obj_list=db_model->getObjects(table_type, schema);
+			QModelIndex index = objects_tree_mdl->getIndex(matches.front());
 
-			//Create a table group item
-			item=new QTreeWidgetItem(root);
-			item->setIcon(0,group_icon);
-			item->setText(0, BaseObject::getTypeName(table_type) + QString(" (%1)").arg(obj_list.size()));
-			item->setData(1, Qt::UserRole, QVariant(enum_t(table_type)));
-			item->setData(2, Qt::UserRole, QString("%1_%2_grp").arg(schema->getObjectId()).arg(BaseObject::getSchemaName(table_type)));
-
-			font=item->font(0);
-			font.setItalic(true);
-			item->setFont(0, font);
-
-			for(auto &obj : obj_list)
+			if(index.isValid() && index.parent().isValid() && !objects_tree_mdl->hasChildren(index))
 			{
-				table = dynamic_cast<PhysicalTable *>(obj);
-				item1 = createItemForObject(table, item);
-
-				//Creating the group for the child objects (column, rules, triggers, indexes and constraints)
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item2 = new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-						font = item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						item2->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(type)).arg(table->getObjectCount(type)));
-						item2->setData(2, Qt::UserRole, QString("%1_%2_grp").arg(table->getObjectId()).arg(BaseObject::getSchemaName(type)));
-
-						for(auto tab_obj : *table->getObjectList(type))
-							createItemForObject(tab_obj, item2);
-					}
-				}
+				objectstree_view->setCurrentIndex(index);
+				objectstree_view->selectionModel()->select(index, QItemSelectionModel::ClearAndSelect);
 			}
 		}
-		catch(Exception &e)
-		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
 	}
-}
-
-void ModelObjectsWidget::updateViewTree(QTreeWidgetItem *root, BaseObject *schema)
-{
-	if(db_model && visible_objs_map[ObjectType::View])
-	{
-		std::vector<BaseObject *> obj_list;
-		View *view = nullptr;
-		QTreeWidgetItem *item = nullptr, *item1 = nullptr, *item2 = nullptr;
-		QFont font;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::View);
-		QPixmap group_icon = QPixmap(GuiUtilsNs::getIconPath(QString(BaseObject::getSchemaName(ObjectType::View))));
-
-		try
-		{
-			//Get all views that belongs to the specified schema
-			obj_list = db_model->getObjects(ObjectType::View, schema);
-
-			//Create a table group item
-			item=new QTreeWidgetItem(root);
-			item->setIcon(0, group_icon);
-			item->setText(0, BaseObject::getTypeName(ObjectType::View) + QString(" (%1)").arg(obj_list.size()));
-			item->setData(1, Qt::UserRole, QVariant(enum_t(ObjectType::View)));
-			item->setData(2, Qt::UserRole, QString("%1_%2_grp").arg(schema->getObjectId()).arg(BaseObject::getSchemaName(ObjectType::View)));
-
-			font = item->font(0);
-			font.setItalic(true);
-			item->setFont(0, font);
 
-			for(auto &obj : obj_list)
-			{
-				view = dynamic_cast<View *>(obj);
-				item1 = createItemForObject(view, item);
-
-				//Creating the group for the child objects (rules, triggers)
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item2 = new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-						font = item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						item2->setText(0, BaseObject::getTypeName(type) + QString(" (%1)").arg(view->getObjectCount(type)));
-						item2->setData(2, Qt::UserRole, QString("%1_%2_grp").arg(view->getObjectId()).arg(BaseObject::getSchemaName(type)));
-
-						for(auto &object : view->getObjects())
-							createItemForObject(object, item2);
-					}
-				}
-			}
-		}
-		catch(Exception &e)
-		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
-	}
+	objectstree_view->blockSignals(false);
 }
 
-void ModelObjectsWidget::updatePermissionTree(QTreeWidgetItem *root, BaseObject *object)
+void ModelObjectsWidget::expandFilteredItems(const QModelIndex &parent)
 {
-	try
+	QModelIndex index;
+
+	for(int row = 0; row < objects_tree_mdl->rowCount(parent); row++)
 	{
-		if(db_model && visible_objs_map[ObjectType::Permission] &&
-				Permission::acceptsPermission(object->getObjectType()))
-		{
-			std::vector<Permission *> perms;
-			QTreeWidgetItem *item = new QTreeWidgetItem(root);
-			QFont font=item->font(0);
+		index = objects_tree_mdl->index(row, 0, parent);
 
-			db_model->getPermissions(object, perms);
-			item->setIcon(0,QPixmap(GuiUtilsNs::getIconPath("permission")));
+		if(!objects_tree_mdl->isFilterPath(index))
+			continue;
 
-			font.setItalic(true);
-			item->setFont(0, font);
-			item->setText(0, QString("%1 (%2)")
-											.arg(BaseObject::getTypeName(ObjectType::Permission))
-											.arg(perms.size()));
+		//Creating the children items before expanding so the nested matches can be reached
+		if(objects_tree_mdl->canFetchMore(index))
+			objects_tree_mdl->fetchMore(index);
 
-			item->setData(0, Qt::UserRole, generateItemData(object));
-			item->setData(1, Qt::UserRole, static_cast<unsigned>(ObjectType::Permission));
-		}
-	}
-	catch(Exception &e)
-	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		objectstree_view->expand(index);
+		expandFilteredItems(index);
 	}
 }
 
-void ModelObjectsWidget::updateDatabaseTree()
+void ModelObjectsWidget::updateObjectsView()
 {
-	if(!db_model)
-		objectstree_tw->clear();
-	else
+	selected_objs.clear();
+
+	/* Changing the visible object types demands the recreation of the tree. Otherwise,
+	 * only the already created items are synchronized with the database model */
+	if(objects_tree_mdl->getObjectsVisible() != visible_objs_map)
 	{
-		QString str_aux;
-		QTreeWidgetItem *root=nullptr,*item1=nullptr, *item2=nullptr;
-		QFont font;
-		std::vector<BaseObject *> obj_list;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Database);
 		int tree_v_pos = 0;
 		QStringList tree_state;
 
-		objectstree_tw->setUpdatesEnabled(false);
-
-		types.push_back(ObjectType::Tag);
-		types.push_back(ObjectType::GenericSql);
-		types.push_back(ObjectType::Textbox);
-		types.push_back(ObjectType::Relationship);
-		types.erase(std::find(types.begin(), types.end(), ObjectType::Schema));
-
 		if(save_tree_state)
 			saveTreeState(tree_state, tree_v_pos);
 
-		try
-		{
-			objectstree_tw->clear();
-
-			if(visible_objs_map[ObjectType::Database])
-			{
-				root = createItemForObject(db_model);
-				objectstree_tw->insertTopLevelItem(0, root);
-
-				updateSchemaTree(root);
-
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item1 = new QTreeWidgetItem(root);
-						str_aux = QString(BaseObject::getSchemaName(type));
-
-						item1->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(str_aux)));
-						item1->setData(1, Qt::UserRole, QVariant(enum_t(type)));
-
-						obj_list=(*db_model->getObjectList(type));
-
-						//Special case for relationship, merging the base relationship list to the relationship list
-						if(type == ObjectType::Relationship)
-						{
-							std::vector<BaseObject *> obj_list_aux;
-							obj_list_aux=(*db_model->getObjectList(ObjectType::BaseRelationship));
-							obj_list.insert(obj_list.end(), obj_list_aux.begin(), obj_list_aux.end());
-						}
-
-						item1->setText(0, BaseObject::getTypeName(type) + QString(" (%1)").arg(obj_list.size()));
-						item1->setData(2, Qt::UserRole, QString("%1_%2_grp").arg(db_model->getObjectId()).arg(BaseObject::getSchemaName(type)));
-						font = item1->font(0);
-						font.setItalic(true);
-						item1->setFont(0, font);
-
-						for(auto &object : obj_list)
-						{
-							item2 = createItemForObject(object, item1);
-
-							if(type == ObjectType::Tag)
-							{
-								for(auto &ref : object->getReferences())
-									createItemForObject(ref, item2, false);
-							}
-						}
-					}
-				}
-
-				objectstree_tw->expandItem(root);
-			}
-		}
-		catch(Exception &e)
-		{
-			objectstree_tw->setUpdatesEnabled(true);
-			Messagebox::error(e, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-		}
-
-		objectstree_tw->sortByColumn(0, Qt::AscendingOrder);
-		objectstree_tw->setUpdatesEnabled(true);
+		objects_tree_mdl->setObjectsVisible(visible_objs_map);
+		expandDatabaseItem();
 
 		if(save_tree_state)
 			restoreTreeState(tree_state, tree_v_pos);
 	}
+	else
+		objects_tree_mdl->updateModel();
+
+	/* The tree model keeps the filter matches up to date as objects are added, removed
+	 * or modified, so there's no need to evaluate all the objects against the filter again */
+	if(!filter_edt->text().isEmpty())
+		showFilterMatches();
 }
 
 BaseObject *ModelObjectsWidget::getSelectedObject()
@@ -762,7 +433,7 @@ void ModelObjectsWidget::close()
 	{
 		BaseObject *selected_obj = nullptr;
 
-		selected_obj = getTreeItemData(objectstree_tw->currentItem());
+		selected_obj = objects_tree_mdl->getValidObject(objectstree_view->currentIndex());
 
 		if(selected_obj && std::find(selected_objs.begin(), selected_objs.end(), selected_obj) == selected_objs.end())
 			selected_objs.push_back(selected_obj);
@@ -787,7 +458,9 @@ void ModelObjectsWidget::setModel(DatabaseModel *db_model)
 
 	this->db_model=db_model;
 	content_wgt->setEnabled(enable);
-	updateObjectsView();	
+	objects_tree_mdl->setDatabaseModel(db_model);
+	expandDatabaseItem();
+	updateObjectsView();
 	expand_all_tb->setEnabled(enable);
 	collapse_all_tb->setEnabled(enable);
 	options_tb->setEnabled(enable);
@@ -875,8 +548,8 @@ void ModelObjectsWidget::mouseMoveEvent(QMouseEvent *)
 
 void ModelObjectsWidget::resizeEvent(QResizeEvent *)
 {
-	objectstree_tw->header()->setMinimumSectionSize(objectstree_tw->width());
-	objectstree_tw->header()->setDefaultSectionSize(objectstree_tw->width());
+	objectstree_view->header()->setMinimumSectionSize(objectstree_view->width());
+	objectstree_view->header()->setDefaultSectionSize(objectstree_view->width());
 }
 
 void ModelObjectsWidget::saveTreeState(bool value)
@@ -886,9 +559,9 @@ void ModelObjectsWidget::saveTreeState(bool value)
 
 void ModelObjectsWidget::clearSelectedObject()
 {
-	objectstree_tw->blockSignals(true);
-	objectstree_tw->clearSelection();
-	objectstree_tw->blockSignals(false);
+	objectstree_view->blockSignals(true);
+	objectstree_view->clearSelection();
+	objectstree_view->blockSignals(false);
 	selected_objs.clear();
 	model_wgt->configurePopupMenu(nullptr);
 	model_wgt->emitSceneInteracted();
@@ -896,88 +569,50 @@ void ModelObjectsWidget::clearSelectedObject()
 
 void ModelObjectsWidget::saveTreeState(QStringList &exp_items_ids, int &v_scroll_pos)
 {
-	QTreeWidgetItemIterator itr(objectstree_tw);
-	QTreeWidgetItem *item=nullptr;
-
-	while(*itr)
+	//Only the already created items can be expanded so there's no need to visit the others
+	for(auto &index : objects_tree_mdl->getPopulatedIndexes())
 	{
-		item = *itr;
-
-		if(item->isExpanded())
-			exp_items_ids.push_back(item->data(2, Qt::UserRole).toString());
-
-		++itr;
+		if(objectstree_view->isExpanded(index))
+			exp_items_ids.push_back(index.data(ObjectsTreeModel::ItemIdRole).toString());
 	}
 
-	v_scroll_pos = objectstree_tw->verticalScrollBar()->value();
+	v_scroll_pos = objectstree_view->verticalScrollBar()->value();
 }
 
 void ModelObjectsWidget::restoreTreeState(const QStringList &exp_items_ids, int v_scroll_pos)
 {
-	QTreeWidgetItem *item = nullptr;
+	QModelIndex index;
 
+	/* Since the ids are stored from the outermost to the innermost items, the children
+	 * of an item are created (when expanding it) before its expanded children are searched */
 	for(auto &item_id : exp_items_ids)
 	{
-		item = getTreeItem(item_id);
+		index = objects_tree_mdl->getIndex(item_id);
 
-		if(!item)
+		if(!index.isValid())
 			continue;
 
-		objectstree_tw->expandItem(item);
-	}
-
-	objectstree_tw->verticalScrollBar()->setValue(v_scroll_pos);
-}
-
-QTreeWidgetItem *ModelObjectsWidget::getTreeItem(BaseObject *object)
-{
-	if(!object)
-		return nullptr;
-
-	QTreeWidgetItemIterator itr(objectstree_tw);
-
-	while(*itr)
-	{
-		if(getTreeItemData(*itr) == object)
-			return *itr;
-
-		++itr;
-	}
-
-	return nullptr;
-}
-
-QTreeWidgetItem *ModelObjectsWidget::getTreeItem(const QString &item_id)
-{
-	QTreeWidgetItemIterator itr(objectstree_tw);
-	QTreeWidgetItem *item = nullptr;
-
-	while(*itr)
-	{
-		if((*itr)->data(2, Qt::UserRole).toString() == item_id)
-		{
-			item = *itr;
-			break;
-		}
+		if(objects_tree_mdl->canFetchMore(index))
+			objects_tree_mdl->fetchMore(index);
 
-		++itr;
+		objectstree_view->expand(index);
 	}
 
-	return item;
+	objectstree_view->verticalScrollBar()->setValue(v_scroll_pos);
 }
 
 void ModelObjectsWidget::selectCreatedObject(BaseObject *obj)
 {
 	updateObjectsView();
-	QTreeWidgetItem *item = getTreeItem(obj);
+	QModelIndex index = objects_tree_mdl->revealObject(obj);
 
-	if(item)
+	if(index.isValid())
 	{
-		objectstree_tw->blockSignals(true);
-		item->setSelected(true);
-		objectstree_tw->setCurrentItem(item);
-		objectstree_tw->scrollToItem(item);
+		objectstree_view->blockSignals(true);
+		objectstree_view->setCurrentIndex(index);
+		objectstree_view->selectionModel()->select(index, QItemSelectionModel::ClearAndSelect);
+		objectstree_view->scrollTo(index);
 		select_tb->setFocus();
-		objectstree_tw->blockSignals(false);
+		objectstree_view->blockSignals(false);
 	}
 }
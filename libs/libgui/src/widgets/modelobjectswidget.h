@@ -28,6 +28,7 @@
 #include "ui_modelobjectswidget.h"
 #include "modelwidget.h"
 #include "objecttypeslistwidget.h"
+#include "utils/objectstreemodel.h"
 
 class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget {
 	Q_OBJECT
@@ -65,37 +66,17 @@ class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget
 
 		ObjectTypesListWidget *obj_types_wgt;
 
-		//! \brief Updates only a schema tree starting from the 'root' item
-		void updateSchemaTree(QTreeWidgetItem *root);
+		//! \brief The lazy model that feeds the objects tree
+		ObjectsTreeModel *objects_tree_mdl;
 
-		/*! \brief Updates only a table / foreign table tree starting from the 'root' item.
-		 * table_type must be ObjectType::Table or ObjectType::ForeignTable */
-		void updateTableTree(QTreeWidgetItem *root, BaseObject *schema, ObjectType table_type);
+		//! \brief Expands the tree items that lead to the objects matching the current filter
+		void expandFilteredItems(const QModelIndex &parent);
 
-		//! \brief Updates only a view tree starting from the 'root' item
-		void updateViewTree(QTreeWidgetItem *root, BaseObject *schema);
+		//! \brief Expands the database item (the tree's root item)
+		void expandDatabaseItem();
 
-		//! \brief Updates only the permission tree related to the specified object
-		void updatePermissionTree(QTreeWidgetItem *root, BaseObject *object);
-
-		//! \brief Updates the whole database object tree
-		void updateDatabaseTree();
-
-		//! \brief Updates the whole object list
-		void updateObjectsTable();
-
-		//! \brief Returns an item from the tree related to the specified object reference
-		QTreeWidgetItem *getTreeItem(BaseObject *object);
-
-		//! \brief Returns an item from the tree related to the specified item id
-		QTreeWidgetItem *getTreeItem(const QString &item_id);
-
-		//! \brief Generates a QVariant containing the passed object reference as data
-		QVariant generateItemData(BaseObject *object);
-
-		BaseObject *getTreeItemData(QTreeWidgetItem *item);
-
-		QTreeWidgetItem *createItemForObject(BaseObject *object, QTreeWidgetItem *root=nullptr, bool update_perms=true);
+		//! \brief Expands the items of the objects matching the current filter (selecting the single match in simplified view)
+		void showFilterMatches();
 
 		void mouseMoveEvent(QMouseEvent *);
 		void resizeEvent(QResizeEvent *);
@@ -19,6 +19,9 @@
 #include "modeloverviewwidget.h"
 #include "modelwidget.h"
 #include <QScrollBar>
+#include <QPicture>
+
+BaseObjectView::DetailLevel ModelOverviewWidget::detail_level { BaseObjectView::MinimumDetail };
 
 ModelOverviewWidget::ModelOverviewWidget(QWidget *parent) : QWidget(parent, Qt::WindowCloseButtonHint | Qt::Tool)
 {
@@ -27,8 +30,29 @@ ModelOverviewWidget::ModelOverviewWidget(QWidget *parent) : QWidget(parent, Qt::
 	zoom_factor = 1;
 	curr_resize_factor = ResizeFactor;
 	moving_frame = false;
+	rendering_tiles = false;
+	overview_gen = 0;
+	tiles_cols = tiles_rows = 0;
+	items_changed = false;
 	setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 	scene_bg_lbl->setStyleSheet("QLabel#scene_bg_lbl{ border: 0px; }");
+
+	render_pool.setMaxThreadCount(1);
+	render_tm.setSingleShot(true);
+	render_tm.setInterval(RenderDelay);
+
+	connect(&render_tm, &QTimer::timeout, this, &ModelOverviewWidget::renderDirtyTiles);
+}
+
+ModelOverviewWidget::~ModelOverviewWidget()
+{
+	render_pool.waitForDone();
+	clearItemsState();
+}
+
+void ModelOverviewWidget::setDetailLevel(BaseObjectView::DetailLevel level)
+{
+	detail_level = level;
 }
 
 void ModelOverviewWidget::show(ModelWidget *model)
@@ -40,14 +64,11 @@ void ModelOverviewWidget::show(ModelWidget *model)
 		disconnect(this->model->scene, nullptr,  this, nullptr);
 	}
 
+	clearItemsState();
 	this->model=model;
 
 	if(this->model)
 	{
-		connect(this->model, &ModelWidget::s_objectCreated, this, qOverload<>(&ModelOverviewWidget::updateOverview));
-		connect(this->model, &ModelWidget::s_objectRemoved, this, qOverload<>(&ModelOverviewWidget::updateOverview));
-		connect(this->model, &ModelWidget::s_objectsMoved, this, qOverload<>(&ModelOverviewWidget::updateOverview));
-		connect(this->model, &ModelWidget::s_objectModified, this, qOverload<>(&ModelOverviewWidget::updateOverview));
 		connect(this->model, &ModelWidget::s_zoomModified, this, &ModelOverviewWidget::updateZoomFactor);
 		connect(this->model, &ModelWidget::s_modelResized, this, &ModelOverviewWidget::resizeOverview);
 		connect(this->model, &ModelWidget::s_modelResized, this, &ModelOverviewWidget::resizeViewportFrame);
@@ -56,7 +77,18 @@ void ModelOverviewWidget::show(ModelWidget *model)
 		connect(this->model->viewport->horizontalScrollBar(), &QScrollBar::valueChanged, this, &ModelOverviewWidget::resizeViewportFrame);
 		connect(this->model->viewport->verticalScrollBar(), &QScrollBar::valueChanged, this, &ModelOverviewWidget::resizeViewportFrame);
 
-		connect(this->model->scene, &ObjectsScene::selectionChanged, this, qOverload<>(&ModelOverviewWidget::updateOverview));
+		/* Instead of redrawing the whole overview on each object creation/removal/modification
+		 * only the tiles under the objects that changed are rendered again. Note that the overview
+		 * must not use the scene's changed() signal since while it is connected the scene stops
+		 * sending the items updates directly to the views and also reports hover changes */
+		connect(this->model, &ModelWidget::s_objectCreated, this, &ModelOverviewWidget::updateChangedObjects);
+		connect(this->model, &ModelWidget::s_objectRemoved, this, &ModelOverviewWidget::updateChangedObjects);
+		connect(this->model, &ModelWidget::s_objectsMoved, this, &ModelOverviewWidget::updateChangedObjects);
+		connect(this->model, &ModelWidget::s_objectModified, this, &ModelOverviewWidget::updateChangedObjects);
+		connect(this->model, &ModelWidget::s_objectsLayerChanged, this, &ModelOverviewWidget::updateChangedObjects);
+		connect(this->model->scene, &ObjectsScene::selectionChanged, this, &ModelOverviewWidget::updateChangedObjects);
+		connect(this->model->scene, &ObjectsScene::s_activeLayersChanged, this, &ModelOverviewWidget::updateChangedObjects);
+		connect(this->model->scene, &ObjectsScene::s_layersChanged, this, qOverload<>(&ModelOverviewWidget::updateOverview));
 		connect(this->model->scene, &ObjectsScene::sceneRectChanged,this, &ModelOverviewWidget::resizeOverview);
 		connect(this->model->scene, &ObjectsScene::sceneRectChanged,this, qOverload<>(&ModelOverviewWidget::updateOverview));
 
@@ -76,6 +108,8 @@ void ModelOverviewWidget::show(ModelWidget *model)
 
 void ModelOverviewWidget::closeEvent(QCloseEvent *event)
 {
+	render_tm.stop();
+	clearItemsState();
 	model=nullptr;
 	emit s_overviewVisible(false);
 	QWidget::closeEvent(event);
@@ -83,6 +117,10 @@ void ModelOverviewWidget::closeEvent(QCloseEvent *event)
 
 void ModelOverviewWidget::showEvent(QShowEvent *event)
 {
+	// Rendering the tiles changed while the overview was hidden
+	if(model && (!dirty_tiles.empty() || items_changed))
+		render_tm.start();
+
 	emit s_overviewVisible(true);
 	QWidget::showEvent(event);
 }
@@ -114,39 +152,251 @@ void ModelOverviewWidget::updateOverview(bool force_update)
 {
 	if(this->model && (this->isVisible() || force_update))
 	{
-		QPixmap pix;
+		// The items state is refreshed as well so the next partial updates start from the current scene
+		invalidateTiles();
+		items_changed = true;
+		renderDirtyTiles();
+	}
+}
 
-		qApp->setOverrideCursor(Qt::WaitCursor);
+void ModelOverviewWidget::updateChangedObjects()
+{
+	if(!model)
+		return;
+
+	items_changed = true;
+
+	if(this->isVisible())
+		render_tm.start();
+}
+
+void ModelOverviewWidget::updateItemsState()
+{
+	std::map<QGraphicsItem *, ItemState> curr_state;
+	BaseObjectView *obj_view = nullptr;
+	BaseGraphicObject *graph_obj = nullptr;
+	QRectF rect;
+	bool selected = false;
+
+	auto invalidate_rect = [this](const QRectF &rect) {
+		// Hidden items have an empty rect, which must not be passed to invalidateTiles() (that would invalidate all tiles)
+		if(!rect.isEmpty())
+			invalidateTiles(rect);
+	};
+
+	items_changed = false;
+
+	for(auto &item : model->scene->items())
+	{
+		if(item->parentItem())
+			continue;
 
-		//Creates a pixmap with the size of the scene
-		pix = QPixmap(pixmap_size);
-		pix.fill(ObjectsScene::getCanvasColor());
+		rect = item->isVisible() ? item->sceneBoundingRect() | item->mapRectToScene(item->childrenBoundingRect()) : QRectF();
+		selected = item->isVisible() && item->isSelected();
+		obj_view = dynamic_cast<BaseObjectView *>(item);
+		graph_obj = obj_view ? dynamic_cast<BaseGraphicObject *>(obj_view->getUnderlyingObject()) : nullptr;
 
-		//Draw the scene onto the pixmap
-		QPainter p(&pix);
+		auto itr = items_state.find(item);
 
-		if(!p.isActive())
+		if(itr != items_state.end() && itr->second.object == graph_obj)
 		{
-			scene_bg_lbl->setPixmap(QPixmap());
-			scene_bg_lbl->setText(tr("Failed to generate the overview image.\nThe requested size %1 x %2 was too big and there was not enough memory to allocate!")
-										 .arg(pixmap_size.width()).arg(pixmap_size.height()));
-			frame->setEnabled(false);
+			if(itr->second.rect != rect || itr->second.selected != selected ||
+				 (graph_obj && modified_objs.count(graph_obj)))
+			{
+				invalidate_rect(itr->second.rect);
+				invalidate_rect(rect);
+			}
+
+			curr_state[item] = { rect, selected, graph_obj, itr->second.mod_conn };
+			items_state.erase(itr);
+			continue;
 		}
-		else
+
+		// New items (or items reusing the address of removed ones)
+		if(itr != items_state.end())
 		{
-			frame->setEnabled(true);
+			invalidate_rect(itr->second.rect);
+			disconnect(itr->second.mod_conn);
+			items_state.erase(itr);
+		}
 
-			p.setRenderHints(QPainter::Antialiasing, false);
-			p.setRenderHints(QPainter::TextAntialiasing, false);
-			model->scene->render(&p, QRect(), scene_rect);
+		invalidate_rect(rect);
+		curr_state[item] = { rect, selected, graph_obj, {} };
 
-			//Resizes the pixmap to the previous configured QSize
-			scene_bg_lbl->setPixmap(pix);
+		/* Changes in the objects that don't affect their area (e.g. colors, tags) are
+		 * detected via the object's own signal. The object is only used as a key here */
+		if(graph_obj)
+		{
+			curr_state[item].mod_conn = connect(graph_obj, &BaseGraphicObject::s_objectModified, this, [this, graph_obj](){
+				modified_objs.insert(graph_obj);
+				updateChangedObjects();
+			});
 		}
+	}
 
-		scene_bg_lbl->resize(curr_size.toSize());
-		qApp->restoreOverrideCursor();
+	// The remaining items were removed from the scene, so the area they occupied is rendered again
+	for(auto &itr : items_state)
+	{
+		invalidate_rect(itr.second.rect);
+		disconnect(itr.second.mod_conn);
 	}
+
+	items_state.swap(curr_state);
+	modified_objs.clear();
+}
+
+void ModelOverviewWidget::clearItemsState()
+{
+	/* The items and objects may be already destroyed at this point
+	 * so only the connections (which are safe to disconnect) are handled */
+	for(auto &itr : items_state)
+		disconnect(itr.second.mod_conn);
+
+	items_state.clear();
+	modified_objs.clear();
+	items_changed = false;
+}
+
+void ModelOverviewWidget::invalidateTiles(const QRectF &rect)
+{
+	if(tiles_cols == 0 || tiles_rows == 0)
+		return;
+
+	if(!rect.isValid())
+	{
+		for(int tile_id = 0; tile_id < tiles_cols * tiles_rows; tile_id++)
+			dirty_tiles.insert(tile_id);
+
+		return;
+	}
+
+	//Converting the scene rect to the overview image coordinates (with a small margin due to antialiasing)
+	QRectF ov_rect((rect.left() - scene_rect.left()) * curr_resize_factor,
+								 (rect.top() - scene_rect.top()) * curr_resize_factor,
+								 rect.width() * curr_resize_factor, rect.height() * curr_resize_factor);
+
+	ov_rect.adjust(-1, -1, 1, 1);
+	ov_rect = ov_rect.intersected(QRectF(QPointF(0, 0), pixmap_size));
+
+	if(ov_rect.isEmpty())
+		return;
+
+	int col_start = ov_rect.left() / TileSize,
+			col_end = std::min(static_cast<int>(ov_rect.right() / TileSize), tiles_cols - 1),
+			row_start = ov_rect.top() / TileSize,
+			row_end = std::min(static_cast<int>(ov_rect.bottom() / TileSize), tiles_rows - 1);
+
+	for(int row = row_start; row <= row_end; row++)
+	{
+		for(int col = col_start; col <= col_end; col++)
+			dirty_tiles.insert((row * tiles_cols) + col);
+	}
+}
+
+QRect ModelOverviewWidget::getTileRect(int tile_id)
+{
+	QRect rect((tile_id % tiles_cols) * TileSize, (tile_id / tiles_cols) * TileSize, TileSize, TileSize);
+	return rect.intersected(QRect(QPoint(0, 0), pixmap_size));
+}
+
+void ModelOverviewWidget::renderDirtyTiles()
+{
+	/* If there's a rendering in progress the dirty tiles are
+	 * rendered right after it finishes (see composeTiles) */
+	if(!model || rendering_tiles)
+		return;
+
+	if(items_changed)
+		updateItemsState();
+
+	if(dirty_tiles.empty())
+		return;
+
+	if(overview_pix.isNull())
+	{
+		scene_bg_lbl->setPixmap(QPixmap());
+		scene_bg_lbl->setText(tr("Failed to generate the overview image.\nThe requested size %1 x %2 was too big and there was not enough memory to allocate!")
+													.arg(pixmap_size.width()).arg(pixmap_size.height()));
+		frame->setEnabled(false);
+		dirty_tiles.clear();
+		return;
+	}
+
+	std::vector<std::pair<QRect, QPicture>> snapshots;
+	BaseObjectView::DetailLevel prev_detail = BaseObjectView::getMaximumDetailLevel();
+	QRect tile_rect;
+	QRectF scn_rect;
+	QPainter painter;
+
+	frame->setEnabled(true);
+	BaseObjectView::setMaximumDetailLevel(detail_level);
+
+	/* The scene items can only be accessed from the main thread, so here we just record
+	 * the painting commands of the scene area under each dirty tile, which is much cheaper
+	 * than rasterizing them. The rasterization of the recorded snapshots is done in background */
+	for(auto &tile_id : dirty_tiles)
+	{
+		tile_rect = getTileRect(tile_id);
+
+		if(tile_rect.isEmpty())
+			continue;
+
+		scn_rect = QRectF(scene_rect.left() + (tile_rect.left() / curr_resize_factor),
+											scene_rect.top() + (tile_rect.top() / curr_resize_factor),
+											tile_rect.width() / curr_resize_factor, tile_rect.height() / curr_resize_factor);
+
+		snapshots.push_back({ tile_rect, QPicture() });
+		painter.begin(&snapshots.back().second);
+		painter.setRenderHints(QPainter::Antialiasing, false);
+		painter.setRenderHints(QPainter::TextAntialiasing, false);
+		model->scene->render(&painter, QRectF(QPointF(0, 0), tile_rect.size()), scn_rect, Qt::IgnoreAspectRatio);
+		painter.end();
+	}
+
+	BaseObjectView::setMaximumDetailLevel(prev_detail);
+	dirty_tiles.clear();
+	rendering_tiles = true;
+
+	render_pool.start([this, snapshots, gen = overview_gen, bg_color = ObjectsScene::getCanvasColor()](){
+		std::vector<std::pair<QRect, QImage>> tiles;
+		QPainter painter;
+
+		for(auto &snapshot : snapshots)
+		{
+			QImage img(snapshot.first.size(), QImage::Format_ARGB32_Premultiplied);
+
+			img.fill(bg_color);
+			painter.begin(&img);
+			painter.drawPicture(0, 0, snapshot.second);
+			painter.end();
+			tiles.push_back({ snapshot.first, img });
+		}
+
+		// The tiles are composed in the main thread since the overview pixmap can only be handled there
+		QMetaObject::invokeMethod(this, [this, gen, tiles](){
+			composeTiles(gen, tiles);
+		}, Qt::QueuedConnection);
+	});
+}
+
+void ModelOverviewWidget::composeTiles(unsigned gen, const std::vector<std::pair<QRect, QImage>> &tiles)
+{
+	rendering_tiles = false;
+
+	// Tiles rendered for a previous overview size are discarded
+	if(gen == overview_gen && !overview_pix.isNull())
+	{
+		QPainter painter(&overview_pix);
+
+		for(auto &tile : tiles)
+			painter.drawImage(tile.first.topLeft(), tile.second);
+
+		painter.end();
+		scene_bg_lbl->setPixmap(overview_pix);
+	}
+
+	if((!dirty_tiles.empty() || items_changed) && this->isVisible())
+		render_tm.start();
 }
 
 void ModelOverviewWidget::resizeViewportFrame()
@@ -195,12 +445,26 @@ void ModelOverviewWidget::resizeOverview()
 		curr_resize_factor = std::min(w_ratio, h_ratio);
 		curr_size.setHeight(scene_rect.height() * curr_resize_factor);
 		curr_size.setWidth(scene_rect.width() * curr_resize_factor);
-		pixmap_size = scene_rect.size().toSize();
 	}
 	else
-	{
 		curr_resize_factor = ResizeFactor;
-		pixmap_size = scene_rect.size().toSize();
+
+	/* The overview image is created already in its final size instead of the scene size
+	 * so the tiles are rendered directly in the overview scale */
+	pixmap_size = curr_size.toSize();
+
+	if(overview_pix.size() != pixmap_size)
+	{
+		overview_gen++;
+		overview_pix = QPixmap(pixmap_size);
+
+		if(!overview_pix.isNull())
+			overview_pix.fill(ObjectsScene::getCanvasColor());
+
+		tiles_cols = std::ceil(pixmap_size.width() / static_cast<double>(TileSize));
+		tiles_rows = std::ceil(pixmap_size.height() / static_cast<double>(TileSize));
+		dirty_tiles.clear();
+		invalidateTiles();
 	}
 
 	viewport_frm->setVisible(true);
@@ -27,6 +27,10 @@
 
 #include "ui_modeloverviewwidget.h"
 #include "modelwidget.h"
+#include <QThreadPool>
+#include <QTimer>
+#include <set>
+#include <map>
 
 class __libgui ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 	Q_OBJECT
@@ -49,9 +53,64 @@ class __libgui ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidg
 
 		QSize pixmap_size;
 
+		//! \brief The overview image composed by the rendered tiles
+		QPixmap overview_pix;
+
+		//! \brief Stores the ids of the tiles that need to be rendered again due to changes in the scene
+		std::set<int> dirty_tiles;
+
+		//! \brief Amount of tiles in each row and column of the overview image
+		int tiles_cols, tiles_rows;
+
+		//! \brief Stores the state of a scene item at the moment the tiles were last rendered
+		struct ItemState {
+			//! \brief The scene area occupied by the item and its children (empty when the item is hidden)
+			QRectF rect;
+
+			bool selected;
+
+			//! \brief The graphical object represented by the item (if any)
+			BaseGraphicObject *object;
+
+			//! \brief Connection to the object's s_objectModified() signal
+			QMetaObject::Connection mod_conn;
+		};
+
+		/*! \brief The state of the top-level items of the scene. Comparing it with the current state
+		 * of the items gives the areas that must be rendered again (see updateItemsState()) */
+		std::map<QGraphicsItem *, ItemState> items_state;
+
+		//! \brief Graphical objects modified since the last update, their tiles are rendered again even if they didn't move
+		std::set<BaseGraphicObject *> modified_objs;
+
+		//! \brief Indicates that the model signaled changes in the objects so the items state must be checked again
+		bool items_changed;
+
+		//! \brief Timer used to merge several sequential model changes into a single tiles rendering
+		QTimer render_tm;
+
+		//! \brief Thread pool (single thread) in which the tiles snapshots are rasterized
+		QThreadPool render_pool;
+
+		//! \brief Indicates that a set of tiles is being rasterized in background
+		bool rendering_tiles;
+
+		/*! \brief Incremented each time the overview image is resized so the tiles rendered
+		 * in background for a previous image size can be discarded */
+		unsigned overview_gen;
+
 		//! \brief Indicates that the viewport frame is being moved by the user via mouse move event
 		bool moving_frame;
 
+		//! \brief The maximum level of detail in which the objects are drawn in the overview
+		static BaseObjectView::DetailLevel detail_level;
+
+		//! \brief The size (in pixels) of each tile in which the overview image is split
+		static constexpr int TileSize = 256;
+
+		//! \brief The time (in ms) the overview waits for new model changes before rendering the changed tiles
+		static constexpr int RenderDelay = 200;
+
 		//! \brief Resize factor applied to overview widgets (default: 20% of the scene original size)
 		static constexpr double ResizeFactor = 0.20;
 
@@ -69,13 +128,44 @@ class __libgui ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidg
 		is used to force the update even if the overview widget is not visible */
 		void updateOverview(bool force_update);
 
+		/*! \brief Marks as dirty the tiles that intersect the provided scene rect.
+		 * An invalid rect causes all tiles to be marked as dirty */
+		void invalidateTiles(const QRectF &rect = QRectF());
+
+		//! \brief Returns the rectangle (in overview image coordinates) of the provided tile
+		QRect getTileRect(int tile_id);
+
+		/*! \brief Compares the current area and selection state of the scene top-level items with the ones
+		 * stored in the last update and marks as dirty the tiles under the items that were created, removed,
+		 * moved, (un)selected or modified (see modified_objs). Hovering an item doesn't change its state
+		 * so it never causes the tiles to be rendered again */
+		void updateItemsState();
+
+		//! \brief Drops the stored items state disconnecting the overview from the objects of the current model
+		void clearItemsState();
+
+		/*! \brief Records a snapshot of the scene area under each dirty tile and rasterizes
+		 * them in a separated thread. The resulting images are composed in the overview via composeTiles() */
+		void renderDirtyTiles();
+
+		//! \brief Draws the rendered tiles onto the overview image if they were rendered for the current image size
+		void composeTiles(unsigned gen, const std::vector<std::pair<QRect, QImage>> &tiles);
+
 	public:
 		ModelOverviewWidget(QWidget *parent = nullptr);
 
+		virtual ~ModelOverviewWidget();
+
+		//! \brief Defines the maximum level of detail in which the objects are drawn in the overview (default: MinimumDetail)
+		static void setDetailLevel(BaseObjectView::DetailLevel level);
+
 	public slots:
 		//! \brief Updates the overview (only if the widget is visible)
 		void updateOverview();
 
+		//! \brief Schedules the rendering of the tiles under the objects changed in the model
+		void updateChangedObjects();
+
 		//! \brief Resizes the frame that represents the visualization window
 		void resizeViewportFrame();
 
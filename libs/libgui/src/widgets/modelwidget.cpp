@@ -159,6 +159,7 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	db_model = new DatabaseModel(this);
 	xmlparser = db_model->getXMLParser();
 	op_list = new OperationList(db_model);
+	model_journal = new ModelJournal(db_model, ModelJournal::getJournalFilename(tmp_filename), this);
 	scene = new ObjectsScene;
 	scene->installEventFilter(this);
 
@@ -727,6 +728,10 @@ ModelWidget::~ModelWidget()
 void ModelWidget::setModified(bool value)
 {
 	this->modified = value;
+
+	if(value)
+		model_journal->setChanged();
+
 	emit s_modelModified(value);
 }
 
@@ -1876,7 +1881,7 @@ void ModelWidget::loadModel(const QString &filename)
 	{
 		task_prog_wgt.close();
 		setModified(false);
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2067,7 +2072,7 @@ void ModelWidget::saveModel(const QString &filename)
 			 * we can write the new one in its place */
 			if(!QFile::rename(filename, bkpfile))
 				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(bkpfile),
-												ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+												ErrorCode::FileDirectoryNotWritten,__exc_origin);
 
 			has_bkp_file = true;
 		}
@@ -2085,7 +2090,7 @@ void ModelWidget::saveModel(const QString &filename)
 		 * so we raise an error to the user and restore the backup file to its original path */
 		if(fi.size() == 0)
 			throw Exception(Exception::getErrorMessage(ErrorCode::ModelFileInvalidSize).arg(filename),
-											ErrorCode::ModelFileInvalidSize,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::ModelFileInvalidSize,__exc_origin);
 
 		// Removing the backup file if the model was successfully saved
 		if(has_bkp_file)
@@ -2105,10 +2110,10 @@ void ModelWidget::saveModel(const QString &filename)
 			QFile::copy(bkpfile, filename);
 
 			throw Exception(Exception::getErrorMessage(ErrorCode::ModelFileSaveFailure).arg(filename).arg(bkpfile),
-											ErrorCode::ModelFileSaveFailure,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+											ErrorCode::ModelFileSaveFailure,__exc_origin, &e);
 		}
 
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
@@ -2273,10 +2278,10 @@ void ModelWidget::showObjectForm(ObjectType obj_type, BaseObject *object, BaseOb
 		if(obj_type!=ObjectType::Permission)
 		{
 			if(object && obj_type!=object->getObjectType())
-				throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ErrorCode::OprObjectInvalidType,__exc_origin);
 			//If the user try to call the table object form without specify a parent object
 			else if(!parent_obj && TableObject::isTableObject(obj_type))
-				throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ErrorCode::OprNotAllocatedObject,__exc_origin);
 		}
 
 		if(object && dynamic_cast<BaseGraphicObject *>(object))
@@ -2290,7 +2295,7 @@ void ModelWidget::showObjectForm(ObjectType obj_type, BaseObject *object, BaseOb
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 											.arg(object->getName(), object->getTypeName()),
-											ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::OprReservedObject,__exc_origin);
 		}
 
 		setBlinkAddedObjects(BaseGraphicObject::isGraphicObject(obj_type));
@@ -2598,7 +2603,7 @@ void ModelWidget::changeOwner()
 					throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 									.arg(obj->getName())
 									.arg(obj->getTypeName()),
-									ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									ErrorCode::OprReservedObject,__exc_origin);
 
 				//Register an operation only if the object is not the database itself
 				if(obj->getObjectType()!=ObjectType::Database)
@@ -2780,7 +2785,7 @@ void ModelWidget::protectObject()
 					{
 						throw Exception(Exception::getErrorMessage(ErrorCode::OprRelationshipAddedObject)
 										.arg(object->getName()).arg(object->getTypeName()),
-										ErrorCode::OprRelationshipAddedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::OprRelationshipAddedObject,__exc_origin);
 					}
 				}
 
@@ -2871,7 +2876,7 @@ void ModelWidget::copyObjects(bool duplicate_mode, bool copy_deps)
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 											.arg(selected_objects[0]->getName()).arg(selected_objects[0]->getTypeName()),
-											ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::OprReservedObject,__exc_origin);
 		}
 	}
 
@@ -3135,7 +3140,7 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 			if(duplicate_mode && aux_table)
 			{
 				xml_objs[object] = aux_table->__getSourceCode(SchemaParser::XmlCode, true);
-			  object->setCodeInvalidated(true);
+			  object->setCodeInvalidated(true, false);
 			}
 			else
 				xml_objs[object] = object->getSourceCode(SchemaParser::XmlCode);
@@ -3297,7 +3302,7 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 	{
 		Messagebox msg_box;
 		msg_box.show(Exception(tr("Not all objects were pasted to the model due to errors returned during the process! Refer to error stack for more details!"),
-								 ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__, errors), "",
+								 ErrorCode::Custom,__exc_origin, errors), "",
 								 Messagebox::AlertIcon);
 	}
 
@@ -3638,14 +3643,14 @@ void ModelWidget::removeObjects(bool cascade)
 					if(object->isSystemObject())
 						throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 														.arg(object->getName()).arg(object->getTypeName()),
-														ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+														ErrorCode::OprReservedObject,__exc_origin);
 					//Raises an error if the user try to remove a protected object
 					else if(object->isProtected())
 					{
 						throw Exception(Exception::getErrorMessage(ErrorCode::RemProtectedObject)
 														.arg(object->getName(true))
 														.arg(object->getTypeName()),
-														ErrorCode::RemProtectedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+														ErrorCode::RemProtectedObject,__exc_origin);
 					}
 					else
 					{
@@ -3658,7 +3663,7 @@ void ModelWidget::removeObjects(bool cascade)
 								throw Exception(Exception::getErrorMessage(ErrorCode::RemProtectedObject)
 																.arg(tab_obj->getName(true))
 																.arg(tab_obj->getTypeName()),
-																ErrorCode::RemProtectedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+																ErrorCode::RemProtectedObject,__exc_origin);
 							}
 
 							table=dynamic_cast<BaseTable *>(tab_obj->getParentTable());
@@ -3696,7 +3701,7 @@ void ModelWidget::removeObjects(bool cascade)
 															 e.getErrorCode()==ErrorCode::OprReservedObject))
 									errors.push_back(e);
 								else
-									throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+									throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 							}
 						}
 						else
@@ -3726,7 +3731,7 @@ void ModelWidget::removeObjects(bool cascade)
 																 e.getErrorCode()==ErrorCode::OprReservedObject))
 										errors.push_back(e);
 									else
-										throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+										throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin,&e);
 								}
 
 								if(rel)
@@ -3750,7 +3755,7 @@ void ModelWidget::removeObjects(bool cascade)
 
 				if(!errors.empty())
 				{
-					msg_box.show(Exception(ErrorCode::RemInvalidatedObjects, __PRETTY_FUNCTION__,__FILE__,__LINE__, errors),
+					msg_box.show(Exception(ErrorCode::RemInvalidatedObjects, __exc_origin, errors),
 								 tr("The cascade deletion found some problems when running! Some objects could not be deleted or registered in the operation's history! Please, refer to error stack for more details."),
 								 Messagebox::AlertIcon);
 				}
@@ -4873,6 +4878,11 @@ OperationList *ModelWidget::getOperationList()
 	return op_list;
 }
 
+ModelJournal *ModelWidget::getModelJournal()
+{
+	return model_journal;
+}
+
 std::vector<BaseObject *> ModelWidget::getSelectedObjects()
 {
 	return selected_objects;
@@ -5022,7 +5032,7 @@ void ModelWidget::convertIntegerToSerial()
 
 		if(!col_type.isIntegerType() || (!col->getDefaultValue().contains(regexp) && !col->getSequence()))
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvConversionIntegerToSerial).arg(col->getName()),
-											ErrorCode::InvConversionIntegerToSerial ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::InvConversionIntegerToSerial ,__exc_origin);
 
 		op_list->registerObject(col, Operation::ObjModified, -1, tab);
 
@@ -5105,7 +5115,7 @@ void ModelWidget::breakRelationshipLine(BaseRelationship *rel, RelBreakMode brea
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
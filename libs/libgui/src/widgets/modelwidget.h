@@ -28,6 +28,7 @@
 #include <QMenu>
 #include "databasemodel.h"
 #include "operationlist.h"
+#include "modeljournal.h"
 #include "messagebox.h"
 #include "objectsscene.h"
 #include "newobjectoverlaywidget.h"
@@ -203,6 +204,9 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Database model handle by the ModelWidget class. All operations are made over this attribute
 		DatabaseModel *db_model;
 
+		//! \brief Journal that stores the changes made in the model in order to restore it after a crash
+		ModelJournal *model_journal;
+
 		//! \brief Stores the loaded database model filename
 		QString filename,
 
@@ -440,6 +444,9 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Returns the operation list used by database model
 		OperationList *getOperationList();
 
+		//! \brief Returns the journal in which the model changes are saved for crash recovery
+		ModelJournal *getModelJournal();
+
 		//! \brief Returns the currently selected list of objects
 		std::vector<BaseObject *> getSelectedObjects();
 
@@ -54,14 +54,14 @@ void ObjectRenameWidget::setAttributes(std::vector<BaseObject *> objs, DatabaseM
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::OprReservedObject)
 												 .arg(obj->getName(), obj->getTypeName()),
-											ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::OprReservedObject,__exc_origin);
 		}
 
 		if(tab_obj && tab_obj->isAddedByRelationship())
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::OprRelationshipAddedObject)
 											.arg(tab_obj->getName(), tab_obj->getTypeName()),
-											ErrorCode::OprRelationshipAddedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::OprRelationshipAddedObject ,__exc_origin);
 		}
 	}
 
@@ -11,12 +11,15 @@ HEADERS += src/parsersglobal.h \
 src/schemaparser.h \
 src/csvdocument.h \
 src/csvparser.h \
+src/sqlscriptparser.h \
 src/xmlparser.h \
 src/attributes.h
 
 SOURCES += src/schemaparser.cpp \
+src/attributes.cpp \
 src/csvdocument.cpp \
 src/csvparser.cpp \
+src/sqlscriptparser.cpp \
 src/xmlparser.cpp
 
 unix|windows: LIBS += $$LIBUTILS_LIB $$XML_LIB
@@ -7,13 +7,13 @@
 # it under the terms of the GNU General Public License as published by
 # the Free Software Foundation version 3.
 #
-# This program is distributed in the hope that it will be useful),
+# This program is distributed in the hope that it will be useful,
 # but WITHOUT ANY WARRANTY; without even the implied warranty of
 # MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
 # GNU General Public License for more details.
 #
 # The complete text of GPLv3 is at LICENSE file on source code root directory.
-# Also), you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
 */
 
 /**
@@ -22,6 +22,7 @@
 \brief Definition of parsers attributes namespace which stores a series of static strings constants used
  to reference the attributes of objects in SQL/XML generation methods.
  Each string stores the name of the attribute used in the schema file "sch" of the respective objects.
+ The constants are defined once in attributes.cpp so all the modules share the same string data.
 \note <strong>Creation date:</strong> 23/09/2008
 */
 
@@ -32,748 +33,749 @@
 #include <QString>
 
 namespace Attributes {
-	static const QString
-	Action ("action"),
-	ActiveLayers("active-layers"),
-	AdminOption("admin-option"),
-	AdminRoles("admin-roles"),
-	AlertUnsavedModels("alert-unsaved-models"),
-	AlertOpenSqlTabs("alert-open-sqltabs"),
-	Alias("alias"),
-	Alignment("alignment"),
-	AlignObjsToGrid("align-objs-to-grid"),
-	AllowCompletion("allow-completion"),
-	AllowConns("allow-conns"),
-	AllVersions("all"),
-	AlterCmds("alter-cmds"),
-	AnalyzeFunc("analyze"),
-	AncestorTable("ancestor-table"),
-	Any("any"),
-	AppendAtEod("append-at-eod"),
-	AppendedSql("appended-sql"),
-	Application("application"),
-	ApplyOnServer("apply-on-server"),
-	ArgCount("arg-count"),
-	ArgDefaults("arg-defaults"),
-	ArgDefCount("arg-def-count"),
-	ArgModes("arg-modes"),
-	ArgNames("arg-names"),
-	ArgTypes("arg-types"),
-	Arguments("arguments"),
-	AscOrder("asc-order"),
-	Assignment("assignment"),
-	AttribsPage("attribs-page"),
-	AttribsPerPage("attribs-per-page"),
-	Attribute("attribute"),
-	Attributes("attributes"),
-	AutoBrowseDb("auto-browse-db"),
-	AutoSaveInterval("autosave-interval"),
-	BackgroundColor("background-color"),
-	BaseType("base"),
-	Before("before"),
-	BehaviorType("behavior-type"),
-	Big("big"),
-	Bold("bold"),
-	BorderColor("border-color"),
-	Bottom("bottom"),
-	BlogPost("blogpost"),
-	Buffering("buffering"),
-	BypassRls("bypassrls"),
-	ByValue("by-value"),
-	Cache("cache"),
-	CanonicalFunc("canonical"),
-	CanvasColor("canvas-color"),
-	CanvasCornerMove("canvas-corner-move"),
-	CaptureNearby("capture-nearby"),
-	Cascade("cascade"),
-	CaseSensitive("case-sensitive"),
-	CastType("cast-type"),
-	Category("category"),
-	Change("change"),
-	Changelog("changelog"),
-	CheckExp("check-exp"),
-	CheckOption("check-option"),
-	CheckUpdate("check-update"),
-	CheckVersions("check-versions"),
-	CkConstr("ck-constr"),
-	ClientEncoding("client-encoding"),
-	CloseChar("close-char"),
-	Code("code"),
-	CodeCompletion("code-completion"),
-	ColIndexes("col-indexes"),
-	ColIsIdentity("col-is-identity"),
-	CollapseMode("collapse-mode"),
-	Collatable("collatable"),
-	Collation("collation"),
-	Collations("collations"),
-	Color("color"),
-	Colors("colors"),
-	ColsComment("cols-comment"),
-	Column("column"),
-	ColumnAlias("column-alias"),
-	ColumnTruncThreshold("column-trunc-threshold"),
-	Columns("columns"),
-	Command("command"),
-	Commands("commands"),
-	Comment("comment"),
-	CommutatorOp("commutator-op"),
-	CompactView("compact-view"),
-	CompareToDatabase("compare-to-db"),
-	ComparisonType("comparison-type"),
-	CompletionTrigger("completion-trigger"),
-	CompositeType("composite"),
-	Concurrent("concurrent"),
-	Condition("condition"),
-	ConfigFile("config-file"),
-	ConfigParam("confparam"),
-	ConfigParams("config-params"),
-	Configuration("configuration"),
-	ConfirmValidation("confirm-validation"),
-	ConnectCenterPnts("center-pnts"),
-	ConnectFkToPk("fk-to-pk"),
-	Connection("connection"),
-	Connections("connections"),
-	ConnectionTimeout("connection-timeout"),
-	ConnectPriv("connect"),
-	ConnectTableEdges("table-edges"),
-	ConnLimit("connlimit"),
-	Constraint("constraint"),
-	Constraints("constraints"),
-	ConstrDefs("constr-defs"),
-	ConstrIndexes("constr-indexes"),
-	ConstrSqlDisabled("constr-sql-disabled"),
-	Contents("contents"),
-	CopyMode("copy-mode"),
-	CopyOptions("copy-options"),
-	CopyTable("copy-table"),
-	Create("create"),
-	CreateCmds("create-cmds"),
-	Created("created"),
-	CreateDb("createdb"),
-	CreatePriv("create"),
-	CreateRole("createrole"),
-	CrowsFoot("crows-foot"),
-	CteExpression("cte-exp"),
-	CurIdentityType("cur-identity-type"),
-	CurrentModel("current-model"),
-	CurVersion("cur-version"),
-	CustomColor("custom-color"),
-	CustomFilter("custom-filter"),
-	CustomIdxs("customidxs"),
-	CustomScale("custom-scale"),
-	Cycle("cycle"),
-	Dark("dark"),
-	Database("database"),
-	DataDirectory("data-directory"),
-	DataDictIndex("datadictidx"),
-	Date("date"),
-	DbModel("dbmodel"),
-	DdlEndToken("-- ddl-end --"),
-	DeadRowsAmount("dead-rows-amount"),
-	Declaration("declaration"),
-	DeclInTable("decl-in-table"),
-	Default("default"),
-	DefaultCollation("default-collation"),
-	DefaultForOps("default-for-ops"),
-	DefaultOwner("default-owner"),
-	DefaultSchema("default-schema"),
-	DefaultTablespace("default-tablespace"),
-	DefaultValue("default-value"),
-	Deferrable("deferrable"),
-	DeferType("defer-type"),
-	Definition("definition"),
-	DelAction("del-action"),
-	Deleted("deleted"),
-	DeletePriv("delete"),
-	DelEvent("del-event"),
-	Delimiter("delimiter"),
-	DelimitersColor("delimiters-color"),
-	Design("design"),
-	DestType("destiny-type"),
-	Deterministic("deterministic"),
-	Diff("diff"),
-	Dimension("dimension"),
-	Directory("directory"),
-	DisableSmoothness("disable-smoothness"),
-	DisableInlineEditor("disable-inline-editor"),
-	DisplayLineNumbers("display-line-numbers"),
-	DockWidgets("dock-widgets"),
-	DomConstraint("domconstraint"),
-	DontDropMissingObjs("dont-drop-missing-objs"),
-	Dot("dot"),
-	Drop("drop"),
-	DropCmds("drop-cmds"),
-	DropMissingColsConstrs("drop-missing-cols-constrs"),
-	DropTruncCascade("drop-trunc-cascade"),
-	DstColPattern("dst-col-pattern"),
-	DstColumns("dst-columns"),
-	DstEncoding("dst-encoding"),
-	DstFkPattern("dst-fk-pattern"),
-	DstLabel("dst-label"),
-	DstRequired("dst-required"),
-	DstTable("dst-table"),
-	DstType("dst-type"),
-	DynamicLibraryPath("dynamic-library-path"),
-	DynamicSharedMemory("dynamic-shared-memory-type"),
-	Element("element"),
-	Elements("elements"),
-	ElementsCount("elements-count"),
-	EmptyPassword("empty-password"),
-	Encoding("encoding"),
-	EnclosingChars("enclosing-chars"),
-	Encrypted("encrypted"),
-	EndExp("end-exp"),
-	EnumType("enumeration"),
-	EntireLine("entire-line"),
-	Entry("entry"),
-	EscapeComment("escape-comment"),
-	Event("event"),
-	Events("events"),
-	EventType("event-type"),
-	ExactMatch("exact-match"),
-	ExcBuiltinArrays("exc-builtin-arrays"),
-	ExcludeElement("excelement"),
-	ExConstr("ex-constr"),
-	ExecType("exec-type"),
-	ExecutionCost("execution-cost"),
-	ExecutPriv("execute"),
-	ExistingValue("existing-value"),
-	ExpansionFactor("expansion-factor"),
-	Explicit("explicit"),
-	Export("export"),
-	ExportToFile("export-to-file"),
-	Expression("expression"),
-	Expressions("expressions"),
-	ExtAttribsPage("ext-attribs-page"),
-	ExtAttribsPerPage("ext-attribs-per-page"),
-	ExtObjOids("ext-obj-oids"),
-	ExtraCondition("extra-condition"),
-	ExtraInfo("extra-info"),
-	Factor("factor"),
-	FadedOut("faded-out"),
-	FadeInObjects("fadein-objects"),
-	False("false"),
-	Family("family"),
-	FastUpdate("fast-update"),
-	Fdw("fdw"),
-	File("file"),
-	FileAssociated("file-associated"),
-	FillColor("fill-color"),
-	Filter("filter"),
-	Filters("filters"),
-	FilterOids("filter-oids"),
-	FilterTableTypes("filter-tab-types"),
-	Final("final"),
-	FinalExp("final-exp"),
-	FinalFunc("final"),
-	FiringType("firing-type"),
-	FirstRun("first-run"),
-	FkColumn("fk-column"),
-	FkConstr("fk-constr"),
-	FkDefs("fk-defs"),
-	FkIdxPattern("fk-idx-pattern"),
-	FkIdxType("fk-idx-type"),
-	ForceObjsReCreation("force-objs-re-creation"),
-	ForcedFiltering("forced-filtering"),
-	Font("font"),
-	FontSize("font-size"),
-	ForegroundColor("foreground-color"),
-	ForeignKeys("foreign-keys"),
-	ForeignTableTogglerButtons("foreigntable-toggler-btns"),
-	ForeignTableTogglerBody("foreigntable-toggler-body"),
-	ForeignTableBody("foreigntable-body"),
-	ForeignTableExtBody("foreigntable-ext-body"),
-	ForeignTableName("foreigntable-name"),
-	ForeignTableSchemaName("foreigntable-schema-name"),
-	ForeignTableTitle("foreigntable-title"),
-	FormatName("format-name"),
-	FromExp("from-exp"),
-	FromSqlFunc("fromsql"),
-	Function("function"),
-	FunctionType("function-type"),
-	GenAlterCmds("gen-alter-cmds"),
-	GenDisabledObjsCode("gen-disabled-objs-code"),
-	General("general"),
-	Generated("generated"),
-	Global("global"),
-	Grant("grant"),
-	GrantOp("grant-op"),
-	GridSize("grid-size"),
-	GridColor("grid-color"),
-	GridPattern("grid-pattern"),
-	Group("group"),
-	HandlerFunc("handler"),
-	HasChanges("has-changes"),
-	Hashes("hashes"),
-	HasOptions("has-options"),
-	HbaFile("hba-file"),
-	Height("height"),
-	HideDescription("hide-description"),
-	HideExtAttribs("hide-ext-attribs"),
-	HideObjShadows("hide-obj-shadows"),
-	HideRelName("hide-rel-name"),
-	HideSchNameUserTypes("hide-schema-names-of-types"),
-	HideTableTags("hide-table-tags"),
-	HideObjectsSelInfo("hide-objects-sel-info"),
-	HideCurPosZoomInfo("hide-cur-pos-zoom-info"),
-	HighlightLines("highlight-lines"),
-	HighlightOrder("highlight-order"),
-	HistoryMaxLength("history-max-length"),
-	Icon("icon"),
-	IconsSize("icons-size"),
-	Id("id"),
-	IdentFile("ident-file"),
-	Identifier("identifier"),
-	IdentityType("identity-type"),
-	IgnoredChars("ignored-chars"),
-	IgnoreDuplicErrors("ignore-duplic-errors"),
-	IgnoreErrorCodes("ignore-error-codes"),
-	IgnoreImportErrors("ignore-import-errors"),
-	Implicit("implicit"),
-	Import("import"),
-	ImportExtObjs("import-ext-objs"),
-	ImportSysObjs("import-sys-objs"),
-	Increment("increment"),
-	Index("index"),
-	IndexElement("idxelement"),
-	Indexes("indexes"),
-	IndexType("index-type"),
-	Info("info"),
-	IncludedCols("include-cols"),
-	InhColumn("inh-column"),
-	InhColumns("inh-columns"),
-	Inherit("inherit"),
-	Inherited("inherited"),
-	InitialCond("initial-cond"),
-	InitialData("initial-data"),
-	InitialExp("initial-exp"),
-	Initial("initial"),
-	InkSaver("inksaver"),
-	InlineFunc("inline"),
-	InputDatabase("input-db"),
-	InputFunc("input"),
-	InsertPriv("insert"),
-	InsEvent("ins-event"),
-	InternalLength("internal-length"),
-	IntervalType("interval-type"),
-	InvertRangeSelTrigger("invert-rangesel-trigger"),
-	IoCast("io-cast"),
-	IsExtType("is-ext-type"),
-	IsPartitioned("is-partitioned"),
-	IsTemplate("is-template"),
-	Italic("italic"),
-	Item("item"),
-	Items("items"),
-	JoinFunc("join"),
-	KeepClusterObjs("keep-cluster-objs"),
-	KeepObjsPerms("keep-objs-perms"),
-	Label("label"),
-	Labels("labels"),
-	LabelsPos("labels-pos"),
-	Landscape("landscape"),
-	Language("language"),
-	LastAnalyze("last-analyze"),
-	LastAutovacuum("last-autovacuum"),
-	LastPosition("last-position"),
-	LastSysOid("last-sys-oid"),
-	LastVacuum("last-vacuum"),
-	LastValue("last-value"),
-	LastZoom("last-zoom"),
-	Layer("layer"),
-	LayerNameColors("layer-name-colors"),
-	LayerRectColors("layer-rect-colors"),
-	Layers("layers"),
-	LayersConfig("layersconfig"),
-	LcCollate("lc-collate"),
-	LcCtype("lc-ctype"),
-	LcCollateMod("lc-collate-mod"),
-	LcCtypeMod("lc-ctype-mod"),
-	LeakProof("leakproof"),
-	Left("left"),
-	LeftType("left-type"),
-	Length("length"),
-	Library("library"),
-	Light("light"),
-	LikeType("like-type"),
-	Line("line"),
-	LineHighlightColor("line-highlight-color"),
-	LineNumbersBgColor("line-numbers-bg-color"),
-	LineNumbersColor("line-numbers-color"),
-	Link("link"),
-	LinkMode("link-mode"),
-	ListenAddresses("listen-addresses"),
-	Locale("locale"),
-	LocaleMod("locale-mod"),
-	LockerArc("locker-arc"),
-	LockerBody("locker-body"),
-	LockPageDelimResize("lock-page-delim-resize"),
-	Login("login"),
-	LookaheadChar("lookahead-char"),
-	LowVerbosity("low-verbosity"),
-	MatchBySignature("match-by-signature"),
-	Materialized("materialized"),
-	MaxConnections("max-connections"),
-	Maximized("maximized"),
-	MaxObjCount("max-obj-count"),
-	MaxValue("max-value"),
-	Medium("medium"),
-	Member("member"),
-	MemberRoles("member-roles"),
-	Merges("merges"),
-	Metadata("metadata"),
-	MinObjectOpacity("min-object-opacity"),
-	MinValue("min-value"),
-	Mode("mode"),
-	ModelAuthor("author"),
-	Name("name"),
-	NameColor("name-color"),
-	NameFilter("name-filter"),
-	NameLabel("name-label"),
-	NamePatterns("name-patterns"),
-	Names("names"),
-	NegatorOp("negator-op"),
-	NewIdentityType("new-identity-type"),
-	NewName("new-name"),
-	NewTableName("new-table-name"),
-	NewVersion("new-version"),
-	Next("next"),
-	NnColumn("nn-column"),
-	NoInherit("no-inherit"),
-	None("none"),
-	NotExtObject("not-ext-object"),
-	NotNull("not-null"),
-	NullsFirst("nulls-first"),
-	NullsNotDistinct("nulls-not-distinct"),
-	Object("object"),
-	ObjectFinder("objectfinder"),
-	ObjectId("object-id"),
-	Objects("objects"),
-	ObjectType("object-type"),
-	ObjCount("objcount"),
-	ObjRelationName("obj-rel-name"),
-	ObjSelection("obj-selection"),
-	ObjShadow("obj-shadow"),
-	Oid("oid"),
-	OidFilterOp("oid-filter-op"),
-	Oids("oids"),
-	OldName("old-name"),
-	OldPgSqlVersions("old-pgsql-versions"),
-	OldTableName("old-table-name"),
-	OldVersion("old-version"),
-	OnlyMatching("only-matching"),
-	OpClass("opclass"),
-	OpClasses("opclasses"),
-	OpenChar("open-char"),
-	Operator("operator"),
-	OperatorFunc("operfunc"),
-	Operators("operators"),
-	OpFamily("opfamily"),
-	OpListSize("op-list-size"),
-	Options("options"),
-	OriginalPk("original-pk"),
-	OutputFunc("output"),
-	Owner("owner"),
-	OwnerColumn("owner-col"),
-	Pagination("pagination"),
-	PaperCustomSize("paper-custom-size"),
-	PaperMargin("paper-margin"),
-	PaperOrientation("paper-orientation"),
-	PaperType("paper-type"),
-	ParallelType("parallel-type"),
-	Parameter("parameter"),
-	Parameters("parameters"),
-	ParamIn("in"),
-	ParamOut("out"),
-	ParamVariadic("variadic"),
-	Parent("parent"),
-	ParentType("parent-type"),
-	Parents("parents"),
-	Parsable("parsable"),
-	PartialMatch("partial-match"),
-	PartitionBoundExpr("partition-bound-expr"),
-	PartitionedTable("partitioned-table"),
-	PartitionTables("partition-tables"),
-	Partitioning("partitioning"),
-	PartitionKey("partitionkey"),
-	PartKeyColls("part-key-colls"),
-	PartKeyCols("part-key-cols"),
-	PartKeyExprs("part-key-exprs"),
-	PartKeyOpCls("part-key-opcls"),
-	Password("password"),
-	PasswordEncryption("password-encryption"),
-	Path("path"),
-	Patterns("patterns"),
-	Permission("permission"),
-	Permissive("permissive"),
-	PerRow("per-line"),
-	Persistent("persistent"),
-	PgModelerVersion("pgmodeler-ver"),
-	PgSqlBaseType("basetype"),
-	PgSqlVersion("pgsql-ver"),
-	PkColPattern("pk-col-pattern"),
-	PkColumn("pk-column"),
-	PkConstr("pk-constr"),
-	PkPattern("pk-pattern"),
-	Placeholder("placeholder"),
-	Placeholders("placeholders"),
-	Plugin("plugin"),
-	Points("points"),
-	Port("port"),
-	Portrait("portrait"),
-	Position("position"),
-	PositionInfo("pos-info"),
-	Precision("precision"),
-	Predicate("predicate"),
-	Preferred("preferred"),
-	PrependAtBod("prepend-at-bod"),
-	PrependedSql("prepended-sql"),
-	PreserveDbName("preserve-db-name"),
-	PrependSchema("prepend-schema"),
-	Preset("preset"),
-	Previous("previous"),
-	PrintGrid("print-grid"),
-	PrintPgNum("print-pg-num"),
-	Privileges("privileges"),
-	PrivilegesGop("privileges-gop"),
-	ProtColumn("prot-column"),
-	Protected("protected"),
-	Provider("provider"),
-	RangeAttribs("range-attribs"),
-	RangeType("range"),
-	Recent("recent"),
-	RecentModels("recent-models"),
-	RecreateUnmodObjs("recreate-unmod-objs"),
-	ReplaceModObjs("replace-mod-objs"),
-	RectVisible("rect-visible"),
-	Recursive("recursive"),
-	RecvFunc("receive"),
-	ReducedForm("reduced-form"),
-	RefAlias("ref-alias"),
-	RefColumn("ref-column"),
-	RefColumns("ref-columns"),
-	Refer("refer"),
-	Reference("reference"),
-	ReferenceFk("reference-fk"),
-	References("references"),
-	ReferencesPriv("references"),
-	Referrers("referrers"),
-	RefName("ref-name"),
-	RefTable("ref-table"),
-	RefTables("ref-tables"),
-	RefTableTag("reftable"),
-	RefType("ref-type"),
-	RegularExp("regexp"),
-	RelatedForeignKey("related-foreign-key"),
-	Relationship("relationship"),
-	Relationship11("rel11"),
-	Relationship1n("rel1n"),
-	RelationshipDep("reldep"),
-	RelationshipFk("relfk"),
-	RelationshipGen("relgen"),
-	RelationshipNn("relnn"),
-	RelationshipPart("relpart"),
-	RelationshipTabView("reltv"),
-	RelsFollowTabsVisibility("rels-follow-tabs-visibility"),
-	Rename("rename"),
-	Replication("replication"),
-	RestartSeq("restart-seq"),
-	RestrictionFunc("restriction"),
-	ReturnsSetOf("returns-setof"),
-	ReturnTable("return-table"),
-	ReturnType("return-type"),
-	ReuseSequences("reuse-sequences"),
-	Revoke("revoke"),
-	Right("right"),
-	RightType("right-type"),
-	RlsEnabled("rls-enabled"),
-	RlsForced("rls-forced"),
-	Role("role"),
-	Roles("roles"),
-	RoleMembers("rolemembers"),
-	RoleType("role-type"),
-	RowAmount("row-amount"),
-	Rules("rules"),
-	RunInTransaction("run-in-transaction"),
-	SaveLastPosition("save-last-position"),
-	SaveRestoreGeometry("save-restore-geometry"),
-	SceneRect("scene-rect"),
-	Schema("schema"),
-	Schemas("schemas"),
-	SchemaOid("schema-oid"),
-	SearchPath("search-path"),
-	SecurityBarrier("security-barrier"),
-	SecurityInvoker("security-invoker"),
-	SecurityType("security-type"),
-	SelectExp("select-exp"),
-	SelectObjects("select-objects"),
-	SelectPriv("select"),
-	SendFunc("send"),
-	Sequence("sequence"),
-	Sequences("sequences"),
-	Server("server"),
-	ServerEncoding("server-encoding"),
-	ServerPid("server-pid"),
-	ServerProtocol("server-protocol"),
-	ServerVersion("server-version"),
-	SessionOpts("sessionopts"),
-	SetPerms("set-perms"),
-	SharedObj("shared-obj"),
-	ShellTypes("shell-types"),
-	ShowAttributesGrid("show-attributes-grid"),
-	ShowCanvasGrid("show-canvas-grid"),
-	ShowLayerNames("show-layer-names"),
-	ShowLayerRects("show-layer-rects"),
-	ShowMainMenu("show-main-menu"),
-	ShowPageDelimiters("show-page-delimiters"),
-	ShowSourcePane("show-source-pane"),
-	ShowSysSchemasRects("show-sys-schemas-rects"),
-	Signature("signature"),
-	SimpleCol("simplecol"),
-	SimpleExp("simple-exp"),
-	SimplifiedObjCreation("simplified-obj-creation"),
-	SingleExp("single-exp"),
-	SinglePkColumn("single-pk-col"),
-	Size("size"),
-	Small("small"),
-	Snippet("snippet"),
-	SortOp("sort-op"),
-	SourceEditorApp("source-editor-app"),
-	SourceEditorArgs("source-editor-args"),
-	SourceType("source-type"),
-	SpatialType("spatial-type"),
-	SpecialPkCols("special-pk-cols"),
-	Split("split"),
-	SqlDisabled("sql-disabled"),
-	SqlObject("sql-object"),
-	SqlTool("sqltool"),
-	SqlValidation("sql-validation"),
-	Square("square"),
-	SrcColPattern("src-col-pattern"),
-	SrcColumns("src-columns"),
-	SrcEncoding("src-encoding"),
-	SrcFkPattern("src-fk-pattern"),
-	SrcLabel("src-label"),
-	SrcRequired("src-required"),
-	SrcTable("src-table"),
-	SrcType("src-type"),
-	Srid("srid"),
-	Ssl("ssl"),
-	SslCaFile("ssl-ca-file"),
-	SslCertFile("ssl-cert-file"),
-	SslCrlFile("ssl-crl-file"),
-	SslKeyFile("ssl-key-file"),
-	Start("start"),
-	StableBeta("stablebeta"),
-	StableOnly("stableonly"),
-	StateType("state-type"),
-	Storage("storage"),
-	StorageParams("stg-params"),
-	StoreInFile("store-in-file"),
-	StrategyNum("stg-number"),
-	Stikeout("strikeout"),
-	Style("style"),
-	Styles("styles"),
-	Subtype("subtype"),
-	SubtypeDiffFunc("subtypediff"),
-	Superuser("superuser"),
-	Symbol("symbol"),
-	System("system"),
-	Table("table"),
-	TableTogglerButtons("table-toggler-btns"),
-	TableTogglerBody("table-toggler-body"),
-	TableBody("table-body"),
-	TableExtBody("table-ext-body"),
-	TableName("table-name"),
-	TableObject("table-obj"),
-	TableSchemaName("table-schema-name"),
-	Tablespace("tablespace"),
-	TableTitle("table-title"),
-	TableType("table-type"),
-	Tag("tag"),
-	TabWidth("tab-width"),
-	TemplateDb("template"),
-	TemporaryPriv("temporary"),
-	Top("top"),
-	ToSqlFunc("tosql"),
-	TpmodInFunc("tpmodin"),
-	TpmodOutFunc("tpmodout"),
-	TransformTypes("transform-types"),
-	TransitionFunc("transition"),
-	TriggerFunc("trigger-func"),
-	TriggerPriv("trigger"),
-	Triggers("triggers"),
-	True("true"),
-	Truncate("truncate"),
-	TruncateColumnData("truncate-column-data"),
-	TruncatePriv("truncate"),
-	TruncEvent("trunc-event"),
-	Trusted("trusted"),
-	TuplesDel("tuples-del"),
-	TuplesIns("tuples-ins"),
-	Type("type"),
-	TypeAttribute("typeattrib"),
-	TypeClass("type-class"),
-	TypeOid("type-oid"),
-	Types("types"),
-	TyplesUpd("tuples-upd"),
-	UiLanguage("ui-language"),
-	UiTheme("ui-theme"),
-	Undefined("undefined"),
-	Underline("underline"),
-	Unique("unique"),
-	Unlogged("unlogged"),
-	Unset("unset"),
-	UnsetPerms("unset-perms"),
-	UpdAction("upd-action"),
-	Updated("updated"),
-	UpdatePriv("update"),
-	UpdEvent("upd-event"),
-	UqColumn("uq-column"),
-	UqConstr("uq-constr"),
-	UqPattern("uq-pattern"),
-	UsagePriv("usage"),
-	UseChangelog("use-changelog"),
-	UseColumns("use-columns"),
-	UseCurvedLines("use-curved-lines"),
-	UseDefDisambiguation("use-def-disambiguation"),
-	UsePlaceholders("use-placeholders"),
-	UseSignature("use-signature"),
-	UseSorting("use-sorting"),
-	UseUniqueNames("use-unique-names"),
-	UsingExp("using-exp"),
-	Validation("validation"),
-	Validator("validator"),
-	ValidatorFunc("validator"),
-	Validity("validity"),
-	Value("value"),
-	Values("values"),
-	Variable("variable"),
-	Variation("variation"),
-	Version("version"),
-	ViewTogglerButtons("view-toggler-btns"),
-	ViewTogglerBody("view-toggler-body"),
-	ViewBody("view-body"),
-	ViewExtBody("view-ext-body"),
-	ViewName("view-name"),
-	ViewSchemaName("view-schema-name"),
-	ViewTitle("view-title"),
-	Visible("visible"),
-	Widget("widget"),
-	WidgetsGeometry("widgets-geometry"),
-	Width("width"),
-	Wildcard("wildcard"),
-	WindowFunc("window-func"),
-	WithNoData("with-no-data"),
-	WithoutOids("without-oids"),
-	WithTimezone("with-timezone"),
-	Word("word"),
-	WordDelimiters("word-delimiters"),
-	WordSeparators("word-separators"),
-	WorkingDir("working-dir"),
-	XPos("x"),
-	YPos("y"),
-	Year("year"),
-	ZValue("z-value");
+	extern __libparsers const QString
+	Action,
+	ActiveLayers,
+	AdminOption,
+	AdminRoles,
+	AlertUnsavedModels,
+	AlertOpenSqlTabs,
+	Alias,
+	Alignment,
+	AlignObjsToGrid,
+	AllowCompletion,
+	AllowConns,
+	AllVersions,
+	AlterCmds,
+	AnalyzeFunc,
+	AncestorTable,
+	Any,
+	AppendAtEod,
+	AppendedSql,
+	Application,
+	ApplyOnServer,
+	ArgCount,
+	ArgDefaults,
+	ArgDefCount,
+	ArgModes,
+	ArgNames,
+	ArgTypes,
+	Arguments,
+	AscOrder,
+	Assignment,
+	AttribsPage,
+	AttribsPerPage,
+	Attribute,
+	Attributes,
+	AutoBrowseDb,
+	AutoSaveInterval,
+	BackgroundColor,
+	BaseType,
+	Before,
+	BehaviorType,
+	Big,
+	Bold,
+	BorderColor,
+	Bottom,
+	BlogPost,
+	Buffering,
+	BypassRls,
+	ByValue,
+	Cache,
+	CanonicalFunc,
+	CanvasColor,
+	CanvasCornerMove,
+	CaptureNearby,
+	Cascade,
+	CaseSensitive,
+	CastType,
+	Category,
+	Change,
+	Changelog,
+	CheckExp,
+	CheckOption,
+	CheckUpdate,
+	CheckVersions,
+	CkConstr,
+	ClientEncoding,
+	CloseChar,
+	Code,
+	CodeCompletion,
+	ColIndexes,
+	ColIsIdentity,
+	CollapseMode,
+	Collatable,
+	Collation,
+	Collations,
+	Color,
+	Colors,
+	ColsComment,
+	Column,
+	ColumnAlias,
+	ColumnTruncThreshold,
+	Columns,
+	Command,
+	Commands,
+	Comment,
+	CommutatorOp,
+	CompactView,
+	CompareToDatabase,
+	ComparisonType,
+	CompletionTrigger,
+	CompositeType,
+	Concurrent,
+	Condition,
+	ConfigFile,
+	ConfigParam,
+	ConfigParams,
+	Configuration,
+	ConfirmValidation,
+	ConnectCenterPnts,
+	ConnectFkToPk,
+	Connection,
+	Connections,
+	ConnectionTimeout,
+	ConnectPriv,
+	ConnectTableEdges,
+	ConnLimit,
+	Constraint,
+	Constraints,
+	ConstrDefs,
+	ConstrIndexes,
+	ConstrSqlDisabled,
+	Contents,
+	CopyMode,
+	CopyOptions,
+	CopyTable,
+	Create,
+	CreateCmds,
+	Created,
+	CreateDb,
+	CreatePriv,
+	CreateRole,
+	CrowsFoot,
+	CteExpression,
+	CurIdentityType,
+	CurrentModel,
+	CurVersion,
+	CustomColor,
+	CustomFilter,
+	CustomIdxs,
+	CustomScale,
+	Cycle,
+	Dark,
+	Database,
+	DataDirectory,
+	DataDictIndex,
+	Date,
+	DbModel,
+	DdlEndToken,
+	DeadRowsAmount,
+	Declaration,
+	DeclInTable,
+	Default,
+	DefaultCollation,
+	DefaultForOps,
+	DefaultOwner,
+	DefaultSchema,
+	DefaultTablespace,
+	DefaultValue,
+	Deferrable,
+	DeferType,
+	Definition,
+	DelAction,
+	Deleted,
+	DeletePriv,
+	DelEvent,
+	Delimiter,
+	DelimitersColor,
+	Design,
+	DestType,
+	Deterministic,
+	Diff,
+	Dimension,
+	Directory,
+	DisableSmoothness,
+	DisableInlineEditor,
+	DisplayLineNumbers,
+	DockWidgets,
+	DomConstraint,
+	DontDropMissingObjs,
+	Dot,
+	Drop,
+	DropCmds,
+	DropMissingColsConstrs,
+	DropTruncCascade,
+	DstColPattern,
+	DstColumns,
+	DstEncoding,
+	DstFkPattern,
+	DstLabel,
+	DstRequired,
+	DstTable,
+	DstType,
+	DynamicLibraryPath,
+	DynamicSharedMemory,
+	Element,
+	Elements,
+	ElementsCount,
+	EmptyPassword,
+	Encoding,
+	EnclosingChars,
+	Encrypted,
+	EndExp,
+	EnumType,
+	EntireLine,
+	Entry,
+	EscapeComment,
+	Event,
+	Events,
+	EventType,
+	ExactMatch,
+	ExcBuiltinArrays,
+	ExcludeElement,
+	ExConstr,
+	ExecType,
+	ExecutionCost,
+	ExecutPriv,
+	ExistingValue,
+	ExpansionFactor,
+	Explicit,
+	Export,
+	ExportToFile,
+	Expression,
+	Expressions,
+	ExtAttribsPage,
+	ExtAttribsPerPage,
+	ExtObjOids,
+	ExtraCondition,
+	ExtraInfo,
+	Factor,
+	FadedOut,
+	FadeInObjects,
+	False,
+	Family,
+	FastUpdate,
+	Fdw,
+	File,
+	FileAssociated,
+	FillColor,
+	Filter,
+	Filters,
+	FilterOids,
+	FilterTableTypes,
+	Final,
+	FinalExp,
+	FinalFunc,
+	FiringType,
+	FirstRun,
+	FkColumn,
+	FkConstr,
+	FkDefs,
+	FkIdxPattern,
+	FkIdxType,
+	ForceObjsReCreation,
+	ForcedFiltering,
+	Font,
+	FontSize,
+	ForegroundColor,
+	ForeignKeys,
+	ForeignTableTogglerButtons,
+	ForeignTableTogglerBody,
+	ForeignTableBody,
+	ForeignTableExtBody,
+	ForeignTableName,
+	ForeignTableSchemaName,
+	ForeignTableTitle,
+	FormatName,
+	FromExp,
+	FromSqlFunc,
+	Function,
+	FunctionType,
+	GenAlterCmds,
+	GenDisabledObjsCode,
+	General,
+	Generated,
+	Global,
+	Grant,
+	GrantOp,
+	GridSize,
+	GridColor,
+	GridPattern,
+	Group,
+	HandlerFunc,
+	HasChanges,
+	Hashes,
+	HasOptions,
+	HbaFile,
+	Height,
+	HideDescription,
+	HideExtAttribs,
+	HideObjShadows,
+	HideRelName,
+	HideSchNameUserTypes,
+	HideTableTags,
+	HideObjectsSelInfo,
+	HideCurPosZoomInfo,
+	HighlightLines,
+	HighlightOrder,
+	HistoryMaxLength,
+	Icon,
+	IconsSize,
+	Id,
+	IdentFile,
+	Identifier,
+	IdentityType,
+	IgnoredChars,
+	IgnoreDuplicErrors,
+	IgnoreErrorCodes,
+	IgnoreImportErrors,
+	Implicit,
+	Import,
+	ImportExtObjs,
+	ImportSysObjs,
+	Increment,
+	Index,
+	IndexElement,
+	Indexes,
+	IndexType,
+	Info,
+	IncludedCols,
+	InhColumn,
+	InhColumns,
+	Inherit,
+	Inherited,
+	InitialCond,
+	InitialData,
+	InitialExp,
+	Initial,
+	InkSaver,
+	InlineFunc,
+	InputDatabase,
+	InputFunc,
+	InsertPriv,
+	InsEvent,
+	InternalLength,
+	IntervalType,
+	InvertRangeSelTrigger,
+	IoCast,
+	IsExtType,
+	IsPartitioned,
+	IsTemplate,
+	Italic,
+	Item,
+	Items,
+	JoinFunc,
+	KeepClusterObjs,
+	KeepObjsPerms,
+	Label,
+	Labels,
+	LabelsPos,
+	Landscape,
+	Language,
+	LastAnalyze,
+	LastAutovacuum,
+	LastPosition,
+	LastSysOid,
+	LastVacuum,
+	LastValue,
+	LastZoom,
+	Layer,
+	LayerNameColors,
+	LayerRectColors,
+	Layers,
+	LayersConfig,
+	LcCollate,
+	LcCtype,
+	LcCollateMod,
+	LcCtypeMod,
+	LeakProof,
+	Left,
+	LeftType,
+	Length,
+	Library,
+	Light,
+	LikeType,
+	Line,
+	LineHighlightColor,
+	LineNumbersBgColor,
+	LineNumbersColor,
+	Link,
+	LinkMode,
+	ListenAddresses,
+	Locale,
+	LocaleMod,
+	LockerArc,
+	LockerBody,
+	LockPageDelimResize,
+	Login,
+	LookaheadChar,
+	LowVerbosity,
+	MatchBySignature,
+	Materialized,
+	MaxConnections,
+	Maximized,
+	MaxObjCount,
+	MaxResultRows,
+	MaxValue,
+	Medium,
+	Member,
+	MemberRoles,
+	Merges,
+	Metadata,
+	MinObjectOpacity,
+	MinValue,
+	Mode,
+	ModelAuthor,
+	Name,
+	NameColor,
+	NameFilter,
+	NameLabel,
+	NamePatterns,
+	Names,
+	NegatorOp,
+	NewIdentityType,
+	NewName,
+	NewTableName,
+	NewVersion,
+	Next,
+	NnColumn,
+	NoInherit,
+	None,
+	NotExtObject,
+	NotNull,
+	NullsFirst,
+	NullsNotDistinct,
+	Object,
+	ObjectFinder,
+	ObjectId,
+	Objects,
+	ObjectType,
+	ObjCount,
+	ObjRelationName,
+	ObjSelection,
+	ObjShadow,
+	Oid,
+	OidFilterOp,
+	Oids,
+	OldName,
+	OldPgSqlVersions,
+	OldTableName,
+	OldVersion,
+	OnlyMatching,
+	OpClass,
+	OpClasses,
+	OpenChar,
+	Operator,
+	OperatorFunc,
+	Operators,
+	OpFamily,
+	OpListSize,
+	Options,
+	OriginalPk,
+	OutputFunc,
+	Owner,
+	OwnerColumn,
+	Pagination,
+	PaperCustomSize,
+	PaperMargin,
+	PaperOrientation,
+	PaperType,
+	ParallelType,
+	Parameter,
+	Parameters,
+	ParamIn,
+	ParamOut,
+	ParamVariadic,
+	Parent,
+	ParentType,
+	Parents,
+	Parsable,
+	PartialMatch,
+	PartitionBoundExpr,
+	PartitionedTable,
+	PartitionTables,
+	Partitioning,
+	PartitionKey,
+	PartKeyColls,
+	PartKeyCols,
+	PartKeyExprs,
+	PartKeyOpCls,
+	Password,
+	PasswordEncryption,
+	Path,
+	Patterns,
+	Permission,
+	Permissive,
+	PerRow,
+	Persistent,
+	PgModelerVersion,
+	PgSqlBaseType,
+	PgSqlVersion,
+	PkColPattern,
+	PkColumn,
+	PkConstr,
+	PkPattern,
+	Placeholder,
+	Placeholders,
+	Plugin,
+	Points,
+	Port,
+	Portrait,
+	Position,
+	PositionInfo,
+	Precision,
+	Predicate,
+	Preferred,
+	PrependAtBod,
+	PrependedSql,
+	PreserveDbName,
+	PrependSchema,
+	Preset,
+	Previous,
+	PrintGrid,
+	PrintPgNum,
+	Privileges,
+	PrivilegesGop,
+	ProtColumn,
+	Protected,
+	Provider,
+	RangeAttribs,
+	RangeType,
+	Recent,
+	RecentModels,
+	RecreateUnmodObjs,
+	ReplaceModObjs,
+	RectVisible,
+	Recursive,
+	RecvFunc,
+	ReducedForm,
+	RefAlias,
+	RefColumn,
+	RefColumns,
+	Refer,
+	Reference,
+	ReferenceFk,
+	References,
+	ReferencesPriv,
+	Referrers,
+	RefName,
+	RefTable,
+	RefTables,
+	RefTableTag,
+	RefType,
+	RegularExp,
+	RelatedForeignKey,
+	Relationship,
+	Relationship11,
+	Relationship1n,
+	RelationshipDep,
+	RelationshipFk,
+	RelationshipGen,
+	RelationshipNn,
+	RelationshipPart,
+	RelationshipTabView,
+	RelsFollowTabsVisibility,
+	Rename,
+	Replication,
+	RestartSeq,
+	RestrictionFunc,
+	ReturnsSetOf,
+	ReturnTable,
+	ReturnType,
+	ReuseSequences,
+	Revoke,
+	Right,
+	RightType,
+	RlsEnabled,
+	RlsForced,
+	Role,
+	Roles,
+	RoleMembers,
+	RoleType,
+	RowAmount,
+	Rules,
+	RunInTransaction,
+	SaveLastPosition,
+	SaveRestoreGeometry,
+	SceneRect,
+	Schema,
+	Schemas,
+	SchemaOid,
+	SearchPath,
+	SecurityBarrier,
+	SecurityInvoker,
+	SecurityType,
+	SelectExp,
+	SelectObjects,
+	SelectPriv,
+	SendFunc,
+	Sequence,
+	Sequences,
+	Server,
+	ServerEncoding,
+	ServerPid,
+	ServerProtocol,
+	ServerVersion,
+	SessionOpts,
+	SetPerms,
+	SharedObj,
+	ShellTypes,
+	ShowAttributesGrid,
+	ShowCanvasGrid,
+	ShowLayerNames,
+	ShowLayerRects,
+	ShowMainMenu,
+	ShowPageDelimiters,
+	ShowSourcePane,
+	ShowSysSchemasRects,
+	Signature,
+	SimpleCol,
+	SimpleExp,
+	SimplifiedObjCreation,
+	SingleExp,
+	SinglePkColumn,
+	Size,
+	Small,
+	Snippet,
+	SortOp,
+	SourceEditorApp,
+	SourceEditorArgs,
+	SourceType,
+	SpatialType,
+	SpecialPkCols,
+	Split,
+	SqlDisabled,
+	SqlObject,
+	SqlTool,
+	SqlValidation,
+	Square,
+	SrcColPattern,
+	SrcColumns,
+	SrcEncoding,
+	SrcFkPattern,
+	SrcLabel,
+	SrcRequired,
+	SrcTable,
+	SrcType,
+	Srid,
+	Ssl,
+	SslCaFile,
+	SslCertFile,
+	SslCrlFile,
+	SslKeyFile,
+	Start,
+	StableBeta,
+	StableOnly,
+	StateType,
+	Storage,
+	StorageParams,
+	StoreInFile,
+	StrategyNum,
+	Stikeout,
+	Style,
+	Styles,
+	Subtype,
+	SubtypeDiffFunc,
+	Superuser,
+	Symbol,
+	System,
+	Table,
+	TableTogglerButtons,
+	TableTogglerBody,
+	TableBody,
+	TableExtBody,
+	TableName,
+	TableObject,
+	TableSchemaName,
+	Tablespace,
+	TableTitle,
+	TableType,
+	Tag,
+	TabWidth,
+	TemplateDb,
+	TemporaryPriv,
+	Top,
+	ToSqlFunc,
+	TpmodInFunc,
+	TpmodOutFunc,
+	TransformTypes,
+	TransitionFunc,
+	TriggerFunc,
+	TriggerPriv,
+	Triggers,
+	True,
+	Truncate,
+	TruncateColumnData,
+	TruncatePriv,
+	TruncEvent,
+	Trusted,
+	TuplesDel,
+	TuplesIns,
+	Type,
+	TypeAttribute,
+	TypeClass,
+	TypeOid,
+	Types,
+	TyplesUpd,
+	UiLanguage,
+	UiTheme,
+	Undefined,
+	Underline,
+	Unique,
+	Unlogged,
+	Unset,
+	UnsetPerms,
+	UpdAction,
+	Updated,
+	UpdatePriv,
+	UpdEvent,
+	UqColumn,
+	UqConstr,
+	UqPattern,
+	UsagePriv,
+	UseChangelog,
+	UseColumns,
+	UseCurvedLines,
+	UseDefDisambiguation,
+	UsePlaceholders,
+	UseSignature,
+	UseSorting,
+	UseUniqueNames,
+	UsingExp,
+	Validation,
+	Validator,
+	ValidatorFunc,
+	Validity,
+	Value,
+	Values,
+	Variable,
+	Variation,
+	Version,
+	ViewTogglerButtons,
+	ViewTogglerBody,
+	ViewBody,
+	ViewExtBody,
+	ViewName,
+	ViewSchemaName,
+	ViewTitle,
+	Visible,
+	Widget,
+	WidgetsGeometry,
+	Width,
+	Wildcard,
+	WindowFunc,
+	WithNoData,
+	WithoutOids,
+	WithTimezone,
+	Word,
+	WordDelimiters,
+	WordSeparators,
+	WorkingDir,
+	XPos,
+	YPos,
+	Year,
+	ZValue;
 }
 
 #endif
@@ -82,6 +82,14 @@ const QRegularExpression SchemaParser::TokenIncludeRegexp { "^\\s*" +
 																													 "\\s+([\"])((.*)?)\\1\\s*$",
 																													 QRegularExpression::MultilineOption };
 
+std::map<QString, std::shared_ptr<const SchemaParser::CachedSchema>> SchemaParser::cached_schemas;
+
+QMutex SchemaParser::cache_mutex;
+
+std::atomic<unsigned> SchemaParser::gen_pass_id {0};
+
+std::atomic<unsigned> SchemaParser::running_gen_passes {0};
+
 SchemaParser::SchemaParser()
 {
 	line = column = 0;
@@ -98,7 +106,7 @@ void SchemaParser::setPgSQLVersion(const QString &pgsql_ver, bool ignore_db_vers
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+										__exc_origin, &e);
 	}
 }
 
@@ -161,6 +169,7 @@ void SchemaParser::restartParser()
 	buffer.clear();
 	attributes.clear();
 	include_infos.clear();
+	compiled_buf.reset();
 	line = column = 0;
 }
 
@@ -170,7 +179,6 @@ void SchemaParser::loadBuffer(const QString &buf)
 	QTextStream ts(&buf_aux);
 	bool open_plain_txt = false;
 	QChar prev_chr;
-	QString orig_cwd = QDir::currentPath();
 
 	// Prepares the parser to do new reading
 	restartParser();
@@ -178,9 +186,6 @@ void SchemaParser::loadBuffer(const QString &buf)
 	if(filename.isEmpty())
 		filename = QT_TR_NOOP("[memory buffer]");
 
-	if(!search_path.isEmpty())
-		QDir::setCurrent(search_path);
-
 	// While the input file doesn't reach the end
 	while(!ts.atEnd())
 	{
@@ -226,8 +231,7 @@ void SchemaParser::loadBuffer(const QString &buf)
 		}
 		catch(Exception &e)
 		{
-			QDir::setCurrent(orig_cwd);
-			throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+			throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 		}
 
 		// Add the treated line in the buffer
@@ -257,11 +261,13 @@ bool SchemaParser::parseInclude(const QString &include_ln, QString &src_buf, qin
 		throw Exception(Exception::getErrorMessage(ErrorCode::InvalidSyntax)
 										.arg(filename).arg(getCurrentLine()).arg(getCurrentColumn()) + " " +
 										QString(QT_TR_NOOP("Expected a valid include statement in the form `%1 \"file.sch\"'.")).arg(TokenInclude),
-										ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidSyntax, __exc_origin);
 	}
 	else
 	{
-		QDir dir;
+		/* The include file is resolved against the search path instead of the process' current
+		 * directory, since the latter is shared by all parsers running in different threads */
+		QDir dir(search_path);
 		QStringList texts = match.capturedTexts();
 		QString incl_file = dir.absoluteFilePath(texts.last());
 		QFileInfo fi(incl_file);
@@ -277,7 +283,7 @@ bool SchemaParser::parseInclude(const QString &include_ln, QString &src_buf, qin
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvalidInclude)
 											.arg(filename).arg(getCurrentLine()).arg(getCurrentColumn()) + " " +
 											QString(QT_TR_NOOP("No such include file `%1'.")).arg(fi.absoluteFilePath()),
-											ErrorCode::InvalidInclude, __PRETTY_FUNCTION__, __FILE__, __LINE__,
+											ErrorCode::InvalidInclude, __exc_origin,
 											nullptr, fi.absoluteFilePath());
 		}
 
@@ -297,7 +303,7 @@ bool SchemaParser::parseInclude(const QString &include_ln, QString &src_buf, qin
 				throw Exception(Exception::getErrorMessage(ErrorCode::InvalidInclude)
 												.arg(filename).arg(getCurrentLine()).arg(getCurrentColumn()) + " " +
 												QString(QT_TR_NOOP("The included file `%1' contains one or more `%2' statements. This isn't currently supported!")).arg(fi.absoluteFilePath(), TokenInclude),
-												ErrorCode::InvalidInclude, __PRETTY_FUNCTION__, __FILE__, __LINE__,
+												ErrorCode::InvalidInclude, __exc_origin,
 												nullptr, fi.absoluteFilePath());
 			}
 
@@ -321,7 +327,7 @@ bool SchemaParser::parseInclude(const QString &include_ln, QString &src_buf, qin
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+			throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 		}
 	}
 }
@@ -333,15 +339,109 @@ void SchemaParser::loadFile(const QString &filename)
 
 	try
 	{
-		QString buf(UtilsNs::loadFile(filename));
-		setSearchPath(QFileInfo(filename).absolutePath());
-		loadBuffer(buf);
+		QFileInfo fi(filename);
+		QString abs_filename = fi.absoluteFilePath();
+		std::shared_ptr<const CachedSchema> cached_sch;
+		unsigned gen_pass = getGenerationPass();
+
+		setSearchPath(fi.absolutePath());
 		SchemaParser::filename = filename;
+
+		{
+			QMutexLocker locker(&cache_mutex);
+			auto itr = cached_schemas.find(abs_filename);
+
+			if(itr != cached_schemas.end())
+				cached_sch = itr->second;
+		}
+
+		/* If the file was already tokenized and neither it nor its included files
+		 * were changed since then we just reuse the cached buffer avoiding reading
+		 * the file(s) again from disk */
+		if(cached_sch && isCachedSchemaValid(*cached_sch, gen_pass))
+		{
+			restartParser();
+			buffer = cached_sch->buffer;
+			compiled_buf = cached_sch->compiled_buf;
+			include_infos = cached_sch->include_infos;
+		}
+		else
+		{
+			std::shared_ptr<CachedSchema> new_sch = std::make_shared<CachedSchema>();
+			std::shared_ptr<CompiledBuffer> instructions = std::make_shared<CompiledBuffer>();
+
+			/* The modification time is retrieved before reading the file so a change made
+			 * while the file is being tokenized invalidates the entry in the next use */
+			new_sch->files_mtime[abs_filename] = fi.lastModified();
+			loadBuffer(UtilsNs::loadFile(filename));
+
+			// The buffer is compiled only once and its instructions are shared by all parsers that load the file
+			compileBuffer(*instructions);
+			line = column = 0;
+			compiled_buf = instructions;
+
+			new_sch->buffer = buffer;
+			new_sch->compiled_buf = compiled_buf;
+			new_sch->include_infos = include_infos;
+			new_sch->validated_pass = gen_pass;
+
+			for(auto &info : include_infos)
+				new_sch->files_mtime[info.include_file] = QFileInfo(info.include_file).lastModified();
+
+			QMutexLocker locker(&cache_mutex);
+			cached_schemas[abs_filename] = new_sch;
+		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
+	}
+}
+
+bool SchemaParser::isCachedSchemaValid(const CachedSchema &cached_sch, unsigned gen_pass)
+{
+	//The files were already checked in the current code generation pass
+	if(gen_pass != 0 && cached_sch.validated_pass == gen_pass)
+		return true;
+
+	for(auto &itr : cached_sch.files_mtime)
+	{
+		QFileInfo fi(itr.first);
+
+		if(!fi.exists() || fi.lastModified() != itr.second)
+			return false;
 	}
+
+	cached_sch.validated_pass = gen_pass;
+	return true;
+}
+
+void SchemaParser::clearSchemasCache()
+{
+	QMutexLocker locker(&cache_mutex);
+	cached_schemas.clear();
+}
+
+unsigned SchemaParser::getGenerationPass()
+{
+	return running_gen_passes > 0 ? gen_pass_id.load() : 0;
+}
+
+void SchemaParser::startGenerationPass()
+{
+	/* A new pass identifier is created only when no other pass is running,
+	 * so concurrent passes share the same identifier. Zero is skipped since
+	 * it indicates that no pass is running */
+	if(running_gen_passes++ == 0 && ++gen_pass_id == 0)
+		gen_pass_id++;
+}
+
+void SchemaParser::finishGenerationPass()
+{
+	unsigned passes = running_gen_passes;
+
+	//Avoids underflowing the counter in case of unbalanced calls
+	while(passes > 0 && !running_gen_passes.compare_exchange_weak(passes, passes - 1));
 }
 
 QString SchemaParser::getAttribute(bool &found_conv_to_xml)
@@ -414,12 +514,12 @@ QString SchemaParser::getAttribute(bool &found_conv_to_xml)
 		throw Exception(getParseError(ErrorCode::InvalidSyntax,
 																	 QString(QT_TR_NOOP("Expected a valid attribute token enclosed by `%1%2'."))
 																	 .arg(CharStartAttribute).arg(CharEndAttribute)),
-										ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidSyntax, __exc_origin);
 	}
 	else if(!AttribRegExp.match(atrib).hasMatch())
 	{
 		throw Exception(getParseError(ErrorCode::InvalidAttribute),
-										ErrorCode::InvalidAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidAttribute, __exc_origin);
 	}
 
 	return atrib;
@@ -531,7 +631,7 @@ QString SchemaParser::getPlainText()
 		throw Exception(getParseError(ErrorCode::InvalidSyntax,
 										QString(QT_TR_NOOP("Plain text expression is unbalanced or is not properly enclosed by `%1%2'."))
 										.arg(CharStartPlainText).arg(CharEndPlainText)),
-										ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidSyntax, __exc_origin);
 	}
 
 	return text;
@@ -571,7 +671,7 @@ QString SchemaParser::getConditional()
 	{
 		throw Exception(getParseError(ErrorCode::InvalidSyntax,
 										QString(QT_TR_NOOP("Expected a valid conditional instruction token starting with `%1' and followed by, at least, a letter.")).arg(CharStartConditional)),
-										ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidSyntax, __exc_origin);
 	}
 
 	return conditional;
@@ -586,7 +686,7 @@ QString SchemaParser::getMetaCharacter()
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+										__exc_origin, &e);
 	}
 }
 
@@ -599,7 +699,7 @@ QString SchemaParser::getEscapedCharacter()
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+										__exc_origin, &e);
 	}
 }
 
@@ -649,7 +749,7 @@ QString SchemaParser::getMetaOrEscapedToken(bool is_escaped)
 			extra_msg = QString(QT_TR_NOOP("Expected a valid metacharacter token starting with `%1' and followed by, at least, a letter.")).arg(start_chr);
 
 		throw Exception(getParseError(ErrorCode::InvalidSyntax, extra_msg),
-										ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidSyntax, __exc_origin);
 	}
 
 	return chr_token;
@@ -663,10 +763,10 @@ bool SchemaParser::isSpecialCharacter(const QChar &chr)
 				 chr == CharToXmlEntity || chr == CharStartEscaped;
 }
 
-bool SchemaParser::evaluateComparisonExpr()
+void SchemaParser::compileComparisonExpr(ExprTerm &term)
 {
 	QString curr_line, attrib, value, oper, valid_op_chrs="=!<>fi", extra_error_msg;
-	bool error = false, end_eval = false, expr_is_true = true, to_xml_entity = false;
+	bool error = false, end_eval = false, to_xml_entity = false;
 	static QStringList opers = { TokenEqOper, TokenNeOper, TokenGtOper,
 															 TokenLtOper, TokenGtEqOper, TokenLtEqOper };
 	QChar chr;
@@ -730,44 +830,17 @@ bool SchemaParser::evaluateComparisonExpr()
 				else if(!opers.contains(QString(oper).remove('f').remove('i')))
 				{
 					throw Exception(getParseError(ErrorCode::InvalidOperatorInExpression, "", oper),
-													ErrorCode::InvalidOperatorInExpression, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-				}
-				else if(attributes.count(attrib)==0 && !ignore_unk_atribs)
-				{
-					throw Exception(getParseError(ErrorCode::UnkownAttribute, "", attrib),
-													ErrorCode::UnkownAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+													ErrorCode::InvalidOperatorInExpression, __exc_origin);
 				}
 				else
 				{
-					QVariant left_val, right_val;
-					QString attr_val = to_xml_entity ?
-																 UtilsNs::convertToXmlEntities(attributes[attrib]) : attributes[attrib];
-
-					to_xml_entity = false;
-					value.remove(CharValueDelim);
-
-					//Evaluating the attribute value against the one captured on the expression without casting
-					if(oper.endsWith('f'))
-					{
-						left_val = QVariant(attr_val.toFloat());
-						right_val = QVariant(value.toFloat());
-						oper.remove('f');
-						expr_is_true = getExpressionResult<float>(oper, left_val, right_val);
-					}
-					else if(oper.endsWith('i'))
-					{
-						left_val = QVariant(attr_val.toInt());
-						right_val = QVariant(value.toInt());
-						oper.remove('i');
-						expr_is_true = getExpressionResult<int>(oper, left_val, right_val);
-					}
-					else
-					{
-						left_val = QVariant(attr_val);
-						right_val = QVariant(value);
-						expr_is_true = getExpressionResult<QString>(oper, left_val, right_val);
-					}
-
+					term.is_comparison = true;
+					term.to_xml_entity = to_xml_entity;
+					term.attribute = attrib;
+					term.oper = oper;
+					term.value = value.remove(CharValueDelim);
+					term.line = line;
+					term.column = column;
 					end_eval = true;
 				}
 			}
@@ -794,7 +867,7 @@ bool SchemaParser::evaluateComparisonExpr()
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(),e.getErrorCode(),
-										__PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+										__exc_origin, &e);
 	}
 
 	if(error && !end_eval && extra_error_msg.isEmpty())
@@ -803,18 +876,67 @@ bool SchemaParser::evaluateComparisonExpr()
 	if(error)
 	{
 		throw Exception(getParseError(ErrorCode::InvalidSyntax, extra_error_msg),
-										ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidSyntax, __exc_origin);
 	}
+}
 
-	return expr_is_true;
+bool SchemaParser::evaluateComparisonExpr(const ExprTerm &term)
+{
+	QString oper = term.oper, attr_val;
+	QVariant left_val, right_val;
+
+	if(attributes.count(term.attribute)==0 && !ignore_unk_atribs)
+	{
+		line = term.line;
+		column = term.column;
+		throw Exception(getParseError(ErrorCode::UnkownAttribute, "", term.attribute),
+										ErrorCode::UnkownAttribute, __exc_origin);
+	}
+
+	attr_val = term.to_xml_entity ?
+							UtilsNs::convertToXmlEntities(attributes[term.attribute]) : attributes[term.attribute];
+
+	//Evaluating the attribute value against the one captured on the expression without casting
+	if(oper.endsWith('f'))
+	{
+		left_val = QVariant(attr_val.toFloat());
+		right_val = QVariant(term.value.toFloat());
+		oper.remove('f');
+		return getExpressionResult<float>(oper, left_val, right_val);
+	}
+
+	if(oper.endsWith('i'))
+	{
+		left_val = QVariant(attr_val.toInt());
+		right_val = QVariant(term.value.toInt());
+		oper.remove('i');
+		return getExpressionResult<int>(oper, left_val, right_val);
+	}
+
+	left_val = QVariant(attr_val);
+	right_val = QVariant(term.value);
+	return getExpressionResult<QString>(oper, left_val, right_val);
 }
 
-void SchemaParser::defineAttribute()
+void SchemaParser::compileAttributeDefinition(Instruction &instr)
 {
-	QString curr_line = buffer[line], attrib, value, new_attrib;
-	bool error=false, end_def=false, use_val_as_name=false, to_xml_entity = false;
+	QString curr_line = buffer[line], word;
+	bool error=false, end_def=false, to_xml_entity = false;
 	int curr_ln_idx = line;
 	QChar chr;
+	ValuePart part;
+
+	//Appends a text to the value merging it to the previous text piece
+	auto add_text = [&instr](const QString &text) {
+		if(!instr.parts.empty() && !instr.parts.back().is_attribute)
+			instr.parts.back().value += text;
+		else
+		{
+			ValuePart text_part;
+			text_part.value = text;
+			instr.parts.push_back(text_part);
+		}
+	};
 
 	try
 	{
@@ -829,11 +951,11 @@ void SchemaParser::defineAttribute()
 			}
 			else if(chr == CharValueOf)
 			{
-				if(!use_val_as_name)
+				if(!instr.use_val_as_name)
 				{
-					use_val_as_name = true;
+					instr.use_val_as_name = true;
 					column++;
-					new_attrib = getAttribute(to_xml_entity);
+					instr.value = getAttribute(to_xml_entity);
 				}
 				else
 					error = true;
@@ -844,26 +966,22 @@ void SchemaParser::defineAttribute()
 			}
 			else if(chr == CharToXmlEntity || chr == CharStartAttribute)
 			{
-				if(new_attrib.isEmpty())
-					new_attrib = getAttribute(to_xml_entity);
+				if(instr.value.isEmpty())
+					instr.value = getAttribute(to_xml_entity);
 				else
 				{
 					//Get the attribute in the middle of the value
-					attrib = getAttribute(to_xml_entity);
-
-					if(attributes.count(attrib)==0 && !ignore_unk_atribs)
-					{
-						throw Exception(getParseError(ErrorCode::UnkownAttribute),
-														ErrorCode::UnkownAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-					}
-
-					value += to_xml_entity ? UtilsNs::convertToXmlEntities(attributes[attrib]) : attributes[attrib];
-					to_xml_entity = false;
+					part = ValuePart();
+					part.is_attribute = true;
+					part.value = getAttribute(part.to_xml_entity);
+					part.line = line;
+					part.column = column;
+					instr.parts.push_back(part);
 				}
 			}
 			else if(chr == CharStartPlainText)
 			{
-				value += getPlainText();
+				add_text(getPlainText());
 
 				/* If we finished the extraction of a plain text
 				 * in which contains multiple lines, we need to stop
@@ -873,55 +991,51 @@ void SchemaParser::defineAttribute()
 			}
 			else if(chr == CharStartMetachar)
 			{
-				value += convertMetaCharacter(getMetaCharacter());
+				add_text(convertMetaCharacter(getMetaCharacter()));
 			}
 			else if(chr == CharStartEscaped)
 			{
-				value += convertEscapedCharacter(getEscapedCharacter());
+				add_text(convertEscapedCharacter(getEscapedCharacter()));
 			}
 			else
 			{
-				value += getWord();
+				word = getWord();
+
+				/* An empty word means that a character that can't be part of
+				 * a value was found (e.g. an unbalanced } or ]) */
+				if(word.isEmpty())
+					error = true;
+				else
+					add_text(word);
 			}
 
 			//If the attribute name was not extracted yet returns a error
-			if(new_attrib.isEmpty())
+			if(instr.value.isEmpty())
 				error = true;
 		}
 	}
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),
-										__PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+										__exc_origin, &e);
 	}
 
-	if(!error)
-	{
-		attrib = (use_val_as_name ? attributes[new_attrib] : new_attrib);
-
-		//Checking if the attribute has a valid name
-		if(!AttribRegExp.match(attrib).hasMatch())
-		{
-			throw Exception(getParseError(ErrorCode::InvalidAttribute),
-											ErrorCode::InvalidAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-		}
-
-		/* Creates the attribute in the attribute map of the schema, making the attribute
-		 * available on the rest of the script being parsed */
-		attributes[attrib] = value;
-	}
-	else
+	if(error)
 	{
 		throw Exception(getParseError(ErrorCode::InvalidSyntax),
-										ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidSyntax, __exc_origin);
 	}
+
+	instr.line = line;
+	instr.column = column;
 }
 
-void SchemaParser::unsetAttribute()
+void SchemaParser::compileAttributeUnset(Instruction &instr)
 {
-	QString curr_line, attrib;
+	QString curr_line;
 	bool end_def=false, to_xml_entity = false;
 	QChar chr;
+	ValuePart part;
 
 	try
 	{
@@ -932,47 +1046,100 @@ void SchemaParser::unsetAttribute()
 			ignoreBlankChars(curr_line);
 			chr = curr_line[column];
 
-			if(chr == CharLineEnd && !attrib.isEmpty())
+			if(chr == CharLineEnd && !instr.parts.empty())
 			{
 				end_def = true;
 			}
 			else if(chr == CharStartAttribute)
 			{
-				attrib = getAttribute(to_xml_entity);
-
-				if(attributes.count(attrib)==0 && !ignore_unk_atribs)
-				{
-					throw Exception(getParseError(ErrorCode::UnkownAttribute, "", attrib),
-													 ErrorCode::UnkownAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-				}
-				else if(!AttribRegExp.match(attrib).hasMatch())
-				{
-					throw Exception(getParseError(ErrorCode::InvalidAttribute, "", attrib),
-													 ErrorCode::InvalidAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-				}
-
-				attributes[attrib]="";
+				part = ValuePart();
+				part.is_attribute = true;
+				part.value = getAttribute(to_xml_entity);
+				part.line = line;
+				part.column = column;
+				instr.parts.push_back(part);
 			}
 			else
 			{
 				throw Exception(getParseError(ErrorCode::InvalidSyntax),
-												 ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+												 ErrorCode::InvalidSyntax, __exc_origin);
 			}
 		}
 	}
 	catch(Exception &e)
 	{
 		throw Exception(e.getErrorMessage(),e.getErrorCode(),
-										__PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+										__exc_origin, &e);
+	}
+
+	instr.line = line;
+	instr.column = column;
+}
+
+void SchemaParser::defineAttribute(const Instruction &instr)
+{
+	QString attrib, value;
+
+	for(auto &part : instr.parts)
+	{
+		if(!part.is_attribute)
+		{
+			value += part.value;
+			continue;
+		}
+
+		if(attributes.count(part.value)==0 && !ignore_unk_atribs)
+		{
+			line = part.line;
+			column = part.column;
+			throw Exception(getParseError(ErrorCode::UnkownAttribute, "", part.value),
+											ErrorCode::UnkownAttribute, __exc_origin);
+		}
+
+		//%unset clears the attributes while %set concatenates their values to the new attribute's value
+		if(instr.opcode == Instruction::Unset)
+			attributes[part.value] = "";
+		else
+			value += part.to_xml_entity ? UtilsNs::convertToXmlEntities(attributes[part.value]) : attributes[part.value];
+	}
+
+	if(instr.opcode == Instruction::Unset)
+		return;
+
+	attrib = (instr.use_val_as_name ? attributes[instr.value] : instr.value);
+
+	//Checking if the attribute has a valid name
+	if(!AttribRegExp.match(attrib).hasMatch())
+	{
+		line = instr.line;
+		column = instr.column;
+		throw Exception(getParseError(ErrorCode::InvalidAttribute),
+										ErrorCode::InvalidAttribute, __exc_origin);
 	}
+
+	/* Creates the attribute in the attribute map of the schema, making the attribute
+	 * available on the rest of the script being parsed */
+	attributes[attrib] = value;
 }
-bool SchemaParser::evaluateExpression()
+
+void SchemaParser::compileExpression(std::vector<ExprTerm> &expression)
 {
-	QString current_line, cond, attrib, prev_cond;
-	bool error = false, end_eval = false, expr_is_true = true,
-			attrib_true = true, comp_true = true, to_xml_entity = false;
+	QString current_line, cond, prev_cond;
+	bool error = false, end_eval = false;
 	unsigned attrib_count = 0, and_or_count = 0;
 	QChar chr;
+	ExprTerm term;
+
+	//Returns how the term being extracted is combined with the result of the previous ones
+	auto get_connector = [](const QString &curr, const QString &prev) {
+		if(curr == TokenAnd || prev == TokenAnd)
+			return ExprTerm::AndConnector;
+
+		if(curr == TokenOr || prev == TokenOr)
+			return ExprTerm::OrConnector;
+
+		return ExprTerm::NoConnector;
+	};
 
 	try
 	{
@@ -1032,14 +1199,10 @@ bool SchemaParser::evaluateExpression()
 			}
 			else if(chr == CharToXmlEntity || chr == CharStartAttribute)
 			{
-				attrib = getAttribute(to_xml_entity);
-
-							 //Raises an error if the attribute does is unknown
-				if(attributes.count(attrib)==0 && !ignore_unk_atribs)
-				{
-					throw Exception(getParseError(ErrorCode::UnkownAttribute, "", attrib),
-													ErrorCode::UnkownAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-				}
+				term = ExprTerm();
+				term.attribute = getAttribute(term.to_xml_entity);
+				term.line = line;
+				term.column = column;
 
 				//Error 1: A conditional token other than %or %not %and if found on conditional expression
 				error=(!cond.isEmpty() && cond != TokenOr && cond != TokenAnd && cond != TokenNot) ||
@@ -1053,36 +1216,20 @@ bool SchemaParser::evaluateExpression()
 
 				if(!error)
 				{
-					//Appliyng the NOT operator if found
-					attrib_true = (cond == TokenNot ? attributes[attrib].isEmpty() : !attributes[attrib].isEmpty());
-
-					//Executing the AND operation if the token is found
-					if(cond == TokenAnd || prev_cond == TokenAnd)
-						expr_is_true=(expr_is_true && attrib_true);
-					else if(cond == TokenOr || prev_cond == TokenOr)
-						expr_is_true = (expr_is_true || attrib_true);
-					else
-						expr_is_true = attrib_true;
-
+					term.negate = (cond == TokenNot);
+					term.connector = get_connector(cond, prev_cond);
+					expression.push_back(term);
 					cond.clear();
 					prev_cond.clear();
 				}
 			}
 			else if(chr == CharStartCompExpr)
 			{
-				comp_true = evaluateComparisonExpr();
-
-				//Appliyng the NOT operator if found
-				if(cond == TokenNot)
-					comp_true = !comp_true;
-
-				//Executing the AND operation if the token is found
-				if(cond == TokenAnd || prev_cond == TokenAnd)
-					expr_is_true = (expr_is_true && comp_true);
-				else if(cond == TokenOr || prev_cond == TokenOr)
-					expr_is_true = (expr_is_true || comp_true);
-				else
-					expr_is_true = comp_true;
+				term = ExprTerm();
+				compileComparisonExpr(term);
+				term.negate = (cond == TokenNot);
+				term.connector = get_connector(cond, prev_cond);
+				expression.push_back(term);
 
 				//Consider the comparison expression as an attribute evaluation
 				attrib_count++;
@@ -1097,18 +1244,231 @@ bool SchemaParser::evaluateExpression()
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),	__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),	__exc_origin, &e);
 	}
 
 	if(error)
 	{
 		throw Exception(getParseError(ErrorCode::InvalidSyntax),
-										ErrorCode::InvalidSyntax,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+										ErrorCode::InvalidSyntax,__exc_origin);
+	}
+}
+
+bool SchemaParser::evaluateExpression(const std::vector<ExprTerm> &expression)
+{
+	bool expr_is_true = true, term_true = true;
+
+	try
+	{
+		for(auto &term : expression)
+		{
+			if(term.is_comparison)
+				term_true = evaluateComparisonExpr(term);
+			else
+			{
+				//Raises an error if the attribute does is unknown
+				if(attributes.count(term.attribute)==0 && !ignore_unk_atribs)
+				{
+					line = term.line;
+					column = term.column;
+					throw Exception(getParseError(ErrorCode::UnkownAttribute, "", term.attribute),
+													ErrorCode::UnkownAttribute, __exc_origin);
+				}
+
+				term_true = !attributes[term.attribute].isEmpty();
+			}
+
+			//Appliyng the NOT operator if found
+			if(term.negate)
+				term_true = !term_true;
+
+			//Executing the AND/OR operation if the token is found
+			if(term.connector == ExprTerm::AndConnector)
+				expr_is_true = (expr_is_true && term_true);
+			else if(term.connector == ExprTerm::OrConnector)
+				expr_is_true = (expr_is_true || term_true);
+			else
+				expr_is_true = term_true;
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),	__exc_origin, &e);
 	}
 
 	return expr_is_true;
 }
 
+void SchemaParser::compileBuffer(CompiledBuffer &instructions)
+{
+	QString cond, prev_cond, text;
+	int open_ifs = 0;
+	bool error = false;
+	QChar chr;
+	Instruction instr;
+
+	auto is_attrib_ref = [](const QString &word) {
+		return !word.isEmpty() &&
+					 (word.startsWith(CharStartAttribute) || word.startsWith(CharToXmlEntity)) &&
+					 word.endsWith(CharEndAttribute);
+	};
+
+	/* Appends a text instruction merging it to the previous one. Texts in the form {attr} or &{attr}
+	 * (e.g. [{attr}]) are kept apart since they are resolved as attributes when placed in if/else
+	 * blocks (see getSourceCode()), so merging them would change the generated code */
+	auto add_text = [&instructions, &is_attrib_ref](const QString &txt) {
+		if(!instructions.empty() &&
+			 instructions.back().opcode == Instruction::Text &&
+			 !is_attrib_ref(instructions.back().value) && !is_attrib_ref(txt) &&
+			 !is_attrib_ref(instructions.back().value + txt))
+		{
+			instructions.back().value += txt;
+			return;
+		}
+
+		Instruction text_instr;
+		text_instr.value = txt;
+		instructions.push_back(text_instr);
+	};
+
+	instructions.clear();
+	line = column = 0;
+
+	while(line < buffer.size())
+	{
+		chr = buffer[line][column];
+
+		/* Increments the number of rows causing the parser
+		to get the next line buffer for analysis */
+		if(chr == CharLineEnd)
+		{
+			line++;
+			column = 0;
+		}
+		else if(chr == CharTabulation || chr == CharSpace)
+		{
+			//The parser will ignore the spaces that are not within pure texts
+			ignoreBlankChars(buffer[line]);
+		}
+		//Metacharacter extraction, storing the character it represents
+		else if(chr == CharStartMetachar || chr == CharStartEscaped)
+		{
+			text = getMetaOrEscapedToken(chr == CharStartEscaped);
+			add_text(convertMetaOrEscaped(text, chr == CharStartEscaped));
+		}
+		//Attribute extraction
+		else if(chr == CharToXmlEntity ||
+						chr == CharStartAttribute ||
+						chr == CharEndAttribute)
+		{
+			instr = Instruction();
+			instr.opcode = Instruction::Attribute;
+			instr.value = getAttribute(instr.to_xml_entity);
+			instr.line = line;
+			instr.column = column;
+
+			if(instr.to_xml_entity)
+				instr.attr_ref += CharToXmlEntity;
+
+			instr.attr_ref += CharStartAttribute;
+			instr.attr_ref += instr.value;
+			instr.attr_ref += CharEndAttribute;
+			instructions.push_back(instr);
+		}
+		//Conditional instruction extraction
+		else if(chr == CharStartConditional)
+		{
+			prev_cond = cond;
+			cond = getConditional();
+			instr = Instruction();
+
+			//Checks whether the extracted token is a valid conditional
+			if(cond != TokenIf && cond != TokenElse &&
+				 cond != TokenThen && cond != TokenEnd &&
+				 cond != TokenOr && cond != TokenNot &&
+				 cond != TokenAnd && cond != TokenSet &&
+				 cond != TokenUnset)
+			{
+				throw Exception(getParseError(ErrorCode::InvalidInstruction, "", cond),
+												ErrorCode::InvalidInstruction, __exc_origin);
+			}
+			else if(cond == TokenSet || cond == TokenUnset)
+			{
+				/* Stores the position of the instruction so the parser is able to ignore it
+				 * when it's under a false if expression (see getSourceCode()) */
+				instr.opcode = (cond == TokenSet ? Instruction::Set : Instruction::Unset);
+				instr.after_else = (prev_cond == TokenElse);
+				instr.stmt_line = line;
+				instr.stmt_column = column;
+
+				if(cond == TokenSet)
+					compileAttributeDefinition(instr);
+				else
+					compileAttributeUnset(instr);
+
+				instructions.push_back(instr);
+			}
+			else
+			{
+				if(cond == TokenIf)
+				{
+					instr.opcode = Instruction::If;
+					compileExpression(instr.expression);
+					open_ifs++;
+				}
+				else if(cond == TokenThen && open_ifs > 0)
+					instr.opcode = Instruction::Then;
+				else if(cond == TokenElse && open_ifs > 0)
+					instr.opcode = Instruction::Else;
+				else if(cond == TokenEnd && open_ifs > 0)
+				{
+					instr.opcode = Instruction::End;
+					open_ifs--;
+				}
+				else
+					error=true;
+
+				if(!error)
+				{
+					/* Verifying that the conditional words appear in a valid  order if not
+					 * the parser generates an error. Correct order means IF before THEN,
+					 * ELSE after IF and before END */
+					if((prev_cond == TokenIf && cond != TokenThen) ||
+							(prev_cond == TokenElse && cond != TokenIf && cond != TokenEnd) ||
+							(prev_cond == TokenThen && cond == TokenThen))
+						error = true;
+				}
+
+				if(error)
+				{
+					throw Exception(getParseError(ErrorCode::InvalidSyntax),
+													ErrorCode::InvalidSyntax, __exc_origin);
+				}
+
+				instr.line = line;
+				instr.column = column;
+				instructions.push_back(instr);
+			}
+		}
+		//Extraction of pure text or simple words
+		else
+		{
+			if(chr == CharStartPlainText || chr == CharEndPlainText)
+				add_text(getPlainText());
+			else
+				add_text(getWord());
+		}
+	}
+
+	/* If has more 'if' toknes than  'end' tokens, this indicates that some 'if' in code
+	 * was not closed thus the parser returns an error */
+	if(open_ifs != 0)
+	{
+		throw Exception(getParseError(ErrorCode::InvalidSyntax),
+										ErrorCode::InvalidSyntax, __exc_origin);
+	}
+}
+
 void SchemaParser::ignoreBlankChars(const QString &line)
 {
 	while(column < line.size() &&
@@ -1136,7 +1496,7 @@ QString SchemaParser::convertMetaCharacter(const QString &meta)
 	if(metas.count(meta) == 0)
 	{
 		throw Exception(getParseError(ErrorCode::InvalidMetacharacter, "", CharStartMetachar + meta),
-										ErrorCode::InvalidMetacharacter, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidMetacharacter, __exc_origin);
 	}
 
 	return metas.at(meta);
@@ -1176,7 +1536,7 @@ QString SchemaParser::convertEscapedCharacter(const QString &escaped)
 	if(idx < 0)
 	{
 		throw Exception(getParseError(ErrorCode::InvalidEscapedCharacter, "", CharStartEscaped + escaped),
-										ErrorCode::InvalidEscapedCharacter, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+										ErrorCode::InvalidEscapedCharacter, __exc_origin);
 	}
 
 	if(idx <= 2)
@@ -1228,7 +1588,7 @@ QString SchemaParser::getSourceCode(const QString & obj_name, attribs_map &attri
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),	__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),	__exc_origin,&e);
 	}
 }
 
@@ -1245,420 +1605,284 @@ void SchemaParser::ignoreEmptyAttributes(bool ignore)
 QString SchemaParser::getSourceCode(const attribs_map &attribs)
 {
 	QString object_def;
-	unsigned end_cnt = 0, if_cnt = 0;
 	int if_level = -1, prev_if_level = -1;
-	QString atrib, cond, prev_cond, word, meta;
-	bool error = false, if_expr = false, to_xml_entity = false;
-	QChar chr;
+	QString atrib, word;
+	bool to_xml_entity = false;
 	std::vector<bool> vet_expif, vet_tk_if, vet_tk_then, vet_tk_else;
 	std::map<int, std::vector<QString> > if_map, else_map;
 	std::vector<QString>::iterator itr, itr_end;
 	std::vector<int> vet_prev_level;
 	std::vector<QString> *vet_aux;
+	attribs_map::iterator attr_itr;
+	std::shared_ptr<const CompiledBuffer> instructions;
 
 	//In case the file was successfuly loaded
 	if(buffer.size() > 0)
 	{
+		//Buffers loaded via loadBuffer() are compiled here, the ones loaded from files are already compiled
+		if(!compiled_buf)
+		{
+			std::shared_ptr<CompiledBuffer> new_buf = std::make_shared<CompiledBuffer>();
+			compileBuffer(*new_buf);
+			compiled_buf = new_buf;
+		}
+
 		//Init the control variables
+		instructions = compiled_buf;
 		attributes = attribs;
-		error = if_expr = false;
-		if_level = -1;
-		end_cnt = if_cnt = 0;
 
-		while(line < buffer.size())
+		for(auto &instr : *instructions)
 		{
-			chr = buffer[line][column];
-
-			/* Increments the number of rows causing the parser
-			to get the next line buffer for analysis */
-			if(chr == CharLineEnd)
+			if(instr.opcode == Instruction::Text)
 			{
-				line++;
-				column = 0;
-			}
-			else if(chr == CharTabulation || chr == CharSpace)
-			{
-				//The parser will ignore the spaces that are not within pure texts
-				ignoreBlankChars(buffer[line]);
-			}
-			//Metacharacter extraction
-			else if(chr == CharStartMetachar || chr == CharStartEscaped)
-			{
-				meta = getMetaOrEscapedToken(chr == CharStartEscaped);
-
-				//Checks whether the metacharacter is part of the  'if' expression (this is an error)
-				if(if_level>=0 && vet_tk_if[if_level] && !vet_tk_then[if_level])
+				//If the parser is inside an 'if / else' extracting tokens
+				if(if_level>=0)
 				{
-					throw Exception(getParseError(ErrorCode::InvalidSyntax),
-													ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+					/* If the parser is in 'if' section,
+					 * places the text on the word map of the current 'if' */
+					if(vet_tk_if[if_level] &&
+						 vet_tk_then[if_level] &&
+						 !vet_tk_else[if_level])
+						if_map[if_level].push_back(instr.value);
+
+					/* If the parser is in 'else' section,
+					 * places the text on the word map of the current 'else'*/
+					else if(vet_tk_else[if_level])
+						else_map[if_level].push_back(instr.value);
 				}
 				else
-				{
-					//Converting the metacharacter/escaped char to the character that it represents
-					meta = convertMetaOrEscaped(meta, chr == CharStartEscaped);
-
-					//If the parser is inside an 'if / else' extracting tokens
-					if(if_level>=0)
-					{
-						/* If the parser is in 'if' section,
-							 places the metacharacter on the word map of the current 'if' */
-						if(vet_tk_if[if_level] &&
-								vet_tk_then[if_level] &&
-								!vet_tk_else[if_level])
-							if_map[if_level].push_back(meta);
-
-						/* If the parser is in 'else' section,
-						 * places the metacharacter on the word map of the current 'else'*/
-						else if(vet_tk_else[if_level])
-							else_map[if_level].push_back(meta);
-					}
-					else
-						/* If the parsers is not in a 'if / else', puts the metacharacter
-						 * in the definition sql */
-						object_def += meta;
-				}
+					//Case the parser is not in 'if/else' concatenates the text directly on the object definition
+					object_def += instr.value;
 			}
-			//Attribute extraction
-			else if(chr == CharToXmlEntity ||
-							 chr == CharStartAttribute ||
-							 chr == CharEndAttribute)
+			else if(instr.opcode == Instruction::Attribute)
 			{
-				atrib = getAttribute(to_xml_entity);
+				attr_itr = attributes.find(instr.value);
 
 				//Checks if the attribute extracted belongs to the passed list of attributes
-				if(attributes.count(atrib) == 0)
+				if(attr_itr == attributes.end())
 				{
 					if(!ignore_unk_atribs)
 					{
-						throw Exception(getParseError(ErrorCode::UnkownAttribute, "", atrib),
-														ErrorCode::UnkownAttribute, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+						line = instr.line;
+						column = instr.column;
+						throw Exception(getParseError(ErrorCode::UnkownAttribute, "", instr.value),
+														ErrorCode::UnkownAttribute, __exc_origin);
 					}
 					else
-						attributes[atrib]	= "";
+						attr_itr = attributes.emplace(instr.value, "").first;
 				}
 
 				//If the parser is inside an 'if / else' extracting tokens
 				if(if_level >= 0)
 				{
-					//If the parser evaluated the 'if' conditional and is inside the current if block
-					if(!(!if_expr && vet_tk_if[if_level] && !vet_tk_then[if_level]))
-					{
-						word = atrib;
-						atrib = "";
-
-						if(to_xml_entity)
-							atrib += CharToXmlEntity;
-
-						atrib += CharStartAttribute;
-						atrib += word;
-						atrib += CharEndAttribute;
-
-									 //If the parser is in the 'if' section
-						if(vet_tk_if[if_level] &&	vet_tk_then[if_level] &&	!vet_tk_else[if_level])
-							//Inserts the attribute value in the map of the words of current the 'if' section
-							if_map[if_level].push_back(atrib);
-						else if(vet_tk_else[if_level])
-							//Inserts the attribute value in the map of the words of current the 'else' section
-							else_map[if_level].push_back(atrib);
-					}
+					//If the parser is in the 'if' section
+					if(vet_tk_if[if_level] &&	vet_tk_then[if_level] &&	!vet_tk_else[if_level])
+						//Inserts the attribute in the map of the words of current the 'if' section
+						if_map[if_level].push_back(instr.attr_ref);
+					else if(vet_tk_else[if_level])
+						//Inserts the attribute in the map of the words of current the 'else' section
+						else_map[if_level].push_back(instr.attr_ref);
 				}
 				else
 				{
 					/* If the attribute has no value set and parser must not ignore empty values
 					 * raises an exception */
-					if(attributes[atrib].isEmpty() && !ignore_empty_atribs)
+					if(attr_itr->second.isEmpty() && !ignore_empty_atribs)
 					{
-						throw Exception(getParseError(ErrorCode::UndefinedAttributeValue, "", atrib),
-														ErrorCode::UndefinedAttributeValue, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+						line = instr.line;
+						column = instr.column;
+						throw Exception(getParseError(ErrorCode::UndefinedAttributeValue, "", instr.value),
+														ErrorCode::UndefinedAttributeValue, __exc_origin);
 					}
 
 					/* If the parser is not in an if / else, concatenates the value of the attribute
 					 * directly in definition in sql */
-					object_def += to_xml_entity ? UtilsNs::convertToXmlEntities(attributes[atrib]) : attributes[atrib];
-					to_xml_entity = false;
+					object_def += instr.to_xml_entity ? UtilsNs::convertToXmlEntities(attr_itr->second) : attr_itr->second;
 				}
 			}
-			//Conditional instruction extraction
-			else if(chr == CharStartConditional)
+			else if(instr.opcode == Instruction::Set || instr.opcode == Instruction::Unset)
 			{
-				prev_cond = cond;
-				cond = getConditional();
-
-				//Checks whether the extracted token is a valid conditional
-				if(cond != TokenIf && cond != TokenElse &&
-					 cond != TokenThen && cond != TokenEnd &&
-					 cond != TokenOr && cond != TokenNot &&
-					 cond != TokenAnd && cond != TokenSet &&
-					 cond != TokenUnset)
-				{
-					throw Exception(getParseError(ErrorCode::InvalidInstruction, "", cond),
-													ErrorCode::InvalidInstruction, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-				}
-				else if(cond == TokenSet || cond == TokenUnset)
-				{
-					bool extract = false;
+				bool extract = false;
 
-					/* Extracts or unset the attribute only if the process is not in the middle of a 'if-then-else' or
-						if the parser is inside the 'if' part and the expression is evaluated as true, or in the 'else' part
-						and the related 'if' is false. Otherwise the line where %set is located will be completely ignored */
-					extract=(if_level < 0 || vet_expif.empty());
+				/* Extracts or unset the attribute only if the process is not in the middle of a 'if-then-else' or
+					if the parser is inside the 'if' part and the expression is evaluated as true, or in the 'else' part
+					and the related 'if' is false. Otherwise the instruction will be completely ignored */
+				extract=(if_level < 0 || vet_expif.empty());
 
-					if(!extract && if_level >= 0)
+				if(!extract && if_level >= 0)
+				{
+					//If in 'else' the related 'if' is false, extracts the attribute
+					if(instr.after_else && !vet_expif[if_level])
+						extract = true;
+					else if(!instr.after_else)
 					{
-						//If in 'else' the related 'if' is false, extracts the attribute
-						if(prev_cond == TokenElse && !vet_expif[if_level])
-							extract = true;
-						else if(prev_cond != TokenElse)
+						//If in the 'if' part all the previous ifs until the current must be true
+						extract = true;
+						for(int i = 0; i <= if_level && extract; i++)
 						{
-							//If in the 'if' part all the previous ifs until the current must be true
-							extract = true;
-							for(int i = 0; i <= if_level && extract; i++)
-							{
-								extract=(vet_expif[i] && !vet_tk_else[i]) ||
-													(!vet_expif[i] && vet_tk_else[i]);
-							}
+							extract=(vet_expif[i] && !vet_tk_else[i]) ||
+												(!vet_expif[i] && vet_tk_else[i]);
 						}
 					}
+				}
 
-					if(extract)
-					{
-						if(cond == TokenSet)
-							defineAttribute();
-						else
-							unsetAttribute();
-					}
-					else
-					{
-						ignoreBlankChars(buffer[line]);
-
-						/* When the %set instruction is ignored due to the fact of it being under a if expression evaluated as false
-						 * there's the need to create an empty representation of it in the set of attributes so in further expressions
-						 * evaluations the parser isn't broke by a unknow attribute exception */
-						atrib = getAttribute(to_xml_entity);
+				if(extract)
+					defineAttribute(instr);
+				else
+				{
+					line = instr.stmt_line;
+					column = instr.stmt_column;
+					ignoreBlankChars(buffer[line]);
 
-						if(attributes.count(atrib) == 0)
-							attributes[atrib] = "";
+					/* When the %set instruction is ignored due to the fact of it being under a if expression evaluated as false
+					 * there's the need to create an empty representation of it in the set of attributes so in further expressions
+					 * evaluations the parser isn't broke by a unknow attribute exception */
+					atrib = getAttribute(to_xml_entity);
 
-						column = 0;
-						line++;
-						atrib.clear();
-					}
+					if(attributes.count(atrib) == 0)
+						attributes[atrib] = "";
 				}
-				else
-				{
-					//If the toke is an 'if'
-					if(cond==TokenIf)
-					{
-						//Evaluates the if expression storing the result on the vector
-						if_expr = true;
-						vet_expif.push_back(evaluateExpression());
+			}
+			//If the toke is an 'if'
+			else if(instr.opcode == Instruction::If)
+			{
+				//Evaluates the if expression storing the result on the vector
+				vet_expif.push_back(evaluateExpression(instr.expression));
 
-						/* Inserts the value of the current 'if' level  in the previous 'if' levels vector.
-						 This vector is used to know which 'if' the parser was in before entering current if */
-						vet_prev_level.push_back(if_level);
+				/* Inserts the value of the current 'if' level  in the previous 'if' levels vector.
+				 This vector is used to know which 'if' the parser was in before entering current if */
+				vet_prev_level.push_back(if_level);
 
-						/* Mark the flags indicating that an  'if' was found and a
-						 * 'then' and 'else' have not been found yet */
-						vet_tk_if.push_back(true);
-						vet_tk_then.push_back(false);
-						vet_tk_else.push_back(false);
+				/* Mark the flags indicating that an  'if' was found and a
+				 * 'then' and 'else' have not been found yet */
+				vet_tk_if.push_back(true);
+				vet_tk_then.push_back(false);
+				vet_tk_else.push_back(false);
 
-						//Defines the current if level as the size of list 'if' tokens found  -1
-						if_level = (vet_tk_if.size()-1);
+				//Defines the current if level as the size of list 'if' tokens found  -1
+				if_level = (vet_tk_if.size()-1);
+			}
+			//If the parser is in 'if / else' and one 'then' token is found
+			else if(instr.opcode == Instruction::Then)
+			{
+				//Marks the then token flag of the current 'if'
+				vet_tk_then[if_level]=true;
+			}
+			//If the parser is in 'if / else' and a 'else' token is found
+			else if(instr.opcode == Instruction::Else)
+			{
+				//Mark the  o flag do token else do if atual
+				vet_tk_else[if_level] = true;
+			}
+			//Case the parser is in 'if/else' and a 'end' token was found
+			else if(instr.opcode == Instruction::End)
+			{
+				//Get the level of the previous 'if' where the parser was
+				prev_if_level = vet_prev_level[if_level];
 
-						//Increases the number of found 'if's
-						if_cnt++;
-					}
-					//If the parser is in 'if / else' and one 'then' token is found
-					else if(cond == TokenThen && if_level >= 0)
-					{
-						//Marks the then token flag of the current 'if'
-						vet_tk_then[if_level]=true;
+				//In case the current 'if' be internal (nested) (if_level > 0)
+				if(if_level > 0)
+				{
+					//In case the current 'if' doesn't in the 'else' section of the above 'if' (previous if level)
+					if(!vet_tk_else[prev_if_level])
+						//Get the extracted word vector on the above 'if'
+						vet_aux=&if_map[prev_if_level];
+					else
+						//Get the extracted word vector on the above 'else'
+						vet_aux=&else_map[prev_if_level];
+				}
+				else
+					vet_aux = nullptr;
 
-						/* Clears the  expression extracted flag from the 'if - then',
-						 * so that the parser does not generate an error when it encounters another
-						 * 'if - then' with an expression still unextracted */
-						if_expr = false;
-					}
-					//If the parser is in 'if / else' and a 'else' token is found
-					else if(cond == TokenElse && if_level >= 0)
-						//Mark the  o flag do token else do if atual
-						vet_tk_else[if_level] = true;
-					//Case the parser is in 'if/else' and a 'end' token was found
-					else if(cond == TokenEnd && if_level >= 0)
-					{
-						//Increments the number of 'end' tokes found
-						end_cnt++;
+				/* Initializes the iterators to scan
+					 the auxiliary vector if necessary */
+				itr=itr_end=if_map[0].end();
 
-									 //Get the level of the previous 'if' where the parser was
-						prev_if_level = vet_prev_level[if_level];
+				/* In case the expression of the current 'if' has the value true
+				 * then the parser will scan the list of words on the 'if' part of the
+				 * current 'if' */
+				if(vet_expif[if_level])
+				{
+					itr = if_map[if_level].begin();
+					itr_end = if_map[if_level].end();
+				}
 
-									 //In case the current 'if' be internal (nested) (if_level > 0)
-						if(if_level > 0)
-						{
-							//In case the current 'if' doesn't in the 'else' section of the above 'if' (previous if level)
-							if(!vet_tk_else[prev_if_level])
-								//Get the extracted word vector on the above 'if'
-								vet_aux=&if_map[prev_if_level];
-							else
-								//Get the extracted word vector on the above 'else'
-								vet_aux=&else_map[prev_if_level];
-						}
-						else
-							vet_aux = nullptr;
+				/* If there is a 'else' part on the current 'if'
+				 * then the parser will scan the list of words on the 'else' part */
+				else if(else_map.count(if_level)>0)
+				{
+					itr = else_map[if_level].begin();
+					itr_end = else_map[if_level].end();
+				}
 
-						/* Initializes the iterators to scan
-							 the auxiliary vector if necessary */
-						itr=itr_end=if_map[0].end();
+				/* This iteration scans the list of words selected above
+				 * inserting them in 'if' part  of the 'if' or 'else' superior to current.
+				 * This is done so that only the words extracted based on
+				 * ifs expressions of the buffer are embedded in defining sql */
+				while(itr!=itr_end)
+				{
+					//If the auxiliary vector is allocated, inserts the word on above 'if / else'
+					if(vet_aux)
+						vet_aux->push_back((*itr));
+					else
+					{
+						word=(*itr);
 
-						/* In case the expression of the current 'if' has the value true
-						 * then the parser will scan the list of words on the 'if' part of the
-						 * current 'if' */
-						if(vet_expif[if_level])
+						//Check if the word is not an attribute
+						if(!word.isEmpty() &&
+								(word.startsWith(CharStartAttribute) ||
+								 word.startsWith(CharToXmlEntity)) &&
+								word.endsWith(CharEndAttribute))
 						{
-							itr = if_map[if_level].begin();
-							itr_end = if_map[if_level].end();
-						}
+							//If its an attribute, extracts the name between { } and checks if the same has empty value
+							bool conv_entity = word.startsWith(CharToXmlEntity);
+							int pos = conv_entity ? 2 : 1;
 
-						/* If there is a 'else' part on the current 'if'
-						 * then the parser will scan the list of words on the 'else' part */
-						else if(else_map.count(if_level)>0)
-						{
-							itr = else_map[if_level].begin();
-							itr_end = else_map[if_level].end();
-						}
+							atrib = word.mid(pos, word.size() - (pos + 1));
+							word = conv_entity ? UtilsNs::convertToXmlEntities(attributes[atrib]) : attributes[atrib];
 
-						/* This iteration scans the list of words selected above
-						 * inserting them in 'if' part  of the 'if' or 'else' superior to current.
-						 * This is done so that only the words extracted based on
-						 * ifs expressions of the buffer are embedded in defining sql */
-						while(itr!=itr_end)
-						{
-							//If the auxiliary vector is allocated, inserts the word on above 'if / else'
-							if(vet_aux)
-								vet_aux->push_back((*itr));
-							else
+							/* If the attribute has no value set and parser must not ignore empty values
+							 * raises an exception */
+							if(word.isEmpty() && !ignore_empty_atribs)
 							{
-								word=(*itr);
-
-											 //Check if the word is not an attribute
-								if(!word.isEmpty() &&
-										(word.startsWith(CharStartAttribute) ||
-										 word.startsWith(CharToXmlEntity)) &&
-										word.endsWith(CharEndAttribute))
-								{
-									//If its an attribute, extracts the name between { } and checks if the same has empty value
-									bool conv_entity = word.startsWith(CharToXmlEntity);
-									int pos = conv_entity ? 2 : 1;
-
-									atrib = word.mid(pos, word.size() - (pos + 1));
-									word = conv_entity ? UtilsNs::convertToXmlEntities(attributes[atrib]) : attributes[atrib];
-
-									/* If the attribute has no value set and parser must not ignore empty values
-									 * raises an exception */
-									if(word.isEmpty() && !ignore_empty_atribs)
-									{
-										throw Exception(getParseError(ErrorCode::UndefinedAttributeValue, "", atrib),
-																		ErrorCode::UndefinedAttributeValue, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-									}
-								}
-
-								//Else, insert the word directly on the object definition
-								object_def += word;
+								line = instr.line;
+								column = instr.column;
+								throw Exception(getParseError(ErrorCode::UndefinedAttributeValue, "", atrib),
+																ErrorCode::UndefinedAttributeValue, __exc_origin);
 							}
-
-							itr++;
-						}
-
-						//Case the current if is nested (internal)
-						if(if_level > 0)
-						{
-							//Causes the parser to return to the earlier 'if'
-							if_level=prev_if_level;
 						}
-						/* In case the 'if' be the uppermost (level 0) indicates that all
-						 * the if's  has already been checked, so the parser will clear the
-						 * used auxiliary structures*/
-						else
-						{
-							if_map.clear();
-							else_map.clear();
-							vet_tk_if.clear();
-							vet_tk_then.clear();
-							vet_tk_else.clear();
-							vet_expif.clear();
-							vet_prev_level.clear();
-
-							//Resets the ifs levels
-							if_level = prev_if_level = -1;
-						}
-					}
-					else
-						error=true;
 
-					if(!error)
-					{
-						/* Verifying that the conditional words appear in a valid  order if not
-						 * the parser generates an error. Correct order means IF before THEN,
-						 * ELSE after IF and before END */
-						if((prev_cond == TokenIf && cond != TokenThen) ||
-								(prev_cond == TokenElse && cond != TokenIf && cond != TokenEnd) ||
-								(prev_cond == TokenThen && cond == TokenThen))
-							error = true;
+						//Else, insert the word directly on the object definition
+						object_def += word;
 					}
 
-					if(error)
-					{
-						throw Exception(getParseError(ErrorCode::InvalidSyntax),
-														ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-					}
+					itr++;
 				}
-			}
-			//Extraction of pure text or simple words
-			else
-			{
-				if(chr == CharStartPlainText || chr == CharEndPlainText)
-					word = getPlainText();
-				else
-					word = getWord();
 
-				//Case the parser is in 'if/else'
-				if(if_level>=0)
+				//Case the current if is nested (internal)
+				if(if_level > 0)
 				{
-					/* In case the word/text be inside 'if' expression, the parser returns an error
-					 * because only an attribute must be on the 'if' expression  */
-					if(vet_tk_if[if_level] && !vet_tk_then[if_level])
-					{
-						throw Exception(getParseError(ErrorCode::InvalidSyntax),
-														ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__, __FILE__, __LINE__);
-					}
-					//Case the parser is in 'if' section
-					else if(vet_tk_if[if_level] &&
-									 vet_tk_then[if_level] &&
-									 !vet_tk_else[if_level])
-					{
-						//Inserts the word on the words map extracted on 'if' section
-						if_map[if_level].push_back(word);
-					}
-					else if(vet_tk_else[if_level])
-					{
-						//Inserts the word on the words map extracted on 'else' section
-						else_map[if_level].push_back(word);
-					}
+					//Causes the parser to return to the earlier 'if'
+					if_level=prev_if_level;
 				}
+				/* In case the 'if' be the uppermost (level 0) indicates that all
+				 * the if's  has already been checked, so the parser will clear the
+				 * used auxiliary structures*/
 				else
-					//Case the parser is not in 'if/else' concatenates the word/text directly on the object definition
-					object_def+=word;
+				{
+					if_map.clear();
+					else_map.clear();
+					vet_tk_if.clear();
+					vet_tk_then.clear();
+					vet_tk_else.clear();
+					vet_expif.clear();
+					vet_prev_level.clear();
+
+					//Resets the ifs levels
+					if_level = prev_if_level = -1;
+				}
 			}
 		}
-
-		/* If has more 'if' toknes than  'end' tokens, this indicates that some 'if' in code
-		 * was not closed thus the parser returns an error */
-		if(if_cnt!=end_cnt)
-		{
-			throw Exception(getParseError(ErrorCode::InvalidSyntax),
-											ErrorCode::InvalidSyntax, __PRETTY_FUNCTION__ , __FILE__, __LINE__);
-		}
 	}
 
 	restartParser();
@@ -1677,7 +1901,7 @@ QString SchemaParser::getSourceCode(const QString &filename, attribs_map &attrib
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__exc_origin, &e);
 	}
 }
 
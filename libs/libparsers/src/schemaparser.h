@@ -32,6 +32,10 @@
 #include "attribsmap.h"
 #include "exception.h"
 #include <QRegularExpression>
+#include <QDateTime>
+#include <memory>
+#include <atomic>
+#include <QMutex>
 
 class __libparsers SchemaParser {
 	private:
@@ -55,6 +59,120 @@ class __libparsers SchemaParser {
 			}
 		};
 
+		//! \brief A piece of the value of a %set instruction or an attribute of a %unset instruction
+		struct ValuePart {
+			QString value;
+			bool is_attribute {false},
+					to_xml_entity {false};
+
+			//! \brief The position in the buffer right after the piece, used to report errors
+			int line {0}, column {0};
+		};
+
+		/*! \brief A term of a conditional expression (%if), which is an attribute or a comparison
+		 *  expression, and how it is combined with the result of the previous terms */
+		struct ExprTerm {
+			enum Connector: unsigned {
+				NoConnector,
+				AndConnector,
+				OrConnector
+			};
+
+			Connector connector {NoConnector};
+
+			bool negate {false},
+					is_comparison {false},
+					to_xml_entity {false};
+
+			//! \brief The attribute of the term and, for comparison expressions, the operator and the value compared
+			QString attribute, oper, value;
+
+			//! \brief The position in the buffer right after the term, used to report errors
+			int line {0}, column {0};
+		};
+
+		/*! \brief An instruction of a compiled buffer (see compileBuffer()). Texts, metacharacters and escaped
+		 *  characters are stored already converted in Text instructions, attribute references in Attribute
+		 *  instructions, and conditional expressions as the list of their terms in If instructions */
+		struct Instruction {
+			enum OpCode: unsigned {
+				Text,
+				Attribute,
+				If,
+				Then,
+				Else,
+				End,
+				Set,
+				Unset
+			};
+
+			OpCode opcode {Text};
+
+			/*! \brief The text (Text), the attribute name (Attribute), or the name of the
+			 *  attribute defined by %set (or the one holding the name when use_val_as_name is set) */
+			QString value,
+
+			//! \brief The attribute reference as written in the buffer ({attr} or &{attr}), used in if/else blocks
+			attr_ref;
+
+			bool to_xml_entity {false},
+
+			//! \brief Indicates a %set @{attr} instruction, which defines the attribute named after the value of attr
+			use_val_as_name {false},
+
+			//! \brief Indicates that the %set/%unset instruction right follows an %else
+			after_else {false};
+
+			/*! \brief The position in the buffer right after the instruction, used to report errors. For %set/%unset
+			 *  stmt_line/stmt_column hold the position right after the instruction token */
+			int line {0}, column {0},
+					stmt_line {0}, stmt_column {0};
+
+			//! \brief The terms of the conditional expression of an If instruction
+			std::vector<ExprTerm> expression;
+
+			//! \brief The pieces of the value of a %set instruction or the attributes of an %unset instruction
+			std::vector<ValuePart> parts;
+		};
+
+		using CompiledBuffer = std::vector<Instruction>;
+
+		/*! \brief Stores the already tokenized buffer of a schema file (comments removed and
+		 *  @include statements expanded), its compiled instructions, as well as the modification time of the files
+		 *  involved in its generation, so changes in the main or in the included files invalidate the entry.
+		 *  An entry is never changed after being cached (except for the validated_pass) so it's shared
+		 *  by all parsers without copying: the buffer is implicitly shared with the parsers that use it */
+		struct CachedSchema {
+			QStringList buffer;
+			std::shared_ptr<const CompiledBuffer> compiled_buf;
+			std::vector<IncludeInfo> include_infos;
+			std::map<QString, QDateTime> files_mtime;
+
+			//! \brief The last code generation pass in which the files of the entry were checked (see isCachedSchemaValid())
+			mutable std::atomic<unsigned> validated_pass {0};
+		};
+
+		/*! \brief Process-wide cache of tokenized schema files (see loadFile()). Since each
+		 *  object has its own parser instance and code generation can happen in secondary
+		 *  threads, the access to this cache is serialized by the cache_mutex. The mutex is held only
+		 *  to retrieve/store the entries, the files are checked and tokenized without holding it */
+		static std::map<QString, std::shared_ptr<const CachedSchema>> cached_schemas;
+
+		static QMutex cache_mutex;
+
+		//! \brief The identifier of the current code generation pass (see startGenerationPass())
+		static std::atomic<unsigned> gen_pass_id;
+
+		//! \brief The amount of code generation passes currently running
+		static std::atomic<unsigned> running_gen_passes;
+
+		//! \brief Returns the identifier of the current code generation pass or zero if no pass is running
+		static unsigned getGenerationPass();
+
+		/*! \brief Returns true when none of the files used to create the cached schema were modified.
+		 *  During a code generation pass (gen_pass > 0) the files are checked only once per pass */
+		static bool isCachedSchemaValid(const CachedSchema &cached_sch, unsigned gen_pass);
+
 		/*! \brief Stores the information (start/end lines) of included files
 		 *  in the buffer. This is used to report syntax/semantic errors at the
 		 *  correct location */
@@ -86,7 +204,7 @@ class __libparsers SchemaParser {
 		//! \brief Get an escaped character from the buffer on the current position
 		QString getEscapedCharacter();
 
-		/*! \brief Returns the result (true|false) of conditional expression evaluation.
+		/*! \brief Compiles the conditional expression starting at the current position into the list of its terms.
 		The expression is evaluated from the left to the right and not support Polish Notation, so
 		as the parser finds an attribute evaluates it and stores the result, when find another one
 		evaluates and compare with previous evaluation, and so on. Example:
@@ -99,9 +217,12 @@ class __libparsers SchemaParser {
 		%if {a1} %or %not {a3} %then --> TRUE
 		%if {a1} %and {a3} %then --> FALSE
 		*/
-		bool evaluateExpression();
+		void compileExpression(std::vector<ExprTerm> &expression);
 
-		/*! \brief Returns the result (true|false) of a comparison expression. A comparison expression
+		//! \brief Returns the result (true|false) of a compiled conditional expression (see compileExpression())
+		bool evaluateExpression(const std::vector<ExprTerm> &expression);
+
+		/*! \brief Compiles the comparison expression starting at the current position. A comparison expression
 		have the form: ( {attribute} [operator] "value" ), where:
 
 		(           --> Starts the expression
@@ -114,9 +235,12 @@ class __libparsers SchemaParser {
 		The parenthesis are mandatory otherwise the parser will not recognize the expression
 		and raise an exception. Multiple expressions combined with logical operators
 		%not %and %or in the same () are not supported. */
-		bool evaluateComparisonExpr();
+		void compileComparisonExpr(ExprTerm &term);
+
+		//! \brief Returns the result (true|false) of a compiled comparison expression (see compileComparisonExpr())
+		bool evaluateComparisonExpr(const ExprTerm &term);
 
-		/*! \brief Creates a new attribute when finding:
+		/*! \brief Compiles the creation of a new attribute when finding:
 		1) %set  {attrib-name} [expr]  or
 		2) %set @{existing-attrib} [expr]
 
@@ -128,10 +252,18 @@ class __libparsers SchemaParser {
 
 		The %set construction must be the only one in the line otherwise the parser will return
 		errors if another instruction starting with % is found. */
-		void defineAttribute();
+		void compileAttributeDefinition(Instruction &instr);
+
+		//! \brief Compiles the clearing of the attributes values when finding the instruction: %unset {attr1} {attr2}...
+		void compileAttributeUnset(Instruction &instr);
 
-		//! \brief Clears the value of attributes when finding the instruction: %unset {attr1} {attr2}...
-		void unsetAttribute();
+		//! \brief Executes a compiled %set or %unset instruction
+		void defineAttribute(const Instruction &instr);
+
+		/*! \brief Translates the buffer (see loadBuffer()) into the list of instructions evaluated by getSourceCode().
+		 *  This is where the syntax of the whole buffer is checked, the errors that depend on the attributes
+		 *  used in the code generation (e.g. unknown attributes) are only detected in the evaluation */
+		void compileBuffer(CompiledBuffer &instructions);
 
 		//! \brief Increments the column counter while blank chars (space and tabs) are found on the line
 		void ignoreBlankChars(const QString &line);
@@ -162,6 +294,9 @@ class __libparsers SchemaParser {
 		 analyzed by de parser */
 		QStringList buffer;
 
+		//! \brief The compiled instructions of the buffer, shared with the cache when the buffer came from a file
+		std::shared_ptr<const CompiledBuffer> compiled_buf;
+
 		//! \brief Current line where the parser reading is
 		int line,
 
@@ -323,15 +458,29 @@ class __libparsers SchemaParser {
 
 		/*! \brief Generic method that interprets a pre-specified buffer (see loadBuffer()) and for a given map
 		 of attributes this method returns the data of the buffer analyzed and filled with the values ​​of the
-		 attributes map */
+		 attributes map. The buffer is compiled only once when loaded from a file (see loadFile()) so subsequent
+		 calls only evaluate its instructions */
 		QString getSourceCode(const attribs_map &attribs);
 
 		//! \brief Loads the schema code from a string buffer
 		void loadBuffer(const QString &buf);
 
-		//! \brief Loads a schema file and inserts its line into the parser's buffer
+		/*! \brief Loads a schema file and inserts its line into the parser's buffer.
+		 *  The tokenized buffer of the file is cached so subsequent calls for the same file
+		 *  just reuse it unless the file (or one of its includes) is modified on disk */
 		void loadFile(const QString &filename);
 
+		//! \brief Clears the process-wide cache of tokenized schema files
+		static void clearSchemasCache();
+
+		/*! \brief Marks the start of a code generation pass (e.g. the generation of a whole model's code).
+		 *  While a pass is running the files of each cached schema are checked for modifications only in their
+		 *  first use in the pass instead of in every loadFile() call. Each call must have a matching finishGenerationPass() */
+		static void startGenerationPass();
+
+		//! \brief Marks the end of a code generation pass (see startGenerationPass())
+		static void finishGenerationPass();
+
 		//! \brief Resets the parser in order to do new analysis
 		void restartParser();
 
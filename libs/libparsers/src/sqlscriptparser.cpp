@@ -0,0 +1,323 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "sqlscriptparser.h"
+#include "attributes.h"
+#include <QStringList>
+
+SqlScriptParser::SqlScriptParser()
+{
+	curr_pos = 0;
+	parse_drop_cmds = false;
+}
+
+void SqlScriptParser::loadBuffer(const QString &sql_buf)
+{
+	buffer = sql_buf;
+	curr_pos = 0;
+}
+
+void SqlScriptParser::setParseDropCommands(bool value)
+{
+	parse_drop_cmds = value;
+}
+
+bool SqlScriptParser::hasNextCommand()
+{
+	return curr_pos < buffer.size();
+}
+
+int SqlScriptParser::getCurrentPosition()
+{
+	return curr_pos;
+}
+
+int SqlScriptParser::getBufferSize()
+{
+	return buffer.size();
+}
+
+QString SqlScriptParser::extractLine()
+{
+	int lb_pos = buffer.indexOf(QChar::LineFeed, curr_pos);
+	QString line;
+
+	if(lb_pos < 0)
+		lb_pos = buffer.size();
+
+	line = buffer.mid(curr_pos, lb_pos - curr_pos);
+	curr_pos = std::min(lb_pos + 1, static_cast<int>(buffer.size()));
+
+	// Discarding the carriage return of Windows line breaks (\r\n)
+	if(line.endsWith(QChar::CarriageReturn))
+		line.chop(1);
+
+	return line;
+}
+
+bool SqlScriptParser::isDropCommand(const QString &line)
+{
+	static const QString AlterTable { "ALTER TABLE" }, Drop { "DROP" };
+	int pos = 0, drop_pos = -1;
+
+	// The line must start with one or more comment indicators optionally followed by spaces
+	while(line.mid(pos, 2) == "--")
+	{
+		pos += 2;
+
+		while(pos < line.size() && line[pos] == QChar::Space)
+			pos++;
+	}
+
+	if(pos == 0)
+		return false;
+
+	// DROP [OBJECT] ...
+	if(line.mid(pos, Drop.size()) == Drop)
+		return line.size() > pos + Drop.size();
+
+	// ALTER TABLE ... DROP ...
+	if(line.mid(pos, AlterTable.size()) != AlterTable)
+		return false;
+
+	drop_pos = line.indexOf(Drop, pos + AlterTable.size() + 1);
+	return drop_pos >= 0 && line.size() > drop_pos + Drop.size();
+}
+
+void SqlScriptParser::removeScriptComments(QString &line)
+{
+	static const QStringList Keywords { "*", "object", "ALTER", "DROP" };
+	int pos = 0, kw_pos = 0;
+
+	if(line.startsWith(Attributes::DdlEndToken))
+		line.remove(0, Attributes::DdlEndToken.size());
+
+	/* Removing from the first comment that identifies an object or
+	 * a commented command (-- object:, -- ALTER, -- DROP, -- *) to the end of the line */
+	while((pos = line.indexOf("--", pos)) >= 0)
+	{
+		kw_pos = pos + 3;
+
+		if(kw_pos < line.size() && line[pos + 2].isSpace())
+		{
+			for(auto &kw : Keywords)
+			{
+				if(line.mid(kw_pos, kw.size()) == kw && line.size() > kw_pos + kw.size())
+				{
+					line.truncate(pos);
+					return;
+				}
+			}
+		}
+
+		pos++;
+	}
+}
+
+QString SqlScriptParser::getNextCommand()
+{
+	QString cmd, line;
+	bool ddl_end_found = false;
+
+	/* Reading lines until a non empty command delimited by ddl-end token is found
+	 * or the end of the buffer is reached */
+	while(curr_pos < buffer.size() && (!ddl_end_found || cmd.isEmpty()))
+	{
+		line = extractLine();
+		ddl_end_found = false;
+
+		if(parse_drop_cmds && isDropCommand(line))
+		{
+			/* If the count of comment indicators (--) is 1 indicates that the DDL of the
+			 * object related to the DROP is enabled, so the DROP is returned otherwise ignored */
+			if(line.count("--") == 1)
+			{
+				cmd = line.remove("--").trimmed() + QChar::LineFeed;
+				ddl_end_found = true;
+			}
+		}
+		else
+		{
+			ddl_end_found = line.contains(Attributes::DdlEndToken);
+			removeScriptComments(line);
+
+			//If the line isn't empty after cleanup it will be included on command
+			if(!line.isEmpty())
+				cmd += line + QChar::LineFeed;
+		}
+	}
+
+	return cmd;
+}
+
+bool SqlScriptParser::skipComment(const QString &sql, qsizetype &pos)
+{
+	qsizetype len = sql.size(), end_pos = 0;
+	QChar chr = sql.at(pos),
+			next_chr = pos + 1 < len ? sql.at(pos + 1) : QChar();
+
+	// Line comments
+	if(chr == '-' && next_chr == '-')
+	{
+		end_pos = sql.indexOf(QChar::LineFeed, pos);
+		pos = end_pos < 0 ? len : end_pos + 1;
+		return true;
+	}
+
+	// Block comments (which can be nested in PostgreSQL)
+	if(chr == '/' && next_chr == '*')
+	{
+		int depth = 1;
+
+		for(pos += 2; pos < len && depth > 0; pos++)
+		{
+			if(sql.at(pos) == '/' && pos + 1 < len && sql.at(pos + 1) == '*')
+			{
+				depth++;
+				pos++;
+			}
+			else if(sql.at(pos) == '*' && pos + 1 < len && sql.at(pos + 1) == '/')
+			{
+				depth--;
+				pos++;
+			}
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+bool SqlScriptParser::skipLiteral(const QString &sql, qsizetype &pos)
+{
+	qsizetype len = sql.size(), end_pos = 0;
+	QChar chr = sql.at(pos);
+
+	// String literals and quoted identifiers (doubled quotes are handled as two consecutive literals)
+	if(chr == '\'' || chr == '"')
+	{
+		// Strings prefixed by E accept backslash escapes
+		bool escapes = chr == '\'' && pos > 0 && sql.at(pos - 1).toLower() == 'e' &&
+									 (pos == 1 || (!sql.at(pos - 2).isLetterOrNumber() && sql.at(pos - 2) != '_'));
+
+		for(pos++; pos < len && sql.at(pos) != chr; pos++)
+		{
+			if(escapes && sql.at(pos) == '\\')
+				pos++;
+		}
+
+		pos++;
+		return true;
+	}
+
+	// Dollar-quoted strings ($$ ... $$ or $tag$ ... $tag$)
+	if(chr == '$')
+	{
+		end_pos = pos + 1;
+
+		while(end_pos < len && (sql.at(end_pos).isLetterOrNumber() || sql.at(end_pos) == '_'))
+			end_pos++;
+
+		// Positional parameters ($1) and identifiers containing $ aren't dollar quotes
+		if(end_pos < len && sql.at(end_pos) == '$' && !sql.at(pos + 1).isDigit())
+		{
+			QString tag = sql.mid(pos, end_pos - pos + 1);
+
+			end_pos = sql.indexOf(tag, end_pos + 1);
+			pos = end_pos < 0 ? len : end_pos + tag.size();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool SqlScriptParser::hasMultipleCommands(const QString &sql)
+{
+	qsizetype pos = 0, len = sql.size();
+	bool cmd_ended = false;
+	QChar chr;
+
+	while(pos < len)
+	{
+		chr = sql.at(pos);
+
+		if(skipComment(sql, pos))
+			continue;
+
+		if(chr.isSpace())
+		{
+			pos++;
+			continue;
+		}
+
+		// Any code after a semicolon means that a new command started
+		if(cmd_ended)
+			return true;
+
+		if(chr == ';')
+		{
+			cmd_ended = true;
+			pos++;
+		}
+		else if(!skipLiteral(sql, pos))
+			pos++;
+	}
+
+	return false;
+}
+
+bool SqlScriptParser::isReadOnlyCommand(const QString &sql)
+{
+	static const QStringList read_kws { "SELECT", "VALUES", "TABLE", "SHOW", "WITH" },
+			write_kws { "INSERT", "UPDATE", "DELETE", "MERGE", "INTO" };
+	qsizetype pos = 0, len = sql.size(), end_pos = 0;
+	bool first_word = true;
+	QString word;
+	QChar chr;
+
+	while(pos < len)
+	{
+		chr = sql.at(pos);
+
+		if(skipComment(sql, pos) || skipLiteral(sql, pos))
+			continue;
+
+		if(!chr.isLetter() && chr != '_')
+		{
+			pos++;
+			continue;
+		}
+
+		for(end_pos = pos + 1; end_pos < len &&
+				(sql.at(end_pos).isLetterOrNumber() || sql.at(end_pos) == '_' || sql.at(end_pos) == '$'); end_pos++);
+
+		word = sql.mid(pos, end_pos - pos).toUpper();
+		pos = end_pos;
+
+		/* The command must start with a keyword that only queries data and must not contain
+		 * data-changing clauses, like in WITH ... INSERT or SELECT ... INTO */
+		if((first_word && !read_kws.contains(word)) || write_kws.contains(word))
+			return false;
+
+		first_word = false;
+	}
+
+	return !first_word;
+}
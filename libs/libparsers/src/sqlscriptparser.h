@@ -0,0 +1,97 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class SqlScriptParser
+\brief This class splits SQL scripts generated by pgModeler into the single commands delimited by the ddl-end token.
+The comments used only to separate the commands in the script are removed from the commands returned.
+*/
+
+#ifndef SQL_SCRIPT_PARSER_H
+#define SQL_SCRIPT_PARSER_H
+
+#include <QString>
+#include "parsersglobal.h"
+
+class __libparsers SqlScriptParser {
+	private:
+		//! \brief The SQL script which is stored in memory and parsed
+		QString buffer;
+
+		//! \brief Indicates the current linear position in which the parser is in.
+		int curr_pos;
+
+		/*! \brief Indicates that the commented DROP commands attached to objects (-- DROP ...)
+		 *  must be extracted as single commands. Commands commented more than once
+		 *  (belonging to objects with SQL disabled) are always ignored */
+		bool parse_drop_cmds;
+
+		//! \brief Extracts the next line of the buffer, without the line break, moving the current position
+		QString extractLine();
+
+		//! \brief Returns if the line contains a commented DROP command (-- DROP or -- ALTER TABLE ... DROP)
+		static bool isDropCommand(const QString &line);
+
+		/*! \brief Removes from the line the ddl-end token (when starting the line) and the
+		 *  comments used to identify objects in the script (-- object:, -- ALTER, -- DROP, -- *) */
+		static void removeScriptComments(QString &line);
+
+		/*! \brief Moves pos past the comment (-- or block comment) starting at that position.
+		 *  Returns false, leaving pos untouched, if there's no comment in the position */
+		static bool skipComment(const QString &sql, qsizetype &pos);
+
+		/*! \brief Moves pos past the string literal, quoted identifier or dollar-quoted string starting at
+		 *  that position. Returns false, leaving pos untouched, if there's no literal in the position */
+		static bool skipLiteral(const QString &sql, qsizetype &pos);
+
+	public:
+		SqlScriptParser();
+
+		//! \brief Loads the SQL script to be parsed, resetting the current position
+		void loadBuffer(const QString &sql_buf);
+
+		void setParseDropCommands(bool value);
+
+		//! \brief Returns if the end of the buffer was not reached, meaning that more commands may be extracted
+		bool hasNextCommand();
+
+		/*! \brief Extracts the next command from the buffer. A command is composed by all the lines
+		 *  from the current position until a ddl-end token or the end of the buffer.
+		 *  Returns an empty string if there are no more commands */
+		QString getNextCommand();
+
+		//! \brief Returns the current position of the parser in the buffer
+		int getCurrentPosition();
+
+		//! \brief Returns the size of the buffer being parsed
+		int getBufferSize();
+
+		/*! \brief Returns true if the SQL code contains more than one command separated by semicolons.
+		 *  Semicolons inside string literals, quoted identifiers, dollar-quoted strings and comments
+		 *  are ignored, as well as a semicolon that just terminates the last command */
+		static bool hasMultipleCommands(const QString &sql);
+
+		/*! \brief Returns true if the SQL code is a single query that only reads data (SELECT, VALUES, TABLE, SHOW
+		 *  or WITH) without data-changing clauses (INSERT, UPDATE, DELETE, MERGE or INTO). Keywords inside string
+		 *  literals, quoted identifiers and comments are ignored. Note that functions called by the query can
+		 *  still change data, this is only a syntactic check */
+		static bool isReadOnlyCommand(const QString &sql);
+};
+
+#endif
@@ -21,8 +21,11 @@
 #include "exception.h"
 #include <QUrl>
 #include <QFileInfo>
+#include <QStringEncoder>
 
 int XmlParser::parser_instances {0};
+std::map<QString, xmlDtdPtr> XmlParser::dtd_cache;
+QMutex XmlParser::dtd_cache_mutex;
 
 XmlParser::XmlParser()
 {
@@ -44,11 +47,75 @@ XmlParser::~XmlParser()
 
 	if(parser_instances <= 0)
 	{
+		clearDTDCache();
 		xmlCleanupParser();
 		parser_instances = 0;
 	}
 }
 
+xmlDtdPtr XmlParser::getCachedDTD(const QString &dtd_url)
+{
+	QMutexLocker locker(&dtd_cache_mutex);
+	auto itr = dtd_cache.find(dtd_url);
+
+	if(itr != dtd_cache.end())
+		return itr->second;
+
+	xmlDtdPtr dtd = xmlParseDTD(nullptr, reinterpret_cast<const xmlChar *>(dtd_url.toUtf8().constData()));
+
+	if(!dtd)
+		return nullptr;
+
+	/* The content models of the elements are built by libxml2 on demand during the validation,
+	 * changing the DTD. Since the cached DTD is shared between threads they are built here, once */
+#ifdef LIBXML_REGEXP_ENABLED
+	if(dtd->elements)
+	{
+		xmlValidCtxtPtr valid_ctx = xmlNewValidCtxt();
+
+		xmlHashScan(reinterpret_cast<xmlHashTablePtr>(dtd->elements), [](void *elem, void *ctx, const xmlChar *) {
+			xmlValidBuildContentModel(static_cast<xmlValidCtxtPtr>(ctx), static_cast<xmlElementPtr>(elem));
+		}, valid_ctx);
+
+		xmlFreeValidCtxt(valid_ctx);
+	}
+#endif
+
+	dtd_cache[dtd_url] = dtd;
+	return dtd;
+}
+
+void XmlParser::setDTDDefaultAttributes(xmlNode *elem, xmlDtdPtr dtd)
+{
+	xmlElementPtr elem_decl = nullptr;
+
+	for(; elem; elem = elem->next)
+	{
+		if(elem->type != XML_ELEMENT_NODE)
+			continue;
+
+		elem_decl = xmlGetDtdElementDesc(dtd, elem->name);
+
+		for(xmlAttributePtr attr = elem_decl ? elem_decl->attributes : nullptr; attr; attr = attr->nexth)
+		{
+			if(attr->defaultValue && !xmlHasProp(elem, attr->name))
+				xmlSetProp(elem, attr->name, attr->defaultValue);
+		}
+
+		setDTDDefaultAttributes(elem->children, dtd);
+	}
+}
+
+void XmlParser::clearDTDCache()
+{
+	QMutexLocker locker(&dtd_cache_mutex);
+
+	for(auto &itr : dtd_cache)
+		xmlFreeDtd(itr.second);
+
+	dtd_cache.clear();
+}
+
 void XmlParser::removeDTD()
 {
 	int pos1=-1, pos2=-1, pos3=-1, len;
@@ -81,7 +148,7 @@ void XmlParser::loadXMLFile(const QString &filename)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, filename);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e, filename);
 	}
 }
 
@@ -92,7 +159,7 @@ void XmlParser::loadXMLBuffer(const QString &xml_buf)
 		int pos1=-1, pos2=-1, tam=0;
 
 		if(xml_buf.isEmpty())
-			throw Exception(ErrorCode::AsgEmptyXMLBuffer,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ErrorCode::AsgEmptyXMLBuffer,__exc_origin);
 
 		pos1=xml_buf.indexOf(QLatin1String("<?xml"));
 		pos2=xml_buf.indexOf(QLatin1String("?>"));
@@ -112,7 +179,7 @@ void XmlParser::loadXMLBuffer(const QString &xml_buf)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e);
 	}
 }
 
@@ -121,10 +188,10 @@ void XmlParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
 	QString fmt_dtd_file;
 
 	if(dtd_file.isEmpty())
-		throw Exception(ErrorCode::AsgEmptyDTDFile,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgEmptyDTDFile,__exc_origin);
 
 	if(dtd_name.isEmpty())
-		throw Exception(ErrorCode::AsgEmptyDTDName,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::AsgEmptyDTDName,__exc_origin);
 
 #ifndef Q_OS_WIN
 	fmt_dtd_file = "file://";
@@ -134,36 +201,81 @@ void XmlParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
 
 	//Formats the dtd file path to URL style (converting to percentage format the non reserved chars)
 	fmt_dtd_file += QUrl::toPercentEncoding(QFileInfo(dtd_file).absoluteFilePath(), "/:");
-	dtd_decl = "<!DOCTYPE " + dtd_name + " SYSTEM " + "\"" + fmt_dtd_file + "\">\n";
+	dtd_url = fmt_dtd_file;
+	this->dtd_name = dtd_name;
 }
 
 void XmlParser::readBuffer()
 {
+	QStringEncoder encoder(QStringEncoder::Utf8);
 	QByteArray buffer;
+	char *buffer_end = nullptr;
+	QString root_name;
 	int parser_opt;
 
 	if(!xml_buffer.isEmpty())
 	{
-		//Inserts the XML declaration
-		buffer+=xml_decl.toUtf8();
-
-		//Configures the parser, initially, to not validate the document against the dtd
+		/* Encoding the XML declaration and the document straight into a single buffer
+		 * avoiding the creation of temporary UTF-8 copies of each part */
+		buffer.resize(encoder.requiredSpace(xml_decl.size() + xml_buffer.size()));
+		buffer_end = encoder.appendToBuffer(buffer.data(), xml_decl);
+		buffer_end = encoder.appendToBuffer(buffer_end, xml_buffer);
+		buffer.truncate(buffer_end - buffer.data());
+
+		/* The parser never loads the DTD by itself, instead, the document is validated after
+		 * its creation against the cached DTD (if configured) which is parsed only once */
 		parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT | XML_PARSE_BIG_LINES);
 
-		//If the dtd declarions is setup
-		if(!dtd_decl.isEmpty())
+		//Create an xml document from the buffer
+		xmlResetLastError();
+		xml_doc=xmlReadMemory(buffer.constData(), buffer.size(),	nullptr, nullptr, parser_opt);
+
+		if(xml_doc && !dtd_url.isEmpty())
 		{
-			//Inserts the default software DTD declarion into XML buffer
-			buffer+=dtd_decl.toUtf8();
+			xmlDtdPtr dtd = getCachedDTD(dtd_url);
+			xmlValidCtxtPtr valid_ctx = nullptr;
+			int valid = 0;
+
+			if(!dtd)
+			{
+				QString extra_info {
+					QString(QT_TR_NOOP("XML file: %1")).arg(xml_doc_filename) + "\n" +
+					QString(QT_TR_NOOP("DTD file: %1")).arg(dtd_url) };
+				const xmlError *xml_error = xmlGetLastError();
+				QString msg = xml_error ? QString(xml_error->message).replace("\n", " ") : QString("failed to parse the DTD file");
+				int line = xml_error ? xml_error->line : 0,
+						column = xml_error ? xml_error->int2 : 0;
 
-			//Now configures the parser to validate the buffer against the DTD
-			parser_opt=(parser_opt | XML_PARSE_DTDLOAD | XML_PARSE_DTDVALID);
-		}
+				restartParser();
 
-		buffer+=xml_buffer.toUtf8();
+				throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
+								.arg(line).arg(column).arg(msg, ""),
+								ErrorCode::LibXMLError, __exc_origin, nullptr,
+								extra_info);
+			}
+
+			valid_ctx = xmlNewValidCtxt();
+			valid = xmlValidateDtd(valid_ctx, xml_doc, dtd);
+			xmlFreeValidCtxt(valid_ctx);
+
+			/* Since the document isn't parsed with the DTD loaded, the default values of the attributes
+			 * declared in the DTD are assigned here in the same way XML_PARSE_DTDATTR would do */
+			if(valid == 1)
+				setDTDDefaultAttributes(xmlDocGetRootElement(xml_doc), dtd);
+			else if(!xmlGetLastError())
+			{
+				QString extra_info {
+					QString(QT_TR_NOOP("XML file: %1")).arg(xml_doc_filename) + "\n" +
+					QString(QT_TR_NOOP("DTD file: %1")).arg(dtd_url) };
 
-		//Create an xml document from the buffer
-		xml_doc=xmlReadMemory(buffer.data(), buffer.size(),	nullptr, nullptr, parser_opt);
+				restartParser();
+
+				throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
+								.arg(0).arg(0).arg("the document is not valid according to the DTD", ""),
+								ErrorCode::LibXMLError, __exc_origin, nullptr,
+								extra_info);
+			}
+		}
 
 		//In case the document criation fails, gets the last xml parser error
 		const xmlError *xml_error = xmlGetLastError();
@@ -173,7 +285,7 @@ void XmlParser::readBuffer()
 		{
 			QString msg, file, extra_info {
 								QString(QT_TR_NOOP("XML file: %1")).arg(xml_doc_filename) + "\n" +
-								QString(QT_TR_NOOP("DTD decl: %1")).arg(dtd_decl) };
+								QString(QT_TR_NOOP("DTD file: %1")).arg(dtd_url) };
 
 			//Formats the error
 			msg = xml_error->message;
@@ -191,19 +303,38 @@ void XmlParser::readBuffer()
 			//Raise an exception with the error massege from the parser xml
 			throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
 							.arg(xml_error->line).arg(xml_error->int2).arg(msg, file),
-							ErrorCode::LibXMLError, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,
+							ErrorCode::LibXMLError, __exc_origin, nullptr,
 							extra_info);
 		}
 
 		//Gets the referênce to the root element on the document
 		root_elem=curr_elem=xmlDocGetRootElement(xml_doc);
+
+		/* Since the document has no DOCTYPE declaration the validation above doesn't check
+		 * the root element name, so we do it here in the same way libxml2 would do */
+		root_name = root_elem ? reinterpret_cast<const char *>(root_elem->name) : "";
+
+		if(!dtd_url.isEmpty() && root_name != dtd_name)
+		{
+			QString extra_info {
+				QString(QT_TR_NOOP("XML file: %1")).arg(xml_doc_filename) + "\n" +
+				QString(QT_TR_NOOP("DTD file: %1")).arg(dtd_url) };
+			int line = root_elem ? root_elem->line : 0;
+
+			restartParser();
+
+			throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
+							.arg(line).arg(0).arg(QString("root and DTD name do not match '%1' and '%2'").arg(root_name, dtd_name), ""),
+							ErrorCode::LibXMLError, __exc_origin, nullptr,
+							extra_info);
+		}
 	}
 }
 
 void XmlParser::savePosition()
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	elems_stack.push(curr_elem);
 }
@@ -211,7 +342,7 @@ void XmlParser::savePosition()
 void XmlParser::restorePosition()
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	if(elems_stack.empty())
 		curr_elem=root_elem;
@@ -225,9 +356,9 @@ void XmlParser::restorePosition()
 void XmlParser::restorePosition(const xmlNode *elem)
 {
 	if(!elem)
-		throw Exception(ErrorCode::OprNotAllocatedElement,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElement,__exc_origin);
 	else if(elem->doc!=xml_doc)
-		throw Exception(ErrorCode::OprInexistentElement,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprInexistentElement,__exc_origin);
 
 	restartNavigation();
 	curr_elem=const_cast<xmlNode *>(elem);
@@ -236,7 +367,7 @@ void XmlParser::restorePosition(const xmlNode *elem)
 void XmlParser::restartNavigation()
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	curr_elem=root_elem;
 
@@ -255,8 +386,9 @@ void XmlParser::restartParser()
 		xml_doc=nullptr;
 	}
 
-	dtd_decl = xml_buffer = xml_decl= "";
+	dtd_url = dtd_name = xml_buffer = xml_decl= "";
 	xml_doc_filename = "";
+	parsed_attribs.clear();
 
 	while(!elems_stack.empty())
 		elems_stack.pop();
@@ -270,7 +402,7 @@ bool XmlParser::accessElement(ElementType elem_type)
 	xmlNode *elems[4];
 
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	elems[RootElement]=curr_elem->parent;
 	elems[ChildElement]=curr_elem->children;
@@ -310,7 +442,7 @@ bool XmlParser::accessElement(ElementType elem_type)
 bool XmlParser::hasElement(ElementType elem_type, xmlElementType xml_node_type)
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	if(elem_type==RootElement)
 	{
@@ -341,7 +473,7 @@ bool XmlParser::hasElement(ElementType elem_type, xmlElementType xml_node_type)
 bool XmlParser::hasAttributes()
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	return (curr_elem->properties != nullptr);
 }
@@ -349,7 +481,7 @@ bool XmlParser::hasAttributes()
 QString XmlParser::getElementContent()
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	/* If the current element has  <![CDATA[]]> node returns the content of the CDATA instead
 	of return the content of the element itself */
@@ -363,7 +495,7 @@ QString XmlParser::getElementContent()
 QString XmlParser::getElementName()
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	return QString(reinterpret_cast<const char *>(curr_elem->name));
 }
@@ -371,7 +503,7 @@ QString XmlParser::getElementName()
 xmlElementType XmlParser::getElementType()
 {
 	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
 
 	return curr_elem->type;
 }
@@ -381,19 +513,13 @@ const xmlNode *XmlParser::getCurrentElement()
 	return curr_elem;
 }
 
-void XmlParser::getElementAttributes(attribs_map &attributes)
+void XmlParser::readElementAttributes(const xmlNode *elem, attribs_map &attributes)
 {
 	xmlAttr *elem_attribs=nullptr;
 	QString attrib, value;
 
-	if(!root_elem)
-		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	//Always clears the passed attributes maps
-	attributes.clear();
-
 	//Gets the references to the element properties
-	elem_attribs=curr_elem->properties;
+	elem_attribs=elem->properties;
 
 	while(elem_attribs)
 	{
@@ -411,6 +537,54 @@ void XmlParser::getElementAttributes(attribs_map &attributes)
 	}
 }
 
+void XmlParser::getElementAttributes(attribs_map &attributes)
+{
+	if(!root_elem)
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__exc_origin);
+
+	//Always clears the passed attributes maps
+	attributes.clear();
+
+	if(!parsed_attribs.empty())
+	{
+		auto itr = parsed_attribs.find(curr_elem);
+
+		/* The pre-parsed attributes are handed over to the caller. If the same
+		 * element is queried again its attributes are read from the element tree */
+		if(itr != parsed_attribs.end())
+		{
+			attributes = std::move(itr->second);
+			parsed_attribs.erase(itr);
+			return;
+		}
+	}
+
+	readElementAttributes(curr_elem, attributes);
+}
+
+void XmlParser::parseSubtreeAttributes(const xmlNode *elem, ElementsAttributes &elems_attribs)
+{
+	if(!elem || elem->type != XML_ELEMENT_NODE)
+		return;
+
+	elems_attribs.emplace_back(elem, attribs_map());
+	readElementAttributes(elem, elems_attribs.back().second);
+
+	for(const xmlNode *child = elem->children; child; child = child->next)
+		parseSubtreeAttributes(child, elems_attribs);
+}
+
+void XmlParser::setParsedAttributes(ElementsAttributes &&elems_attribs)
+{
+	parsed_attribs.clear();
+	parsed_attribs.reserve(elems_attribs.size());
+
+	for(auto &[elem, attribs] : elems_attribs)
+		parsed_attribs[elem] = std::move(attribs);
+
+	elems_attribs.clear();
+}
+
 QString XmlParser::getLoadedFilename()
 {
 	return xml_doc_filename;
@@ -28,10 +28,14 @@
 
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/valid.h>
 #include <stack>
+#include <vector>
+#include <unordered_map>
 #include <iostream>
 #include "parsersglobal.h"
 #include <QString>
+#include <QMutex>
 #include "attribsmap.h"
 
 class __libparsers XmlParser {
@@ -42,6 +46,25 @@ class __libparsers XmlParser {
 		 * Reference: http://xmlsoft.org/html/libxml-parser.html#xmlCleanupParser */
 		static int parser_instances;
 
+		/*! \brief Stores the DTDs already parsed (values) by their URLs (keys). Since the same DTD is generally
+		 * used to validate lots of buffers, it's parsed only once and shared between all parser instances.
+		 * The DTDs are released when the last parser instance is destroyed */
+		static std::map<QString, xmlDtdPtr> dtd_cache;
+
+		//! \brief Serializes the access to the DTD cache since parsers can be used in different threads
+		static QMutex dtd_cache_mutex;
+
+		/*! \brief Returns the DTD related to the provided URL parsing and caching it in the first usage.
+		 * Returns nullptr if the DTD could not be parsed, in that case the libxml2 error is kept set */
+		static xmlDtdPtr getCachedDTD(const QString &dtd_url);
+
+		/*! \brief Assigns to the provided element, its siblings and descendants the default values of
+		 * the attributes declared in the DTD which are absent in the elements */
+		static void setDTDDefaultAttributes(xmlNode *elem, xmlDtdPtr dtd);
+
+		//! \brief Releases all the DTDs in the cache
+		static void clearDTDCache();
+
 		/*! \brief Stores the name of the file that generated the xml buffer when
 		 loadXMLFile() method is called */
 		QString xml_doc_filename;
@@ -64,8 +87,11 @@ class __libparsers XmlParser {
 		 position is necessary call restorePosition() */
 		std::stack<xmlNode *> elems_stack;
 
-		//! \brief Stores the document DTD declaration
-		QString	dtd_decl,
+		//! \brief Stores the URL of the DTD used to validate the documents
+		QString	dtd_url,
+
+		//! \brief Stores the name of the root element expected by the DTD
+		dtd_name,
 
 		//! \brief Stores XML document to be analyzed
 		xml_buffer,
@@ -74,6 +100,13 @@ class __libparsers XmlParser {
 		 * a default declaration. */
 		xml_decl;
 
+		/*! \brief Stores the attributes of elements extracted in advance (see setParsedAttributes()).
+		 *  The attributes of an element are removed from this map once returned by getElementAttributes() */
+		std::unordered_map<const xmlNode *, attribs_map> parsed_attribs;
+
+		//! \brief Stores on a map the attributes (names and values) of the provided element reading them from the element tree
+		static void readElementAttributes(const xmlNode *elem, attribs_map &attributes);
+
 		/*! \brief Remove the original DTD from the document. This is done to evit that
 		 the user insert some external dtd in the model file that is not valid for pgModeler */
 		void removeDTD();
@@ -81,10 +114,14 @@ class __libparsers XmlParser {
 		/*! \brief Makes the interpretation of XML inside the buffer validating it according to
 		 DTD defined configured (by the parser) to the buffer. Initializes
 		 the necessary attributes to make possible the navigation through the element tree
-		 generated from the XML document read. */
+		 generated from the XML document read. When no DTD is configured (the case of the
+		 buffers generated internally, see restartParser()) the validation is skipped at all */
 		void readBuffer();
 
 	public:
+		//! \brief Stores the attributes of the elements of a subtree of the document (see parseSubtreeAttributes())
+		using ElementsAttributes = std::vector<std::pair<const xmlNode *, attribs_map>>;
+
 		//! \brief Constants used to referência the elements on the element tree
 		enum ElementType: unsigned {
 			RootElement,
@@ -127,9 +164,19 @@ class __libparsers XmlParser {
 		//! \brief Retorns if an element has attributes
 		bool hasAttributes();
 
-		//! \brief Stores on a map the atrributes (names and values) of the current element
+		/*! \brief Stores on a map the atrributes (names and values) of the current element. If the attributes
+		 *  of the element were extracted in advance (see setParsedAttributes()) they are returned instead */
 		void getElementAttributes(attribs_map &attributes);
 
+		/*! \brief Extracts the attributes of the provided element and of all its descendant elements. This method
+		 *  only reads the element tree so it can be called from worker threads over distinct subtrees of a loaded
+		 *  document, as long as the document isn't released (see restartParser()) in the meantime */
+		static void parseSubtreeAttributes(const xmlNode *elem, ElementsAttributes &elems_attribs);
+
+		/*! \brief Configures the attributes extracted by parseSubtreeAttributes() to be returned by getElementAttributes()
+		 *  so the element tree isn't read again. Any attributes configured previously are discarded */
+		void setParsedAttributes(ElementsAttributes &&elems_attribs);
+
 		/*! \brief Returns the content text of the element, used only for elements which do not have children
 		 and that are filled by simple texts */
 		QString getElementContent();
@@ -18,6 +18,7 @@
 #include "exception.h"
 #include "enumtype.h"
 #include <QApplication>
+#include <algorithm>
 
 QString Exception::messages[Exception::ErrorCount][2]={
 	{"Custom", " "},
@@ -297,88 +298,125 @@ Exception::Exception()
 	configureException("",ErrorCode::Custom,"","",-1,"");
 }
 
+Exception::Exception(const QString &msg, const Origin &origin, Exception *exception, const QString &extra_info)
+{
+	configureException(msg, ErrorCode::Custom, origin.method, origin.file, origin.line, extra_info);
+	reuseDefaultMessage(msg, exception);
+	addException(exception);
+}
+
+Exception::Exception(const QString &msg, const Origin &origin, std::vector<Exception> &exceptions, const QString &extra_info)
+{
+	configureException(msg, ErrorCode::Custom, origin.method, origin.file, origin.line, extra_info);
+	addExceptions(exceptions);
+}
+
+Exception::Exception(const QString &msg, ErrorCode error_code, const Origin &origin, Exception *exception, const QString &extra_info)
+{
+	configureException(msg, error_code, origin.method, origin.file, origin.line, extra_info);
+	reuseDefaultMessage(msg, exception);
+	addException(exception);
+}
+
+Exception::Exception(const QString &msg, ErrorCode error_code, const Origin &origin, std::vector<Exception> &exceptions, const QString &extra_info)
+{
+	configureException(msg, error_code, origin.method, origin.file, origin.line, extra_info);
+	addExceptions(exceptions);
+}
+
+Exception::Exception(ErrorCode error_code, const Origin &origin, Exception *exception, const QString &extra_info)
+{
+	/* The default message of the error code is only translated when it's retrieved
+	 * via getErrorMessage() since most of the exceptions are just rethrown or discarded */
+	configureException("", error_code, origin.method, origin.file, origin.line, extra_info);
+	default_msg = true;
+	addException(exception);
+}
+
+Exception::Exception(ErrorCode error_code, const Origin &origin, std::vector<Exception> &exceptions, const QString &extra_info)
+{
+	configureException("", error_code, origin.method, origin.file, origin.line, extra_info);
+	default_msg = true;
+	addExceptions(exceptions);
+}
+
 Exception::Exception(const QString &msg, const QString &method, const QString &file, int line, Exception *exception, const QString &extra_info)
 {
 	configureException(msg,ErrorCode::Custom, method, file, line, extra_info);
+	reuseDefaultMessage(msg, exception);
 	addException(exception);
 }
 
 Exception::Exception(ErrorCode error_code, const QString &method, const QString &file, int line, Exception *exception, const QString &extra_info)
 {
-	/* Because the Exception class is not derived from QObject the function tr() is inefficient to translate messages
-		so the translation method is called  directly from the application specifying the
-		context (Exception) in the ts file and the text to be translated */
-	configureException(qApp->translate("Exception",messages[enum_t(error_code)][ErrorMessage].toStdString().c_str(),"", -1),
-										 error_code, method, file, line, extra_info);
-
+	configureException("", error_code, method, file, line, extra_info);
+	default_msg = true;
 	addException(exception);
 }
 
 Exception::Exception(const QString &msg, ErrorCode error_code, const QString &method, const QString &file, int line, Exception *exception, const QString &extra_info)
 {
 	configureException(msg,error_code, method, file, line, extra_info);
+	reuseDefaultMessage(msg, exception);
 	addException(exception);
 }
 
 Exception::Exception(ErrorCode error_code, const QString &method, const QString &file, int line, std::vector<Exception> &exceptions, const QString &extra_info)
 {
-	std::vector<Exception>::iterator itr, itr_end;
-
-	/* Because the Exception class is not derived from QObject the function tr() is inefficient to translate messages
-		so the translation method is called  directly from the application specifying the
-		context (Exception) in the ts file and the text to be translated */
-	configureException(qApp->translate("Exception",messages[enum_t(error_code)][ErrorMessage].toStdString().c_str(),"",-1),
-										 error_code, method, file, line, extra_info);
-
-	itr=exceptions.begin();
-	itr_end=exceptions.end();
-	while(itr!=itr_end)
-	{
-		addException(&(*itr));
-		itr++;
-	}
+	configureException("", error_code, method, file, line, extra_info);
+	default_msg = true;
+	addExceptions(exceptions);
 }
 
 Exception::Exception(const QString &msg, const QString &method, const QString &file, int line, std::vector<Exception> &exceptions, const QString &extra_info)
 {
-	std::vector<Exception>::iterator itr, itr_end;
-
 	configureException(msg,ErrorCode::Custom, method, file, line, extra_info);
-
-	itr=exceptions.begin();
-	itr_end=exceptions.end();
-	while(itr!=itr_end)
-	{
-		addException(&(*itr));
-		itr++;
-	}
+	addExceptions(exceptions);
 }
 
 Exception::Exception(const QString &msg, ErrorCode error_code, const QString &method, const QString &file, int line, std::vector<Exception> &exceptions, const QString &extra_info)
 {
-	std::vector<Exception>::iterator itr=exceptions.begin();
-
 	configureException(msg,error_code, method, file, line, extra_info);
-
-	while(itr!=exceptions.end())
-	{
-		addException(&(*itr));
-		itr++;
-	}
+	addExceptions(exceptions);
 }
 
-void Exception::configureException(const QString &msg, ErrorCode error_code, const QString &method, const QString &file, int line, const QString &extra_info)
+void Exception::configureException(const QString &msg, ErrorCode error_code, const char *method, const char *file, int line, const QString &extra_info)
 {
 	this->error_code = error_code;
 	this->error_msg = msg;
+	this->default_msg = false;
 	this->method = method;
 	this->file = file;
 	this->line = line;
 	this->extra_info = extra_info;
 }
 
-QString Exception::getErrorMessage()
+void Exception::configureException(const QString &msg, ErrorCode error_code, const QString &method, const QString &file, int line, const QString &extra_info)
+{
+	configureException(msg, error_code, nullptr, nullptr, line, extra_info);
+	method_str = method;
+	file_str = file;
+}
+
+void Exception::reuseDefaultMessage(const QString &msg, Exception *exception)
+{
+	if(!exception || !exception->default_msg || exception->error_code != error_code)
+		return;
+
+	/* The rethrown exceptions usually receive the message of the cause (Exception::getErrorMessage()).
+	 * The untranslated message is checked first so the translation is only repeated when it differs */
+	if(msg == messages[enum_t(error_code)][ErrorMessage] || msg == getErrorMessage(error_code))
+	{
+		error_msg.clear();
+		default_msg = true;
+	}
+}
+
+QString Exception::getErrorMessage() const
 {
+	if(default_msg)
+		return getErrorMessage(error_code);
+
 	return error_msg;
 }
 
@@ -395,27 +433,27 @@ QString Exception::getErrorCode(ErrorCode error_code)
 	return messages[enum_t(error_code)][ErrorCodeId];
 }
 
-QString Exception::getMethod()
+QString Exception::getMethod() const
 {
-	return method;
+	return method ? QString(method) : method_str;
 }
 
-QString Exception::getFile()
+QString Exception::getFile() const
 {
-	return file;
+	return file ? QString(file) : file_str;
 }
 
-QString Exception::getLine()
+QString Exception::getLine() const
 {
 	return QString("%1").arg(line);
 }
 
-ErrorCode Exception::getErrorCode()
+ErrorCode Exception::getErrorCode() const
 {
 	return error_code;
 }
 
-QString Exception::getExtraInfo()
+QString Exception::getExtraInfo() const
 {
 	return extra_info;
 }
@@ -425,25 +463,48 @@ void Exception::addException(Exception *exception)
 	if(!exception)
 		return;
 
-	for(auto &ex : exception->exceptions)
+	/* The most common case: the exception is being rethrown so its stack is
+	 * just shared (copying the exception only copies the pointer to its cause) */
+	if(!cause)
 	{
-		this->exceptions.push_back(Exception(ex.error_msg,ex.error_code,
-																				 ex.method, ex.file, ex.line, nullptr,
-																				 ex.extra_info));
+		cause = std::make_shared<const Exception>(*exception);
+		return;
 	}
 
-	this->exceptions.push_back(*exception);
-	//exception->exceptions.clear();
+	/* When more than one exception is added (see the constructors that receive a list of exceptions)
+	 * the stack of the new one is rebuilt on top of the current one, since the shared stack can't be changed */
+	std::vector<Exception> list;
+	exception->getExceptionsList(list);
+
+	for(auto &ex : list)
+	{
+		ex.cause = cause;
+		cause = std::make_shared<const Exception>(std::move(ex));
+	}
 }
 
-void Exception::getExceptionsList(std::vector<Exception> &list)
+void Exception::addExceptions(std::vector<Exception> &exceptions)
 {
-	list.assign(this->exceptions.begin(), this->exceptions.end());
-	list.push_back(Exception(this->error_msg,this->error_code,
-													 this->method,this->file,this->line,nullptr,this->extra_info));
+	for(auto &ex : exceptions)
+		addException(&ex);
 }
 
-QString Exception::getExceptionsText()
+void Exception::getExceptionsList(std::vector<Exception> &list) const
+{
+	list.clear();
+
+	for(const Exception *ex = cause.get(); ex; ex = ex->cause.get())
+		list.push_back(*ex);
+
+	std::reverse(list.begin(), list.end());
+	list.push_back(*this);
+
+	// The exceptions in the list are detached from their own stacks since the list itself is the whole stack
+	for(auto &ex : list)
+		ex.cause.reset();
+}
+
+QString Exception::getExceptionsText() const
 {
 	std::vector<Exception> exceptions;
 	std::vector<Exception>::reverse_iterator itr, itr_end;
@@ -487,14 +548,13 @@ QString Exception::getExceptionsText()
 	return exceptions_txt;
 }
 
-QString Exception::getExceptiosExtraInfo()
+QString Exception::getExceptiosExtraInfo() const
 {
 	QStringList list;
 
-	for(auto &ex : exceptions)
-		list.prepend(ex.extra_info);
+	for(const Exception *ex = this; ex; ex = ex->cause.get())
+		list.append(ex->extra_info);
 
-	list.prepend(extra_info);
 	list.removeAll("");
 	list.removeDuplicates();
 
@@ -31,6 +31,11 @@
 #include <exception>
 #include <signal.h>
 #include <vector>
+#include <memory>
+
+/*! \brief Expands to the origin (method, file and line) of the code in which an exception is being created.
+ *  This is the only way an Exception::Origin must be created (see Exception::Origin) */
+#define __exc_origin Exception::Origin { __PRETTY_FUNCTION__, __FILE__, __LINE__ }
 
 //! \brief This enum defines the global error codes used throughout the application
 enum class ErrorCode: unsigned {
@@ -307,15 +312,26 @@ enum class ErrorCode: unsigned {
 };
 
 class __libutils Exception {
+	public:
+		/*! \brief Identifies the method, file and line of the code that raised an exception.
+		 *  It must be created only through the macro __exc_origin which provides the static strings
+		 *  __PRETTY_FUNCTION__ and __FILE__, this way, the exception doesn't need to copy them */
+		struct Origin {
+			const char *method, *file;
+			int line;
+		};
+
 	private:
 		static constexpr unsigned ErrorCount=271;
 
 		//! \brief Constants used to access the error details
 		static constexpr unsigned ErrorCodeId=0, ErrorMessage=1;
 
-		/*! \brief Stores other exceptions before raise the 'this' exception.
-		 This structure can be used to simulate a stack trace to improve the debug */
-		std::vector<Exception> exceptions;
+		/*! \brief Stores the exception raised before the 'this' exception. Each exception in the stack
+		 points to the previous one, so this structure can be used to simulate a stack trace to improve the debug.
+		 Since the previous exceptions are never changed they are shared by all the exceptions that chain them,
+		 this way, rethrowing an exception doesn't copy the whole stack */
+		std::shared_ptr<const Exception> cause;
 
 		//! \brief Stores the error messages and codes (names of errors) in string format
 		static QString messages[ErrorCount][2];
@@ -323,34 +339,67 @@ class __libutils Exception {
 		//! \brief Error type related to the exception
 		ErrorCode error_code;
 
+		/*! \brief Indicates that the error message is the default one of the error code, which is only
+		 translated when retrieved by getErrorMessage() */
+		bool default_msg;
+
 		//! \brief Formated error message
 		QString error_msg,
-				/*! \brief Holds the class name and method which was
-							triggered the exception. For this to be possible, at the time
-							instantiation of this class the  G++ macro __ PRETTY_FUNCTION__
-							must be passed. This macro contains the format [RETURN][CLASS]::[METHOD][PARAMS] */
-				method,
-
-				//! \brief File where the exception was generated (Macro __ FILE__)
-				file,
 
 				/*! \brief Additional information (optional) may store any other
 				type of information that is interesting on attempt to resolve the error */
 				extra_info;
 
+		/*! \brief Holds the class name and method which was
+				triggered the exception. For this to be possible, at the time
+				instantiation of this class the  G++ macro __ PRETTY_FUNCTION__
+				must be passed. This macro contains the format [RETURN][CLASS]::[METHOD][PARAMS].
+				Since the macro is a static string only its address is stored (see Origin) */
+		const char *method,
+
+				//! \brief File where the exception was generated (Macro __ FILE__)
+				*file;
+
+		/*! \brief Copies of the method and file names when they aren't provided through an Origin.
+				These are used only when the attributes method and file are null */
+		QString method_str, file_str;
+
 		//! \brief Line of file where the exception were generated (Macro __LINE__)
 		int line;
 
 		//! \brief Configures the basic attributes of exception
+		void configureException(const QString &msg, ErrorCode error_code, const char *method, const char *file, int line, const QString &extra_info);
+
+		//! \brief Configures the basic attributes of exception storing copies of the method and file names
 		void configureException(const QString &msg, ErrorCode error_code, const QString &method, const QString &file, int line, const QString &extra_info);
 
-		//! \brief Adds a exception to the list of exceptions
+		//! \brief Adds a exception to the stack of exceptions
 		void addException(Exception *exception);
 
+		//! \brief Adds the exceptions in the list to the stack of exceptions
+		void addExceptions(std::vector<Exception> &exceptions);
+
+		/*! \brief Makes the exception use the lazily translated default message of its error code when the provided
+		 *  message is the one of the cause, which is the case of an exception being rethrown (see getErrorMessage()) */
+		void reuseDefaultMessage(const QString &msg, Exception *exception);
+
 	public:
 		static unsigned constexpr MaximumStackSize = 50;
 
 		Exception();
+
+		/*! \brief The constructors that receive an Origin (see the macro __exc_origin) store only the addresses
+		 *  of the method and file names. The ones that receive the method and file as QString store copies of them,
+		 *  so they must be used when these names aren't static strings (e.g. a temporary buffer).
+		 *  The constructors that receive the exception being rethrown reuse its default message,
+		 *  when it is the case, instead of storing a copy of the translated one */
+		Exception(const QString &msg, const Origin &origin, Exception *exception=nullptr, const QString &extra_info="");
+		Exception(const QString &msg, const Origin &origin, std::vector<Exception> &exceptions, const QString &extra_info="");
+		Exception(const QString &msg, ErrorCode error_code, const Origin &origin, Exception *exception=nullptr, const QString &extra_info="");
+		Exception(const QString &msg, ErrorCode error_code, const Origin &origin, std::vector<Exception> &exceptions, const QString &extra_info="");
+		Exception(ErrorCode error_code, const Origin &origin, Exception *exception=nullptr, const QString &extra_info="");
+		Exception(ErrorCode error_code, const Origin &origin, std::vector<Exception> &exceptions, const QString &extra_info="");
+
 		Exception(const QString &msg, const QString &method, const QString &file, int line, Exception *exception=nullptr, const QString &extra_info="");
 		Exception(const QString &msg, const QString &method, const QString &file, int line, std::vector<Exception> &exceptions, const QString &extra_info="");
 		Exception(const QString &msg, ErrorCode error_code, const QString &method, const QString &file, int line, Exception *exception=nullptr, const QString &extra_info="");
@@ -359,24 +408,24 @@ class __libutils Exception {
 		Exception(ErrorCode error_code, const QString &method, const QString &file, int line, std::vector<Exception> &exceptions, const QString &extra_info="");
 
 		~Exception(void){}
-		QString getErrorMessage();
+		QString getErrorMessage() const;
 		static QString getErrorMessage(ErrorCode error_code);
 		static QString getErrorCode(ErrorCode error_code);
-		QString getMethod();
-		QString getFile();
-		QString getLine();
-		ErrorCode getErrorCode();
-		QString getExtraInfo();
+		QString getMethod() const;
+		QString getFile() const;
+		QString getLine() const;
+		ErrorCode getErrorCode() const;
+		QString getExtraInfo() const;
 
 		//! \brief Gets the full exception stack
-		void getExceptionsList(std::vector<Exception> &list);
+		void getExceptionsList(std::vector<Exception> &list) const;
 
 		//! \brief Gets the exception stack in a formatted text
-		QString getExceptionsText();
+		QString getExceptionsText() const;
 
 		/*! \brief Returns in one string all the extra info from the exceptions in the error stack
 			 * Duplicated extra information is discarded */
-		QString getExceptiosExtraInfo();
+		QString getExceptiosExtraInfo() const;
 };
 
 /* Registering the Exception class as a Qt MetaType in order to make
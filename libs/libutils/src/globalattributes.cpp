@@ -72,6 +72,7 @@ const QString GlobalAttributes::BugReportEmail {"bug@pgmodeler.io"};
 const QString GlobalAttributes::BugReportFile {"pgmodeler%1.bug"};
 const QString GlobalAttributes::StacktraceFile {".stacktrace"};
 const QString GlobalAttributes::LastModelFile {"lastmodel"};
+const QString GlobalAttributes::LastJournalFile {"lastjournal"};
 
 const QString GlobalAttributes::DbModelExt {".dbm"};
 const QString GlobalAttributes::DbModelBkpExt {".dbk"};
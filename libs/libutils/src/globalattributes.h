@@ -168,6 +168,7 @@ class __libutils GlobalAttributes {
 		BugReportFile,
 		StacktraceFile,
 		LastModelFile,
+		LastJournalFile, //! \brief A file that holds the path to the journal of the last model (see ModelJournal)
 
 		DbModelExt,
 		DbModelBkpExt,
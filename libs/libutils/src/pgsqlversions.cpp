@@ -50,7 +50,7 @@ namespace PgSqlVersions {
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::InvPostgreSQLVersion)
 											.arg(pgsql_ver, PgSqlVersions::MinimumVersion, PgSqlVersions::DefaulVersion),
-											ErrorCode::InvPostgreSQLVersion, __PRETTY_FUNCTION__,__FILE__,__LINE__);
+											ErrorCode::InvPostgreSQLVersion, __exc_origin);
 		}
 
 		if(curr_ver > 0)
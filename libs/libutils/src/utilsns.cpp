@@ -33,7 +33,7 @@ namespace UtilsNs {
 		if(!output.isOpen())
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
-											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__,
+											ErrorCode::FileDirectoryNotWritten,__exc_origin,
 											nullptr, output.errorString());
 		}
 
@@ -51,7 +51,7 @@ namespace UtilsNs {
 		if(!input.isOpen())
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(input.fileName()),
-											ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__,
+											ErrorCode::FileDirectoryNotAccessed,__exc_origin,
 											nullptr, input.errorString());
 		}
 
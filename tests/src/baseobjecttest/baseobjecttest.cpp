@@ -19,6 +19,8 @@
 #include <QtTest/QtTest>
 #include "coreutilsns.h"
 #include "table.h"
+#include "schema.h"
+#include "role.h"
 
 class BaseObjectTest: public QObject {
 	Q_OBJECT
@@ -27,6 +29,8 @@ class BaseObjectTest: public QObject {
     void quoteNameIfKeyword();
     void nameIsInvalidIfStartsWithNumber();
 		void dontFormatNameIfAlreadyQuoted();
+		void removeIgnoredAttributesAndTagsFromCode();
+		void codeFingerprintChangesWhenCodeIsInvalidated();
 };
 
 void BaseObjectTest::quoteNameIfKeyword()
@@ -48,5 +52,50 @@ void BaseObjectTest::dontFormatNameIfAlreadyQuoted()
 	QCOMPARE(BaseObject::formatName(name), name);
 }
 
+void BaseObjectTest::removeIgnoredAttributesAndTagsFromCode()
+{
+	QString xml = "<table name=\"tab\" layers=\"0\" gen-alter-cmds=\"true\">\n"
+								"  <position x=\"10\" y=\"20\"/>\n"
+								"  <comment><![CDATA[comment]]></comment>\n"
+								"  <column name=\"id\" layers=\"1\"/>\n"
+								"</table>";
+
+	QCOMPARE(BaseObject::removeIgnoredCode(xml, { "layers", "gen-alter-cmds" }, { "position", "comment" }),
+					 QString("<table name=\"tab\" > <column name=\"id\" layers=\"1\"/> </table>"));
+}
+
+void BaseObjectTest::codeFingerprintChangesWhenCodeIsInvalidated()
+{
+	Schema sch1, sch2;
+
+	sch1.setName("schema");
+	sch2.setName("schema");
+	QCOMPARE(sch1.getCodeFingerprint(), sch2.getCodeFingerprint());
+	QVERIFY(!sch1.isCodeDiffersFrom(&sch2));
+
+	// The fingerprint is computed from the attributes, so the code of the objects isn't generated
+	QVERIFY(sch1.isCodeInvalidated());
+	QVERIFY(sch2.isCodeInvalidated());
+
+	sch2.setComment("changed comment");
+	QVERIFY(sch1.getCodeFingerprint() != sch2.getCodeFingerprint());
+	QVERIFY(sch1.isCodeDiffersFrom(&sch2));
+	QVERIFY(!sch1.isCodeDiffersFrom(&sch2, {}, { Attributes::Comment }));
+
+	// The ignored tags are also removed from the attributes holding xml code (e.g. the owner's <role/>)
+	Role role;
+	role.setName("owner");
+	sch2.setOwner(&role);
+	QVERIFY(sch1.isCodeDiffersFrom(&sch2, {}, { Attributes::Comment }));
+	QVERIFY(!sch1.isCodeDiffersFrom(&sch2, {}, { Attributes::Comment, Attributes::Role }));
+
+	// Generating the code doesn't change the fingerprint
+	sch1.getSourceCode(SchemaParser::XmlCode);
+	sch1.setCodeInvalidated(true);
+	sch2.setOwner(nullptr);
+	sch2.setComment("");
+	QCOMPARE(sch1.getCodeFingerprint(), sch2.getCodeFingerprint());
+}
+
 QTEST_MAIN(BaseObjectTest)
 #include "baseobjecttest.moc"
@@ -0,0 +1,352 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "tools/databaseimporthelper.h"
+#include "pgmodelerunittest.h"
+
+/* The import test cases need a reachable database which is informed through the environment
+ * variable PGMODELER_TEST_CONNINFO using the libpq keyword/value format, for instance:
+ * PGMODELER_TEST_CONNINFO="host=localhost port=5432 dbname=sample user=postgres password=secret"
+ * When the variable isn't set these test cases are skipped. The test cases that feed recorded
+ * catalog attributes to the importer run offline */
+/* Exposes the storage of catalog attributes of the importer so the test cases
+ * can feed it with recorded attributes instead of querying a database */
+class CatalogAttribsImportHelper: public DatabaseImportHelper {
+	public:
+		using DatabaseImportHelper::user_objs;
+		using DatabaseImportHelper::system_objs;
+		using DatabaseImportHelper::types;
+		using DatabaseImportHelper::columns;
+		using DatabaseImportHelper::created_objs;
+		using DatabaseImportHelper::createObject;
+};
+
+class DatabaseImportHelperTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		DatabaseImportHelperTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private:
+		Connection conn;
+
+		//! \brief Indicates that PGMODELER_TEST_CONNINFO was set so the import test cases can run
+		bool has_conn_info;
+
+		//! \brief Imports the whole database configured in conn into the provided model
+		void importDatabase(DatabaseModel &model, bool direct_creation, unsigned jobs = 1);
+
+		Table *createTable(DatabaseModel &dbmodel, const QString &name, const QStringList &columns);
+
+		/*! \brief Creates in the provided model a set of constraints and a function from attributes in the
+		 * same format returned by the catalog queries, without a database connection. The tables referenced
+		 * by the constraints are created in the model before the import */
+		void importCatalogAttributes(DatabaseModel &model, bool direct_creation);
+
+	private slots:
+		void initTestCase();
+		void directCreationMatchesXmlCreationOffline();
+		void directCreationMatchesXmlCreation();
+		void parallelImportMatchesSerialImport();
+		void benchmarkImport_data();
+		void benchmarkImport();
+};
+
+void DatabaseImportHelperTest::importDatabase(DatabaseModel &model, bool direct_creation, unsigned jobs)
+{
+	DatabaseImportHelper import_hlp;
+	Catalog catalog;
+	std::map<ObjectType, std::vector<unsigned>> obj_oids;
+	std::map<unsigned, std::vector<unsigned>> col_oids;
+	QString db_oid;
+
+	catalog.setConnection(conn);
+	catalog.setQueryFilter(Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes |
+												 Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs);
+	catalog.getObjectsOIDs(obj_oids, col_oids, {{Attributes::FilterTableTypes, Attributes::True}});
+	db_oid = catalog.getObjectOID(conn.getConnectionParam(Connection::ParamDbName), ObjectType::Database);
+	obj_oids[ObjectType::Database].push_back(db_oid.toUInt());
+	catalog.closeConnection();
+
+	import_hlp.setConnection(conn);
+	import_hlp.setImportOptions(false, false, true, false, false, false, false, false);
+	import_hlp.setDirectObjectCreation(direct_creation);
+	import_hlp.setImportJobs(jobs);
+
+	model.createSystemObjects(true);
+	import_hlp.setSelectedOIDs(&model, obj_oids, col_oids);
+	import_hlp.importDatabase();
+	import_hlp.closeConnection();
+}
+
+Table *DatabaseImportHelperTest::createTable(DatabaseModel &dbmodel, const QString &name, const QStringList &columns)
+{
+	Table *table = new Table;
+	Column *col = nullptr;
+
+	table->setName(name);
+	table->setSchema(dbmodel.getSchema("public"));
+
+	for(auto &col_name : columns)
+	{
+		col = new Column;
+		col->setName(col_name);
+		col->setType(PgSqlType("integer"));
+		table->addColumn(col);
+	}
+
+	dbmodel.addTable(table);
+	return table;
+}
+
+void DatabaseImportHelperTest::importCatalogAttributes(DatabaseModel &model, bool direct_creation)
+{
+	CatalogAttribsImportHelper import_hlp;
+	QString tab_type = QString::number(enum_t(ObjectType::Table)),
+			constr_type = QString::number(enum_t(ObjectType::Constraint)),
+			func_type = QString::number(enum_t(ObjectType::Function));
+	std::vector<attribs_map> objs_attribs;
+
+	model.createSystemObjects(true);
+	createTable(model, "ref_tab", { "id" });
+	createTable(model, "tab", { "id", "ref_id", "value" });
+
+	import_hlp.setImportOptions(false, false, false, false, false, false, false, false);
+	import_hlp.setDirectObjectCreation(direct_creation);
+	import_hlp.setSelectedOIDs(&model, {}, {});
+
+	// Dependencies as retrieved by retrieveSystemObjects()/retrieveUserObjects()
+	import_hlp.system_objs[10] = {{ Attributes::Oid, "10" }, { Attributes::Name, "postgres" },
+																{ Attributes::ObjectType, QString::number(enum_t(ObjectType::Role)) }};
+	import_hlp.system_objs[14] = {{ Attributes::Oid, "14" }, { Attributes::Name, "sql" },
+																{ Attributes::ObjectType, QString::number(enum_t(ObjectType::Language)) }};
+	import_hlp.system_objs[2200] = {{ Attributes::Oid, "2200" }, { Attributes::Name, "public" },
+																	{ Attributes::ObjectType, QString::number(enum_t(ObjectType::Schema)) }};
+	import_hlp.user_objs[16400] = {{ Attributes::Oid, "16400" }, { Attributes::Name, "ref_tab" },
+																 { Attributes::Schema, "2200" }, { Attributes::ObjectType, tab_type }};
+	import_hlp.user_objs[16401] = {{ Attributes::Oid, "16401" }, { Attributes::Name, "tab" },
+																 { Attributes::Schema, "2200" }, { Attributes::ObjectType, tab_type }};
+	import_hlp.types[23] = {{ Attributes::Oid, "23" }, { Attributes::Name, "integer" }};
+	import_hlp.columns[16400][1] = {{ Attributes::Name, "id" }};
+	import_hlp.columns[16401][1] = {{ Attributes::Name, "id" }};
+	import_hlp.columns[16401][2] = {{ Attributes::Name, "ref_id" }};
+	import_hlp.columns[16401][3] = {{ Attributes::Name, "value" }};
+	import_hlp.created_objs = { 10, 14, 2200, 16400, 16401 };
+
+	objs_attribs = {
+		{{ Attributes::Oid, "16410" }, { Attributes::ObjectType, constr_type }, { Attributes::Name, "ref_tab_pk" },
+		 { Attributes::Table, "16400" }, { Attributes::TableType, Attributes::Table }, { Attributes::Type, Attributes::PkConstr },
+		 { Attributes::SrcColumns, "{1}" }, { Attributes::DstColumns, "" }, { Attributes::RefTable, "0" },
+		 { Attributes::Tablespace, "0" }, { Attributes::Factor, "" }, { Attributes::Deferrable, "" },
+		 { Attributes::DeferType, "INITIALLY IMMEDIATE" }, { Attributes::IndexType, "btree" },
+		 { Attributes::Expressions, "PRIMARY KEY (id)" }, { Attributes::Comment, "" }},
+
+		{{ Attributes::Oid, "16411" }, { Attributes::ObjectType, constr_type }, { Attributes::Name, "tab_pk" },
+		 { Attributes::Table, "16401" }, { Attributes::TableType, Attributes::Table }, { Attributes::Type, Attributes::PkConstr },
+		 { Attributes::SrcColumns, "{1}" }, { Attributes::DstColumns, "" }, { Attributes::RefTable, "0" },
+		 { Attributes::Tablespace, "0" }, { Attributes::Factor, "{fillfactor=90}" }, { Attributes::Deferrable, "" },
+		 { Attributes::DeferType, "INITIALLY IMMEDIATE" }, { Attributes::IndexType, "btree" },
+		 { Attributes::Expressions, "PRIMARY KEY (id)" }, { Attributes::Comment, "Primary key of tab" }},
+
+		{{ Attributes::Oid, "16412" }, { Attributes::ObjectType, constr_type }, { Attributes::Name, "tab_uq" },
+		 { Attributes::Table, "16401" }, { Attributes::TableType, Attributes::Table }, { Attributes::Type, Attributes::UqConstr },
+		 { Attributes::SrcColumns, "{3,2}" }, { Attributes::DstColumns, "" }, { Attributes::RefTable, "0" },
+		 { Attributes::Tablespace, "0" }, { Attributes::Factor, "" }, { Attributes::Deferrable, Attributes::True },
+		 { Attributes::DeferType, "INITIALLY DEFERRED" }, { Attributes::IndexType, "btree" },
+		 { Attributes::NullsNotDistinct, Attributes::True }, { Attributes::Expressions, "UNIQUE NULLS NOT DISTINCT (value, ref_id)" },
+		 { Attributes::Comment, "" }},
+
+		{{ Attributes::Oid, "16413" }, { Attributes::ObjectType, constr_type }, { Attributes::Name, "tab_ck" },
+		 { Attributes::Table, "16401" }, { Attributes::TableType, Attributes::Table }, { Attributes::Type, Attributes::CkConstr },
+		 { Attributes::SrcColumns, "{3}" }, { Attributes::DstColumns, "" }, { Attributes::RefTable, "0" },
+		 { Attributes::Tablespace, "0" }, { Attributes::Factor, "" }, { Attributes::Deferrable, "" },
+		 { Attributes::DeferType, "INITIALLY IMMEDIATE" }, { Attributes::NoInherit, Attributes::True },
+		 { Attributes::Expressions, "CHECK ((value > 0))" }, { Attributes::Comment, "" }},
+
+		{{ Attributes::Oid, "16414" }, { Attributes::ObjectType, constr_type }, { Attributes::Name, "tab_fk" },
+		 { Attributes::Table, "16401" }, { Attributes::TableType, Attributes::Table }, { Attributes::Type, Attributes::FkConstr },
+		 { Attributes::SrcColumns, "{2}" }, { Attributes::DstColumns, "{1}" }, { Attributes::RefTable, "16400" },
+		 { Attributes::Tablespace, "0" }, { Attributes::Factor, "" }, { Attributes::Deferrable, Attributes::True },
+		 { Attributes::DeferType, "INITIALLY DEFERRED" }, { Attributes::ComparisonType, "MATCH FULL" },
+		 { Attributes::UpdAction, "CASCADE" }, { Attributes::DelAction, "SET NULL" },
+		 { Attributes::Expressions, "FOREIGN KEY (ref_id) REFERENCES ref_tab(id) MATCH FULL ON UPDATE CASCADE ON DELETE SET NULL DEFERRABLE INITIALLY DEFERRED" },
+		 { Attributes::Comment, "References ref_tab" }},
+
+		{{ Attributes::Oid, "16420" }, { Attributes::ObjectType, func_type }, { Attributes::Name, "sum_values" },
+		 { Attributes::Schema, "2200" }, { Attributes::Owner, "10" }, { Attributes::Language, "14" },
+		 { Attributes::ArgTypes, "{23,23}" }, { Attributes::ArgNames, "{a,b}" }, { Attributes::ArgModes, "" },
+		 { Attributes::ArgDefaults, "1" }, { Attributes::ReturnType, "23" }, { Attributes::ReturnsSetOf, "" },
+		 { Attributes::WindowFunc, "" }, { Attributes::LeakProof, Attributes::True },
+		 { Attributes::Definition, "\nSELECT a + b;\n" }, { Attributes::Library, "" },
+		 { Attributes::SecurityType, "SECURITY DEFINER" }, { Attributes::FunctionType, "IMMUTABLE" },
+		 { Attributes::BehaviorType, "RETURNS NULL ON NULL INPUT" }, { Attributes::ParallelType, "PARALLEL SAFE" },
+		 { Attributes::ExecutionCost, "10" }, { Attributes::RowAmount, "0" }, { Attributes::TransformTypes, "" },
+		 { Attributes::ConfigParams, QString("search_path=public") + UtilsNs::DataSeparator + "work_mem=64MB" },
+		 { Attributes::Comment, "Sums two values" }}
+	};
+
+	for(auto &attribs : objs_attribs)
+		import_hlp.createObject(attribs);
+}
+
+void DatabaseImportHelperTest::initTestCase()
+{
+	QString conn_info = qEnvironmentVariable("PGMODELER_TEST_CONNINFO");
+	QStringList key_val;
+
+	has_conn_info = !conn_info.isEmpty();
+
+	for(auto &param : conn_info.split(' ', Qt::SkipEmptyParts))
+	{
+		key_val = param.split('=');
+
+		if(key_val.size() == 2)
+			conn.setConnectionParam(key_val[0], key_val[1]);
+	}
+}
+
+void DatabaseImportHelperTest::directCreationMatchesXmlCreationOffline()
+{
+	DatabaseModel xml_model, direct_model;
+	PhysicalTable *xml_tab = nullptr, *direct_tab = nullptr;
+	Constraint *direct_constr = nullptr;
+	Function *xml_func = nullptr, *direct_func = nullptr;
+
+	try
+	{
+		importCatalogAttributes(xml_model, false);
+		importCatalogAttributes(direct_model, true);
+
+		for(auto &tab_name : { "public.ref_tab", "public.tab" })
+		{
+			xml_tab = xml_model.getTable(tab_name);
+			direct_tab = direct_model.getTable(tab_name);
+
+			QVERIFY(xml_tab && direct_tab);
+			QCOMPARE(direct_tab->getConstraintCount(), xml_tab->getConstraintCount());
+			QCOMPARE(direct_tab->getSourceCode(SchemaParser::XmlCode), xml_tab->getSourceCode(SchemaParser::XmlCode));
+
+			for(auto &obj : *xml_tab->getObjectList(ObjectType::Constraint))
+			{
+				direct_constr = direct_tab->getConstraint(obj->getName());
+				QVERIFY2(direct_constr, obj->getSignature().toStdString().c_str());
+				QCOMPARE(direct_constr->getSourceCode(SchemaParser::XmlCode), obj->getSourceCode(SchemaParser::XmlCode));
+				QCOMPARE(direct_constr->getSourceCode(SchemaParser::SqlCode), obj->getSourceCode(SchemaParser::SqlCode));
+			}
+		}
+
+		xml_func = xml_model.getFunction("public.sum_values(integer,integer)");
+		direct_func = direct_model.getFunction("public.sum_values(integer,integer)");
+
+		QVERIFY(xml_func && direct_func);
+		QCOMPARE(direct_func->getSourceCode(SchemaParser::XmlCode), xml_func->getSourceCode(SchemaParser::XmlCode));
+		QCOMPARE(direct_func->getSourceCode(SchemaParser::SqlCode), xml_func->getSourceCode(SchemaParser::SqlCode));
+		QCOMPARE(direct_model.getSourceCode(SchemaParser::SqlCode), xml_model.getSourceCode(SchemaParser::SqlCode));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseImportHelperTest::directCreationMatchesXmlCreation()
+{
+	if(!has_conn_info)
+		QSKIP("PGMODELER_TEST_CONNINFO is not set, skipping the import test!");
+
+	DatabaseModel xml_model, direct_model;
+	PhysicalTable *direct_tab = nullptr;
+
+	try
+	{
+		importDatabase(xml_model, false);
+		importDatabase(direct_model, true);
+
+		QCOMPARE(direct_model.getObjectCount(), xml_model.getObjectCount());
+
+		for(auto &obj : *xml_model.getObjectList(ObjectType::Table))
+		{
+			direct_tab = direct_model.getTable(obj->getSignature());
+			QVERIFY2(direct_tab, obj->getSignature().toStdString().c_str());
+			QCOMPARE(direct_tab->getSourceCode(SchemaParser::XmlCode), obj->getSourceCode(SchemaParser::XmlCode));
+		}
+
+		QCOMPARE(direct_model.getSourceCode(SchemaParser::SqlCode), xml_model.getSourceCode(SchemaParser::SqlCode));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseImportHelperTest::parallelImportMatchesSerialImport()
+{
+	if(!has_conn_info)
+		QSKIP("PGMODELER_TEST_CONNINFO is not set, skipping the import test!");
+
+	DatabaseModel serial_model, parallel_model;
+
+	try
+	{
+		importDatabase(serial_model, true);
+		importDatabase(parallel_model, true, 4);
+
+		QCOMPARE(parallel_model.getObjectCount(), serial_model.getObjectCount());
+		QCOMPARE(parallel_model.getSourceCode(SchemaParser::SqlCode), serial_model.getSourceCode(SchemaParser::SqlCode));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseImportHelperTest::benchmarkImport_data()
+{
+	QTest::addColumn<bool>("direct_creation");
+	QTest::addColumn<unsigned>("jobs");
+
+	QTest::newRow("xml creation") << false << 1u;
+	QTest::newRow("direct creation") << true << 1u;
+	QTest::newRow("direct creation, 4 jobs") << true << 4u;
+}
+
+void DatabaseImportHelperTest::benchmarkImport()
+{
+	if(!has_conn_info)
+		QSKIP("PGMODELER_TEST_CONNINFO is not set, skipping the import test!");
+
+	QFETCH(bool, direct_creation);
+	QFETCH(unsigned, jobs);
+
+	try
+	{
+		QBENCHMARK_ONCE
+		{
+			DatabaseModel model;
+			importDatabase(model, direct_creation, jobs);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(DatabaseImportHelperTest)
+#include "databaseimporthelpertest.moc"
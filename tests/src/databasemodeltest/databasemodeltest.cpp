@@ -18,6 +18,8 @@
 
 #include <QtTest/QtTest>
 #include "databasemodel.h"
+#include "utilsns.h"
+#include "defaultlanguages.h"
 #include "pgmodelerunittest.h"
 
 class DatabaseModelTest: public QObject, public PgModelerUnitTest {
@@ -26,12 +28,84 @@ class DatabaseModelTest: public QObject, public PgModelerUnitTest {
 	public:
 		DatabaseModelTest() : PgModelerUnitTest(SCHEMASDIR){}
 
+	private:
+		/*! \brief Creates chain_count chains of chain_len tables linked by 1:n relationships
+		 *  (table_N_0 -> table_N_1 -> ...) where each table has its own primary key */
+		void createRelationshipChains(DatabaseModel &dbmodel, unsigned chain_count, unsigned chain_len);
+
+		//! \brief Returns the first column added by relationship in the provided table
+		Column *getRelAddedColumn(Table *table);
+
 	private slots:
 		void saveObjectsMetadata();
 		void loadObjectsMetadata();
 		void saveSplitSQLDefinition();
+		void saveModelMatchesSourceCode();
+		void findObjectsAfterRenaming();
+		void coalesceObjectModifications();
+		void benchmarkModelCodeGeneration();
+		void revalidateOnlyAffectedRelationships();
+		void benchmarkSingleEditRevalidation_data();
+		void benchmarkSingleEditRevalidation();
+		void benchmarkRemoveTables();
 };
 
+void DatabaseModelTest::createRelationshipChains(DatabaseModel &dbmodel, unsigned chain_count, unsigned chain_len)
+{
+	Schema *public_sch = nullptr;
+	Table *table = nullptr, *prev_table = nullptr;
+	Column *col = nullptr;
+	Constraint *pk = nullptr;
+	Relationship *rel = nullptr;
+
+	dbmodel.createSystemObjects(false);
+	public_sch = dbmodel.getSchema("public");
+
+	for(unsigned chain = 0; chain < chain_count; chain++)
+	{
+		prev_table = nullptr;
+
+		for(unsigned pos = 0; pos < chain_len; pos++)
+		{
+			table = new Table;
+			table->setName(QString("table_%1_%2").arg(chain).arg(pos));
+			table->setSchema(public_sch);
+
+			col = new Column;
+			col->setName("id");
+			col->setType(PgSqlType("integer"));
+			table->addColumn(col);
+
+			pk = new Constraint;
+			pk->setName(QString("table_%1_%2_pk").arg(chain).arg(pos));
+			pk->setConstraintType(ConstraintType::PrimaryKey);
+			pk->addColumn(col, Constraint::SourceCols);
+			table->addConstraint(pk);
+
+			dbmodel.addTable(table);
+
+			if(prev_table)
+			{
+				rel = new Relationship(BaseRelationship::Relationship1n, prev_table, table);
+				dbmodel.addRelationship(rel);
+			}
+
+			prev_table = table;
+		}
+	}
+}
+
+Column *DatabaseModelTest::getRelAddedColumn(Table *table)
+{
+	for(auto &obj : *table->getObjectList(ObjectType::Column))
+	{
+		if(obj->isAddedByRelationship())
+			return dynamic_cast<Column *>(obj);
+	}
+
+	return nullptr;
+}
+
 void DatabaseModelTest::saveObjectsMetadata()
 {
 	DatabaseModel dbmodel;
@@ -101,5 +175,297 @@ void DatabaseModelTest::saveSplitSQLDefinition()
 	}
 }
 
+void DatabaseModelTest::saveModelMatchesSourceCode()
+{
+	DatabaseModel dbmodel;
+	QTextStream out(stdout);
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + QString("demo_saved"),
+			input_dbm=SAMPLESDIR + GlobalAttributes::DirSeparator + QString("demo.dbm");
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input_dbm);
+
+		for(auto def_type : { SchemaParser::XmlCode, SchemaParser::SqlCode })
+		{
+			dbmodel.saveModel(output, def_type);
+			QCOMPARE(UtilsNs::loadFile(output), dbmodel.getSourceCode(def_type).toUtf8());
+		}
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void DatabaseModelTest::findObjectsAfterRenaming()
+{
+	DatabaseModel dbmodel;
+	Schema *schema = new Schema;
+	Table *table = new Table;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		schema->setName("schema_a");
+		dbmodel.addSchema(schema);
+
+		table->setName("table_a");
+		table->setSchema(schema);
+		dbmodel.addTable(table);
+
+		QCOMPARE(dbmodel.getTable("schema_a.table_a"), table);
+		QCOMPARE(dbmodel.getTable("\"schema_a\".\"table_a\""), table);
+		QCOMPARE(dbmodel.getTable("table_a"), table);
+
+		// Renaming the table must reflect in the searches by name/signature
+		table->setName("table_b");
+		QVERIFY(dbmodel.getTable("schema_a.table_a") == nullptr);
+		QCOMPARE(dbmodel.getTable("schema_a.table_b"), table);
+
+		// Renaming the schema must reflect in the signatures of its children
+		schema->setName("schema_b");
+		QCOMPARE(dbmodel.getSchema("schema_b"), schema);
+		QVERIFY(dbmodel.getTable("schema_a.table_b") == nullptr);
+		QCOMPARE(dbmodel.getTable("schema_b.table_b"), table);
+
+		dbmodel.removeTable(table);
+		QVERIFY(dbmodel.getTable("schema_b.table_b") == nullptr);
+		QCOMPARE(dbmodel.getObjectIndex(table), -1);
+		delete table;
+
+		// Removing the schema of an extension must reflect in its signature
+		Extension *extension = new Extension;
+		extension->setName("ext_a");
+		extension->setSchema(schema);
+		dbmodel.addExtension(extension);
+		QCOMPARE(dbmodel.getExtension("schema_b.ext_a"), extension);
+
+		extension->setSchema(nullptr);
+		QVERIFY(dbmodel.getExtension("schema_b.ext_a") == nullptr);
+		QCOMPARE(dbmodel.getExtension("ext_a"), extension);
+
+		// Changing the parameters of a function must reflect in its signature
+		Function *func = new Function;
+		func->setName("func_a");
+		func->setSchema(schema);
+		func->setLanguage(dbmodel.getLanguage(DefaultLanguages::Sql));
+		func->setReturnType(PgSqlType("integer"));
+		func->setFunctionSource("select 1;");
+		dbmodel.addFunction(func);
+		QCOMPARE(dbmodel.getFunction("schema_b.func_a()"), func);
+
+		func->addParameter(Parameter("param1", PgSqlType("integer")));
+		QVERIFY(dbmodel.getFunction("schema_b.func_a()") == nullptr);
+		QCOMPARE(dbmodel.getFunction("schema_b.func_a(integer)"), func);
+
+		// Copies of an object (e.g. the ones in the operation list) must not touch the names index
+		Function func_copy(*func);
+		func_copy.setName("func_copy");
+		QCOMPARE(dbmodel.getFunction("schema_b.func_a(integer)"), func);
+		QVERIFY(dbmodel.getFunction("schema_b.func_copy(integer)") == nullptr);
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::coalesceObjectModifications()
+{
+	DatabaseModel dbmodel;
+	Schema *schema = new Schema;
+	Table *table = new Table;
+	std::vector<BaseObject *> modified;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		schema->setName("schema_a");
+		dbmodel.addSchema(schema);
+
+		table->setName("table_a");
+		table->setSchema(schema);
+		dbmodel.addTable(table);
+
+		connect(&dbmodel, &DatabaseModel::s_objectModified, this, [&modified](BaseObject *object) {
+			modified.push_back(object);
+		});
+
+		QCoreApplication::processEvents();
+		modified.clear();
+
+		// Moving the table several times (like dragging it in the canvas) is notified once in the next event loop pass
+		for(int pos = 0; pos < 10; pos++)
+			table->setPosition(QPointF(pos, pos));
+
+		QVERIFY(modified.empty());
+		QCoreApplication::processEvents();
+		QCOMPARE(modified.size(), static_cast<size_t>(1));
+		QVERIFY(modified.front() == table);
+
+		// The pending notifications can be delivered right away
+		table->setPosition(QPointF(100, 100));
+		dbmodel.notifyModifiedObjects();
+		QCOMPARE(modified.size(), static_cast<size_t>(2));
+		QCoreApplication::processEvents();
+		QCOMPARE(modified.size(), static_cast<size_t>(2));
+
+		// Objects removed from the model before the notification are not notified
+		table->setPosition(QPointF(200, 200));
+		dbmodel.removeTable(table);
+		QCoreApplication::processEvents();
+		QVERIFY(std::find(modified.begin() + 2, modified.end(), table) == modified.end());
+		delete table;
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::benchmarkModelCodeGeneration()
+{
+	DatabaseModel dbmodel;
+	QString input_dbm=SAMPLESDIR + GlobalAttributes::DirSeparator + QString("demo.dbm");
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input_dbm);
+
+		/* Invalidating the cached code of all objects on each iteration
+		 * so the whole model is generated again (simulating save + export) */
+		QBENCHMARK
+		{
+			dbmodel.setCodesInvalidated();
+			dbmodel.getSourceCode(SchemaParser::XmlCode);
+			dbmodel.getSourceCode(SchemaParser::SqlCode);
+		}
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::revalidateOnlyAffectedRelationships()
+{
+	DatabaseModel dbmodel;
+
+	try
+	{
+		Column *untouched_col = nullptr;
+
+		createRelationshipChains(dbmodel, 2, 3);
+		untouched_col = getRelAddedColumn(dbmodel.getTable("public.table_1_1"));
+		QVERIFY(untouched_col != nullptr);
+
+		dbmodel.getTable("public.table_0_0")->getColumn("id")->setName("code");
+		QVERIFY(dbmodel.validateRelationships());
+
+		// The change must be propagated to the whole chain of affected tables
+		QVERIFY(getRelAddedColumn(dbmodel.getTable("public.table_0_1"))->getName().startsWith("code"));
+		QVERIFY(getRelAddedColumn(dbmodel.getTable("public.table_0_2")) != nullptr);
+		QVERIFY(!dbmodel.hasInvalidRelatioships());
+
+		// Relationships in the unaffected chain must not be disconnected/reconnected
+		QCOMPARE(getRelAddedColumn(dbmodel.getTable("public.table_1_1")), untouched_col);
+
+		// Nothing left to validate
+		QVERIFY(!dbmodel.validateRelationships());
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::benchmarkSingleEditRevalidation_data()
+{
+	QTest::addColumn<unsigned>("chain_count");
+
+	QTest::newRow("300 relationships") << 100u;
+	QTest::newRow("3000 relationships") << 1000u;
+}
+
+void DatabaseModelTest::benchmarkSingleEditRevalidation()
+{
+	QFETCH(unsigned, chain_count);
+
+	DatabaseModel dbmodel;
+	Column *pk_col = nullptr;
+	unsigned edit = 0;
+
+	try
+	{
+		createRelationshipChains(dbmodel, chain_count, 4);
+		pk_col = dbmodel.getTable("public.table_0_0")->getColumn("id");
+
+		// Measures the latency of renaming a single primary key column and revalidating the model
+		QBENCHMARK
+		{
+			pk_col->setName(QString("id_%1").arg(edit++));
+			dbmodel.validateRelationships();
+		}
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::benchmarkRemoveTables()
+{
+	DatabaseModel dbmodel;
+	Schema *public_sch = nullptr;
+	Role *owner = new Role;
+	Table *table = nullptr;
+	std::vector<Table *> tables;
+	size_t sch_refs = 0;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		public_sch = dbmodel.getSchema("public");
+		sch_refs = public_sch->getReferences().size();
+
+		owner->setName("owner");
+		dbmodel.addRole(owner);
+
+		/* All the tables reference the same schema and owner, so each removal
+		 * unsets a reference from two objects with thousands of references */
+		for(unsigned idx = 0; idx < 10000; idx++)
+		{
+			table = new Table;
+			table->setName(QString("table_%1").arg(idx));
+			table->setSchema(public_sch);
+			table->setOwner(owner);
+			dbmodel.addTable(table);
+			tables.push_back(table);
+		}
+
+		QBENCHMARK_ONCE
+		{
+			for(auto &tab : tables)
+			{
+				dbmodel.removeTable(tab);
+				delete tab;
+			}
+		}
+
+		QCOMPARE(public_sch->getReferences().size(), sch_refs);
+		QVERIFY(!owner->isReferenced());
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(DatabaseModelTest)
 #include "databasemodeltest.moc"
@@ -0,0 +1,161 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "exception.h"
+
+class ExceptionTest: public QObject {
+	Q_OBJECT
+
+	private:
+		//! \brief Raises an exception rethrown by each one of the recursive calls
+		void raiseNestedException(int depth);
+
+	private slots:
+		void testKeepStackWhenRethrown();
+		void testKeepStackOrderFromExceptionsList();
+		void testTranslateDefaultMessageOnDemand();
+		void testCopyNonLiteralMethodAndFile();
+		void benchmarkRethrowNestedExceptions();
+};
+
+void ExceptionTest::raiseNestedException(int depth)
+{
+	try
+	{
+		if(depth == 0)
+			throw Exception(ErrorCode::AsgNotAllocattedObject, __exc_origin, nullptr, "root");
+
+		raiseNestedException(depth - 1);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__exc_origin, &e);
+	}
+}
+
+void ExceptionTest::testKeepStackWhenRethrown()
+{
+	try
+	{
+		raiseNestedException(10);
+		QFAIL("No exception raised!");
+	}
+	catch(Exception &e)
+	{
+		std::vector<Exception> list;
+
+		e.getExceptionsList(list);
+		QCOMPARE(list.size(), static_cast<size_t>(12));
+		QCOMPARE(list.front().getExtraInfo(), "root");
+		QCOMPARE(list.back().getLine(), e.getLine());
+		QCOMPARE(e.getExceptiosExtraInfo(), "root");
+
+		for(auto &ex : list)
+		{
+			QCOMPARE(ex.getErrorCode(), ErrorCode::AsgNotAllocattedObject);
+			QCOMPARE(ex.getFile(), QString(__FILE__));
+		}
+	}
+}
+
+void ExceptionTest::testKeepStackOrderFromExceptionsList()
+{
+	std::vector<Exception> errors, list;
+	Exception first("first", __exc_origin),
+			second("second", __exc_origin, &first),
+			third("third", __exc_origin);
+
+	errors.push_back(second);
+	errors.push_back(third);
+
+	Exception e("last", __exc_origin, errors);
+	e.getExceptionsList(list);
+
+	QCOMPARE(list.size(), static_cast<size_t>(4));
+	QCOMPARE(list[0].getErrorMessage(), "first");
+	QCOMPARE(list[1].getErrorMessage(), "second");
+	QCOMPARE(list[2].getErrorMessage(), "third");
+	QCOMPARE(list[3].getErrorMessage(), "last");
+
+	// The exceptions added to the stack of the last one must remain untouched
+	second.getExceptionsList(list);
+	QCOMPARE(list.size(), static_cast<size_t>(2));
+}
+
+void ExceptionTest::testTranslateDefaultMessageOnDemand()
+{
+	Exception e(ErrorCode::AsgNotAllocattedObject, __exc_origin);
+
+	QCOMPARE(e.getErrorMessage(), Exception::getErrorMessage(ErrorCode::AsgNotAllocattedObject));
+	QCOMPARE(e.getMethod(), QString(__PRETTY_FUNCTION__));
+
+	// A rethrown exception shares the default message of the cause while a custom one is kept
+	Exception rethrown(e.getErrorMessage(), e.getErrorCode(), __exc_origin, &e),
+			custom("custom message", e.getErrorCode(), __exc_origin, &e);
+
+	QCOMPARE(rethrown.getErrorMessage(), e.getErrorMessage());
+	QCOMPARE(custom.getErrorMessage(), "custom message");
+}
+
+void ExceptionTest::testCopyNonLiteralMethodAndFile()
+{
+	Exception *e = nullptr;
+
+	{
+		QString method = "QString method", file = "qstring_file.cpp";
+		std::string buffer = "buffer_file.cpp";
+		char array[] = "array_method";
+
+		// The strings provided here are released before the exception is used
+		Exception ex_str("error", ErrorCode::Custom, method, file, 10),
+				ex_buf("error", ErrorCode::Custom, method, buffer.c_str(), 20, &ex_str),
+				ex_arr("error", ErrorCode::Custom, array, buffer.c_str(), 30, &ex_buf);
+
+		e = new Exception(ex_arr);
+	}
+
+	std::vector<Exception> list;
+	e->getExceptionsList(list);
+
+	QCOMPARE(list.size(), static_cast<size_t>(3));
+	QCOMPARE(list[0].getMethod(), "QString method");
+	QCOMPARE(list[0].getFile(), "qstring_file.cpp");
+	QCOMPARE(list[1].getFile(), "buffer_file.cpp");
+	QCOMPARE(list[2].getMethod(), "array_method");
+	delete e;
+}
+
+void ExceptionTest::benchmarkRethrowNestedExceptions()
+{
+	QBENCHMARK
+	{
+		for(int i = 0; i < 100; i++)
+		{
+			try
+			{
+				raiseNestedException(30);
+			}
+			catch(Exception &)
+			{}
+		}
+	}
+}
+
+QTEST_MAIN(ExceptionTest)
+#include "exceptiontest.moc"
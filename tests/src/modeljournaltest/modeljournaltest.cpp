@@ -0,0 +1,113 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "modeljournal.h"
+#include "pgmodelerunittest.h"
+
+class ModelJournalTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		ModelJournalTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void replayJournalAfterChanges();
+		void lockJournalWhileInUse();
+};
+
+void ModelJournalTest::replayJournalAfterChanges()
+{
+	DatabaseModel dbmodel;
+	QTextStream out(stdout);
+	QString journal_file=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + QString("demo.dbm.journal"),
+			input_dbm=SAMPLESDIR + GlobalAttributes::DirSeparator + QString("demo.dbm");
+
+	try
+	{
+		QFile::remove(journal_file);
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input_dbm);
+
+		{
+			ModelJournal journal(&dbmodel, journal_file);
+			Schema *schema = new Schema;
+			Table *table = dbmodel.getTable(0);
+			BaseObject *textbox = dbmodel.getTextbox(0);
+
+			// The first flush writes the snapshot, the second one appends only the changes
+			journal.flush();
+
+			schema->setName("journal_schema");
+			dbmodel.addSchema(schema);
+			table->setName(table->getName() + "_renamed");
+
+			dbmodel.removeObject(textbox);
+
+			journal.setChanged();
+			journal.flush();
+			delete textbox;
+
+			// The changes in the objects (including the children of tables) are tracked by the journal itself
+			Column *column = new Column;
+			column->setName("journal_column");
+			column->setType(PgSqlType("integer"));
+			table->addColumn(column);
+			schema->setComment("journal schema");
+
+			QVERIFY(journal.isChanged());
+			journal.flush();
+			QVERIFY(!journal.isChanged());
+		}
+
+		QCOMPARE(ModelJournal::replay(journal_file), dbmodel.getSourceCode(SchemaParser::XmlCode));
+
+		// A record partially written at the end of the journal must be ignored
+		QFile file(journal_file);
+		file.open(QFile::WriteOnly | QFile::Append);
+		file.write(QByteArray::fromHex("000000ff0102"));
+		file.close();
+
+		QCOMPARE(ModelJournal::replay(journal_file), dbmodel.getSourceCode(SchemaParser::XmlCode));
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void ModelJournalTest::lockJournalWhileInUse()
+{
+	DatabaseModel dbmodel;
+	QString journal_file=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + QString("lock.dbm.journal");
+
+	{
+		ModelJournal journal(&dbmodel, journal_file);
+
+		// The lock held by the current process doesn't make the journal in use by another instance
+		QVERIFY(QFileInfo::exists(ModelJournal::getLockFilename(journal_file)));
+		QVERIFY(!ModelJournal::isInUse(journal_file));
+	}
+
+	QVERIFY(!QFileInfo::exists(ModelJournal::getLockFilename(journal_file)));
+	QVERIFY(!ModelJournal::isInUse(journal_file));
+}
+
+QTEST_MAIN(ModelJournalTest)
+#include "modeljournaltest.moc"
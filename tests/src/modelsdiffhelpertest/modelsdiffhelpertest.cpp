@@ -0,0 +1,215 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "databasemodel.h"
+#include "tools/modelsdiffhelper.h"
+#include "pgmodelerunittest.h"
+
+class ModelsDiffHelperTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		ModelsDiffHelperTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private:
+		/*! \brief Creates tab_count tables in the model spread over schema_count schemas (the first one
+		 *  being the public schema). The tables with index greater or equal to changed_from receive a comment
+		 *  so they differ from the ones created in other model with the same parameters but different changed_from */
+		void createTables(DatabaseModel &model, int tab_count, int changed_from, int schema_count = 1);
+
+		/*! \brief Generates the diff between two models with several schemas using the provided number of jobs
+		 *  returning the generated code. The diff infos are stored in the form "type:signature" in the infos list */
+		QString generateDiff(unsigned jobs, QStringList &infos);
+
+	private slots:
+		void generateDiffForNewAndChangedTables();
+		void parallelDiffMatchesSerialDiff();
+		void benchmarkDiffGeneration_data();
+		void benchmarkDiffGeneration();
+};
+
+void ModelsDiffHelperTest::createTables(DatabaseModel &model, int tab_count, int changed_from, int schema_count)
+{
+	std::vector<Schema *> schemas;
+	Schema *schema = nullptr;
+	Table *table = nullptr;
+	Column *column = nullptr;
+
+	model.createSystemObjects(true);
+	schemas.push_back(model.getSchema("public"));
+
+	for(int i = 1; i < schema_count; i++)
+	{
+		schema = new Schema;
+		schema->setName(QString("schema_%1").arg(i));
+		model.addSchema(schema);
+		schemas.push_back(schema);
+	}
+
+	for(int i = 0; i < tab_count; i++)
+	{
+		table = new Table;
+		table->setName(QString("table_%1").arg(i));
+		table->setSchema(schemas[i % schemas.size()]);
+
+		column = new Column;
+		column->setName("id");
+		column->setType(PgSqlType("integer"));
+		table->addColumn(column);
+
+		if(i >= changed_from)
+			table->setComment("changed table");
+
+		model.addTable(table);
+	}
+}
+
+void ModelsDiffHelperTest::generateDiffForNewAndChangedTables()
+{
+	DatabaseModel src_model, imp_model;
+	ModelsDiffHelper diff_hlp;
+	unsigned created = 0, altered = 0;
+
+	try
+	{
+		// 10 tables in the model: 5 missing in the database, 2 with different comments
+		createTables(src_model, 10, 3);
+		createTables(imp_model, 5, 5);
+
+		connect(&diff_hlp, &ModelsDiffHelper::s_objectsDiffInfoGenerated, this, [&](ObjectsDiffInfo diff_info){
+			if(diff_info.getObject()->getObjectType() != ObjectType::Table)
+				return;
+
+			if(diff_info.getDiffType() == ObjectsDiffInfo::CreateObject)
+				created++;
+			else if(diff_info.getDiffType() == ObjectsDiffInfo::AlterObject)
+				altered++;
+		});
+
+		diff_hlp.setModels(&src_model, &imp_model);
+		diff_hlp.diffModels();
+
+		QCOMPARE(created, 5u);
+		QCOMPARE(altered, 2u);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QString ModelsDiffHelperTest::generateDiff(unsigned jobs, QStringList &infos)
+{
+	DatabaseModel src_model, imp_model;
+	ModelsDiffHelper diff_hlp;
+	Column *column = nullptr;
+	QString diff_def;
+	int i = 0;
+
+	// 60 tables in 4 schemas: 20 missing in the database, 20 with different comments
+	createTables(src_model, 60, 20, 4);
+	createTables(imp_model, 40, 40, 4);
+
+	// Every third table in the model also gets a new column
+	for(auto &obj : *src_model.getObjectList(ObjectType::Table))
+	{
+		if(i++ % 3 != 0)
+			continue;
+
+		column = new Column;
+		column->setName("description");
+		column->setType(PgSqlType("text"));
+		dynamic_cast<Table *>(obj)->addColumn(column);
+	}
+
+	connect(&diff_hlp, &ModelsDiffHelper::s_objectsDiffInfoGenerated, this, [&infos](ObjectsDiffInfo diff_info){
+		infos.append(QString("%1:%2").arg(diff_info.getDiffTypeString(), diff_info.getObject()->getSignature()));
+	});
+
+	connect(&diff_hlp, &ModelsDiffHelper::s_diffAborted, this, [](Exception e){
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	});
+
+	diff_hlp.setModels(&src_model, &imp_model);
+	diff_hlp.setParallelJobs(jobs);
+	diff_hlp.diffModels();
+
+	// The generation date in the header is the only expected difference between two runs
+	diff_def = diff_hlp.getDiffDefinition();
+	diff_def.remove(QRegularExpression("\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}"));
+
+	return diff_def;
+}
+
+void ModelsDiffHelperTest::parallelDiffMatchesSerialDiff()
+{
+	QStringList serial_infos, parallel_infos;
+	QString serial_diff, parallel_diff;
+
+	try
+	{
+		serial_diff = generateDiff(1, serial_infos);
+		parallel_diff = generateDiff(4, parallel_infos);
+
+		QVERIFY(!serial_diff.isEmpty());
+		QVERIFY(!serial_infos.isEmpty());
+		QCOMPARE(parallel_infos, serial_infos);
+		QCOMPARE(parallel_diff, serial_diff);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelsDiffHelperTest::benchmarkDiffGeneration_data()
+{
+	QTest::addColumn<int>("changes");
+
+	QTest::newRow("1k changes") << 1000;
+	QTest::newRow("10k changes") << 10000;
+	QTest::newRow("50k changes") << 50000;
+}
+
+void ModelsDiffHelperTest::benchmarkDiffGeneration()
+{
+	QFETCH(int, changes);
+
+	DatabaseModel src_model, imp_model;
+	ModelsDiffHelper diff_hlp;
+
+	try
+	{
+		// Half of the changes are new tables and the other half are changed tables
+		createTables(src_model, changes, changes / 4);
+		createTables(imp_model, changes / 2, changes / 2);
+		diff_hlp.setModels(&src_model, &imp_model);
+
+		QBENCHMARK_ONCE {
+			diff_hlp.diffModels();
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ModelsDiffHelperTest)
+#include "modelsdiffhelpertest.moc"
@@ -0,0 +1,157 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+#include <QtTest/QtTest>
+#include <QPainter>
+#include <cmath>
+#include "objectsscene.h"
+#include "tableview.h"
+#include "schema.h"
+#include "pgmodelerunittest.h"
+
+class ObjectsSceneTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		ObjectsSceneTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private:
+		/*! \brief Creates tab_count tables (with col_count columns each) placed in a grid
+		 *  and adds their graphical representations to the provided scene */
+		void createTablesGrid(ObjectsScene *scene, Schema *schema, std::vector<Table *> &tables,
+													unsigned tab_count, unsigned col_count);
+
+		void destroyTablesGrid(ObjectsScene *scene, std::vector<Table *> &tables);
+
+	private slots:
+		void detailLevelMatchesThresholds();
+		void benchmarkPanningLargeScene_data();
+		void benchmarkPanningLargeScene();
+};
+
+void ObjectsSceneTest::createTablesGrid(ObjectsScene *scene, Schema *schema, std::vector<Table *> &tables, unsigned tab_count, unsigned col_count)
+{
+	Table *table = nullptr;
+	Column *col = nullptr;
+	unsigned grid_cols = std::ceil(std::sqrt(tab_count));
+
+	for(unsigned tab_id = 0; tab_id < tab_count; tab_id++)
+	{
+		table = new Table;
+		table->setName(QString("table_%1").arg(tab_id));
+		table->setSchema(schema);
+		table->setPosition(QPointF((tab_id % grid_cols) * 250, (tab_id / grid_cols) * 250));
+
+		for(unsigned col_id = 0; col_id < col_count; col_id++)
+		{
+			col = new Column;
+			col->setName(QString("column_%1").arg(col_id));
+			col->setType(PgSqlType("varchar", 0, 128));
+			table->addColumn(col);
+		}
+
+		tables.push_back(table);
+		scene->addItem(new TableView(table));
+	}
+}
+
+void ObjectsSceneTest::destroyTablesGrid(ObjectsScene *scene, std::vector<Table *> &tables)
+{
+	// The scene must be destroyed first since the views reference the tables
+	delete scene;
+
+	for(auto &table : tables)
+		delete table;
+
+	tables.clear();
+}
+
+void ObjectsSceneTest::detailLevelMatchesThresholds()
+{
+	double medium = BaseObjectView::getDetailLevelThreshold(BaseObjectView::MediumDetail),
+			full = BaseObjectView::getDetailLevelThreshold(BaseObjectView::FullDetail);
+
+	QVERIFY(medium < full);
+	QVERIFY(BaseObjectView::getDetailLevel(1) == BaseObjectView::FullDetail);
+	QVERIFY(BaseObjectView::getDetailLevel(full) == BaseObjectView::FullDetail);
+	QVERIFY(BaseObjectView::getDetailLevel((medium + full) / 2) == BaseObjectView::MediumDetail);
+	QVERIFY(BaseObjectView::getDetailLevel(medium / 2) == BaseObjectView::MinimumDetail);
+
+	// Disabling the level of detail always produces full detail rendering
+	BaseObjectView::setLevelOfDetailEnabled(false);
+	QVERIFY(BaseObjectView::getDetailLevel(medium / 2) == BaseObjectView::FullDetail);
+	BaseObjectView::setLevelOfDetailEnabled(true);
+}
+
+void ObjectsSceneTest::benchmarkPanningLargeScene_data()
+{
+	QTest::addColumn<bool>("lod_enabled");
+
+	QTest::newRow("full detail") << false;
+	QTest::newRow("level of detail") << true;
+}
+
+void ObjectsSceneTest::benchmarkPanningLargeScene()
+{
+	QFETCH(bool, lod_enabled);
+
+	ObjectsScene *scene = new ObjectsScene;
+	std::vector<Table *> tables;
+	Schema schema;
+	QImage frame(1280, 800, QImage::Format_ARGB32_Premultiplied);
+	QRectF view_rect;
+	QPainter painter;
+	double zoom = 0.15;
+	unsigned step = 0;
+
+	try
+	{
+		schema.setName("public");
+		createTablesGrid(scene, &schema, tables, 5000, 8);
+		BaseObjectView::setLevelOfDetailEnabled(lod_enabled);
+
+		// The viewport in scene coordinates for the zoom factor above
+		view_rect.setSize(QSizeF(frame.width() / zoom, frame.height() / zoom));
+
+		/* Measures the time to render a single frame of the scene
+		 * while the viewport pans diagonally over the table grid */
+		QBENCHMARK
+		{
+			view_rect.moveTopLeft(QPointF((step % 10) * 500, (step % 10) * 250));
+			step++;
+
+			frame.fill(Qt::white);
+			painter.begin(&frame);
+			painter.setRenderHint(QPainter::Antialiasing, true);
+			painter.setRenderHint(QPainter::TextAntialiasing, true);
+			scene->render(&painter, frame.rect(), view_rect);
+			painter.end();
+		}
+
+		BaseObjectView::setLevelOfDetailEnabled(true);
+		destroyTablesGrid(scene, tables);
+	}
+	catch (Exception &e)
+	{
+		BaseObjectView::setLevelOfDetailEnabled(true);
+		destroyTablesGrid(scene, tables);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ObjectsSceneTest)
+#include "objectsscenetest.moc"
@@ -0,0 +1,301 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "utils/objectstreemodel.h"
+#include "pgmodelerunittest.h"
+
+class ObjectsTreeModelTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		ObjectsTreeModelTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private:
+		//! \brief Loads the demo model and attaches it to the tree model with all object types visible
+		void loadDemoModel(DatabaseModel &dbmodel, ObjectsTreeModel &tree_mdl);
+
+		//! \brief Returns the index of the child item of the provided node and object types, creating the children if needed
+		QModelIndex getChildIndex(ObjectsTreeModel &tree_mdl, const QModelIndex &parent,
+															ObjectsTreeModel::NodeType node_type, ObjectType obj_type);
+
+		//! \brief Creates a table with the provided columns in the public schema of the model
+		Table *createTable(DatabaseModel &dbmodel, const QString &name, const QStringList &columns);
+
+	private slots:
+		void syncInsertedAndRemovedObjects();
+		void syncRenamedObject();
+		void filterObjectsAndGroups();
+		void filterAddedAndModifiedObjects();
+		void syncCollapsedItems();
+};
+
+void ObjectsTreeModelTest::loadDemoModel(DatabaseModel &dbmodel, ObjectsTreeModel &tree_mdl)
+{
+	std::map<ObjectType, bool> visible_objs;
+
+	for(auto &type : BaseObject::getObjectTypes(true))
+		visible_objs[type] = true;
+
+	dbmodel.createSystemObjects(false);
+	dbmodel.loadModel(QString(SAMPLESDIR) + "/demo.dbm");
+	tree_mdl.setDatabaseModel(&dbmodel);
+	tree_mdl.setObjectsVisible(visible_objs);
+}
+
+QModelIndex ObjectsTreeModelTest::getChildIndex(ObjectsTreeModel &tree_mdl, const QModelIndex &parent,
+																								ObjectsTreeModel::NodeType node_type, ObjectType obj_type)
+{
+	QModelIndex index;
+
+	if(tree_mdl.canFetchMore(parent))
+		tree_mdl.fetchMore(parent);
+
+	for(int row = 0; row < tree_mdl.rowCount(parent); row++)
+	{
+		index = tree_mdl.index(row, 0, parent);
+
+		if(index.data(ObjectsTreeModel::NodeTypeRole).toUInt() == node_type &&
+			 index.data(ObjectsTreeModel::ObjectTypeRole).toUInt() == enum_t(obj_type))
+			return index;
+	}
+
+	return QModelIndex();
+}
+
+Table *ObjectsTreeModelTest::createTable(DatabaseModel &dbmodel, const QString &name, const QStringList &columns)
+{
+	Table *table = new Table;
+	Column *col = nullptr;
+
+	table->setName(name);
+	table->setSchema(dbmodel.getSchema("public"));
+
+	for(auto &col_name : columns)
+	{
+		col = new Column;
+		col->setName(col_name);
+		col->setType(PgSqlType("integer"));
+		table->addColumn(col);
+	}
+
+	dbmodel.addTable(table);
+	return table;
+}
+
+void ObjectsTreeModelTest::syncInsertedAndRemovedObjects()
+{
+	DatabaseModel dbmodel;
+	ObjectsTreeModel tree_mdl;
+	Table *table = nullptr;
+
+	try
+	{
+		loadDemoModel(dbmodel, tree_mdl);
+
+		Schema *schema = dbmodel.getSchema("public");
+		QPersistentModelIndex grp_idx = getChildIndex(tree_mdl, tree_mdl.revealObject(schema),
+																									ObjectsTreeModel::GroupNode, ObjectType::Table);
+		int row_count = tree_mdl.rowCount(grp_idx);
+
+		QVERIFY(grp_idx.isValid());
+		QCOMPARE(static_cast<size_t>(row_count), dbmodel.getObjects(ObjectType::Table, schema).size());
+
+		table = createTable(dbmodel, "new_table", { "id" });
+		QCOMPARE(tree_mdl.rowCount(grp_idx), row_count + 1);
+		QVERIFY(tree_mdl.getIndex(table).isValid());
+		QVERIFY(grp_idx.data(Qt::DisplayRole).toString().endsWith(QString("(%1)").arg(row_count + 1)));
+
+		dbmodel.removeTable(table);
+		QCOMPARE(tree_mdl.rowCount(grp_idx), row_count);
+		QVERIFY(!tree_mdl.getIndex(table).isValid());
+		QVERIFY(grp_idx.data(Qt::DisplayRole).toString().endsWith(QString("(%1)").arg(row_count)));
+
+		delete table;
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ObjectsTreeModelTest::syncRenamedObject()
+{
+	DatabaseModel dbmodel;
+	ObjectsTreeModel tree_mdl;
+
+	try
+	{
+		loadDemoModel(dbmodel, tree_mdl);
+
+		Table *table = dbmodel.getTable(0U);
+		QModelIndex index = tree_mdl.revealObject(table);
+
+		QVERIFY(index.isValid());
+
+		table->setName("aaa_renamed_table");
+		tree_mdl.updateModel();
+		index = tree_mdl.getIndex(table);
+
+		QVERIFY(index.isValid());
+		QCOMPARE(index.data(Qt::DisplayRole).toString(), QString("aaa_renamed_table"));
+
+		//The items are kept sorted by their texts after the renaming
+		QCOMPARE(index.row(), 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ObjectsTreeModelTest::filterObjectsAndGroups()
+{
+	DatabaseModel dbmodel;
+	ObjectsTreeModel tree_mdl;
+
+	try
+	{
+		loadDemoModel(dbmodel, tree_mdl);
+
+		Schema *schema = dbmodel.getSchema("public");
+		BaseTable *table = dbmodel.getObjects(ObjectType::Table, schema).size() > 0 ?
+												 dynamic_cast<BaseTable *>(dbmodel.getObjects(ObjectType::Table, schema).front()) : nullptr;
+		std::vector<BaseObject *> matches;
+		QModelIndex sch_idx;
+
+		QVERIFY(table);
+
+		// Filtering by the object's name
+		tree_mdl.setFilter(table->getName(), false);
+		matches = tree_mdl.getFilterMatches();
+		sch_idx = tree_mdl.revealObject(schema);
+
+		QVERIFY(std::find(matches.begin(), matches.end(), table) != matches.end());
+		QVERIFY(tree_mdl.revealObject(table).isValid());
+		QVERIFY(tree_mdl.isFilterPath(sch_idx));
+		QVERIFY(!getChildIndex(tree_mdl, sch_idx, ObjectsTreeModel::GroupNode, ObjectType::Function).isValid());
+
+		// Narrowing down the filter keeps only the objects matching the longer pattern
+		tree_mdl.setFilter(table->getName() + "_no_match", false);
+		QVERIFY(tree_mdl.getFilterMatches().empty());
+
+		// Filtering by the name of a group lists the group even if none of its objects match
+		tree_mdl.setFilter(BaseObject::getTypeName(ObjectType::Function), false);
+		sch_idx = tree_mdl.revealObject(schema);
+
+		QVERIFY(tree_mdl.isFilterPath(sch_idx));
+		QVERIFY(getChildIndex(tree_mdl, sch_idx, ObjectsTreeModel::GroupNode, ObjectType::Function).isValid());
+		QVERIFY(!getChildIndex(tree_mdl, sch_idx, ObjectsTreeModel::GroupNode, ObjectType::Sequence).isValid());
+
+		// Clearing the filter restores all the groups
+		tree_mdl.setFilter("", false);
+		sch_idx = tree_mdl.revealObject(schema);
+
+		QVERIFY(!tree_mdl.isFilterActive());
+		QVERIFY(getChildIndex(tree_mdl, sch_idx, ObjectsTreeModel::GroupNode, ObjectType::Sequence).isValid());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ObjectsTreeModelTest::filterAddedAndModifiedObjects()
+{
+	DatabaseModel dbmodel;
+	ObjectsTreeModel tree_mdl;
+
+	try
+	{
+		loadDemoModel(dbmodel, tree_mdl);
+		tree_mdl.setFilter("zzz_", false);
+		QVERIFY(tree_mdl.getFilterMatches().empty());
+
+		// The added objects are evaluated against the filter as soon as they are inserted in the model
+		Table *table = createTable(dbmodel, "zzz_table", { "id" }),
+				*other_table = createTable(dbmodel, "other_table", { "id" });
+		std::vector<BaseObject *> matches = tree_mdl.getFilterMatches();
+
+		QCOMPARE(matches.size(), static_cast<size_t>(1));
+		QVERIFY(matches.front() == table);
+		QVERIFY(tree_mdl.revealObject(table).isValid());
+
+		// The modified objects are evaluated again in the next synchronization
+		other_table->setName("zzz_other_table");
+		table->setName("renamed_table");
+		tree_mdl.updateModel();
+		matches = tree_mdl.getFilterMatches();
+
+		QCOMPARE(matches.size(), static_cast<size_t>(1));
+		QVERIFY(matches.front() == other_table);
+		QVERIFY(tree_mdl.getIndex(other_table).isValid());
+		QVERIFY(!tree_mdl.getIndex(table).isValid());
+
+		dbmodel.removeTable(other_table);
+		QVERIFY(tree_mdl.getFilterMatches().empty());
+		QVERIFY(!tree_mdl.getIndex(other_table).isValid());
+
+		delete other_table;
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ObjectsTreeModelTest::syncCollapsedItems()
+{
+	DatabaseModel dbmodel;
+	ObjectsTreeModel tree_mdl;
+
+	try
+	{
+		loadDemoModel(dbmodel, tree_mdl);
+
+		Table *table = createTable(dbmodel, "collapsed_table", { "col_a", "col_b" });
+		Column *col = table->getColumn("col_b");
+		QModelIndex col_idx = tree_mdl.revealObject(col);
+		QPersistentModelIndex grp_idx = col_idx.parent();
+
+		QVERIFY(col_idx.isValid());
+		QVERIFY(tree_mdl.getValidObject(col_idx) == col);
+		QCOMPARE(tree_mdl.rowCount(grp_idx), 2);
+
+		/* The items created before (now collapsed in a view) reference the column until the next sync.
+		 * Removing columns doesn't trigger any sync, so the item must be handled without touching the object */
+		table->removeObject(col);
+		delete col;
+
+		QVERIFY(!tree_mdl.getValidObject(col_idx));
+		tree_mdl.hasChildren(col_idx);
+		tree_mdl.data(col_idx, Qt::DisplayRole);
+
+		tree_mdl.updateModel();
+		QCOMPARE(tree_mdl.rowCount(grp_idx), 1);
+		QVERIFY(!tree_mdl.getIndex(col).isValid());
+		QVERIFY(grp_idx.data(Qt::DisplayRole).toString().endsWith("(1)"));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ObjectsTreeModelTest)
+#include "objectstreemodeltest.moc"
@@ -0,0 +1,173 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "databasemodel.h"
+#include "pgmodelerunittest.h"
+
+class PgSqlTypeTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		PgSqlTypeTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private:
+		//! \brief Creates tab_count tables in the public schema of the model, each one registered as an user type
+		void createTables(DatabaseModel &model, int tab_count);
+
+	private slots:
+		void resolveBuiltInTypeNames();
+		void raiseErrorOnInvalidTypeName();
+		void resolveUserTypesByNameAndModel();
+		void dontResolveRemovedUserTypes();
+		void benchmarkTypeResolution_data();
+		void benchmarkTypeResolution();
+};
+
+void PgSqlTypeTest::createTables(DatabaseModel &model, int tab_count)
+{
+	Schema *public_sch = nullptr;
+	Table *table = nullptr;
+
+	model.createSystemObjects(true);
+	public_sch = model.getSchema("public");
+
+	for(int i = 0; i < tab_count; i++)
+	{
+		table = new Table;
+		table->setName(QString("table_%1").arg(i));
+		table->setSchema(public_sch);
+		model.addTable(table);
+	}
+}
+
+void PgSqlTypeTest::resolveBuiltInTypeNames()
+{
+	try
+	{
+		QCOMPARE(ActionType("SET DEFAULT").getTypeId(), ActionType::SetDefault);
+		QCOMPARE(ActionType("NO ACTION").getTypeId(), ActionType::NoAction);
+		QCOMPARE(PgSqlType("timestamp with time zone").getTypeName(false), QString("timestamp"));
+		QCOMPARE(PgSqlType::parseString("varchar(20)[]").getDimension(), 1u);
+		QVERIFY(PgSqlType::getBaseTypeIndex("integer[]") != PgSqlType::Null);
+		QVERIFY(PgSqlType::getBaseTypeIndex("foo") == PgSqlType::Null);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void PgSqlTypeTest::raiseErrorOnInvalidTypeName()
+{
+	try
+	{
+		ActionType act_type("NOACTION");
+		QFAIL("Expected exception not thrown!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::AsgInvalidTypeObject);
+	}
+}
+
+void PgSqlTypeTest::resolveUserTypesByNameAndModel()
+{
+	DatabaseModel model_a, model_b;
+
+	try
+	{
+		createTables(model_a, 5);
+		createTables(model_b, 3);
+
+		QVERIFY(PgSqlType::isRegistered("public.table_4", &model_a));
+		QVERIFY(!PgSqlType::isRegistered("public.table_4", &model_b));
+		QVERIFY(PgSqlType::isRegistered("public.table_2", &model_b));
+
+		// The same type name resolves to different types depending on the model
+		QVERIFY(PgSqlType::getUserTypeIndex("public.table_2", nullptr, &model_a) !=
+						PgSqlType::getUserTypeIndex("public.table_2", nullptr, &model_b));
+
+		QCOMPARE(PgSqlType::getUserTypeIndex("", model_a.getTable("public.table_1"), &model_a),
+						 PgSqlType::getUserTypeIndex("public.table_1", nullptr, &model_a));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void PgSqlTypeTest::dontResolveRemovedUserTypes()
+{
+	DatabaseModel model;
+
+	try
+	{
+		Table *table = nullptr;
+
+		createTables(model, 3);
+		table = model.getTable("public.table_1");
+
+		QVERIFY(PgSqlType::isRegistered("public.table_1", &model));
+		model.removeTable(table);
+		QVERIFY(!PgSqlType::isRegistered("public.table_1", &model));
+		QVERIFY(PgSqlType::isRegistered("public.table_2", &model));
+		delete table;
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void PgSqlTypeTest::benchmarkTypeResolution_data()
+{
+	QTest::addColumn<int>("user_types");
+
+	QTest::newRow("100 user types") << 100;
+	QTest::newRow("10k user types") << 10000;
+}
+
+void PgSqlTypeTest::benchmarkTypeResolution()
+{
+	QFETCH(int, user_types);
+
+	DatabaseModel model;
+	QString last_type = QString("public.table_%1").arg(user_types - 1);
+
+	try
+	{
+		createTables(model, user_types);
+
+		QBENCHMARK {
+			PgSqlType("integer");
+			PgSqlType("timestamp with time zone");
+			PgSqlType::parseString("varchar(255)[]");
+			PgSqlType(last_type);
+			ActionType("SET DEFAULT");
+			StorageType("extended");
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(PgSqlTypeTest)
+#include "pgsqltypetest.moc"
@@ -19,6 +19,7 @@
 #include <QtTest/QtTest>
 #include "schemaparser.h"
 #include "exception.h"
+#include "utilsns.h"
 
 class SchemaParserTest: public QObject {
 	Q_OBJECT
@@ -35,6 +36,13 @@ class SchemaParserTest: public QObject {
 		void testConvertMetaCharsCorrectly();
 		void testConvertEscapedCharsCorrectly();
 		void testConvertEscapedPlainTextCharsInPlaintextExpr();
+		void testReloadCachedFileWhenModified();
+		void testCheckCachedFileOncePerGenerationPass();
+		void testReuseCompiledFileWithDifferentAttributes();
+		void testResolveIncludesAgainstSearchPath();
+		void benchmarkCachedFileParsing();
+		void benchmarkSourceCodeGeneration();
+		void benchmarkCompiledSourceCodeGeneration();
 };
 
 
@@ -283,5 +291,241 @@ void SchemaParserTest::testConvertAttribsToXmlEntitiesInCondExpr()
 	}
 }
 
+void SchemaParserTest::testReloadCachedFileWhenModified()
+{
+	SchemaParser schparser;
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("cached.sch");
+	attribs_map attribs;
+
+	try
+	{
+		attribs["attr"] = "foo";
+		UtilsNs::saveFile(filename, "[first ] {attr}\n");
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "first foo");
+
+		// The second call must use the cached buffer producing the same result
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "first foo");
+
+		/* Changing the file contents and forcing a different modification time
+		 * so the cached buffer is discarded and the file reloaded */
+		UtilsNs::saveFile(filename, "[second ] {attr}\n");
+		QFile file(filename);
+		file.open(QFile::ReadWrite);
+		file.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime);
+		file.close();
+
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "second foo");
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SchemaParserTest::testCheckCachedFileOncePerGenerationPass()
+{
+	SchemaParser schparser;
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("pass.sch");
+	attribs_map attribs;
+
+	try
+	{
+		attribs["attr"] = "foo";
+		UtilsNs::saveFile(filename, "[first ] {attr}\n");
+
+		SchemaParser::startGenerationPass();
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "first foo");
+
+		/* The file was already checked in the current pass so a modification
+		 * made during the pass is only detected in the next one */
+		UtilsNs::saveFile(filename, "[second ] {attr}\n");
+		QFile file(filename);
+		file.open(QFile::ReadWrite);
+		file.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime);
+		file.close();
+
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "first foo");
+		SchemaParser::finishGenerationPass();
+
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "second foo");
+	}
+	catch(Exception &e)
+	{
+		SchemaParser::finishGenerationPass();
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SchemaParserTest::testReuseCompiledFileWithDifferentAttributes()
+{
+	SchemaParser schparser;
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("nested.sch"), buffer;
+	attribs_map attribs;
+
+	buffer = "%if {a} %then\n";
+	buffer += " [a]\n";
+	buffer += " %if {b} %then [b] %else [!b] %end\n";
+	buffer += "%else\n";
+	buffer += " %set {c} [c]\n";
+	buffer += " %if ({d} == \"1\") %then {c} %else [!d] %end\n";
+	buffer += "%end\n";
+	buffer += "$sp {d}";
+
+	try
+	{
+		UtilsNs::saveFile(filename, buffer.toUtf8());
+
+		/* The file is compiled only in the first call, the subsequent ones
+		 * evaluate the same instructions against different attributes */
+		attribs = {{"a", "1"}, {"b", "1"}, {"d", "1"}};
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "ab 1");
+
+		attribs = {{"a", "1"}, {"b", ""}, {"d", "1"}};
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "a!b 1");
+
+		attribs = {{"a", ""}, {"b", ""}, {"d", "1"}};
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "c 1");
+
+		attribs = {{"a", ""}, {"b", ""}, {"d", "2"}};
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "!d 2");
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SchemaParserTest::testResolveIncludesAgainstSearchPath()
+{
+	SchemaParser schparser;
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("main.sch"),
+			curr_dir = QDir::currentPath();
+	attribs_map attribs;
+
+	try
+	{
+		attribs["attr"] = "foo";
+		UtilsNs::saveFile(tmp_dir.filePath("included.sch"), "[included ] {attr}\n");
+		UtilsNs::saveFile(filename, "[main ]\n@include \"included\"\n");
+
+		// The include file must be found in the file's directory without changing the current directory
+		QVERIFY(QDir(curr_dir) != QDir(tmp_dir.path()));
+		QCOMPARE(schparser.getSourceCode(filename, attribs), "main included foo");
+		QCOMPARE(QDir::currentPath(), curr_dir);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SchemaParserTest::benchmarkCachedFileParsing()
+{
+	SchemaParser schparser;
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("bench.sch"), buffer;
+	attribs_map attribs;
+
+	/* Generating a schema file with a reasonable amount of instructions
+	 * in order to simulate the code generation of a huge set of objects */
+	for(int i = 0; i < 50; i++)
+	{
+		attribs[QString("attr%1").arg(i)] = QString("value%1").arg(i);
+		buffer += QString("%if {attr%1} %then [ attr%1 = ] {attr%1} $br %else [ none ] %end\n").arg(i);
+	}
+
+	try
+	{
+		UtilsNs::saveFile(filename, buffer.toUtf8());
+
+		QBENCHMARK
+		{
+			for(int i = 0; i < 1000; i++)
+				schparser.getSourceCode(filename, attribs);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SchemaParserTest::benchmarkSourceCodeGeneration()
+{
+	SchemaParser schparser;
+	QString buffer;
+	attribs_map attribs;
+
+	/* Simulating the code generation of an object with a large set of attributes
+	 * (like tables and columns) in which most of them are referenced by the template.
+	 * This is the reference measure of the attribs_map lookups done by the parser, any
+	 * replacement of the attributes container must be compared against it */
+	for(int i = 0; i < 200; i++)
+	{
+		attribs[QString("attr%1").arg(i)] = (i % 3 == 0 ? "" : QString("value%1").arg(i));
+
+		if(i % 2 == 0)
+			buffer += QString("%if {attr%1} %then [ attr%1 = ] {attr%1} $br %end\n").arg(i);
+	}
+
+	try
+	{
+		QBENCHMARK
+		{
+			for(int i = 0; i < 1000; i++)
+			{
+				schparser.loadBuffer(buffer);
+				schparser.getSourceCode(attribs);
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SchemaParserTest::benchmarkCompiledSourceCodeGeneration()
+{
+	SchemaParser schparser;
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("compiled.sch"), buffer;
+	attribs_map attribs;
+
+	/* Same template of benchmarkSourceCodeGeneration() but loaded from a file, so it's compiled
+	 * only in the first call and the remaining ones just evaluate the compiled instructions.
+	 * The difference between both measures is the cost of parsing the template in each call */
+	for(int i = 0; i < 200; i++)
+	{
+		attribs[QString("attr%1").arg(i)] = (i % 3 == 0 ? "" : QString("value%1").arg(i));
+
+		if(i % 2 == 0)
+			buffer += QString("%if {attr%1} %then [ attr%1 = ] {attr%1} $br %end\n").arg(i);
+	}
+
+	try
+	{
+		UtilsNs::saveFile(filename, buffer.toUtf8());
+		SchemaParser::startGenerationPass();
+
+		QBENCHMARK
+		{
+			for(int i = 0; i < 1000; i++)
+				schparser.getSourceCode(filename, attribs);
+		}
+
+		SchemaParser::finishGenerationPass();
+	}
+	catch(Exception &e)
+	{
+		SchemaParser::finishGenerationPass();
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(SchemaParserTest)
 #include "schemaparsertest.moc"
@@ -0,0 +1,128 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2025 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "sqlscriptparser.h"
+
+class SqlScriptParserTest: public QObject {
+	Q_OBJECT
+
+	private slots:
+		void testSplitCommandsByDdlEndToken();
+		void testRemoveObjectComments();
+		void testLastCommandWithoutDdlEndToken();
+		void testExtractEnabledDropCommands();
+		void testIgnoreDropCommandsWhenDisabled();
+		void testDetectMultipleCommands();
+		void testDetectReadOnlyCommands();
+};
+
+void SqlScriptParserTest::testSplitCommandsByDdlEndToken()
+{
+	SqlScriptParser parser;
+
+	parser.loadBuffer("CREATE SCHEMA public;\n-- ddl-end --\n\nCREATE TABLE public.t1 (\n id integer\n);\n-- ddl-end --\n");
+
+	QCOMPARE(parser.getNextCommand(), QString("CREATE SCHEMA public;\n"));
+	QCOMPARE(parser.getNextCommand(), QString("CREATE TABLE public.t1 (\n id integer\n);\n"));
+	QCOMPARE(parser.getNextCommand(), QString());
+	QVERIFY(!parser.hasNextCommand());
+}
+
+void SqlScriptParserTest::testRemoveObjectComments()
+{
+	SqlScriptParser parser;
+
+	parser.loadBuffer("-- object: public.t1 | type: TABLE --\n"
+										"-- DROP TABLE IF EXISTS public.t1 CASCADE;\n"
+										"CREATE TABLE public.t1 (id integer); -- ALTER TABLE public.t1 OWNER TO postgres;\n"
+										"-- ddl-end --\n"
+										"COMMENT ON TABLE public.t1 IS '-- text';\n"
+										"-- ddl-end --\n");
+
+	QCOMPARE(parser.getNextCommand(), QString("CREATE TABLE public.t1 (id integer); \n"));
+	QCOMPARE(parser.getNextCommand(), QString("COMMENT ON TABLE public.t1 IS '-- text';\n"));
+}
+
+void SqlScriptParserTest::testLastCommandWithoutDdlEndToken()
+{
+	SqlScriptParser parser;
+
+	parser.loadBuffer("SET search_path TO public;\r\n-- ddl-end --\r\nGRANT ALL ON SCHEMA public TO postgres;");
+
+	QCOMPARE(parser.getNextCommand(), QString("SET search_path TO public;\n"));
+	QCOMPARE(parser.getNextCommand(), QString("GRANT ALL ON SCHEMA public TO postgres;\n"));
+	QCOMPARE(parser.getCurrentPosition(), parser.getBufferSize());
+	QVERIFY(!parser.hasNextCommand());
+}
+
+void SqlScriptParserTest::testExtractEnabledDropCommands()
+{
+	SqlScriptParser parser;
+
+	parser.setParseDropCommands(true);
+	parser.loadBuffer("-- DROP TABLE IF EXISTS public.t1 CASCADE;\n"
+										"CREATE TABLE public.t1 (id integer);\n"
+										"-- ddl-end --\n"
+										"-- -- DROP TABLE IF EXISTS public.t2 CASCADE;\n"
+										"-- ALTER TABLE public.t1 DROP COLUMN IF EXISTS c1 CASCADE;\n");
+
+	QCOMPARE(parser.getNextCommand(), QString("DROP TABLE IF EXISTS public.t1 CASCADE;\n"));
+	QCOMPARE(parser.getNextCommand(), QString("CREATE TABLE public.t1 (id integer);\n"));
+	QCOMPARE(parser.getNextCommand(), QString("ALTER TABLE public.t1 DROP COLUMN IF EXISTS c1 CASCADE;\n"));
+	QCOMPARE(parser.getNextCommand(), QString());
+}
+
+void SqlScriptParserTest::testIgnoreDropCommandsWhenDisabled()
+{
+	SqlScriptParser parser;
+
+	parser.loadBuffer("-- DROP TABLE IF EXISTS public.t1 CASCADE;\n"
+										"CREATE TABLE public.t1 (id integer);\n"
+										"-- ddl-end --\n");
+
+	QCOMPARE(parser.getNextCommand(), QString("CREATE TABLE public.t1 (id integer);\n"));
+	QCOMPARE(parser.getNextCommand(), QString());
+}
+
+void SqlScriptParserTest::testDetectMultipleCommands()
+{
+	QVERIFY(!SqlScriptParser::hasMultipleCommands("SELECT 1"));
+	QVERIFY(!SqlScriptParser::hasMultipleCommands("SELECT 1; -- comment\n"));
+	QVERIFY(!SqlScriptParser::hasMultipleCommands("SELECT 'a;''b', \"c;\" FROM t;"));
+	QVERIFY(!SqlScriptParser::hasMultipleCommands("SELECT E'a\\';' FROM t"));
+	QVERIFY(!SqlScriptParser::hasMultipleCommands("/* ; /* ; */ */ SELECT $1;"));
+	QVERIFY(!SqlScriptParser::hasMultipleCommands("DO $body$ BEGIN PERFORM 1; END $body$;"));
+	QVERIFY(SqlScriptParser::hasMultipleCommands("BEGIN; INSERT INTO t VALUES (1)"));
+	QVERIFY(SqlScriptParser::hasMultipleCommands("DO $$ BEGIN PERFORM 1; END $$; SELECT 1;"));
+}
+
+void SqlScriptParserTest::testDetectReadOnlyCommands()
+{
+	QVERIFY(SqlScriptParser::isReadOnlyCommand("-- comment\n select * from t"));
+	QVERIFY(SqlScriptParser::isReadOnlyCommand("WITH q AS (SELECT 1) SELECT * FROM q"));
+	QVERIFY(SqlScriptParser::isReadOnlyCommand("SELECT 'insert', \"update\" FROM t /* delete */"));
+	QVERIFY(SqlScriptParser::isReadOnlyCommand("SELECT $$ INSERT INTO t $$, updated_at FROM t"));
+	QVERIFY(!SqlScriptParser::isReadOnlyCommand("UPDATE t SET a = 1 RETURNING *"));
+	QVERIFY(!SqlScriptParser::isReadOnlyCommand("WITH d AS (DELETE FROM t RETURNING *) SELECT * FROM d"));
+	QVERIFY(!SqlScriptParser::isReadOnlyCommand("SELECT * INTO t2 FROM t"));
+	QVERIFY(!SqlScriptParser::isReadOnlyCommand("/* SELECT */"));
+}
+
+QTEST_MAIN(SqlScriptParserTest)
+#include "sqlscriptparsertest.moc"
@@ -19,14 +19,38 @@
 #include <QtTest/QtTest>
 #include "utilsns.h"
 #include "exception.h"
+#include "xmlparser.h"
+#include "globalattributes.h"
+#include "pgmodelerunittest.h"
+#include <functional>
 
-class XmlParserTest: public QObject {
+class XmlParserTest: public QObject, public PgModelerUnitTest {
 	Q_OBJECT
 
+	public:
+		XmlParserTest() : PgModelerUnitTest(SCHEMASDIR) {}
+
+	private:
+		//! \brief Returns the path to the root DTD of the model files
+		QString getRootDTDPath();
+
 	private slots:
 		void correctlyConvertJsonValsToXmlEntites();
+		void validatesBuffersAgainstCachedDTD();
+		void raisesErrorOnInvalidBuffers();
+		void assignsDTDDefaultAttributes();
+		void raisesErrorOnMissingDTD();
+		void returnsPreparsedAttributesOfSubtrees();
 };
 
+QString XmlParserTest::getRootDTDPath()
+{
+	return GlobalAttributes::getSchemasRootPath() + GlobalAttributes::DirSeparator +
+				 GlobalAttributes::XMLSchemaDir + GlobalAttributes::DirSeparator +
+				 GlobalAttributes::ObjectDTDDir + GlobalAttributes::DirSeparator +
+				 GlobalAttributes::RootDTD + GlobalAttributes::ObjectDTDExt;
+}
+
 void XmlParserTest::correctlyConvertJsonValsToXmlEntites()
 {
 	QString value = "value=\"'{\"attr\": { \"\" }}'::json\"		value-abc=\"true\"     value-cde=\"'{\"sign_aspect\": { \"message_no\": 0, \"message_multi\": \"\" }}'::json\"\n",
@@ -44,5 +68,167 @@ void XmlParserTest::correctlyConvertJsonValsToXmlEntites()
 	}
 }
 
+void XmlParserTest::validatesBuffersAgainstCachedDTD()
+{
+	XmlParser xmlparser;
+	attribs_map attribs;
+
+	try
+	{
+		/* The same DTD is used several times in a row, from the second
+		 * buffer on the validation is made against the cached DTD */
+		for(unsigned i = 0; i < 3; i++)
+		{
+			xmlparser.restartParser();
+			xmlparser.setDTDFile(getRootDTDPath(), "role");
+			xmlparser.loadXMLBuffer(QString("<role name=\"role_%1\" login=\"true\"/>").arg(i));
+			xmlparser.getElementAttributes(attribs);
+
+			QCOMPARE(xmlparser.getElementName(), "role");
+			QCOMPARE(attribs["name"], QString("role_%1").arg(i));
+		}
+
+		// Buffers loaded without DTD are not validated at all
+		xmlparser.restartParser();
+		xmlparser.loadXMLBuffer("<unknown attr=\"value\"/>");
+		QCOMPARE(xmlparser.getElementName(), "unknown");
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void XmlParserTest::raisesErrorOnInvalidBuffers()
+{
+	XmlParser xmlparser;
+	std::vector<std::pair<QString, QString>> invalid_bufs = {
+		//Undeclared element
+		{ "role", "<role name=\"role\"><unknown/></role>" },
+
+		//Root element not matching the DTD name
+		{ "schema", "<role name=\"role\"/>" },
+
+		//Malformed document
+		{ "role", "<role name=\"role\">" }
+	};
+
+	for(auto &[dtd_name, buffer] : invalid_bufs)
+	{
+		try
+		{
+			xmlparser.restartParser();
+			xmlparser.setDTDFile(getRootDTDPath(), dtd_name);
+			xmlparser.loadXMLBuffer(buffer);
+			QFAIL(QString("No error raised for the buffer: %1").arg(buffer).toStdString().c_str());
+		}
+		catch(Exception &e)
+		{
+			QVERIFY(e.getErrorCode() == ErrorCode::LibXMLError);
+		}
+	}
+}
+
+void XmlParserTest::assignsDTDDefaultAttributes()
+{
+	XmlParser xmlparser;
+	attribs_map attribs;
+
+	try
+	{
+		xmlparser.setDTDFile(getRootDTDPath(), "role");
+		xmlparser.loadXMLBuffer("<role name=\"role\" login=\"true\"><roles names=\"other\"/></role>");
+		xmlparser.getElementAttributes(attribs);
+
+		// The absent attributes with default values in the DTD must be filled in
+		QCOMPARE(attribs["login"], "true");
+		QCOMPARE(attribs["superuser"], "false");
+		QVERIFY(attribs.count("password") == 0);
+
+		xmlparser.accessElement(XmlParser::ChildElement);
+		xmlparser.getElementAttributes(attribs);
+		QCOMPARE(attribs["role-type"], "member");
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void XmlParserTest::raisesErrorOnMissingDTD()
+{
+	XmlParser xmlparser;
+
+	try
+	{
+		xmlparser.setDTDFile(QDir::temp().absoluteFilePath("pgmodeler_missing.dtd"), "role");
+		xmlparser.loadXMLBuffer("<role name=\"role\"/>");
+		QFAIL("No error raised for a missing DTD file!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::LibXMLError);
+	}
+}
+
+void XmlParserTest::returnsPreparsedAttributesOfSubtrees()
+{
+	XmlParser xmlparser;
+	XmlParser::ElementsAttributes elems_attribs;
+	std::vector<attribs_map> tree_attribs, parsed_attribs;
+	attribs_map attribs;
+
+	// Reads the attributes of the root element and all its descendants in document order
+	auto read_attributes = [&xmlparser, &attribs](std::vector<attribs_map> &attribs_list) {
+		std::function<void()> read_subtree = [&](){
+			do
+			{
+				xmlparser.getElementAttributes(attribs);
+				attribs_list.push_back(attribs);
+
+				xmlparser.savePosition();
+
+				if(xmlparser.accessElement(XmlParser::ChildElement))
+					read_subtree();
+
+				xmlparser.restorePosition();
+			}
+			while(xmlparser.accessElement(XmlParser::NextElement));
+		};
+
+		xmlparser.restartNavigation();
+		read_subtree();
+	};
+
+	try
+	{
+		xmlparser.loadXMLBuffer("<table name=\"tab\" layers=\"0\">"
+														"<schema name=\"public\"/>"
+														"<column name=\"id\" not-null=\"true\"><type name=\"integer\" length=\"0\"/></column>"
+														"<column name=\"name\"><type name=\"text\" length=\"0\"/></column>"
+														"</table>");
+
+		read_attributes(tree_attribs);
+
+		xmlparser.restartNavigation();
+		XmlParser::parseSubtreeAttributes(xmlparser.getCurrentElement(), elems_attribs);
+		QCOMPARE(elems_attribs.size(), tree_attribs.size());
+
+		/* The pre-parsed attributes must be the same read from the element tree and
+		 * querying the same elements again must read them from the element tree */
+		xmlparser.setParsedAttributes(std::move(elems_attribs));
+		read_attributes(parsed_attribs);
+		QVERIFY(parsed_attribs == tree_attribs);
+
+		parsed_attribs.clear();
+		read_attributes(parsed_attribs);
+		QVERIFY(parsed_attribs == tree_attribs);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(XmlParserTest)
 #include "xmlparsertest.moc"
@@ -5,7 +5,9 @@ src/baseobjecttest \
 src/roletest \
 src/syntaxhighlightertest \
 src/databasemodeltest \
+src/modeljournaltest \
 src/schemaparsertest \
+src/exceptiontest \
 src/linenumberstest \
 src/partrelationshiptest \
 src/foreigndatawrappertest \
@@ -18,3 +20,9 @@ src/xmlparsertest \
 src/proceduretest \
 src/basefunctiontest \
 src/csvparsertest \
+src/modelsdiffhelpertest \
+src/sqlscriptparsertest \
+src/pgsqltypetest \
+src/databaseimporthelpertest \
+src/objectsscenetest \
+src/objectstreemodeltest \